@@ -23,7 +23,8 @@ int main()
     // Basic startup notice (no external logging dependency)
     // printf("GameBuilder2d starting up\n");
 
-    gb2d::logging::LogManager::init({"GameBuilder2d", gb2d::logging::Level::info, "[%H:%M:%S] [%^%l%$] %v"});
+    gb2d::logging::Config logConfig{"GameBuilder2d", gb2d::logging::Level::info, "[%H:%M:%S] [%^%l%$] %v"};
+    gb2d::logging::LogManager::init(logConfig);
     gb2d::logging::LogManager::info("Starting GameBuilder2d");
     bool configLoaded = gb2d::ConfigurationManager::load();
 
@@ -32,6 +33,27 @@ int main()
         gb2d::logging::LogManager::warn("Configuration file missing or invalid; using defaults");
     }
 
+    if (gb2d::ConfigurationManager::getBool("logging.async", false)) {
+        const std::string overflow = gb2d::ConfigurationManager::getString("logging.async_overflow", "block");
+        logConfig.async.enabled = true;
+        logConfig.async.queue_capacity = static_cast<size_t>(std::max<int64_t>(gb2d::ConfigurationManager::getInt("logging.async_queue_size", 8192), 64));
+        logConfig.async.overflow = overflow == "drop_oldest" ? gb2d::logging::OverflowPolicy::drop_oldest
+            : overflow == "drop_newest" ? gb2d::logging::OverflowPolicy::drop_newest
+            : gb2d::logging::OverflowPolicy::block;
+        gb2d::logging::LogManager::reconfigure(logConfig);
+    }
+
+    const std::string binaryDir = gb2d::ConfigurationManager::getString("logging.binary_dir", "");
+    if (!binaryDir.empty()) {
+        logConfig.binary.enabled = true;
+        logConfig.binary.directory = binaryDir;
+        logConfig.binary.segment_bytes = static_cast<size_t>(std::clamp<int64_t>(gb2d::ConfigurationManager::getInt("logging.binary_segment_mb", 8), 1, 1024)) << 20;
+        logConfig.binary.max_segments = static_cast<size_t>(std::max<int64_t>(gb2d::ConfigurationManager::getInt("logging.binary_max_segments", 8), 1));
+        logConfig.binary.text_sinks = !gb2d::ConfigurationManager::getBool("logging.binary_only", false);
+        gb2d::logging::LogManager::reconfigure(logConfig);
+        gb2d::logging::LogManager::info("Binary log: writing segments to '{}'", binaryDir);
+    }
+
     constexpr int kDefaultWidth = 1280;
     constexpr int kDefaultHeight = 720;
     constexpr int kDefaultFullscreenWidth = 1920;
@@ -81,6 +103,7 @@ int main()
     rlImGuiSetup(true);
 
     gb2d::textures::TextureManager::init();
+    gb2d::textures::TextureManager::preloadGroup("startup");
     if (!gb2d::audio::AudioManager::init()) {
         gb2d::logging::LogManager::warn("AudioManager failed to initialize");
     }
@@ -100,6 +123,7 @@ int main()
     {
         float dt = GetFrameTime();
         gb2d::audio::AudioManager::tick(dt);
+        gb2d::textures::TextureManager::tick();
 
         BeginDrawing();
 
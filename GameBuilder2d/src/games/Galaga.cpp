@@ -1,4 +1,5 @@
 #include "games/Galaga.h"
+#include "games/GameAudio.h"
 #include "services/audio/AudioManager.h"
 #include "services/logger/LogManager.h"
 #include <algorithm>
@@ -230,7 +231,7 @@ void Galaga::updatePlayer(float dt, bool acceptInput) {
             shot.vel = { 0.0f, -480.0f };
             player_bullets_.push_back(shot);
             player_.cooldown = 0.18f;
-            playSound(sfx_player_shot_, 0.8f, panForX(player_.pos.x));
+            playSoundAt(sfx_player_shot_, player_.pos, 0.8f);
         }
     }
 }
@@ -399,7 +400,7 @@ void Galaga::handleCollisions() {
                     shot.alive = false;
                     enemy.alive = false;
                     score_ += 150 + enemy.row * 60;
-                    playSound(sfx_enemy_down_, 0.85f, panForX(enemy.pos.x));
+                    playSoundAt(sfx_enemy_down_, enemy.pos, 0.85f);
                     break;
                 }
             }
@@ -441,7 +442,7 @@ void Galaga::handlePlayerHit() {
     player_.lives -= 1;
     player_bullets_.clear();
     player_.pos = { width_ * 0.5f, height_ - 60.0f };
-    playSound(sfx_player_hit_, 1.0f, panForX(player_.pos.x));
+    playSoundAt(sfx_player_hit_, player_.pos, 1.0f);
     if (player_.lives <= 0) {
         player_.alive = false;
         game_over_ = true;
@@ -579,22 +580,27 @@ void Galaga::releaseAudioAssets() {
     }
 }
 
-void Galaga::playSound(const SoundAsset& asset, float volume, float pan) {
+void Galaga::playSound(const SoundAsset& asset, float volume) {
     if (asset.key.empty() || asset.placeholder) {
         return;
     }
     gb2d::audio::PlaybackParams params;
     params.volume = volume;
-    params.pan = std::clamp(pan, 0.0f, 1.0f);
     gb2d::audio::AudioManager::playSound(asset.key, params);
 }
 
-float Galaga::panForX(float worldX) const {
-    if (width_ <= 0) {
-        return 0.5f;
+void Galaga::playSoundAt(const SoundAsset& asset, Vector2 position, float volume) {
+    if (!asset.placeholder) {
+        playPannedSound(asset.key, position, volume, audioListener());
     }
-    float normalized = worldX / static_cast<float>(width_);
-    return std::clamp(normalized, 0.0f, 1.0f);
+}
+
+gb2d::audio::AudioListener Galaga::audioListener() const {
+    // The listener sits over the playfield center and pans its edges fully left and right.
+    gb2d::audio::AudioListener listener;
+    listener.position = {static_cast<float>(width_) * 0.5f, 0.0f};
+    listener.panWidth = static_cast<float>(width_) * 0.5f;
+    return listener;
 }
 
 } // namespace gb2d::games
@@ -1,5 +1,6 @@
 #pragma once
 #include "games/Game.h"
+#include "services/audio/SpatialAudio.h"
 #include <array>
 #include <string>
 #include <vector>
@@ -30,8 +31,9 @@ private:
 
     void loadAudioAssets();
     void releaseAudioAssets();
-    void playSound(const SoundAsset& asset, float volume = 1.0f, float pan = 0.5f);
-    float panForX(float worldX) const;
+    void playSound(const SoundAsset& asset, float volume = 1.0f);
+    void playSoundAt(const SoundAsset& asset, Vector2 position, float volume = 1.0f);
+    gb2d::audio::AudioListener audioListener() const;
 
     struct Shot {
         Vector2 pos{};
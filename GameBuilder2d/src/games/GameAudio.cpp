@@ -0,0 +1,18 @@
+#include "games/GameAudio.h"
+#include "services/audio/AudioManager.h"
+
+namespace gb2d::games {
+
+void playPannedSound(const std::string& key, Vector2 position, float volume, const gb2d::audio::AudioListener& listener) {
+    if (key.empty()) {
+        return;
+    }
+    static const gb2d::audio::SpatialSettings kPanOnly{gb2d::audio::AttenuationCurve::None};
+    gb2d::audio::AudioManager::setListener(listener);
+    gb2d::audio::PlaybackParams params;
+    params.volume = volume;
+    params.spatial = kPanOnly;
+    gb2d::audio::AudioManager::playSoundAt(key, position, params);
+}
+
+} // namespace gb2d::games
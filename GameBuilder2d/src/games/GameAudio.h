@@ -0,0 +1,13 @@
+#pragma once
+#include "services/audio/SpatialAudio.h"
+#include <raylib.h>
+#include <string>
+
+namespace gb2d::games {
+
+// Plays `key` panned by where `position` sits relative to `listener`, which each game places over
+// its visible playfield. Nothing fades with distance, since everything on screen should be heard.
+// Empty keys are ignored.
+void playPannedSound(const std::string& key, Vector2 position, float volume, const gb2d::audio::AudioListener& listener);
+
+} // namespace gb2d::games
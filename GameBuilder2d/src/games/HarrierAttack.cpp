@@ -1,4 +1,5 @@
 #include "games/HarrierAttack.h"
+#include "games/GameAudio.h"
 #include "services/audio/AudioManager.h"
 #include "services/logger/LogManager.h"
 #include <algorithm>
@@ -154,11 +155,11 @@ void HarrierAttack::update(float dt, int width, int height, bool acceptInput) {
     player_.invuln = std::max(0.0f, player_.invuln - dt);
 
     if (player_.missionComplete && !mission_success_cue_played_) {
-        playSound(sfx_mission_success_, 1.0f, panForWorldX(player_.pos.x));
+        playSoundAt(sfx_mission_success_, player_.pos, 1.0f);
         mission_success_cue_played_ = true;
     }
     if (missionFailed_ && !mission_fail_cue_played_) {
-        playSound(sfx_mission_fail_, 1.0f, panForWorldX(player_.pos.x));
+        playSoundAt(sfx_mission_fail_, player_.pos, 1.0f);
         mission_fail_cue_played_ = true;
     }
 }
@@ -183,7 +184,7 @@ void HarrierAttack::updatePlayer(float dt, bool acceptInput) {
             bombs_.push_back(bomb);
             player_.bombs -= 1;
             player_.bombCooldown = 0.35f;
-            playSound(sfx_bomb_drop_, 0.8f, panForWorldX(player_.pos.x));
+            playSoundAt(sfx_bomb_drop_, player_.pos, 0.8f);
         }
         if ((IsKeyDown(KEY_X) || IsKeyDown(KEY_RIGHT_CONTROL)) && player_.rocketCooldown <= 0.0f && player_.rockets > 0) {
             Rocket rocket;
@@ -192,7 +193,7 @@ void HarrierAttack::updatePlayer(float dt, bool acceptInput) {
             rockets_.push_back(rocket);
             player_.rockets -= 1;
             player_.rocketCooldown = 0.65f;
-            playSound(sfx_rocket_fire_, 0.9f, panForWorldX(player_.pos.x));
+            playSoundAt(sfx_rocket_fire_, player_.pos, 0.9f);
         }
     }
 
@@ -336,8 +337,8 @@ void HarrierAttack::handleCollisions() {
                 target.alive = false;
                 score_ += 500;
                 setStatusMessage("Target destroyed", 1.6f);
-                float targetCenterX = target.rect.x + target.rect.width * 0.5f;
-                playSound(sfx_explosion_, 1.0f, panForWorldX(targetCenterX));
+                Vector2 targetCenter{target.rect.x + target.rect.width * 0.5f, target.rect.y + target.rect.height * 0.5f};
+                playSoundAt(sfx_explosion_, targetCenter, 1.0f);
                 break;
             }
         }
@@ -352,7 +353,7 @@ void HarrierAttack::handleCollisions() {
                 jet.alive = false;
                 score_ += 200;
                 setStatusMessage("Enemy jet down", 1.6f);
-                playSound(sfx_explosion_, 1.0f, panForWorldX(jet.pos.x));
+                playSoundAt(sfx_explosion_, jet.pos, 1.0f);
                 break;
             }
         }
@@ -365,7 +366,7 @@ void HarrierAttack::handleCollisions() {
                 player_.alive = false;
                 missionFailed_ = true;
                 setStatusMessage("Hit by enemy fire", 2.5f);
-                playSound(sfx_player_hit_, 1.0f, panForWorldX(player_.pos.x));
+                playSoundAt(sfx_player_hit_, player_.pos, 1.0f);
                 break;
             }
         }
@@ -378,7 +379,7 @@ void HarrierAttack::handleCollisions() {
                 player_.alive = false;
                 missionFailed_ = true;
                 setStatusMessage("Collision with enemy jet", 2.5f);
-                playSound(sfx_player_hit_, 1.0f, panForWorldX(player_.pos.x));
+                playSoundAt(sfx_player_hit_, player_.pos, 1.0f);
                 break;
             }
         }
@@ -389,7 +390,7 @@ void HarrierAttack::handleCollisions() {
             player_.alive = false;
             missionFailed_ = true;
             setStatusMessage("Aircraft lost", 2.5f);
-            playSound(sfx_player_hit_, 1.0f, panForWorldX(player_.pos.x));
+            playSoundAt(sfx_player_hit_, player_.pos, 1.0f);
         }
     }
 }
@@ -528,15 +529,17 @@ void HarrierAttack::loadAudioAssets() {
         const char* identifier;
         const char* alias;
         SoundAsset* slot;
+        gb2d::audio::SoundVoiceSettings voice;
     };
 
+    // Weapon sounds are capped so a barrage cannot crowd out hits and mission stingers.
     const std::array<AssetConfig, 6> assets{ {
-        {"harrier/bomb_drop.wav", "game/harrier/bomb-drop", &sfx_bomb_drop_},
-        {"harrier/rocket_fire.wav", "game/harrier/rocket-fire", &sfx_rocket_fire_},
-        {"harrier/explosion.wav", "game/harrier/explosion", &sfx_explosion_},
-        {"harrier/player_hit.wav", "game/harrier/player-hit", &sfx_player_hit_},
-        {"harrier/mission_success.wav", "game/harrier/mission-success", &sfx_mission_success_},
-        {"harrier/mission_fail.wav", "game/harrier/mission-fail", &sfx_mission_fail_}
+        {"harrier/bomb_drop.wav", "game/harrier/bomb-drop", &sfx_bomb_drop_, {0, 3}},
+        {"harrier/rocket_fire.wav", "game/harrier/rocket-fire", &sfx_rocket_fire_, {0, 3}},
+        {"harrier/explosion.wav", "game/harrier/explosion", &sfx_explosion_, {5, 4}},
+        {"harrier/player_hit.wav", "game/harrier/player-hit", &sfx_player_hit_, {10, 2}},
+        {"harrier/mission_success.wav", "game/harrier/mission-success", &sfx_mission_success_, {20, 1}},
+        {"harrier/mission_fail.wav", "game/harrier/mission-fail", &sfx_mission_fail_, {20, 1}}
     } };
 
     for (const auto& asset : assets) {
@@ -551,6 +554,7 @@ void HarrierAttack::loadAudioAssets() {
         } else if (result.placeholder) {
             LogManager::debug("HarrierAttack audio '{}' using placeholder", asset.identifier);
         } else {
+            AudioManager::setSoundVoiceSettings(result.key, asset.voice);
             LogManager::debug("HarrierAttack audio '{}' ready (key='{}')", asset.identifier, result.key);
         }
     }
@@ -581,24 +585,27 @@ void HarrierAttack::releaseAudioAssets() {
     }
 }
 
-void HarrierAttack::playSound(const SoundAsset& asset, float volume, float pan) {
+void HarrierAttack::playSound(const SoundAsset& asset, float volume) {
     if (asset.key.empty() || asset.placeholder) {
         return;
     }
     gb2d::audio::PlaybackParams params;
     params.volume = volume;
-    params.pan = std::clamp(pan, 0.0f, 1.0f);
     gb2d::audio::AudioManager::playSound(asset.key, params);
 }
 
-float HarrierAttack::panForWorldX(float worldX) const {
-    if (width_ <= 0) {
-        return 0.5f;
+void HarrierAttack::playSoundAt(const SoundAsset& asset, Vector2 position, float volume) {
+    if (!asset.placeholder) {
+        playPannedSound(asset.key, position, volume, audioListener());
     }
-    float cam = cameraX();
-    float screenX = worldX - cam;
-    float normalized = screenX / static_cast<float>(width_);
-    return std::clamp(normalized, 0.0f, 1.0f);
+}
+
+gb2d::audio::AudioListener HarrierAttack::audioListener() const {
+    // The listener follows the camera, so the screen edges pan fully left and right.
+    gb2d::audio::AudioListener listener;
+    listener.position = {cameraX() + static_cast<float>(width_) * 0.5f, 0.0f};
+    listener.panWidth = static_cast<float>(width_) * 0.5f;
+    return listener;
 }
 
 } // namespace gb2d::games
@@ -1,4 +1,5 @@
 #include "games/PacMan.h"
+#include "games/GameAudio.h"
 #include "services/audio/AudioManager.h"
 #include "services/logger/LogManager.h"
 #include <algorithm>
@@ -220,11 +221,11 @@ void PacMan::update(float dt, int width, int height, bool acceptInput) {
     powerTimer_ = std::max(0.0f, powerTimer_ - dt);
 
     if (victory_ && !victory_cue_played_) {
-        playSound(sfx_victory_, 1.0f, panForWorldX(pacmanPos_.x));
+        playSoundAt(sfx_victory_, pacmanPos_, 1.0f);
         victory_cue_played_ = true;
     }
     if (gameOver_ && !game_over_cue_played_) {
-        playSound(sfx_game_over_, 1.0f, panForWorldX(pacmanPos_.x));
+        playSoundAt(sfx_game_over_, pacmanPos_, 1.0f);
         game_over_cue_played_ = true;
     }
 }
@@ -387,14 +388,14 @@ void PacMan::handlePellets() {
         tile = ' ';
         score_ += 10;
         pelletsRemaining_ = std::max(0, pelletsRemaining_ - 1);
-        playSound(sfx_pellet_, 0.6f, panForWorldX(pacmanPos_.x));
+        playSoundAt(sfx_pellet_, pacmanPos_, 0.6f);
     } else if (tile == 'o') {
         tile = ' ';
         score_ += 50;
         pelletsRemaining_ = std::max(0, pelletsRemaining_ - 1);
         powerTimer_ = 6.0f;
         enterFrightenedMode();
-        playSound(sfx_power_pellet_, 0.9f, panForWorldX(pacmanPos_.x));
+        playSoundAt(sfx_power_pellet_, pacmanPos_, 0.9f);
     }
 }
 
@@ -418,7 +419,7 @@ void PacMan::handleCollisions() {
                 ghost.eyesOnly = true;
                 ghost.frightenedTimer = 0.0f;
                 score_ += 200;
-                playSound(sfx_ghost_eaten_, 0.9f, panForWorldX(ghost.pos.x));
+                playSoundAt(sfx_ghost_eaten_, ghost.pos, 0.9f);
             } else if (ghost.mode != GhostMode::Returning) {
                 pacmanAlive_ = false;
                 pacmanDir_ = {0.0f, 0.0f};
@@ -431,7 +432,7 @@ void PacMan::handleCollisions() {
                 if (lives_ <= 0) {
                     gameOver_ = true;
                 }
-                playSound(sfx_pacman_death_, 1.0f, panForWorldX(pacmanPos_.x));
+                playSoundAt(sfx_pacman_death_, pacmanPos_, 1.0f);
                 break;
             }
         }
@@ -586,24 +587,28 @@ void PacMan::releaseAudioAssets() {
     }
 }
 
-void PacMan::playSound(const SoundAsset& asset, float volume, float pan) {
+void PacMan::playSound(const SoundAsset& asset, float volume) {
     if (asset.key.empty() || asset.placeholder) {
         return;
     }
     gb2d::audio::PlaybackParams params;
     params.volume = volume;
-    params.pan = std::clamp(pan, 0.0f, 1.0f);
     gb2d::audio::AudioManager::playSound(asset.key, params);
 }
 
-float PacMan::panForWorldX(float worldX) const {
-    int cols = std::max(1, gridWidth());
-    float span = static_cast<float>(tileSize_ * cols);
-    if (span <= 0.0f) {
-        return 0.5f;
+void PacMan::playSoundAt(const SoundAsset& asset, Vector2 position, float volume) {
+    if (!asset.placeholder) {
+        playPannedSound(asset.key, position, volume, audioListener());
     }
-    float normalized = (worldX - offset_.x) / span;
-    return std::clamp(normalized, 0.0f, 1.0f);
+}
+
+gb2d::audio::AudioListener PacMan::audioListener() const {
+    // The listener sits over the maze center and pans the maze edges fully left and right.
+    const float span = static_cast<float>(tileSize_ * std::max(1, gridWidth()));
+    gb2d::audio::AudioListener listener;
+    listener.position = {offset_.x + span * 0.5f, offset_.y};
+    listener.panWidth = span * 0.5f;
+    return listener;
 }
 
 int PacMan::gridWidth() const {
@@ -1,5 +1,6 @@
 #pragma once
 #include "games/Game.h"
+#include "services/audio/SpatialAudio.h"
 #include <raylib.h>
 #include <vector>
 #include <string>
@@ -29,8 +30,9 @@ private:
 
     void loadAudioAssets();
     void releaseAudioAssets();
-    void playSound(const SoundAsset& asset, float volume = 1.0f, float pan = 0.5f);
-    float panForWorldX(float worldX) const;
+    void playSound(const SoundAsset& asset, float volume = 1.0f);
+    void playSoundAt(const SoundAsset& asset, Vector2 position, float volume = 1.0f);
+    gb2d::audio::AudioListener audioListener() const;
 
     enum class GhostMode { Scatter, Chase, Frightened, Returning };
 
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "AudioManager.h"
+
+namespace gb2d::audio {
+
+// Bounded lock-free ring after Vyukov's array queue. Every cell carries a sequence number saying
+// whose turn it is, so a producer claims a position with one CAS and never waits for other
+// producers or for the consumer. Items come out in the order their positions were claimed, which
+// includes each producer's own posting order. Safe for any number of producers and consumers; the
+// AudioManager drains it from tick() only. Capacity is rounded up to a power of two.
+template <typename T>
+class CommandRing {
+public:
+    explicit CommandRing(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    CommandRing(const CommandRing&) = delete;
+    CommandRing& operator=(const CommandRing&) = delete;
+
+    // Returns false, leaving `value` untouched, when the ring is full.
+    bool tryPush(T&& value) {
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Empty when nothing is queued, or when the oldest claimed cell is still being written.
+    std::optional<T> tryPop() {
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        std::optional<T> value(std::move(cell->value));
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Racy by nature; for metrics only.
+    std::size_t sizeApprox() const {
+        const std::size_t enqueued = enqueuePos_.load(std::memory_order_relaxed);
+        const std::size_t dequeued = dequeuePos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_{0};
+    alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(64) std::atomic<std::size_t> dequeuePos_{0};
+};
+
+enum class AudioCommandType {
+    PlaySound,
+    PlaySoundAt,
+    StopSound,
+    UpdateSoundPlayback,
+    StopAllSounds,
+    SetMusicVolume,
+    SetSoundPosition
+};
+
+// One deferred AudioManager call; which fields matter depends on `type`.
+struct AudioCommand {
+    AudioCommandType type{AudioCommandType::PlaySound};
+    std::string key{};
+    PlaybackParams params{};
+    PlaybackHandle handle{};
+    float volume{1.0f};
+    Vector2 position{0.0f, 0.0f};
+};
+
+using AudioCommandQueue = CommandRing<AudioCommand>;
+
+} // namespace gb2d::audio
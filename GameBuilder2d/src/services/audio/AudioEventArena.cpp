@@ -0,0 +1,107 @@
+#include "AudioEventArena.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace gb2d::audio {
+
+bool AudioEventArena::publish(AudioEventType type, std::string_view key, std::string_view details,
+                              std::uint64_t timestampMs, bool coalesce) {
+    std::size_t keyHash = 0;
+    if (coalesce) {
+        keyHash = std::hash<std::string_view>{}(key);
+        if (const KeySlot* slot = findKeySlot(keyHash); slot && slot->generation == generation_) {
+            Record& latest = records_[slot->record];
+            if (latest.type == type && text(latest.keyOffset, latest.keyLength) == key &&
+                text(latest.detailsOffset, latest.detailsLength) == details) {
+                ++latest.count;
+                return false;
+            }
+        }
+    }
+
+    Record record{};
+    record.type = type;
+    record.keyOffset = static_cast<std::uint32_t>(text_.size());
+    record.keyLength = static_cast<std::uint32_t>(key.size());
+    text_.append(key);
+    record.detailsOffset = static_cast<std::uint32_t>(text_.size());
+    record.detailsLength = static_cast<std::uint32_t>(details.size());
+    text_.append(details);
+    record.count = 1;
+    record.timestampMs = timestampMs;
+    records_.push_back(record);
+    if (coalesce) {
+        rememberLatest(keyHash, static_cast<std::uint32_t>(records_.size() - 1));
+    }
+    return true;
+}
+
+std::span<const AudioEvent> AudioEventArena::materialize(std::vector<AudioEvent>& scratch) const {
+    if (scratch.size() < records_.size()) {
+        scratch.resize(records_.size());
+    }
+    for (std::size_t i = 0; i < records_.size(); ++i) {
+        const Record& record = records_[i];
+        AudioEvent& event = scratch[i];
+        event.type = record.type;
+        event.key.assign(text(record.keyOffset, record.keyLength));
+        event.timestampMs = record.timestampMs;
+        event.details.assign(text(record.detailsOffset, record.detailsLength));
+        event.count = record.count;
+    }
+    return std::span<const AudioEvent>(scratch.data(), records_.size());
+}
+
+void AudioEventArena::clear() {
+    records_.clear();
+    text_.clear();
+    keysUsed_ = 0;
+    if (++generation_ == 0) {
+        for (KeySlot& slot : latestByKey_) {
+            slot.generation = 0;
+        }
+        generation_ = 1;
+    }
+}
+
+void AudioEventArena::swap(AudioEventArena& other) noexcept {
+    records_.swap(other.records_);
+    text_.swap(other.text_);
+    latestByKey_.swap(other.latestByKey_);
+    std::swap(keysUsed_, other.keysUsed_);
+    std::swap(generation_, other.generation_);
+}
+
+AudioEventArena::KeySlot* AudioEventArena::findKeySlot(std::size_t hash) {
+    if (latestByKey_.empty()) {
+        return nullptr;
+    }
+    const std::size_t mask = latestByKey_.size() - 1;
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        KeySlot& slot = latestByKey_[i];
+        if (slot.generation != generation_ || slot.hash == hash) {
+            return &slot;
+        }
+    }
+}
+
+void AudioEventArena::rememberLatest(std::size_t hash, std::uint32_t record) {
+    if ((keysUsed_ + 1) * 2 > latestByKey_.size()) {
+        std::vector<KeySlot> previous(std::max<std::size_t>(16, latestByKey_.size() * 2));
+        previous.swap(latestByKey_);
+        for (const KeySlot& slot : previous) {
+            if (slot.generation == generation_) {
+                *findKeySlot(slot.hash) = slot;
+            }
+        }
+    }
+    KeySlot* slot = findKeySlot(hash);
+    if (slot->generation != generation_) {
+        ++keysUsed_;
+    }
+    *slot = KeySlot{hash, record, generation_};
+}
+
+} // namespace gb2d::audio
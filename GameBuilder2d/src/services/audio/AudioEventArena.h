@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AudioManager.h"
+
+namespace gb2d::audio {
+
+// Events published between two deliveries (normally one frame). Keys and details are appended to
+// one text buffer instead of being allocated per event, and every buffer keeps its capacity across
+// clear(), so a game that publishes about the same number of events each frame stops allocating
+// after the first few frames.
+class AudioEventArena {
+public:
+    // Appends an event. With `coalesce`, an event whose type and details match the latest event
+    // for the same key is folded into it instead (its count grows, its timestamp stays), so
+    // events for one key keep their relative order. Returns false when the event was folded.
+    bool publish(AudioEventType type, std::string_view key, std::string_view details,
+                 std::uint64_t timestampMs, bool coalesce);
+
+    // Copies the events into `scratch`, which only ever grows, so its strings' capacity is reused
+    // from batch to batch. The span stays valid until `scratch` is next modified.
+    std::span<const AudioEvent> materialize(std::vector<AudioEvent>& scratch) const;
+
+    bool empty() const { return records_.empty(); }
+    std::size_t size() const { return records_.size(); }
+    void clear();
+    void swap(AudioEventArena& other) noexcept;
+
+private:
+    struct Record {
+        AudioEventType type;
+        std::uint32_t keyOffset;
+        std::uint32_t keyLength;
+        std::uint32_t detailsOffset;
+        std::uint32_t detailsLength;
+        std::uint32_t count;
+        std::uint64_t timestampMs;
+    };
+
+    // Open-addressing slot mapping a key hash to its latest record. Slots from before the last
+    // clear() are empty: clearing bumps generation_ instead of touching the table.
+    struct KeySlot {
+        std::size_t hash{0};
+        std::uint32_t record{0};
+        std::uint32_t generation{0};
+    };
+
+    std::string_view text(std::uint32_t offset, std::uint32_t length) const {
+        return std::string_view(text_).substr(offset, length);
+    }
+    // The slot holding `hash`, or the empty slot where it would go; null while the table is empty.
+    KeySlot* findKeySlot(std::size_t hash);
+    void rememberLatest(std::size_t hash, std::uint32_t record);
+
+    std::vector<Record> records_{};
+    std::string text_{};
+    // Only filled while coalescing; the size is a power of two kept at most half full.
+    std::vector<KeySlot> latestByKey_{};
+    std::size_t keysUsed_{0};
+    std::uint32_t generation_{1};
+};
+
+} // namespace gb2d::audio
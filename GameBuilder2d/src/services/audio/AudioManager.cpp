@@ -1,16 +1,30 @@
 #include "AudioManager.h"
+#include "AudioCommandQueue.h"
+#include "AudioEventArena.h"
+#include "MixerKernels.h"
+#include "SoundBank.h"
 
 #include "services/configuration/ConfigurationManager.h"
+#include "services/filesystem/PathResolver.h"
 #include "services/logger/LogManager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cmath>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -23,13 +37,30 @@ using gb2d::logging::LogManager;
 struct Settings {
     bool enabled{true};
     bool diagnosticsLoggingEnabled{true};
+    bool coalesceEvents{false};
     float masterVolume{1.0f};
     float musicVolume{1.0f};
     float sfxVolume{1.0f};
     std::size_t maxConcurrentSounds{16};
+    std::size_t aliasPoolSize{2};
+    VoiceStealPolicy stealPolicy{VoiceStealPolicy::LowestPriority};
+    // Canonical identifier or alias -> voice settings from audio.engine.voices.
+    std::unordered_map<std::string, SoundVoiceSettings> voices{};
+    bool mixerEnabled{false};
+    std::uint32_t mixerSampleRate{48000};
+    MixerOutputMode mixerOutput{MixerOutputMode::Device};
+    std::vector<MixerBusConfig> mixerBuses{};
+    bool musicStreamThread{true};
+    std::uint32_t musicBufferFrames{4096};
+    std::uint32_t musicUpdateIntervalMs{5};
+    SpatialSettings spatial{};
+    float spatialCullVolume{0.001f};
+    std::size_t memoryBudgetBytes{0};
+    float decodeOnDemandSeconds{0.0f};
     std::vector<std::filesystem::path> searchPaths{};
     std::vector<std::string> preloadSounds{};
     std::vector<std::string> preloadMusic{};
+    std::vector<std::string> soundBanks{};
     std::unordered_map<std::string, std::string> preloadSoundAliases{};
     std::unordered_map<std::string, std::string> preloadMusicAliases{};
 };
@@ -40,6 +71,26 @@ struct SoundRecord {
     bool placeholder{true};
     std::string originalIdentifier{};
     std::string resolvedPath{};
+    SoundVoiceSettings voice{};
+    bool voiceOverridden{false}; // set through setSoundVoiceSettings; config reloads leave it alone
+    // Idle aliases of `sound`, recycled across plays so a trigger does not allocate under the lock.
+    std::vector<Sound> aliasPool{};
+    std::size_t activeVoices{0};
+    std::size_t peakVoices{0};
+    // Decoded samples when the software mixer plays the sound; `sound` stays empty then.
+    std::shared_ptr<const PcmBuffer> pcm{};
+    // Set when the sound was loaded from a mounted sound bank rather than its own file.
+    std::shared_ptr<const SoundBank> bank{};
+    // Decode-on-demand: the file as read from disk, decoded into `sound`/`pcm` when played. Its
+    // format is measured once at load, so the inventory can describe it before the first play.
+    std::vector<unsigned char> encoded{};
+    std::string encodedType{}; // file extension, as LoadWaveFromMemory expects
+    std::uint32_t encodedFrames{0};
+    std::uint32_t encodedSampleRate{0};
+    std::uint32_t encodedChannels{0};
+    std::uint64_t lastPlayed{0}; // playSequence of the latest play
+    // Queued for eviction while released and audio.memory.max_bytes is set.
+    std::optional<std::list<std::string>::iterator> lruEntry{};
 };
 
 struct MusicRecord {
@@ -51,6 +102,122 @@ struct MusicRecord {
     bool playing{false};
     bool paused{false};
     float volume{1.0f};
+    // Streaming: when updateMusicStream last refilled the track, and how long its buffer lasts.
+    std::chrono::steady_clock::time_point lastServiced{};
+    float bufferedSeconds{0.0f};
+    // Software mixer playback: the whole track decoded up front, played as one looping voice.
+    std::shared_ptr<const PcmBuffer> pcm{};
+    MixerVoiceId voice{0};
+};
+
+bool isSoundValid(const Sound& sound);
+bool isMusicValid(const Music& music);
+
+// Decoded samples held for the sound. raylib keeps a sound in the device format its stream reports.
+std::size_t decodedSoundBytes(const SoundRecord& record) {
+    if (record.pcm) {
+        return record.pcm->samples.size() * sizeof(float);
+    }
+    if (isSoundValid(record.sound)) {
+        return static_cast<std::size_t>(record.sound.frameCount) * record.sound.stream.channels *
+               (record.sound.stream.sampleSize / 8);
+    }
+    return 0;
+}
+
+std::size_t soundRecordBytes(const SoundRecord& record) {
+    return decodedSoundBytes(record) + record.encoded.size();
+}
+
+// A raylib music stream decodes as it plays, so it holds its two stream buffers rather than the track.
+std::size_t musicRecordBytes(const MusicRecord& record) {
+    if (record.pcm) {
+        return record.pcm->samples.size() * sizeof(float);
+    }
+    if (isMusicValid(record.music)) {
+        const auto frames = static_cast<std::size_t>(record.bufferedSeconds * static_cast<float>(record.music.stream.sampleRate) + 0.5f);
+        return 2 * frames * record.music.stream.channels * (record.music.stream.sampleSize / 8);
+    }
+    return 0;
+}
+
+constexpr std::size_t kCommandQueueCapacity = 4096;
+
+// Keeps playing music streams topped up from a thread of its own, so a long frame on the main
+// thread no longer starves them. Each pass takes the manager lock briefly.
+struct MusicStreamThread {
+    using Clock = std::chrono::steady_clock;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idleChanged;
+    std::thread worker{};
+    bool stopping{false};
+    bool running{false};
+    // Guarded by `mutex`: the worker is waiting for `due`, the time of its next pass.
+    bool idle{false};
+    Clock::time_point due{};
+    // Tests replace steady_clock with a clock that only moves in advanceManualClock.
+    std::atomic<bool> manualClock{false};
+    std::atomic<Clock::rep> manualTicks{0};
+
+    ~MusicStreamThread() { stop(); }
+
+    [[nodiscard]] Clock::time_point now() const {
+        if (manualClock.load(std::memory_order_acquire)) {
+            return Clock::time_point(Clock::duration(manualTicks.load(std::memory_order_acquire)));
+        }
+        return Clock::now();
+    }
+
+    void start(std::chrono::milliseconds interval) {
+        if (worker.joinable()) {
+            return;
+        }
+        {
+            std::scoped_lock lock(mutex);
+            stopping = false;
+            running = true;
+            idle = false;
+            due = now() + interval;
+        }
+        worker = std::thread([this, interval]() { run(interval); });
+    }
+
+    // Must be called without the manager lock: the worker may be waiting for it.
+    void stop() {
+        {
+            std::scoped_lock lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        if (worker.joinable()) {
+            worker.join();
+        }
+        {
+            std::scoped_lock lock(mutex);
+            running = false;
+        }
+        idleChanged.notify_all();
+    }
+
+    void useManualClock(bool enabled) {
+        if (enabled) {
+            manualTicks.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+        }
+        manualClock.store(enabled, std::memory_order_release);
+    }
+
+    // Must be called without the manager lock. Returns once the worker has run the pass that fell
+    // due, if any, and is waiting again.
+    void advanceManualClock(Clock::duration step) {
+        std::unique_lock lock(mutex);
+        manualTicks.fetch_add(step.count(), std::memory_order_acq_rel);
+        wake.notify_all();
+        idleChanged.wait(lock, [this]() { return !running || stopping || (idle && due > now()); });
+    }
+
+    void run(std::chrono::milliseconds interval);
 };
 
 struct ManagerState {
@@ -66,11 +233,30 @@ struct ManagerState {
     std::uint32_t generationCounter{1};
     std::size_t activeSoundInstances{0};
     const AudioManager::RaylibHooks* overrideHooks{nullptr};
-    // Event subscription infrastructure
+    // Event subscription infrastructure. Events are buffered under `mutex` and delivered to sinks
+    // by tick() after it is released; `deliveryMutex` keeps batches from different threads in
+    // order and guards the delivery-side buffers, which trade places with `pendingEvents`.
     std::vector<AudioEventSubscription> eventSubscriptions{};
     std::uint32_t nextSubscriptionId{1};
+    std::size_t activeSubscriptions{0};
+    AudioEventArena pendingEvents{};
+    std::atomic<bool> eventsPending{false};
+    std::atomic<std::uint32_t> subscriptionsVersion{0};
+    std::size_t eventsPublished{0};
+    std::size_t eventsCoalesced{0};
+    std::atomic<std::size_t> eventBatchesDelivered{0};
+    std::mutex deliveryMutex;
+    AudioEventArena deliveringEvents{};
+    std::vector<AudioEvent> deliveredEvents{};
+    std::vector<AudioEventSubscription> deliverySubscriptions{};
+    // Commands posted without the lock by post*(); drained by tick().
+    AudioCommandQueue commands{kCommandQueueCapacity};
+    std::atomic<std::size_t> commandsPosted{0};
+    std::atomic<std::size_t> commandsRejected{0};
+    std::size_t commandsApplied{0};
     struct SoundSlot {
         Sound alias{};
+        MixerVoiceId voice{0}; // set instead of `alias` when the software mixer plays the slot
         std::string key{};
         bool active{false};
         bool placeholder{true};
@@ -78,8 +264,62 @@ struct ManagerState {
         float volume{1.0f};
         float pitch{1.0f};
         float pan{0.5f};
+        int priority{0};
+        std::uint64_t startedSequence{0}; // orders voices by age for stealing
+        // playSoundAt voices: `volume` and `pan` above are derived from these on every move.
+        bool positional{false};
+        bool emitterMoved{false};
+        Vector2 position{0.0f, 0.0f};
+        float baseVolume{1.0f};
+        SpatialSettings spatial{};
     };
     std::vector<SoundSlot> soundSlots{};
+    std::uint64_t playSequence{0};
+    std::size_t voicesStolen{0};
+    std::size_t voicesDropped{0};
+    std::size_t instanceCapHits{0};
+    std::size_t aliasPoolHits{0};
+    std::size_t aliasPoolMisses{0};
+    // Spatial audio. A listener move re-spatializes every positional voice at the next tick().
+    AudioListener listener{};
+    bool listenerMoved{false};
+    std::size_t spatialCulled{0};
+    std::size_t spatialUpdates{0};
+    // Audio memory budget. Released sounds wait in `soundLru` (front is evicted first) while
+    // audio.memory.max_bytes is set; otherwise they are unloaded on release.
+    std::list<std::string> soundLru{};
+    std::size_t soundsEvicted{0};
+    std::size_t evictedSoundBytes{0};
+    std::size_t soundsDecodedOnDemand{0};
+    std::size_t decodedSoundsDropped{0};
+    bool overBudgetNotified{false};
+    // Highest concurrency seen per sound key; outlives the record so a re-acquire pre-creates enough.
+    std::unordered_map<std::string, std::size_t> voicePeaks{};
+    gb2d::filesystem::PathResolver resolver{};
+    // Software mixer, created by init() when audio.mixer.enabled is set and the hooks support it.
+    // In device mode raylib pulls it through `mixerStream`; the callback only sees `streamMixer`.
+    std::unique_ptr<AudioMixer> mixer{};
+    // Offline backends: scratch for tick(dt) renders, and the fraction of a frame not yet rendered.
+    std::vector<float> offlineScratch{};
+    double offlineFrameCarry{0.0};
+    AudioStream mixerStream{};
+    std::atomic<AudioMixer*> streamMixer{nullptr};
+    // Mounted audio.preload.sound_banks, and their sounds by canonical identifier. The first bank
+    // listed wins when two contain the same identifier.
+    struct BankedSound {
+        std::shared_ptr<const SoundBank> bank{};
+        std::size_t index{0};
+        std::string key{};
+        std::string path{}; // where the sound's own file would be; shown in the inventory
+    };
+    std::vector<std::shared_ptr<const SoundBank>> soundBanks{};
+    std::unordered_map<std::string, BankedSound> bankedSounds{};
+    // Music streaming. With the thread running, tick() no longer calls updateMusicStream.
+    MusicStreamThread musicThread{};
+    bool musicThreadActive{false};
+    std::size_t musicStreamUpdates{0};
+    std::size_t musicUnderruns{0};
+    float musicLongestGapMs{0.0f};
 };
 
 ManagerState& state() {
@@ -87,38 +327,139 @@ ManagerState& state() {
     return s;
 }
 
-void publishAudioEvent(AudioEventType type, const std::string& key = "", const std::string& details = "") {
+const AudioManager::RaylibHooks& hooks(const ManagerState& st);
+
+// Refills every playing raylib music stream. A refill that comes later than the stream's buffer
+// lasts means the device ran dry in between, so it is counted as an underrun.
+void serviceMusicStreamsLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
+    const auto now = st.musicThread.now();
+    for (auto& [key, rec] : st.music) {
+        (void)key;
+        if (rec.placeholder || rec.pcm || !rec.playing || rec.paused) {
+            continue;
+        }
+        if (rec.lastServiced != std::chrono::steady_clock::time_point{}) {
+            const std::chrono::duration<float> gap = now - rec.lastServiced;
+            st.musicLongestGapMs = std::max(st.musicLongestGapMs, gap.count() * 1000.0f);
+            if (rec.bufferedSeconds > 0.0f && gap.count() > rec.bufferedSeconds) {
+                st.musicUnderruns++;
+            }
+        }
+        api.updateMusicStream(rec.music);
+        rec.lastServiced = now;
+        st.musicStreamUpdates++;
+    }
+}
+
+void MusicStreamThread::run(std::chrono::milliseconds interval) {
     auto& st = state();
-    // Note: This function assumes the caller already holds st.mutex
-    
-    AudioEvent event{
-        type,
-        key,
-        static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()).count()),
-        details
-    };
-    
-    const bool diagnosticsLogging = st.settings.diagnosticsLoggingEnabled;
-    if (diagnosticsLogging) {
-        LogManager::info("AudioManager publishing event: type={}, key='{}', subscriptions={}", 
-                         static_cast<int>(type), key, st.eventSubscriptions.size());
+    for (;;) {
+        {
+            std::unique_lock lock(mutex);
+            while (!stopping && now() < due) {
+                idle = true;
+                idleChanged.notify_all();
+                if (manualClock.load(std::memory_order_acquire)) {
+                    wake.wait(lock);
+                } else {
+                    wake.wait_until(lock, due);
+                }
+                idle = false;
+            }
+            if (stopping) {
+                return;
+            }
+        }
+        {
+            std::scoped_lock lock(st.mutex);
+            if (st.initialized && st.deviceReady && !st.silentMode) {
+                serviceMusicStreamsLocked(st, hooks(st));
+            }
+        }
+        std::scoped_lock lock(mutex);
+        due = now() + interval;
     }
-    
-    for (const auto& subscription : st.eventSubscriptions) {
-        if (subscription.active && subscription.sink) {
-            if (diagnosticsLogging) {
-                LogManager::info("AudioManager calling onAudioEvent for subscription ID {}", subscription.id);
+}
+
+// Caller holds st.mutex. The event reaches sinks at the next tick() or flushEvents(). With nobody
+// subscribed (AudioManagerWindow closed) it is dropped before anything is formatted or copied.
+void publishAudioEvent(AudioEventType type, std::string_view key = {}, std::string_view details = {}) {
+    auto& st = state();
+    if (st.activeSubscriptions == 0) {
+        return;
+    }
+    const auto timestampMs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    ++st.eventsPublished;
+    if (!st.pendingEvents.publish(type, key, details, timestampMs, st.settings.coalesceEvents)) {
+        ++st.eventsCoalesced;
+    }
+    st.eventsPending.store(true, std::memory_order_release);
+}
+
+thread_local bool deliveringAudioEvents = false;
+
+// Hands buffered events to the sinks without holding st.mutex, so a sink may call back into the
+// AudioManager. Each sink gets the whole batch in one onAudioEvents call. Events published by a
+// sink on this thread form the next batch of the same loop.
+void deliverPendingEvents(ManagerState& st) {
+    if (deliveringAudioEvents || !st.eventsPending.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::scoped_lock delivery(st.deliveryMutex);
+    deliveringAudioEvents = true;
+    auto& batch = st.deliveringEvents;
+    auto& subscriptions = st.deliverySubscriptions;
+    std::uint32_t subscriptionsVersion = 0;
+    bool diagnosticsLogging = false;
+    const auto refreshSubscriptions = [&]() {
+        subscriptions = st.eventSubscriptions;
+        subscriptionsVersion = st.subscriptionsVersion.load(std::memory_order_relaxed);
+    };
+    const auto takeBatch = [&]() {
+        batch.clear();
+        std::scoped_lock lock(st.mutex);
+        batch.swap(st.pendingEvents);
+        st.eventsPending.store(false, std::memory_order_relaxed);
+        refreshSubscriptions();
+        diagnosticsLogging = st.settings.diagnosticsLoggingEnabled;
+    };
+    for (takeBatch(); !batch.empty(); takeBatch()) {
+        const auto events = batch.materialize(st.deliveredEvents);
+        if (diagnosticsLogging) {
+            LogManager::info("AudioManager delivering {} event(s) to {} subscription(s)", events.size(),
+                             subscriptions.size());
+        }
+        // Subscriptions are only ever appended or deactivated, so indices survive a refresh.
+        for (std::size_t i = 0; i < subscriptions.size(); ++i) {
+            if (st.subscriptionsVersion.load(std::memory_order_acquire) != subscriptionsVersion) {
+                // A sink (un)subscribed mid-batch; never call a sink after it unsubscribed.
+                std::scoped_lock lock(st.mutex);
+                refreshSubscriptions();
             }
-            subscription.sink->onAudioEvent(event);
-        } else {
-            if (diagnosticsLogging) {
-                LogManager::warn("AudioManager skipping inactive subscription ID {}", subscription.id);
+            const auto& subscription = subscriptions[i];
+            if (subscription.active && subscription.sink) {
+                subscription.sink->onAudioEvents(events);
+                st.eventBatchesDelivered.fetch_add(1, std::memory_order_relaxed);
             }
         }
     }
+    batch.clear();
+    deliveringAudioEvents = false;
 }
 
+// Declared before the manager lock in tick(), so its destructor runs after the lock is released.
+class EventDelivery {
+public:
+    explicit EventDelivery(ManagerState& st) : st_(st) {}
+    ~EventDelivery() { deliverPendingEvents(st_); }
+    EventDelivery(const EventDelivery&) = delete;
+    EventDelivery& operator=(const EventDelivery&) = delete;
+
+private:
+    ManagerState& st_;
+};
+
 class RaylibBackend final : public AudioManager::Backend {
 public:
     void initDevice() override { InitAudioDevice(); }
@@ -139,28 +480,40 @@ AudioManager::Backend* backend() {
 
 const AudioManager::RaylibHooks& defaultHooks() {
     static const AudioManager::RaylibHooks hooks{
-        &LoadSound,
-        &UnloadSound,
-        &LoadSoundAlias,
-        &UnloadSoundAlias,
-        &rlPlaySound,
-        &StopSound,
-        &IsSoundPlaying,
-        &SetSoundVolume,
-        &SetSoundPitch,
-        &SetSoundPan,
-        &LoadMusicStream,
-        &UnloadMusicStream,
-        &PlayMusicStream,
-        &PauseMusicStream,
-        &ResumeMusicStream,
-        &StopMusicStream,
-        &UpdateMusicStream,
-        &IsMusicStreamPlaying,
-        &SetMusicVolume,
-        &SeekMusicStream,
-        &GetMusicTimeLength,
-        &GetMusicTimePlayed
+        .loadSound = &LoadSound,
+        .unloadSound = &UnloadSound,
+        .loadSoundAlias = &LoadSoundAlias,
+        .unloadSoundAlias = &UnloadSoundAlias,
+        .playSound = &rlPlaySound,
+        .stopSound = &StopSound,
+        .isSoundPlaying = &IsSoundPlaying,
+        .setSoundVolume = &SetSoundVolume,
+        .setSoundPitch = &SetSoundPitch,
+        .setSoundPan = &SetSoundPan,
+        .loadMusicStream = &LoadMusicStream,
+        .unloadMusicStream = &UnloadMusicStream,
+        .playMusicStream = &PlayMusicStream,
+        .pauseMusicStream = &PauseMusicStream,
+        .resumeMusicStream = &ResumeMusicStream,
+        .stopMusicStream = &StopMusicStream,
+        .updateMusicStream = &UpdateMusicStream,
+        .isMusicStreamPlaying = &IsMusicStreamPlaying,
+        .setMusicVolume = &SetMusicVolume,
+        .seekMusicStream = &SeekMusicStream,
+        .getMusicTimeLength = &GetMusicTimeLength,
+        .getMusicTimePlayed = &GetMusicTimePlayed,
+        .loadWave = &LoadWave,
+        .unloadWave = &UnloadWave,
+        .loadWaveSamples = &LoadWaveSamples,
+        .unloadWaveSamples = &UnloadWaveSamples,
+        .loadAudioStream = &LoadAudioStream,
+        .unloadAudioStream = &UnloadAudioStream,
+        .setAudioStreamCallback = &SetAudioStreamCallback,
+        .playAudioStream = &PlayAudioStream,
+        .stopAudioStream = &StopAudioStream,
+        .setAudioStreamBufferSizeDefault = &SetAudioStreamBufferSizeDefault,
+        .loadSoundFromWave = &LoadSoundFromWave,
+        .loadWaveFromMemory = &LoadWaveFromMemory
     };
     return hooks;
 }
@@ -216,13 +569,92 @@ void ensureSoundSlotCapacity(ManagerState& st) {
     st.activeSoundInstances = 0;
 }
 
-std::optional<std::size_t> findFreeSoundSlotIndex(ManagerState& st) {
+bool isStealCandidate(VoiceStealPolicy policy, const ManagerState::SoundSlot& slot, int priority) {
+    switch (policy) {
+        case VoiceStealPolicy::Oldest:
+        case VoiceStealPolicy::Quietest:
+            return slot.priority <= priority;
+        case VoiceStealPolicy::LowestPriority:
+            return slot.priority < priority;
+        case VoiceStealPolicy::None:
+            break;
+    }
+    return false;
+}
+
+// True if `candidate` should be stolen before `current`.
+bool isBetterVictim(VoiceStealPolicy policy, const ManagerState::SoundSlot& candidate, const ManagerState::SoundSlot& current) {
+    switch (policy) {
+        case VoiceStealPolicy::Quietest:
+            if (candidate.volume != current.volume) {
+                return candidate.volume < current.volume;
+            }
+            break;
+        case VoiceStealPolicy::LowestPriority:
+            if (candidate.priority != current.priority) {
+                return candidate.priority < current.priority;
+            }
+            break;
+        case VoiceStealPolicy::Oldest:
+        case VoiceStealPolicy::None:
+            break;
+    }
+    return candidate.startedSequence < current.startedSequence;
+}
+
+enum class VoiceDecision {
+    FreeSlot,
+    Steal,         // policy victim: another voice loses its slot to a more important one
+    StealInstance, // instance cap: the sound retriggers its own oldest voice
+    InstanceCap,
+    PoolFull
+};
+
+struct VoiceSchedule {
+    VoiceDecision decision{VoiceDecision::PoolFull};
+    std::size_t index{0};
+};
+
+// Picks the slot for a new voice of `key` in one pass over the pool. A sound at its instance cap
+// retriggers its own oldest voice (unless stealing is off) rather than taking another slot.
+VoiceSchedule scheduleVoiceLocked(const ManagerState& st, const std::string& key, int priority, std::size_t maxInstances) {
+    const auto policy = st.settings.stealPolicy;
+    std::optional<std::size_t> freeIndex;
+    std::optional<std::size_t> oldestInstance;
+    std::optional<std::size_t> victim;
+    std::size_t instances = 0;
     for (std::size_t i = 0; i < st.soundSlots.size(); ++i) {
-        if (!st.soundSlots[i].active) {
-            return i;
+        const auto& slot = st.soundSlots[i];
+        if (!slot.active) {
+            if (!freeIndex) {
+                freeIndex = i;
+            }
+            continue;
+        }
+        if (slot.key == key) {
+            ++instances;
+            if (!oldestInstance || slot.startedSequence < st.soundSlots[*oldestInstance].startedSequence) {
+                oldestInstance = i;
+            }
+        }
+        if (isStealCandidate(policy, slot, priority) && (!victim || isBetterVictim(policy, slot, st.soundSlots[*victim]))) {
+            victim = i;
         }
     }
-    return std::nullopt;
+
+    if (maxInstances > 0 && instances >= maxInstances) {
+        if (policy == VoiceStealPolicy::None || !oldestInstance) {
+            return {VoiceDecision::InstanceCap, 0};
+        }
+        return {VoiceDecision::StealInstance, *oldestInstance};
+    }
+    if (freeIndex) {
+        return {VoiceDecision::FreeSlot, *freeIndex};
+    }
+    if (victim) {
+        return {VoiceDecision::Steal, *victim};
+    }
+    return {VoiceDecision::PoolFull, 0};
 }
 
 std::string trimCopy(const std::string& value) {
@@ -255,81 +687,184 @@ std::string canonicalizePath(const std::filesystem::path& path) {
     return canonicalizeKey(normalized.generic_string());
 }
 
-std::optional<std::filesystem::path> checkCandidate(const std::filesystem::path& candidate) {
-    std::error_code ec;
-    if (!std::filesystem::exists(candidate, ec)) {
-        return std::nullopt;
+std::optional<std::filesystem::path> resolvePath(ManagerState& st, const std::string& identifier) {
+    return st.resolver.resolve(identifier);
+}
+
+bool isSoundValid(const Sound& sound) {
+    return sound.frameCount > 0 && sound.stream.buffer != nullptr;
+}
+
+bool isMusicValid(const Music& music) {
+    return music.stream.buffer != nullptr;
+}
+
+bool isSoundDecoded(const SoundRecord& record) {
+    return record.pcm || isSoundValid(record.sound);
+}
+
+// A decode-on-demand sound is playable before it is decoded; playSound decodes it first.
+bool isSoundPlayable(const SoundRecord& record) {
+    return !record.placeholder && (isSoundDecoded(record) || !record.encoded.empty());
+}
+
+bool isMusicPlayable(const MusicRecord& record) {
+    return !record.placeholder && (record.pcm || isMusicValid(record.music));
+}
+
+// Converts a decoded wave to float PCM for the software mixer. Waves with more than two channels
+// keep the first two. The caller still owns `wave`.
+std::shared_ptr<const PcmBuffer> pcmFromWave(const AudioManager::RaylibHooks& api, const Wave& wave) {
+    if (wave.frameCount == 0 || wave.channels == 0 || wave.data == nullptr) {
+        return nullptr;
     }
-    auto canonical = std::filesystem::weakly_canonical(candidate, ec);
-    if (ec) {
-        return std::nullopt;
+    float* samples = api.loadWaveSamples(wave);
+    if (!samples) {
+        return nullptr;
+    }
+    auto pcm = std::make_shared<PcmBuffer>();
+    pcm->sampleRate = wave.sampleRate;
+    pcm->channels = std::min(wave.channels, 2u);
+    if (pcm->channels == wave.channels) {
+        pcm->samples.assign(samples, samples + static_cast<std::size_t>(wave.frameCount) * wave.channels);
+    } else {
+        pcm->samples.resize(static_cast<std::size_t>(wave.frameCount) * 2);
+        for (std::size_t frame = 0; frame < wave.frameCount; ++frame) {
+            std::memcpy(&pcm->samples[frame * 2], samples + frame * wave.channels, 2 * sizeof(float));
+        }
     }
-    return canonical;
+    api.unloadWaveSamples(samples);
+    return pcm;
 }
 
-std::optional<std::filesystem::path> resolvePath(const std::string& identifier, const Settings& settings) {
-    if (identifier.empty()) {
-        return std::nullopt;
+// Decodes a file to float PCM for the software mixer.
+std::shared_ptr<const PcmBuffer> loadPcm(const AudioManager::RaylibHooks& api, const std::string& path) {
+    Wave wave = api.loadWave(path.c_str());
+    auto pcm = pcmFromWave(api, wave);
+    if (wave.data != nullptr) {
+        api.unloadWave(wave);
     }
+    return pcm;
+}
 
-    std::filesystem::path input(identifier);
+std::string soundBus(const SoundRecord& record) {
+    return record.voice.bus.empty() ? AudioMixer::kSfxBus : record.voice.bus;
+}
 
-    if (input.is_absolute()) {
-        if (auto absolute = checkCandidate(input)) {
-            return absolute;
-        }
-        return std::nullopt;
+// Runs on raylib's audio thread. UnloadAudioStream waits for a callback in flight, so the mixer
+// outlives every call that can still see it.
+void mixerStreamCallback(void* buffer, unsigned int frames) {
+    auto* out = static_cast<float*>(buffer);
+    if (auto* mixer = state().streamMixer.load(std::memory_order_acquire)) {
+        mixer->render(out, frames);
+    } else {
+        std::fill(out, out + static_cast<std::size_t>(frames) * 2, 0.0f);
     }
+}
 
-    std::error_code ec;
-    auto currentDir = std::filesystem::current_path(ec);
-    if (!ec) {
-        auto direct = currentDir / input;
-        if (auto found = checkCandidate(direct)) {
-            return found;
-        }
+void applyMixerBusesLocked(ManagerState& st) {
+    for (const auto& name : st.mixer->applyBusConfig(st.settings.mixerBuses)) {
+        LogManager::warn("audio.mixer.buses entry '{}' has an unknown parent or forms a cycle; ignoring it", name);
     }
+}
 
-    for (const auto& root : settings.searchPaths) {
-        std::filesystem::path base = root;
-        if (!base.is_absolute()) {
-            std::error_code rootEc;
-            auto cwd = std::filesystem::current_path(rootEc);
-            if (!rootEc) {
-                base = cwd / base;
-            }
-        }
-        auto candidate = base / input;
-        if (auto found = checkCandidate(candidate)) {
-            return found;
-        }
+// Feeds an offline backend dt seconds of mix. The fractional frame is carried to the next tick, so
+// a fixed sequence of dt values always renders the same number of frames.
+void renderOfflineLocked(ManagerState& st, float deltaSeconds) {
+    auto* target = backend();
+    if (!st.mixer || deltaSeconds <= 0.0f || target->offlineSampleRate() == 0) {
+        return;
     }
-
-    return std::nullopt;
+    const double exact = static_cast<double>(deltaSeconds) * st.mixer->sampleRate() + st.offlineFrameCarry;
+    const auto frames = static_cast<std::size_t>(exact);
+    st.offlineFrameCarry = exact - static_cast<double>(frames);
+    if (frames == 0) {
+        return;
+    }
+    st.offlineScratch.resize(frames * 2);
+    st.mixer->render(st.offlineScratch.data(), frames);
+    target->consumeOfflineAudio(st.offlineScratch.data(), frames);
 }
 
-bool isSoundValid(const Sound& sound) {
-    return sound.frameCount > 0 && sound.stream.buffer != nullptr;
+// Creates the mixer and, in device mode, the float stream raylib pulls it through. Leaves the
+// mixer off (raylib playback) when the hook table lacks what it needs.
+void startMixerLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
+    if (!api.loadWave || !api.unloadWave || !api.loadWaveSamples || !api.unloadWaveSamples) {
+        LogManager::warn("AudioManager software mixer needs wave decoding hooks; using raylib playback");
+        return;
+    }
+    const bool device = st.settings.mixerOutput == MixerOutputMode::Device;
+    if (device && (!api.loadAudioStream || !api.unloadAudioStream || !api.setAudioStreamCallback ||
+                   !api.playAudioStream || !api.stopAudioStream)) {
+        LogManager::warn("AudioManager software mixer needs audio stream hooks for device output; using raylib playback");
+        return;
+    }
+    auto mixer = std::make_unique<AudioMixer>(st.settings.mixerSampleRate);
+    mixer->setOutputGain(st.settings.masterVolume);
+    st.mixer = std::move(mixer);
+    applyMixerBusesLocked(st);
+    if (device) {
+        AudioStream stream = api.loadAudioStream(st.settings.mixerSampleRate, 32, 2);
+        if (stream.buffer == nullptr) {
+            LogManager::error("AudioManager could not open a {} Hz mixer stream; using raylib playback", st.settings.mixerSampleRate);
+            st.mixer.reset();
+            return;
+        }
+        st.mixerStream = stream;
+        st.streamMixer.store(st.mixer.get(), std::memory_order_release);
+        api.setAudioStreamCallback(stream, &mixerStreamCallback);
+        api.playAudioStream(stream);
+    }
+    LogManager::info("AudioManager software mixer active ({} Hz, {} output, {} kernels)",
+                     st.settings.mixerSampleRate,
+                     device ? "device" : "offline",
+                     kernels::instructionSet());
 }
 
-bool isMusicValid(const Music& music) {
-    return music.stream.buffer != nullptr;
+void stopMixerLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
+    if (st.mixerStream.buffer != nullptr) {
+        api.stopAudioStream(st.mixerStream);
+        api.unloadAudioStream(st.mixerStream);
+        st.mixerStream = AudioStream{};
+    }
+    st.streamMixer.store(nullptr, std::memory_order_release);
+    st.mixer.reset();
+    st.offlineScratch.clear();
+    st.offlineFrameCarry = 0.0;
 }
 
+// Callers stop the record's voices first, so every alias it owns is back in the pool.
 void unloadSoundRecord(SoundRecord& record, const AudioManager::RaylibHooks& api) {
+    for (const auto& alias : record.aliasPool) {
+        api.unloadSoundAlias(alias);
+    }
+    record.aliasPool.clear();
+    record.activeVoices = 0;
     if (!record.placeholder && isSoundValid(record.sound)) {
         api.unloadSound(record.sound);
     }
     record.sound = Sound{};
+    record.pcm.reset();
+    record.bank.reset();
+    record.encoded = {};
+    record.encodedType.clear();
+    record.encodedFrames = 0;
+    record.encodedSampleRate = 0;
+    record.encodedChannels = 0;
     record.placeholder = true;
     record.resolvedPath.clear();
 }
 
-void unloadMusicRecord(MusicRecord& record, const AudioManager::RaylibHooks& api) {
+void unloadMusicRecord(ManagerState& st, MusicRecord& record, const AudioManager::RaylibHooks& api) {
     if (!record.placeholder && isMusicValid(record.music)) {
         api.stopMusicStream(record.music);
         api.unloadMusicStream(record.music);
     }
+    if (record.voice != 0 && st.mixer) {
+        st.mixer->stopVoice(record.voice);
+    }
+    record.voice = 0;
+    record.pcm.reset();
     record.music = Music{};
     record.placeholder = true;
     record.resolvedPath.clear();
@@ -338,14 +873,32 @@ void unloadMusicRecord(MusicRecord& record, const AudioManager::RaylibHooks& api
     record.volume = 1.0f;
 }
 
-void releaseSoundSlot(ManagerState::SoundSlot& slot, const AudioManager::RaylibHooks& api) {
-    if (slot.active) {
-        if (isSoundValid(slot.alias)) {
-            api.stopSound(slot.alias);
+// Stops the voice and hands its alias back to the owning sound's pool. Aliases whose sound is no
+// longer loaded are unloaded instead.
+void releaseSoundSlot(ManagerState& st, ManagerState::SoundSlot& slot, const AudioManager::RaylibHooks& api) {
+    if (slot.active && slot.voice != 0) {
+        if (st.mixer) {
+            st.mixer->stopVoice(slot.voice);
+        }
+        auto it = st.sounds.find(slot.key);
+        if (it != st.sounds.end() && it->second.activeVoices > 0) {
+            it->second.activeVoices--;
+        }
+    } else if (slot.active && isSoundValid(slot.alias)) {
+        api.stopSound(slot.alias);
+        auto it = st.sounds.find(slot.key);
+        if (it != st.sounds.end() && !it->second.placeholder) {
+            auto& record = it->second;
+            record.aliasPool.push_back(slot.alias);
+            if (record.activeVoices > 0) {
+                record.activeVoices--;
+            }
+        } else {
             api.unloadSoundAlias(slot.alias);
         }
     }
     slot.alias = Sound{};
+    slot.voice = 0;
     slot.key.clear();
     slot.active = false;
     slot.placeholder = true;
@@ -353,6 +906,10 @@ void releaseSoundSlot(ManagerState::SoundSlot& slot, const AudioManager::RaylibH
     slot.volume = 1.0f;
     slot.pitch = 1.0f;
     slot.pan = 0.5f;
+    slot.priority = 0;
+    slot.startedSequence = 0;
+    slot.positional = false;
+    slot.emitterMoved = false;
 }
 
 void refreshSoundSlotsLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
@@ -361,15 +918,14 @@ void refreshSoundSlotsLocked(ManagerState& st, const AudioManager::RaylibHooks&
         if (!slot.active) {
             continue;
         }
-        if (!api.isSoundPlaying(slot.alias)) {
-            // Sound finished playing - publish event before releasing
-            std::string stoppedKey = slot.key;
-            releaseSoundSlot(slot, api);
-            
-            // Publish event outside the slot cleanup
-            if (!stoppedKey.empty()) {
-                publishAudioEvent(AudioEventType::SoundPlaybackStopped, stoppedKey);
+        const bool playing = slot.voice != 0 ? st.mixer && st.mixer->isVoicePlaying(slot.voice)
+                                             : api.isSoundPlaying(slot.alias);
+        if (!playing) {
+            // Sound finished playing; the event copies the key, so publish before releasing.
+            if (!slot.key.empty()) {
+                publishAudioEvent(AudioEventType::SoundPlaybackStopped, slot.key);
             }
+            releaseSoundSlot(st, slot, api);
             continue;
         }
         active++;
@@ -382,98 +938,1093 @@ void stopAllSoundsLocked(ManagerState& st, const AudioManager::RaylibHooks& api)
         if (!slot.active) {
             continue;
         }
-        releaseSoundSlot(slot, api);
+        releaseSoundSlot(st, slot, api);
     }
     st.activeSoundInstances = 0;
 }
 
-void stopMusicRecord(const AudioManager::RaylibHooks& api, MusicRecord& record) {
-    if (!record.placeholder && isMusicValid(record.music)) {
-        api.stopMusicStream(record.music);
+void stopSoundVoicesLocked(ManagerState& st, const std::string& key, const AudioManager::RaylibHooks& api) {
+    for (auto& slot : st.soundSlots) {
+        if (slot.active && slot.key == key) {
+            releaseSoundSlot(st, slot, api);
+            if (st.activeSoundInstances > 0) {
+                st.activeSoundInstances--;
+            }
+        }
     }
-    record.playing = false;
-    record.paused = false;
 }
 
-Settings loadSettings() {
-    Settings s;
-    s.enabled = ConfigurationManager::getBool("audio.core.enabled", true);
-
-    s.diagnosticsLoggingEnabled = ConfigurationManager::getBool("audio.core.diagnostics_logging", true);
-
-    s.masterVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.master", 1.0), 0.0, 1.0);
-
-    s.musicVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.music", 1.0), 0.0, 1.0);
-
-    s.sfxVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.sfx", 1.0), 0.0, 1.0);
-
-    auto maxSlots = ConfigurationManager::getInt("audio.engine.max_concurrent_sounds", 16);
-    if (maxSlots < 0) maxSlots = 0;
-    s.maxConcurrentSounds = static_cast<std::size_t>(maxSlots);
+Sound takePooledAlias(ManagerState& st, SoundRecord& record, const AudioManager::RaylibHooks& api) {
+    if (!record.aliasPool.empty()) {
+        Sound alias = record.aliasPool.back();
+        record.aliasPool.pop_back();
+        st.aliasPoolHits++;
+        return alias;
+    }
+    st.aliasPoolMisses++;
+    return api.loadSoundAlias(record.sound);
+}
 
-    auto paths = ConfigurationManager::getStringList("audio.engine.search_paths", {"assets/audio"});
-    s.searchPaths.reserve(paths.size());
-    for (const auto& p : paths) {
-        s.searchPaths.emplace_back(p);
+// Pre-creates aliases for a freshly loaded sound: audio.engine.alias_pool_size, or as many as the
+// sound has ever had playing at once if that is more, bounded by its instance cap and the pool.
+void prewarmAliasPool(ManagerState& st, const std::string& key, SoundRecord& record, const AudioManager::RaylibHooks& api) {
+    if (record.placeholder || !isSoundValid(record.sound)) {
+        return;
+    }
+    std::size_t target = st.settings.aliasPoolSize;
+    if (auto it = st.voicePeaks.find(key); it != st.voicePeaks.end()) {
+        target = std::max(target, it->second);
     }
+    if (record.voice.maxInstances > 0) {
+        target = std::min(target, record.voice.maxInstances);
+    }
+    target = std::min(target, st.settings.maxConcurrentSounds);
+    while (record.aliasPool.size() < target) {
+        Sound alias = api.loadSoundAlias(record.sound);
+        if (!isSoundValid(alias)) {
+            LogManager::warn("AudioManager could not pre-create alias {} of {} for '{}'", record.aliasPool.size() + 1, target, key);
+            break;
+        }
+        record.aliasPool.push_back(alias);
+    }
+}
 
-    s.preloadSounds = ConfigurationManager::getStringList("audio.preload.sounds", {});
+// Maps every bank in audio.preload.sound_banks and indexes its sounds. A banked sound is keyed as
+// if its file sat beside the bank, so it shares keys and aliases with individually loaded files.
+void mountSoundBanksLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
+    st.soundBanks.clear();
+    st.bankedSounds.clear();
+    if (st.settings.soundBanks.empty()) {
+        return;
+    }
+    if (!st.mixer && !api.loadSoundFromWave) {
+        LogManager::warn("AudioManager cannot play sound banks without LoadSoundFromWave; loading files instead");
+        return;
+    }
+    for (const auto& identifier : st.settings.soundBanks) {
+        const auto resolved = resolvePath(st, identifier);
+        auto bank = resolved ? SoundBank::open(*resolved) : nullptr;
+        if (!bank) {
+            LogManager::warn("AudioManager could not open sound bank '{}'", identifier);
+            continue;
+        }
+        const auto directory = resolved->parent_path();
+        for (std::size_t index = 0; index < bank->soundCount(); ++index) {
+            const std::string name(bank->sound(index).name);
+            const auto path = (directory / name).lexically_normal();
+            st.bankedSounds.try_emplace(canonicalizeKey(name),
+                                        ManagerState::BankedSound{bank, index, canonicalizePath(path), path.string()});
+        }
+        LogManager::info("AudioManager mounted sound bank '{}' ({} sounds)", resolved->string(), bank->soundCount());
+        st.soundBanks.push_back(std::move(bank));
+    }
+}
 
-    s.preloadMusic = ConfigurationManager::getStringList("audio.preload.music", {});
+const ManagerState::BankedSound* findBankedSound(const ManagerState& st, const std::string& identifier) {
+    if (st.bankedSounds.empty()) {
+        return nullptr;
+    }
+    auto it = st.bankedSounds.find(canonicalizeKey(identifier));
+    return it != st.bankedSounds.end() ? &it->second : nullptr;
+}
 
-    auto soundAliasMap = ConfigurationManager::getStringMap("audio.preload.sound_aliases", {});
-    for (const auto& [rawKey, rawAlias] : soundAliasMap) {
-        std::string canonical = canonicalizeConfigIdentifier(rawKey);
-        std::string trimmedAlias = trimCopy(rawAlias);
-        if (!canonical.empty() && !trimmedAlias.empty()) {
-            s.preloadSoundAliases[canonical] = trimmedAlias;
-        }
+// Loads a banked sound into `record` straight from the mapping: converted to float for the mixer,
+// or handed to raylib as an in-memory wave, which raylib copies into its own buffer.
+bool loadBankedSoundLocked(ManagerState& st,
+                           const std::string& key,
+                           SoundRecord& record,
+                           const AudioManager::RaylibHooks& api,
+                           const ManagerState::BankedSound& banked) {
+    const SoundBankSound sound = banked.bank->sound(banked.index);
+    if (sound.frameCount == 0) {
+        return false;
     }
-    auto musicAliasMap = ConfigurationManager::getStringMap("audio.preload.music_aliases", {});
-    for (const auto& [rawKey, rawAlias] : musicAliasMap) {
-        std::string canonical = canonicalizeConfigIdentifier(rawKey);
-        std::string trimmedAlias = trimCopy(rawAlias);
-        if (!canonical.empty() && !trimmedAlias.empty()) {
-            s.preloadMusicAliases[canonical] = trimmedAlias;
+    if (st.mixer) {
+        auto pcm = std::make_shared<PcmBuffer>();
+        pcm->sampleRate = sound.sampleRate;
+        pcm->channels = std::min(sound.channels, 2u);
+        pcm->samples.resize(static_cast<std::size_t>(sound.frameCount) * pcm->channels);
+        for (std::size_t frame = 0; frame < sound.frameCount; ++frame) {
+            for (std::uint32_t channel = 0; channel < pcm->channels; ++channel) {
+                // Same scale as raylib's LoadWaveSamples, so banked and file sounds mix identically.
+                pcm->samples[frame * pcm->channels + channel] =
+                    static_cast<float>(sound.samples[frame * sound.channels + channel]) / 32768.0f;
+            }
+        }
+        record.pcm = std::move(pcm);
+    } else {
+        Wave wave{};
+        wave.frameCount = sound.frameCount;
+        wave.sampleRate = sound.sampleRate;
+        wave.sampleSize = 16;
+        wave.channels = sound.channels;
+        wave.data = const_cast<std::int16_t*>(sound.samples);
+        Sound handle = api.loadSoundFromWave(wave);
+        if (!isSoundValid(handle)) {
+            return false;
         }
+        record.sound = handle;
     }
-    return s;
+    record.bank = banked.bank;
+    record.placeholder = false;
+    prewarmAliasPool(st, key, record, api);
+    return true;
 }
 
-AudioConfig toConfig(const Settings& s, bool initialized, bool deviceReady, bool silentMode) {
-    AudioConfig cfg;
-    cfg.enabled = s.enabled;
-    cfg.diagnosticsLoggingEnabled = s.diagnosticsLoggingEnabled;
-    cfg.masterVolume = s.masterVolume;
-    cfg.musicVolume = s.musicVolume;
-    cfg.sfxVolume = s.sfxVolume;
-    cfg.maxConcurrentSounds = s.maxConcurrentSounds;
-    cfg.searchPaths.reserve(s.searchPaths.size());
-    for (const auto& p : s.searchPaths) {
-        cfg.searchPaths.emplace_back(p.generic_string());
+void rememberVoicePeak(ManagerState& st, const std::string& key, const SoundRecord& record) {
+    if (record.peakVoices > 0) {
+        auto& peak = st.voicePeaks[key];
+        peak = std::max(peak, record.peakVoices);
     }
-    cfg.preloadSounds = s.preloadSounds;
-    cfg.preloadMusic = s.preloadMusic;
-    cfg.soundAliases = s.preloadSoundAliases;
-    cfg.musicAliases = s.preloadMusicAliases;
-    (void)initialized;
-    (void)deviceReady;
-    (void)silentMode;
-    return cfg;
 }
 
-} // namespace
-
-bool AudioManager::init() {
-    auto& st = state();
-    std::unique_lock<std::mutex> lock(st.mutex);
-    if (st.initialized) {
-        return st.deviceReady && !st.silentMode;
+// Decode-on-demand applies to compressed formats only: keeping a WAV file's bytes would save
+// nothing over its decoded samples.
+std::string encodedFileType(const std::string& path) {
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (extension == ".ogg" || extension == ".mp3" || extension == ".flac" || extension == ".qoa") {
+        return extension;
     }
+    return {};
+}
 
-    st.settings = loadSettings();
-    ensureSoundSlotCapacity(st);
-    st.publishedConfig = toConfig(st.settings, true, false, false);
+bool canDecodeOnDemand(const ManagerState& st, const AudioManager::RaylibHooks& api, const std::string& path) {
+    if (st.settings.decodeOnDemandSeconds <= 0.0f || !api.loadWaveFromMemory || !api.unloadWave) {
+        return false;
+    }
+    if (st.mixer ? !api.loadWaveSamples : !api.loadSoundFromWave) {
+        return false;
+    }
+    return !encodedFileType(path).empty();
+}
+
+std::vector<unsigned char> readFileBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return {};
+    }
+    const auto size = static_cast<std::streamsize>(file.tellg());
+    std::vector<unsigned char> bytes(static_cast<std::size_t>(std::max<std::streamsize>(size, 0)));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        return {};
+    }
+    return bytes;
+}
+
+bool decodeWaveIntoRecord(ManagerState& st,
+                          const std::string& key,
+                          SoundRecord& record,
+                          const AudioManager::RaylibHooks& api,
+                          const Wave& wave) {
+    if (st.mixer) {
+        record.pcm = pcmFromWave(api, wave);
+        return record.pcm != nullptr;
+    }
+    Sound handle = api.loadSoundFromWave(wave);
+    if (!isSoundValid(handle)) {
+        return false;
+    }
+    record.sound = handle;
+    prewarmAliasPool(st, key, record, api);
+    return true;
+}
+
+// Reads an encoded file and decodes it once to learn its length. Sounds longer than
+// audio.memory.decode_on_demand_seconds keep only the file's bytes until they are played; shorter
+// ones keep the decoded copy, as any other sound.
+bool loadSoundForDecodeOnDemand(ManagerState& st,
+                                const std::string& key,
+                                SoundRecord& record,
+                                const AudioManager::RaylibHooks& api,
+                                const std::string& path) {
+    auto bytes = readFileBytes(path);
+    if (bytes.empty()) {
+        return false;
+    }
+    const std::string fileType = encodedFileType(path);
+    Wave wave = api.loadWaveFromMemory(fileType.c_str(), bytes.data(), static_cast<int>(bytes.size()));
+    if (wave.data == nullptr || wave.frameCount == 0 || wave.sampleRate == 0) {
+        return false;
+    }
+    const float seconds = static_cast<float>(wave.frameCount) / static_cast<float>(wave.sampleRate);
+    bool loaded = true;
+    if (seconds > st.settings.decodeOnDemandSeconds) {
+        record.encoded = std::move(bytes);
+        record.encodedType = fileType;
+        record.encodedFrames = wave.frameCount;
+        record.encodedSampleRate = wave.sampleRate;
+        record.encodedChannels = wave.channels;
+    } else {
+        loaded = decodeWaveIntoRecord(st, key, record, api, wave);
+    }
+    api.unloadWave(wave);
+    record.placeholder = !loaded;
+    return loaded;
+}
+
+// First play of a decode-on-demand sound, or the first since the budget dropped its decoded copy.
+bool decodeOnDemandLocked(ManagerState& st, const std::string& key, SoundRecord& record, const AudioManager::RaylibHooks& api) {
+    Wave wave = api.loadWaveFromMemory(record.encodedType.c_str(), record.encoded.data(), static_cast<int>(record.encoded.size()));
+    if (wave.data == nullptr || wave.frameCount == 0) {
+        return false;
+    }
+    const bool decoded = decodeWaveIntoRecord(st, key, record, api, wave);
+    api.unloadWave(wave);
+    if (decoded) {
+        st.soundsDecodedOnDemand++;
+    }
+    return decoded;
+}
+
+// Frees an idle decode-on-demand sound's decoded copy; its encoded file stays for the next play.
+void dropDecodedSound(SoundRecord& record, const AudioManager::RaylibHooks& api) {
+    for (const auto& alias : record.aliasPool) {
+        api.unloadSoundAlias(alias);
+    }
+    record.aliasPool.clear();
+    if (isSoundValid(record.sound)) {
+        api.unloadSound(record.sound);
+    }
+    record.sound = Sound{};
+    record.pcm.reset();
+}
+
+std::size_t audioMemoryBytesLocked(const ManagerState& st) {
+    std::size_t bytes = 0;
+    for (const auto& [key, record] : st.sounds) {
+        (void)key;
+        bytes += soundRecordBytes(record);
+    }
+    for (const auto& [key, record] : st.music) {
+        (void)key;
+        bytes += musicRecordBytes(record);
+    }
+    return bytes;
+}
+
+// Brings audio memory under audio.memory.max_bytes: released sounds are evicted least recently
+// released first, then idle decode-on-demand sounds give up their decoded copies, least recently
+// played first. `keep` (a sound about to be played) is spared. Referenced sounds and music are
+// never unloaded, so the budget can still be exceeded; that is reported once.
+void enforceMemoryBudgetLocked(ManagerState& st, const AudioManager::RaylibHooks& api, const SoundRecord* keep = nullptr) {
+    const std::size_t budget = st.settings.memoryBudgetBytes;
+    if (budget == 0) {
+        return;
+    }
+    std::size_t total = audioMemoryBytesLocked(st);
+    while (total > budget && !st.soundLru.empty()) {
+        const std::string key = std::move(st.soundLru.front());
+        st.soundLru.pop_front();
+        auto it = st.sounds.find(key);
+        if (it == st.sounds.end()) {
+            continue;
+        }
+        const std::size_t bytes = soundRecordBytes(it->second);
+        LogManager::debug("AudioManager evicting released sound '{}' ({} bytes)", key, bytes);
+        rememberVoicePeak(st, key, it->second);
+        unloadSoundRecord(it->second, api);
+        st.sounds.erase(it);
+        publishAudioEvent(AudioEventType::SoundUnloaded, key, "evicted");
+        st.soundsEvicted++;
+        st.evictedSoundBytes += bytes;
+        total -= std::min(total, bytes);
+    }
+    if (total > budget) {
+        std::vector<SoundRecord*> idle;
+        for (auto& [key, record] : st.sounds) {
+            (void)key;
+            if (&record != keep && !record.encoded.empty() && isSoundDecoded(record) && record.activeVoices == 0) {
+                idle.push_back(&record);
+            }
+        }
+        std::sort(idle.begin(), idle.end(), [](const SoundRecord* a, const SoundRecord* b) { return a->lastPlayed < b->lastPlayed; });
+        for (auto* record : idle) {
+            if (total <= budget) {
+                break;
+            }
+            const std::size_t bytes = decodedSoundBytes(*record);
+            dropDecodedSound(*record, api);
+            st.decodedSoundsDropped++;
+            total -= std::min(total, bytes);
+        }
+    }
+    if (total > budget && !st.overBudgetNotified) {
+        LogManager::warn("Audio memory budget exceeded: {} bytes > configured cap {} bytes (all resident audio is in use)",
+                         total,
+                         budget);
+        st.overBudgetNotified = true;
+    }
+}
+
+void stopMusicRecord(ManagerState& st, const AudioManager::RaylibHooks& api, MusicRecord& record) {
+    if (!record.placeholder && isMusicValid(record.music)) {
+        api.stopMusicStream(record.music);
+    }
+    if (record.voice != 0 && st.mixer) {
+        st.mixer->stopVoice(record.voice);
+    }
+    record.voice = 0;
+    record.playing = false;
+    record.paused = false;
+    record.lastServiced = {};
+}
+
+// Loads a raylib music stream with audio.music.buffer_frames of buffering, then restores raylib's
+// default so other streams are unaffected.
+Music loadMusicStreamBuffered(const ManagerState& st, const AudioManager::RaylibHooks& api, const std::string& path) {
+    if (api.setAudioStreamBufferSizeDefault) {
+        api.setAudioStreamBufferSizeDefault(static_cast<int>(st.settings.musicBufferFrames));
+    }
+    Music music = api.loadMusicStream(path.c_str());
+    if (api.setAudioStreamBufferSizeDefault) {
+        api.setAudioStreamBufferSizeDefault(0);
+    }
+    return music;
+}
+
+float musicBufferedSeconds(const ManagerState& st, const Music& music) {
+    if (music.stream.sampleRate == 0) {
+        return 0.0f;
+    }
+    return static_cast<float>(st.settings.musicBufferFrames) / static_cast<float>(music.stream.sampleRate);
+}
+
+std::vector<std::filesystem::path> loadSearchPaths() {
+    auto paths = ConfigurationManager::getStringList("audio.engine.search_paths", {"assets/audio"});
+    return std::vector<std::filesystem::path>(paths.begin(), paths.end());
+}
+
+VoiceStealPolicy parseStealPolicy(const std::string& value) {
+    const auto policy = canonicalizeConfigIdentifier(value);
+    if (policy == "none") {
+        return VoiceStealPolicy::None;
+    }
+    if (policy == "oldest") {
+        return VoiceStealPolicy::Oldest;
+    }
+    if (policy == "quietest") {
+        return VoiceStealPolicy::Quietest;
+    }
+    if (policy != "lowest_priority") {
+        LogManager::warn("Unknown audio.engine.steal_policy '{}'; using 'lowest_priority'", value);
+    }
+    return VoiceStealPolicy::LowestPriority;
+}
+
+AttenuationCurve parseAttenuationCurve(const std::string& value) {
+    const auto curve = canonicalizeConfigIdentifier(value);
+    if (curve == "none") {
+        return AttenuationCurve::None;
+    }
+    if (curve == "inverse") {
+        return AttenuationCurve::Inverse;
+    }
+    if (curve == "exponential") {
+        return AttenuationCurve::Exponential;
+    }
+    if (curve != "linear") {
+        LogManager::warn("Unknown audio.spatial.curve '{}'; using 'linear'", value);
+    }
+    return AttenuationCurve::Linear;
+}
+
+// audio.engine.voices: { "<identifier or alias>": { "priority": 10, "max_instances": 2, "bus": "ui" } }
+std::unordered_map<std::string, SoundVoiceSettings> loadVoiceSettings() {
+    std::unordered_map<std::string, SoundVoiceSettings> voices;
+    const auto& root = ConfigurationManager::raw();
+    if (!root.is_object()) {
+        return voices;
+    }
+    const auto audioIt = root.find("audio");
+    if (audioIt == root.end() || !audioIt->is_object()) {
+        return voices;
+    }
+    const auto engineIt = audioIt->find("engine");
+    if (engineIt == audioIt->end() || !engineIt->is_object()) {
+        return voices;
+    }
+    const auto voicesIt = engineIt->find("voices");
+    if (voicesIt == engineIt->end() || !voicesIt->is_object()) {
+        return voices;
+    }
+    for (const auto& [identifier, entry] : voicesIt->items()) {
+        if (!entry.is_object()) {
+            LogManager::warn("audio.engine.voices entry '{}' is not an object; ignoring it", identifier);
+            continue;
+        }
+        SoundVoiceSettings voice;
+        if (auto it = entry.find("priority"); it != entry.end() && it->is_number_integer()) {
+            voice.priority = it->get<int>();
+        }
+        if (auto it = entry.find("max_instances"); it != entry.end() && it->is_number_integer()) {
+            voice.maxInstances = static_cast<std::size_t>(std::max<std::int64_t>(0, it->get<std::int64_t>()));
+        }
+        if (auto it = entry.find("bus"); it != entry.end() && it->is_string()) {
+            voice.bus = canonicalizeConfigIdentifier(it->get<std::string>());
+        }
+        voices[canonicalizeConfigIdentifier(identifier)] = voice;
+    }
+    return voices;
+}
+
+MixerOutputMode parseMixerOutput(const std::string& value) {
+    const auto output = canonicalizeConfigIdentifier(value);
+    if (output == "offline") {
+        return MixerOutputMode::Offline;
+    }
+    if (output != "device") {
+        LogManager::warn("Unknown audio.mixer.output '{}'; using 'device'", value);
+    }
+    return MixerOutputMode::Device;
+}
+
+std::optional<MixerEffectType> parseMixerEffectType(const std::string& value) {
+    const auto type = canonicalizeConfigIdentifier(value);
+    if (type == "low_pass") {
+        return MixerEffectType::LowPass;
+    }
+    if (type == "compressor") {
+        return MixerEffectType::Compressor;
+    }
+    if (type == "reverb") {
+        return MixerEffectType::Reverb;
+    }
+    return std::nullopt;
+}
+
+// audio.mixer.buses: { "<bus>": { "parent": "master", "gain": 1.0, "muted": false, "solo": false,
+//                                 "effects": [ { "type": "low_pass", "cutoff_hz": 2000 } ] } }
+// The built-in master, music, sfx and ui buses may be listed to set their gain and effects.
+std::vector<MixerBusConfig> loadMixerBuses() {
+    std::vector<MixerBusConfig> buses;
+    const auto& root = ConfigurationManager::raw();
+    if (!root.is_object()) {
+        return buses;
+    }
+    const auto audioIt = root.find("audio");
+    if (audioIt == root.end() || !audioIt->is_object()) {
+        return buses;
+    }
+    const auto mixerIt = audioIt->find("mixer");
+    if (mixerIt == audioIt->end() || !mixerIt->is_object()) {
+        return buses;
+    }
+    const auto busesIt = mixerIt->find("buses");
+    if (busesIt == mixerIt->end() || !busesIt->is_object()) {
+        return buses;
+    }
+    const auto readFloat = [](const auto& object, const char* name, float& target) {
+        if (auto it = object.find(name); it != object.end() && it->is_number()) {
+            target = it->template get<float>();
+        }
+    };
+    const auto readBool = [](const auto& object, const char* name, bool& target) {
+        if (auto it = object.find(name); it != object.end() && it->is_boolean()) {
+            target = it->template get<bool>();
+        }
+    };
+    for (const auto& [name, entry] : busesIt->items()) {
+        if (!entry.is_object()) {
+            LogManager::warn("audio.mixer.buses entry '{}' is not an object; ignoring it", name);
+            continue;
+        }
+        MixerBusConfig bus;
+        bus.name = canonicalizeConfigIdentifier(name);
+        if (auto it = entry.find("parent"); it != entry.end() && it->is_string()) {
+            bus.parent = canonicalizeConfigIdentifier(it->get<std::string>());
+        }
+        readFloat(entry, "gain", bus.settings.gain);
+        readBool(entry, "muted", bus.settings.muted);
+        readBool(entry, "solo", bus.settings.solo);
+        if (auto effectsIt = entry.find("effects"); effectsIt != entry.end() && effectsIt->is_array()) {
+            for (const auto& effectEntry : *effectsIt) {
+                const auto typeIt = effectEntry.is_object() ? effectEntry.find("type") : effectEntry.end();
+                const auto type = typeIt != effectEntry.end() && typeIt->is_string()
+                    ? parseMixerEffectType(typeIt->get<std::string>())
+                    : std::nullopt;
+                if (!type) {
+                    LogManager::warn("audio.mixer.buses.{} has an effect without a known type; ignoring it", name);
+                    continue;
+                }
+                MixerEffectSettings effect;
+                effect.type = *type;
+                readBool(effectEntry, "bypass", effect.bypass);
+                readFloat(effectEntry, "cutoff_hz", effect.cutoffHz);
+                readFloat(effectEntry, "resonance", effect.resonance);
+                readFloat(effectEntry, "threshold_db", effect.thresholdDb);
+                readFloat(effectEntry, "ratio", effect.ratio);
+                readFloat(effectEntry, "attack_ms", effect.attackMs);
+                readFloat(effectEntry, "release_ms", effect.releaseMs);
+                readFloat(effectEntry, "makeup_db", effect.makeupDb);
+                readFloat(effectEntry, "room_size", effect.roomSize);
+                readFloat(effectEntry, "damping", effect.damping);
+                readFloat(effectEntry, "wet", effect.wet);
+                bus.effects.push_back(effect);
+            }
+        }
+        buses.push_back(std::move(bus));
+    }
+    return buses;
+}
+
+// Config entries may name a sound by alias, by the identifier it was acquired with, or by its key.
+SoundVoiceSettings voiceSettingsFor(const Settings& settings, const std::string& key, const std::string& identifier) {
+    for (const auto& candidate : {key, canonicalizeConfigIdentifier(identifier)}) {
+        if (auto it = settings.voices.find(candidate); it != settings.voices.end()) {
+            return it->second;
+        }
+    }
+    return {};
+}
+
+Settings loadSettings() {
+    Settings s;
+    s.enabled = ConfigurationManager::getBool("audio.core.enabled", true);
+
+    s.diagnosticsLoggingEnabled = ConfigurationManager::getBool("audio.core.diagnostics_logging", true);
+
+    s.coalesceEvents = ConfigurationManager::getBool("audio.core.coalesce_events", false);
+
+    s.masterVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.master", 1.0), 0.0, 1.0);
+
+    s.musicVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.music", 1.0), 0.0, 1.0);
+
+    s.sfxVolume = std::clamp(ConfigurationManager::getDouble("audio.volumes.sfx", 1.0), 0.0, 1.0);
+
+    auto maxSlots = ConfigurationManager::getInt("audio.engine.max_concurrent_sounds", 16);
+    if (maxSlots < 0) maxSlots = 0;
+    s.maxConcurrentSounds = static_cast<std::size_t>(maxSlots);
+
+    auto poolSize = ConfigurationManager::getInt("audio.engine.alias_pool_size", 2);
+    if (poolSize < 0) poolSize = 0;
+    s.aliasPoolSize = static_cast<std::size_t>(poolSize);
+
+    s.stealPolicy = parseStealPolicy(ConfigurationManager::getString("audio.engine.steal_policy", "lowest_priority"));
+
+    s.voices = loadVoiceSettings();
+
+    s.mixerEnabled = ConfigurationManager::getBool("audio.mixer.enabled", false);
+
+    auto mixerRate = ConfigurationManager::getInt("audio.mixer.sample_rate", 48000);
+    s.mixerSampleRate = static_cast<std::uint32_t>(std::clamp<std::int64_t>(mixerRate, 8000, 192000));
+
+    s.mixerOutput = parseMixerOutput(ConfigurationManager::getString("audio.mixer.output", "device"));
+
+    s.mixerBuses = loadMixerBuses();
+
+    s.musicStreamThread = ConfigurationManager::getBool("audio.music.stream_thread", true);
+
+    auto bufferFrames = ConfigurationManager::getInt("audio.music.buffer_frames", 4096);
+    s.musicBufferFrames = static_cast<std::uint32_t>(std::clamp<std::int64_t>(bufferFrames, 256, 65536));
+
+    auto updateInterval = ConfigurationManager::getInt("audio.music.update_interval_ms", 5);
+    s.musicUpdateIntervalMs = static_cast<std::uint32_t>(std::clamp<std::int64_t>(updateInterval, 1, 100));
+
+    s.spatial.curve = parseAttenuationCurve(ConfigurationManager::getString("audio.spatial.curve", "linear"));
+
+    s.spatial.minDistance = static_cast<float>(std::max(ConfigurationManager::getDouble("audio.spatial.min_distance", 64.0), 0.0));
+
+    s.spatial.maxDistance = static_cast<float>(
+        std::max(ConfigurationManager::getDouble("audio.spatial.max_distance", 1024.0), static_cast<double>(s.spatial.minDistance)));
+
+    s.spatial.rolloff = static_cast<float>(std::clamp(ConfigurationManager::getDouble("audio.spatial.rolloff", 1.0), 0.0, 10.0));
+
+    s.spatialCullVolume = static_cast<float>(std::clamp(ConfigurationManager::getDouble("audio.spatial.cull_volume", 0.001), 0.0, 1.0));
+
+    s.memoryBudgetBytes = static_cast<std::size_t>(std::max<std::int64_t>(ConfigurationManager::getInt("audio.memory.max_bytes", 0), 0));
+
+    s.decodeOnDemandSeconds = static_cast<float>(std::max(ConfigurationManager::getDouble("audio.memory.decode_on_demand_seconds", 0.0), 0.0));
+
+    s.searchPaths = loadSearchPaths();
+
+    s.preloadSounds = ConfigurationManager::getStringList("audio.preload.sounds", {});
+
+    s.preloadMusic = ConfigurationManager::getStringList("audio.preload.music", {});
+
+    s.soundBanks = ConfigurationManager::getStringList("audio.preload.sound_banks", {});
+
+    auto soundAliasMap = ConfigurationManager::getStringMap("audio.preload.sound_aliases", {});
+    for (const auto& [rawKey, rawAlias] : soundAliasMap) {
+        std::string canonical = canonicalizeConfigIdentifier(rawKey);
+        std::string trimmedAlias = trimCopy(rawAlias);
+        if (!canonical.empty() && !trimmedAlias.empty()) {
+            s.preloadSoundAliases[canonical] = trimmedAlias;
+        }
+    }
+    auto musicAliasMap = ConfigurationManager::getStringMap("audio.preload.music_aliases", {});
+    for (const auto& [rawKey, rawAlias] : musicAliasMap) {
+        std::string canonical = canonicalizeConfigIdentifier(rawKey);
+        std::string trimmedAlias = trimCopy(rawAlias);
+        if (!canonical.empty() && !trimmedAlias.empty()) {
+            s.preloadMusicAliases[canonical] = trimmedAlias;
+        }
+    }
+    return s;
+}
+
+AudioConfig toConfig(const Settings& s, bool initialized, bool deviceReady, bool silentMode) {
+    AudioConfig cfg;
+    cfg.enabled = s.enabled;
+    cfg.diagnosticsLoggingEnabled = s.diagnosticsLoggingEnabled;
+    cfg.coalesceEvents = s.coalesceEvents;
+    cfg.masterVolume = s.masterVolume;
+    cfg.musicVolume = s.musicVolume;
+    cfg.sfxVolume = s.sfxVolume;
+    cfg.maxConcurrentSounds = s.maxConcurrentSounds;
+    cfg.aliasPoolSize = s.aliasPoolSize;
+    cfg.stealPolicy = s.stealPolicy;
+    cfg.mixerEnabled = s.mixerEnabled;
+    cfg.mixerSampleRate = s.mixerSampleRate;
+    cfg.mixerOutput = s.mixerOutput;
+    cfg.musicStreamThread = s.musicStreamThread;
+    cfg.musicBufferFrames = s.musicBufferFrames;
+    cfg.musicUpdateIntervalMs = s.musicUpdateIntervalMs;
+    cfg.spatial = s.spatial;
+    cfg.spatialCullVolume = s.spatialCullVolume;
+    cfg.memoryBudgetBytes = s.memoryBudgetBytes;
+    cfg.decodeOnDemandSeconds = s.decodeOnDemandSeconds;
+    cfg.searchPaths.reserve(s.searchPaths.size());
+    for (const auto& p : s.searchPaths) {
+        cfg.searchPaths.emplace_back(p.generic_string());
+    }
+    cfg.preloadSounds = s.preloadSounds;
+    cfg.soundBanks = s.soundBanks;
+    cfg.preloadMusic = s.preloadMusic;
+    cfg.soundAliases = s.preloadSoundAliases;
+    cfg.musicAliases = s.preloadMusicAliases;
+    (void)initialized;
+    (void)deviceReady;
+    (void)silentMode;
+    return cfg;
+}
+
+// Reload hook: picks up audio.engine.search_paths edits without a restart. Resolved identifiers
+// are dropped only when the roots actually changed.
+void applySearchPathsFromConfig() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.initialized) {
+        return;
+    }
+    auto paths = loadSearchPaths();
+    if (st.resolver.setSearchPaths(paths)) {
+        st.settings.searchPaths = std::move(paths);
+        st.publishedConfig = toConfig(st.settings, st.initialized, st.deviceReady, st.silentMode);
+        LogManager::info("Audio search paths changed ({} roots); path cache cleared", st.settings.searchPaths.size());
+    }
+}
+
+// Reload hook: steal policy and per-sound voice settings apply to the next playSound. Sounds whose
+// settings were overridden at runtime keep the override.
+void applyVoiceSettingsFromConfig() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.initialized) {
+        return;
+    }
+    st.settings.stealPolicy = parseStealPolicy(ConfigurationManager::getString("audio.engine.steal_policy", "lowest_priority"));
+    st.settings.voices = loadVoiceSettings();
+    for (auto& [key, record] : st.sounds) {
+        if (!record.voiceOverridden) {
+            record.voice = voiceSettingsFor(st.settings, key, record.originalIdentifier);
+        }
+    }
+    st.publishedConfig = toConfig(st.settings, st.initialized, st.deviceReady, st.silentMode);
+}
+
+// Reload hook: bus layout, gains and effects apply to the running mixer. Turning the mixer on or
+// off, or changing its rate or output, takes effect on the next init().
+void applyMixerBusesFromConfig() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.initialized || !st.mixer) {
+        return;
+    }
+    st.settings.mixerBuses = loadMixerBuses();
+    applyMixerBusesLocked(st);
+}
+
+float distanceToListener(const ManagerState& st, Vector2 position) {
+    return std::hypot(position.x - st.listener.position.x, position.y - st.listener.position.y);
+}
+
+// Derives a positional voice's volume and pan from its emitter and the listener.
+void spatializeSlot(const ManagerState& st, ManagerState::SoundSlot& slot) {
+    slot.volume = clamp01(slot.baseVolume * spatialGain(slot.spatial, distanceToListener(st, slot.position)));
+    slot.pan = spatialPan(st.listener, slot.position);
+}
+
+// `position` is set for playSoundAt.
+PlaybackHandle playSoundLocked(ManagerState& st,
+                               const std::string& canonical,
+                               const PlaybackParams& params,
+                               const Vector2* position = nullptr) {
+    if (!st.initialized) {
+        LogManager::warn("AudioManager::playSound called before initialization (key='{}')", canonical);
+        return {};
+    }
+
+    auto it = st.sounds.find(canonical);
+    // Released sounds kept resident for the memory budget are not playable until acquired again.
+    if (it == st.sounds.end() || it->second.refCount == 0) {
+        LogManager::warn("AudioManager::playSound unknown key '{}'", canonical);
+        return {};
+    }
+
+    auto& record = it->second;
+
+    if (!isSoundPlayable(record)) {
+        LogManager::warn("AudioManager::playSound using placeholder sound for key '{}'", canonical);
+        return {};
+    }
+
+    if (st.silentMode || !st.deviceReady) {
+        LogManager::debug("AudioManager::playSound silent mode; suppressing playback for '{}'", canonical);
+        return {};
+    }
+
+    if (st.soundSlots.empty()) {
+        LogManager::warn("AudioManager::playSound dropped '{}' (maxConcurrentSounds=0)", canonical);
+        return {};
+    }
+
+    const float baseVolume = clamp01(params.volume);
+    float volume = baseVolume;
+    float pan = clampPan(params.pan);
+    SpatialSettings spatial{};
+    if (position) {
+        // Culled before scheduling, so an inaudible sound never takes or steals a slot.
+        spatial = params.spatial.value_or(st.settings.spatial);
+        volume = clamp01(baseVolume * spatialGain(spatial, distanceToListener(st, *position)));
+        if (volume <= 0.0f || volume < st.settings.spatialCullVolume) {
+            st.spatialCulled++;
+            return {};
+        }
+        pan = spatialPan(st.listener, *position);
+    }
+
+    const auto& api = hooks(st);
+    if (!isSoundDecoded(record)) {
+        if (!decodeOnDemandLocked(st, canonical, record, api)) {
+            LogManager::error("AudioManager::playSound failed to decode '{}'", canonical);
+            return {};
+        }
+        LogManager::debug("AudioManager decoded '{}' on first play ({} bytes)", canonical, decodedSoundBytes(record));
+        enforceMemoryBudgetLocked(st, api, &record);
+    }
+    refreshSoundSlotsLocked(st, api);
+
+    const int priority = params.priority.value_or(record.voice.priority);
+    const auto schedule = scheduleVoiceLocked(st, canonical, priority, record.voice.maxInstances);
+    if (schedule.decision == VoiceDecision::InstanceCap) {
+        st.instanceCapHits++;
+        st.voicesDropped++;
+        LogManager::debug("AudioManager::playSound throttled '{}': {} instances already playing",
+                          canonical,
+                          record.voice.maxInstances);
+        return {};
+    }
+    if (schedule.decision == VoiceDecision::PoolFull) {
+        st.voicesDropped++;
+        LogManager::debug("AudioManager::playSound throttled '{}' (priority {}): active={} max={}",
+                          canonical,
+                          priority,
+                          st.activeSoundInstances,
+                          st.soundSlots.size());
+        return {};
+    }
+
+    auto& slot = st.soundSlots[schedule.index];
+    if (schedule.decision == VoiceDecision::Steal || schedule.decision == VoiceDecision::StealInstance) {
+        // The slot keeps its index but takes a new generation below, so handles to the stolen
+        // voice stop matching. A retriggered voice returns its alias to the pool we draw from next.
+        if (schedule.decision == VoiceDecision::StealInstance) {
+            st.instanceCapHits++;
+        }
+        publishAudioEvent(AudioEventType::SoundPlaybackStopped, slot.key, "stolen");
+        releaseSoundSlot(st, slot, api);
+        st.voicesStolen++;
+    } else {
+        st.activeSoundInstances = std::min<std::size_t>(st.activeSoundInstances + 1, st.soundSlots.size());
+    }
+
+    float finalVolume = clamp01(volume * st.settings.sfxVolume);
+    float pitch = clampPitch(params.pitch);
+    Sound alias{};
+    MixerVoiceId voice = 0;
+    if (record.pcm && st.mixer) {
+        voice = st.mixer->startVoice(record.pcm, soundBus(record), MixerVoiceParams{finalVolume, pan, pitch});
+        if (voice == 0) {
+            LogManager::error("AudioManager::playSound failed to start a mixer voice for '{}'", canonical);
+            st.activeSoundInstances--;
+            return {};
+        }
+    } else {
+        alias = takePooledAlias(st, record, api);
+        if (!isSoundValid(alias)) {
+            LogManager::error("AudioManager::playSound failed to create alias for '{}'", canonical);
+            st.activeSoundInstances--;
+            return {};
+        }
+        api.setSoundVolume(alias, finalVolume);
+        api.setSoundPitch(alias, pitch);
+        api.setSoundPan(alias, pan);
+        api.playSound(alias);
+    }
+    record.activeVoices++;
+    record.peakVoices = std::max(record.peakVoices, record.activeVoices);
+
+    slot.alias = alias;
+    slot.voice = voice;
+    slot.key = canonical;
+    slot.active = true;
+    slot.placeholder = false;
+    slot.generation = st.generationCounter++;
+    slot.volume = volume;
+    slot.pitch = pitch;
+    slot.pan = pan;
+    slot.priority = priority;
+    slot.startedSequence = ++st.playSequence;
+    record.lastPlayed = slot.startedSequence;
+    slot.positional = position != nullptr;
+    slot.emitterMoved = false;
+    slot.position = position ? *position : Vector2{0.0f, 0.0f};
+    slot.baseVolume = baseVolume;
+    slot.spatial = spatial;
+
+    return PlaybackHandle{static_cast<int>(schedule.index), slot.generation};
+}
+
+bool stopSoundLocked(ManagerState& st, PlaybackHandle handle) {
+    if (!handle.valid()) {
+        return false;
+    }
+
+    if (!st.initialized) {
+        return false;
+    }
+
+    const auto index = static_cast<std::size_t>(handle.slot);
+    if (index >= st.soundSlots.size()) {
+        return false;
+    }
+
+    auto& slot = st.soundSlots[index];
+    if (!slot.active || slot.generation != handle.generation) {
+        return false;
+    }
+
+    const auto& api = hooks(st);
+    releaseSoundSlot(st, slot, api);
+    refreshSoundSlotsLocked(st, api);
+    return true;
+}
+
+bool updateSoundPlaybackLocked(ManagerState& st, PlaybackHandle handle, const PlaybackParams& params) {
+    if (!handle.valid()) {
+        return false;
+    }
+
+    if (!st.initialized) {
+        return false;
+    }
+
+    const auto index = static_cast<std::size_t>(handle.slot);
+    if (index >= st.soundSlots.size()) {
+        return false;
+    }
+
+    auto& slot = st.soundSlots[index];
+    if (!slot.active || slot.generation != handle.generation) {
+        return false;
+    }
+
+    const auto& api = hooks(st);
+    if (slot.voice == 0 && !isSoundValid(slot.alias)) {
+        return false;
+    }
+
+    slot.pitch = clampPitch(params.pitch);
+    if (slot.positional) {
+        // The emitter keeps deciding pan and attenuation; params.volume is the volume at the source.
+        slot.baseVolume = clamp01(params.volume);
+        spatializeSlot(st, slot);
+    } else {
+        slot.volume = clamp01(params.volume);
+        slot.pan = clampPan(params.pan);
+    }
+
+    if (slot.voice != 0) {
+        return st.mixer && st.mixer->setVoiceParams(
+            slot.voice, MixerVoiceParams{clamp01(slot.volume * st.settings.sfxVolume), slot.pan, slot.pitch});
+    }
+    api.setSoundVolume(slot.alias, clamp01(slot.volume * st.settings.sfxVolume));
+    api.setSoundPitch(slot.alias, slot.pitch);
+    api.setSoundPan(slot.alias, slot.pan);
+    return true;
+}
+
+// Records where a positional voice's emitter is; tick() applies it.
+bool setSoundPositionLocked(ManagerState& st, PlaybackHandle handle, Vector2 position) {
+    if (!handle.valid() || !st.initialized) {
+        return false;
+    }
+    const auto index = static_cast<std::size_t>(handle.slot);
+    if (index >= st.soundSlots.size()) {
+        return false;
+    }
+    auto& slot = st.soundSlots[index];
+    if (!slot.active || slot.generation != handle.generation || !slot.positional) {
+        return false;
+    }
+    slot.position = position;
+    slot.emitterMoved = true;
+    return true;
+}
+
+// One pass over the voices: re-spatializes those whose emitter moved, or all positional voices
+// after a listener move, and pushes only the volumes and pans that changed.
+void updateSpatialVoicesLocked(ManagerState& st, const AudioManager::RaylibHooks& api) {
+    const bool listenerMoved = st.listenerMoved;
+    st.listenerMoved = false;
+    for (auto& slot : st.soundSlots) {
+        if (!slot.active || !slot.positional || !(listenerMoved || slot.emitterMoved)) {
+            continue;
+        }
+        slot.emitterMoved = false;
+        const float previousVolume = slot.volume;
+        const float previousPan = slot.pan;
+        spatializeSlot(st, slot);
+        if (slot.volume == previousVolume && slot.pan == previousPan) {
+            continue;
+        }
+        const float finalVolume = clamp01(slot.volume * st.settings.sfxVolume);
+        if (slot.voice != 0) {
+            if (st.mixer) {
+                st.mixer->setVoiceParams(slot.voice, MixerVoiceParams{finalVolume, slot.pan, slot.pitch});
+            }
+        } else if (isSoundValid(slot.alias)) {
+            api.setSoundVolume(slot.alias, finalVolume);
+            api.setSoundPan(slot.alias, slot.pan);
+        }
+        st.spatialUpdates++;
+    }
+}
+
+bool setMusicVolumeLocked(ManagerState& st, const std::string& canonical, float volume) {
+    if (!st.initialized) {
+        return false;
+    }
+
+    auto it = st.music.find(canonical);
+    if (it == st.music.end()) {
+        return false;
+    }
+
+    auto& record = it->second;
+    record.volume = clamp01(volume);
+
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
+        return true;
+    }
+
+    float finalVolume = clamp01(record.volume * st.settings.musicVolume);
+    if (record.pcm) {
+        if (record.voice != 0 && st.mixer) {
+            st.mixer->setVoiceParams(record.voice, MixerVoiceParams{finalVolume, 0.5f, 1.0f});
+        }
+        return true;
+    }
+    const auto& api = hooks(st);
+    api.setMusicVolume(record.music, finalVolume);
+    return true;
+}
+
+void applyCommandLocked(ManagerState& st, AudioCommand& command) {
+    switch (command.type) {
+        case AudioCommandType::PlaySound:
+            playSoundLocked(st, command.key, command.params);
+            break;
+        case AudioCommandType::PlaySoundAt:
+            playSoundLocked(st, command.key, command.params, &command.position);
+            break;
+        case AudioCommandType::StopSound:
+            stopSoundLocked(st, command.handle);
+            break;
+        case AudioCommandType::UpdateSoundPlayback:
+            updateSoundPlaybackLocked(st, command.handle, command.params);
+            break;
+        case AudioCommandType::StopAllSounds:
+            if (st.initialized) {
+                stopAllSoundsLocked(st, hooks(st));
+            }
+            break;
+        case AudioCommandType::SetMusicVolume:
+            setMusicVolumeLocked(st, command.key, command.volume);
+            break;
+        case AudioCommandType::SetSoundPosition:
+            setSoundPositionLocked(st, command.handle, command.position);
+            break;
+    }
+}
+
+// Applies what has been posted in one batch, at most one ring's worth so producers cannot keep
+// tick() here forever. A command still being written stops the batch; it and everything posted
+// after it wait for the next tick, so ordering holds.
+void drainCommandsLocked(ManagerState& st) {
+    for (std::size_t budget = st.commands.capacity(); budget > 0; --budget) {
+        auto command = st.commands.tryPop();
+        if (!command) {
+            break;
+        }
+        applyCommandLocked(st, *command);
+        st.commandsApplied++;
+    }
+}
+
+bool postCommand(AudioCommand&& command) {
+    auto& st = state();
+    if (!st.commands.tryPush(std::move(command))) {
+        st.commandsRejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    st.commandsPosted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace
+
+bool AudioManager::init() {
+    auto& st = state();
+    std::unique_lock<std::mutex> lock(st.mutex);
+    if (st.initialized) {
+        return st.deviceReady && !st.silentMode;
+    }
+
+    st.settings = loadSettings();
+    if (const auto offlineRate = backend()->offlineSampleRate(); offlineRate > 0) {
+        st.settings.mixerEnabled = true;
+        st.settings.mixerOutput = MixerOutputMode::Offline;
+        st.settings.mixerSampleRate = offlineRate;
+    }
+    st.resolver.setSearchPaths(st.settings.searchPaths);
+    ConfigurationManager::pushReloadHook({
+        .name = "AudioManager::search_paths",
+        .callback = []() { applySearchPathsFromConfig(); }
+    });
+    ConfigurationManager::pushReloadHook({
+        .name = "AudioManager::voices",
+        .callback = []() { applyVoiceSettingsFromConfig(); }
+    });
+    ConfigurationManager::pushReloadHook({
+        .name = "AudioManager::mixer",
+        .callback = []() { applyMixerBusesFromConfig(); }
+    });
+    ensureSoundSlotCapacity(st);
+    st.publishedConfig = toConfig(st.settings, true, false, false);
 
     std::vector<std::string> preloadSounds = st.settings.preloadSounds;
     std::vector<std::string> preloadMusic = st.settings.preloadMusic;
@@ -491,7 +2042,16 @@ bool AudioManager::init() {
     st.silentMode = !st.deviceReady;
 
     if (st.deviceReady) {
-        backend()->setMasterVolume(st.settings.masterVolume);
+        if (st.settings.mixerEnabled) {
+            startMixerLocked(st, hooks(st));
+        }
+        // The mixer applies the master volume itself, after its master bus.
+        backend()->setMasterVolume(st.mixer ? 1.0f : st.settings.masterVolume);
+        if (st.settings.musicStreamThread) {
+            st.musicThread.start(std::chrono::milliseconds(st.settings.musicUpdateIntervalMs));
+            st.musicThreadActive = true;
+        }
+        mountSoundBanksLocked(st, hooks(st));
         LogManager::info("AudioManager initialized (master={}, music={}, sfx={}, maxSlots={})",
                          st.settings.masterVolume,
                          st.settings.musicVolume,
@@ -534,33 +2094,60 @@ bool AudioManager::init() {
 
 void AudioManager::shutdown() {
     auto& st = state();
+    // Joined before taking the lock, which the streaming thread needs to finish its pass.
+    st.musicThread.stop();
     std::scoped_lock lock(st.mutex);
+    st.musicThreadActive = false;
     if (!st.initialized) {
         return;
     }
 
     const auto& api = hooks(st);
+    stopAllSoundsLocked(st, api);
     for (auto& [key, rec] : st.sounds) {
-        (void)key;
+        rememberVoicePeak(st, key, rec);
         unloadSoundRecord(rec, api);
     }
     for (auto& [key, rec] : st.music) {
         (void)key;
-        unloadMusicRecord(rec, api);
+        unloadMusicRecord(st, rec, api);
     }
     st.sounds.clear();
     st.music.clear();
-    st.activeSoundInstances = 0;
-
-    stopAllSoundsLocked(st, api);
+    st.soundLru.clear();
+    st.activeSoundInstances = 0;
+    st.soundBanks.clear();
+    st.bankedSounds.clear();
+
+    st.voicesStolen = 0;
+    st.voicesDropped = 0;
+    st.instanceCapHits = 0;
+    st.aliasPoolHits = 0;
+    st.aliasPoolMisses = 0;
+    st.spatialCulled = 0;
+    st.spatialUpdates = 0;
+    st.soundsEvicted = 0;
+    st.evictedSoundBytes = 0;
+    st.soundsDecodedOnDemand = 0;
+    st.decodedSoundsDropped = 0;
+    st.overBudgetNotified = false;
+    st.eventsPublished = 0;
+    st.eventsCoalesced = 0;
+    st.eventBatchesDelivered.store(0, std::memory_order_relaxed);
+    st.musicStreamUpdates = 0;
+    st.musicUnderruns = 0;
+    st.musicLongestGapMs = 0.0f;
     for (auto& slot : st.soundSlots) {
         slot = ManagerState::SoundSlot{};
     }
+    stopMixerLocked(st, api);
 
     if (st.deviceReady) {
         backend()->closeDevice();
     }
 
+    st.resolver.clear();
+    st.resolver.resetStats();
     st.initialized = false;
     st.deviceReady = false;
     st.silentMode = false;
@@ -578,9 +2165,11 @@ bool AudioManager::isDeviceReady() {
     return st.deviceReady;
 }
 
-void AudioManager::tick(float /*deltaSeconds*/) {
+void AudioManager::tick(float deltaSeconds) {
     auto& st = state();
+    EventDelivery delivery(st);
     std::scoped_lock lock(st.mutex);
+    drainCommandsLocked(st);
     if (!st.initialized || st.silentMode) {
         if (st.initialized && st.activeSoundInstances > 0) {
             const auto& api = hooks(st);
@@ -595,17 +2184,28 @@ void AudioManager::tick(float /*deltaSeconds*/) {
     }
 
     const auto& api = hooks(st);
+    updateSpatialVoicesLocked(st, api);
+    renderOfflineLocked(st, deltaSeconds);
     refreshSoundSlotsLocked(st, api);
+    if (!st.musicThreadActive) {
+        serviceMusicStreamsLocked(st, api);
+    }
 
     for (auto& [key, rec] : st.music) {
         (void)key;
         if (rec.placeholder || !rec.playing || rec.paused) {
             continue;
         }
-        api.updateMusicStream(rec.music);
-        if (!api.isMusicStreamPlaying(rec.music)) {
+        bool stillPlaying = false;
+        if (rec.pcm) {
+            stillPlaying = rec.voice != 0 && st.mixer && st.mixer->isVoicePlaying(rec.voice);
+        } else {
+            stillPlaying = api.isMusicStreamPlaying(rec.music);
+        }
+        if (!stillPlaying) {
             rec.playing = false;
             rec.paused = false;
+            rec.lastServiced = {};
             
             // Publish music stopped event
             publishAudioEvent(AudioEventType::MusicPlaybackStopped, key);
@@ -632,35 +2232,77 @@ AcquireSoundResult AudioManager::acquireSound(const std::string& identifier,
     }
     const auto& api = hooks(st);
     std::string key = alias && !alias->empty() ? canonicalizeKey(*alias) : canonicalizeKey(identifier);
-    std::optional<std::filesystem::path> resolved = resolvePath(identifier, st.settings);
-    if ((!alias || alias->empty()) && resolved) {
-        key = canonicalizePath(*resolved);
+    // Banked sounds need no filesystem probe.
+    const ManagerState::BankedSound* banked = findBankedSound(st, identifier);
+    std::optional<std::filesystem::path> resolved;
+    if (!banked) {
+        resolved = resolvePath(st, identifier);
+    }
+    if (!alias || alias->empty()) {
+        if (banked) {
+            key = banked->key;
+        } else if (resolved) {
+            key = canonicalizePath(*resolved);
+        }
     }
     auto it = st.sounds.find(key);
     if (it != st.sounds.end()) {
-        it->second.refCount++;
-        return AcquireSoundResult{key, &it->second.sound, it->second.placeholder, false};
+        auto& existing = it->second;
+        if (existing.lruEntry) {
+            st.soundLru.erase(*existing.lruEntry);
+            existing.lruEntry.reset();
+        }
+        existing.refCount++;
+        return AcquireSoundResult{key, &existing.sound, existing.placeholder, false};
     }
 
     SoundRecord record;
     record.refCount = 1;
     record.originalIdentifier = identifier;
     record.placeholder = true;
-    if (resolved) {
+    record.voice = voiceSettingsFor(st.settings, key, identifier);
+    if (banked) {
+        record.resolvedPath = banked->path;
+    } else if (resolved) {
         record.resolvedPath = resolved->string();
     }
 
-    if (!st.silentMode && st.deviceReady && resolved) {
+    if (!st.silentMode && st.deviceReady && banked) {
+        if (loadBankedSoundLocked(st, key, record, api, *banked)) {
+            LogManager::info("AudioManager loaded sound '{}' from bank '{}'", key, banked->bank->path().string());
+            publishAudioEvent(AudioEventType::SoundLoaded, key);
+        } else {
+            LogManager::error("AudioManager failed to load sound '{}' from bank '{}', using placeholder", key, banked->bank->path().string());
+        }
+    } else if (!st.silentMode && st.deviceReady && resolved && canDecodeOnDemand(st, api, resolved->string())) {
+        if (loadSoundForDecodeOnDemand(st, key, record, api, resolved->string())) {
+            LogManager::info("AudioManager loaded sound '{}' as '{}'{}", resolved->string(), key,
+                             record.encoded.empty() ? "" : " (decoded on first play)");
+            publishAudioEvent(AudioEventType::SoundLoaded, key);
+        } else {
+            LogManager::error("AudioManager failed to load sound '{}' (key '{}'), using placeholder", resolved->string(), key);
+        }
+    } else if (!st.silentMode && st.deviceReady && resolved && st.mixer) {
+        record.pcm = loadPcm(api, resolved->string());
+        if (record.pcm) {
+            record.placeholder = false;
+            LogManager::info("AudioManager decoded sound '{}' as '{}' for the mixer", resolved->string(), key);
+            publishAudioEvent(AudioEventType::SoundLoaded, key);
+        } else {
+            LogManager::error("AudioManager failed to decode sound '{}' (key '{}'), using placeholder", resolved->string(), key);
+        }
+    } else if (!st.silentMode && st.deviceReady && resolved) {
         Sound soundHandle = api.loadSound(resolved->string().c_str());
         if (isSoundValid(soundHandle)) {
             record.sound = soundHandle;
             record.placeholder = false;
+            prewarmAliasPool(st, key, record, api);
             LogManager::info("AudioManager loaded sound '{}' as '{}'", resolved->string(), key);
             publishAudioEvent(AudioEventType::SoundLoaded, key);
         } else {
             LogManager::error("AudioManager failed to load sound '{}' (key '{}'), using placeholder", resolved->string(), key);
         }
-    } else if (!resolved) {
+    } else if (!resolved && !banked) {
         LogManager::warn("AudioManager could not resolve sound identifier '{}'", identifier);
     } else if (st.silentMode || !st.deviceReady) {
         LogManager::info("AudioManager in silent mode; sound '{}' will be placeholder", identifier);
@@ -668,6 +2310,7 @@ AcquireSoundResult AudioManager::acquireSound(const std::string& identifier,
 
     auto [insertedIt, inserted] = st.sounds.emplace(key, std::move(record));
     (void)inserted;
+    enforceMemoryBudgetLocked(st, api, &insertedIt->second);
     return AcquireSoundResult{key, &insertedIt->second.sound, insertedIt->second.placeholder, true};
 }
 
@@ -676,7 +2319,7 @@ const Sound* AudioManager::tryGetSound(const std::string& key) {
     std::scoped_lock lock(st.mutex);
     auto canonical = canonicalizeKey(key);
     auto it = st.sounds.find(canonical);
-    if (it == st.sounds.end()) {
+    if (it == st.sounds.end() || it->second.refCount == 0) {
         return nullptr;
     }
     return &it->second.sound;
@@ -698,7 +2341,15 @@ bool AudioManager::releaseSound(const std::string& key) {
         return false;
     }
     rec.refCount--;
-    if (rec.refCount == 0) {
+    if (rec.refCount == 0 && st.settings.memoryBudgetBytes > 0 && !rec.placeholder) {
+        // Kept resident, most recently released at the back, until the budget needs the bytes.
+        stopSoundVoicesLocked(st, canonical, api);
+        st.soundLru.push_back(canonical);
+        rec.lruEntry = std::prev(st.soundLru.end());
+        enforceMemoryBudgetLocked(st, api);
+    } else if (rec.refCount == 0) {
+        stopSoundVoicesLocked(st, canonical, api);
+        rememberVoicePeak(st, canonical, rec);
         unloadSoundRecord(rec, api);
         st.sounds.erase(it);
         publishAudioEvent(AudioEventType::SoundUnloaded, canonical);
@@ -719,7 +2370,7 @@ AcquireMusicResult AudioManager::acquireMusic(const std::string& identifier,
     }
     const auto& api = hooks(st);
     std::string key = alias && !alias->empty() ? canonicalizeKey(*alias) : canonicalizeKey(identifier);
-    std::optional<std::filesystem::path> resolved = resolvePath(identifier, st.settings);
+    std::optional<std::filesystem::path> resolved = resolvePath(st, identifier);
     if (!alias || alias->empty()) {
         if (resolved) {
             key = canonicalizePath(*resolved);
@@ -739,10 +2390,20 @@ AcquireMusicResult AudioManager::acquireMusic(const std::string& identifier,
         record.resolvedPath = resolved->string();
     }
 
-    if (!st.silentMode && st.deviceReady && resolved) {
-        Music musicHandle = api.loadMusicStream(resolved->string().c_str());
+    if (!st.silentMode && st.deviceReady && resolved && st.mixer) {
+        record.pcm = loadPcm(api, resolved->string());
+        if (record.pcm) {
+            record.placeholder = false;
+            LogManager::info("AudioManager decoded music '{}' as '{}' for the mixer", resolved->string(), key);
+            publishAudioEvent(AudioEventType::MusicLoaded, key);
+        } else {
+            LogManager::error("AudioManager failed to decode music '{}' (key '{}'), using placeholder", resolved->string(), key);
+        }
+    } else if (!st.silentMode && st.deviceReady && resolved) {
+        Music musicHandle = loadMusicStreamBuffered(st, api, resolved->string());
         if (isMusicValid(musicHandle)) {
             record.music = musicHandle;
+            record.bufferedSeconds = musicBufferedSeconds(st, musicHandle);
             record.placeholder = false;
             LogManager::info("AudioManager loaded music '{}' as '{}'", resolved->string(), key);
             publishAudioEvent(AudioEventType::MusicLoaded, key);
@@ -788,7 +2449,7 @@ bool AudioManager::releaseMusic(const std::string& key) {
     }
     rec.refCount--;
     if (rec.refCount == 0) {
-        unloadMusicRecord(rec, api);
+        unloadMusicRecord(st, rec, api);
         st.music.erase(it);
         publishAudioEvent(AudioEventType::MusicUnloaded, canonical);
     }
@@ -799,100 +2460,73 @@ PlaybackHandle AudioManager::playSound(const std::string& key, const PlaybackPar
     auto canonical = canonicalizeKey(key);
     auto& st = state();
     std::scoped_lock lock(st.mutex);
-    if (!st.initialized) {
-        LogManager::warn("AudioManager::playSound called before initialization (key='{}')", canonical);
-        return {};
-    }
-
-    auto it = st.sounds.find(canonical);
-    if (it == st.sounds.end()) {
-        LogManager::warn("AudioManager::playSound unknown key '{}'", canonical);
-        return {};
-    }
-
-    auto& record = it->second;
-
-    if (record.placeholder || !isSoundValid(record.sound)) {
-        LogManager::warn("AudioManager::playSound using placeholder sound for key '{}'", canonical);
-        return {};
-    }
-
-    if (st.silentMode || !st.deviceReady) {
-        LogManager::debug("AudioManager::playSound silent mode; suppressing playback for '{}'", canonical);
-        return {};
-    }
-
-    if (st.soundSlots.empty()) {
-        LogManager::warn("AudioManager::playSound dropped '{}' (maxConcurrentSounds=0)", canonical);
-        return {};
-    }
+    return playSoundLocked(st, canonical, params);
+}
 
-    const auto& api = hooks(st);
-    refreshSoundSlotsLocked(st, api);
+PlaybackHandle AudioManager::playSoundAt(const std::string& key, Vector2 position, const PlaybackParams& params) {
+    auto canonical = canonicalizeKey(key);
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return playSoundLocked(st, canonical, params, &position);
+}
 
-    auto freeIndex = findFreeSoundSlotIndex(st);
-    if (!freeIndex) {
-        LogManager::warn("AudioManager::playSound throttled '{}': active={} max={}",
-                         canonical,
-                         st.activeSoundInstances,
-                         st.soundSlots.size());
-        return {};
-    }
+bool AudioManager::setSoundPosition(PlaybackHandle handle, Vector2 position) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return setSoundPositionLocked(st, handle, position);
+}
 
-    Sound alias = api.loadSoundAlias(record.sound);
-    if (!isSoundValid(alias)) {
-        LogManager::error("AudioManager::playSound failed to create alias for '{}'", canonical);
-        return {};
+std::size_t AudioManager::setSoundPositions(std::span<const EmitterPosition> emitters) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    std::size_t moved = 0;
+    for (const auto& emitter : emitters) {
+        moved += setSoundPositionLocked(st, emitter.handle, emitter.position) ? 1 : 0;
     }
-
-    float volume = clamp01(params.volume);
-    float finalVolume = clamp01(volume * st.settings.sfxVolume);
-    float pitch = clampPitch(params.pitch);
-    float pan = clampPan(params.pan);
-    api.setSoundVolume(alias, finalVolume);
-    api.setSoundPitch(alias, pitch);
-    api.setSoundPan(alias, pan);
-    api.playSound(alias);
-
-    auto& slot = st.soundSlots[*freeIndex];
-    slot.alias = alias;
-    slot.key = canonical;
-    slot.active = true;
-    slot.placeholder = false;
-    slot.generation = st.generationCounter++;
-    slot.volume = volume;
-    slot.pitch = pitch;
-    slot.pan = pan;
-    st.activeSoundInstances = std::min<std::size_t>(st.activeSoundInstances + 1, st.soundSlots.size());
-
-    return PlaybackHandle{static_cast<int>(*freeIndex), slot.generation};
+    return moved;
 }
 
-bool AudioManager::stopSound(PlaybackHandle handle) {
-    if (!handle.valid()) {
-        return false;
-    }
+void AudioManager::setListener(const AudioListener& listener) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    st.listener = listener;
+    st.listenerMoved = true;
+}
 
+AudioListener AudioManager::listener() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
-    if (!st.initialized) {
-        return false;
-    }
+    return st.listener;
+}
 
-    const auto index = static_cast<std::size_t>(handle.slot);
-    if (index >= st.soundSlots.size()) {
+bool AudioManager::setSoundVoiceSettings(const std::string& key, const SoundVoiceSettings& settings) {
+    auto canonical = canonicalizeKey(key);
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    auto it = st.sounds.find(canonical);
+    if (it == st.sounds.end()) {
+        LogManager::warn("AudioManager::setSoundVoiceSettings unknown key '{}'", canonical);
         return false;
     }
+    it->second.voice = settings;
+    it->second.voiceOverridden = true;
+    return true;
+}
 
-    auto& slot = st.soundSlots[index];
-    if (!slot.active || slot.generation != handle.generation) {
-        return false;
+std::optional<SoundVoiceSettings> AudioManager::soundVoiceSettings(const std::string& key) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    auto it = st.sounds.find(canonicalizeKey(key));
+    if (it == st.sounds.end()) {
+        return std::nullopt;
     }
+    return it->second.voice;
+}
 
-    const auto& api = hooks(st);
-    releaseSoundSlot(slot, api);
-    refreshSoundSlotsLocked(st, api);
-    return true;
+bool AudioManager::stopSound(PlaybackHandle handle) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return stopSoundLocked(st, handle);
 }
 
 bool AudioManager::stopAllSounds() {
@@ -906,6 +2540,60 @@ bool AudioManager::stopAllSounds() {
     return true;
 }
 
+bool AudioManager::postPlaySound(const std::string& key, const PlaybackParams& params) {
+    AudioCommand command;
+    command.type = AudioCommandType::PlaySound;
+    command.key = canonicalizeKey(key);
+    command.params = params;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postPlaySoundAt(const std::string& key, Vector2 position, const PlaybackParams& params) {
+    AudioCommand command;
+    command.type = AudioCommandType::PlaySoundAt;
+    command.key = canonicalizeKey(key);
+    command.params = params;
+    command.position = position;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postSetSoundPosition(PlaybackHandle handle, Vector2 position) {
+    AudioCommand command;
+    command.type = AudioCommandType::SetSoundPosition;
+    command.handle = handle;
+    command.position = position;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postStopSound(PlaybackHandle handle) {
+    AudioCommand command;
+    command.type = AudioCommandType::StopSound;
+    command.handle = handle;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postUpdateSoundPlayback(PlaybackHandle handle, const PlaybackParams& params) {
+    AudioCommand command;
+    command.type = AudioCommandType::UpdateSoundPlayback;
+    command.handle = handle;
+    command.params = params;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postStopAllSounds() {
+    AudioCommand command;
+    command.type = AudioCommandType::StopAllSounds;
+    return postCommand(std::move(command));
+}
+
+bool AudioManager::postSetMusicVolume(const std::string& key, float volume) {
+    AudioCommand command;
+    command.type = AudioCommandType::SetMusicVolume;
+    command.key = canonicalizeKey(key);
+    command.volume = volume;
+    return postCommand(std::move(command));
+}
+
 bool AudioManager::isHandleActive(PlaybackHandle handle) {
     if (!handle.valid()) {
         return false;
@@ -927,39 +2615,9 @@ bool AudioManager::isHandleActive(PlaybackHandle handle) {
 }
 
 bool AudioManager::updateSoundPlayback(PlaybackHandle handle, const PlaybackParams& params) {
-    if (!handle.valid()) {
-        return false;
-    }
-
     auto& st = state();
     std::scoped_lock lock(st.mutex);
-    if (!st.initialized) {
-        return false;
-    }
-
-    const auto index = static_cast<std::size_t>(handle.slot);
-    if (index >= st.soundSlots.size()) {
-        return false;
-    }
-
-    auto& slot = st.soundSlots[index];
-    if (!slot.active || slot.generation != handle.generation) {
-        return false;
-    }
-
-    const auto& api = hooks(st);
-    if (!isSoundValid(slot.alias)) {
-        return false;
-    }
-
-    slot.volume = clamp01(params.volume);
-    slot.pitch = clampPitch(params.pitch);
-    slot.pan = clampPan(params.pan);
-
-    api.setSoundVolume(slot.alias, clamp01(slot.volume * st.settings.sfxVolume));
-    api.setSoundPitch(slot.alias, slot.pitch);
-    api.setSoundPan(slot.alias, slot.pan);
-    return true;
+    return updateSoundPlaybackLocked(st, handle, params);
 }
 
 bool AudioManager::playMusic(const std::string& key) {
@@ -986,15 +2644,28 @@ bool AudioManager::playMusic(const std::string& key) {
         return true;
     }
 
-    if (record.placeholder || !isMusicValid(record.music)) {
+    if (!isMusicPlayable(record)) {
         LogManager::warn("AudioManager::playMusic using placeholder music for '{}'", canonical);
         record.playing = false;
         return false;
     }
 
     const auto& api = hooks(st);
+    if (record.pcm) {
+        stopMusicRecord(st, api, record);
+        record.playing = true;
+        const float finalVolume = clamp01(record.volume * st.settings.musicVolume);
+        record.voice = st.mixer ? st.mixer->startVoice(record.pcm, AudioMixer::kMusicBus, MixerVoiceParams{finalVolume, 0.5f, 1.0f}, true) : 0;
+        if (record.voice == 0) {
+            LogManager::error("AudioManager::playMusic failed to start a mixer voice for '{}'", canonical);
+            record.playing = false;
+            return false;
+        }
+        return true;
+    }
     api.stopMusicStream(record.music);
     api.playMusicStream(record.music);
+    record.lastServiced = st.musicThread.now();
     float finalVolume = clamp01(record.volume * st.settings.musicVolume);
     api.setMusicVolume(record.music, finalVolume);
     return true;
@@ -1019,12 +2690,19 @@ bool AudioManager::pauseMusic(const std::string& key) {
     }
 
     record.paused = true;
-    if (st.silentMode || !st.deviceReady || record.placeholder || !isMusicValid(record.music)) {
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
         return true;
     }
 
+    if (record.pcm) {
+        if (record.voice != 0 && st.mixer) {
+            st.mixer->setVoicePaused(record.voice, true);
+        }
+        return true;
+    }
     const auto& api = hooks(st);
     api.pauseMusicStream(record.music);
+    record.lastServiced = {};
     return true;
 }
 
@@ -1048,12 +2726,20 @@ bool AudioManager::resumeMusic(const std::string& key) {
 
     record.paused = false;
 
-    if (st.silentMode || !st.deviceReady || record.placeholder || !isMusicValid(record.music)) {
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
         return true;
     }
 
+    if (record.pcm) {
+        if (record.voice != 0 && st.mixer) {
+            st.mixer->setVoicePaused(record.voice, false);
+            st.mixer->setVoiceParams(record.voice, MixerVoiceParams{clamp01(record.volume * st.settings.musicVolume), 0.5f, 1.0f});
+        }
+        return true;
+    }
     const auto& api = hooks(st);
     api.resumeMusicStream(record.music);
+    record.lastServiced = st.musicThread.now();
     float finalVolume = clamp01(record.volume * st.settings.musicVolume);
     api.setMusicVolume(record.music, finalVolume);
     return true;
@@ -1077,14 +2763,14 @@ bool AudioManager::stopMusic(const std::string& key) {
         return false;
     }
 
-    if (st.silentMode || !st.deviceReady || record.placeholder || !isMusicValid(record.music)) {
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
         record.playing = false;
         record.paused = false;
         return true;
     }
 
     const auto& api = hooks(st);
-    stopMusicRecord(api, record);
+    stopMusicRecord(st, api, record);
     return true;
 }
 
@@ -1092,26 +2778,7 @@ bool AudioManager::setMusicVolume(const std::string& key, float volume) {
     auto canonical = canonicalizeKey(key);
     auto& st = state();
     std::scoped_lock lock(st.mutex);
-    if (!st.initialized) {
-        return false;
-    }
-
-    auto it = st.music.find(canonical);
-    if (it == st.music.end()) {
-        return false;
-    }
-
-    auto& record = it->second;
-    record.volume = clamp01(volume);
-
-    if (st.silentMode || !st.deviceReady || record.placeholder || !isMusicValid(record.music)) {
-        return true;
-    }
-
-    const auto& api = hooks(st);
-    float finalVolume = clamp01(record.volume * st.settings.musicVolume);
-    api.setMusicVolume(record.music, finalVolume);
-    return true;
+    return setMusicVolumeLocked(st, canonical, volume);
 }
 
 bool AudioManager::seekMusic(const std::string& key, float positionSeconds) {
@@ -1128,10 +2795,16 @@ bool AudioManager::seekMusic(const std::string& key, float positionSeconds) {
     }
 
     auto& record = it->second;
-    if (st.silentMode || !st.deviceReady || record.placeholder || !isMusicValid(record.music)) {
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
         return true;
     }
 
+    if (record.pcm) {
+        if (record.voice != 0 && st.mixer) {
+            st.mixer->seekVoice(record.voice, std::max(positionSeconds, 0.0f));
+        }
+        return true;
+    }
     const auto& api = hooks(st);
     api.seekMusicStream(record.music, std::max(positionSeconds, 0.0f));
     return true;
@@ -1160,7 +2833,15 @@ MusicPlaybackStatus AudioManager::musicPlaybackStatus(const std::string& key) {
         return status;
     }
 
-    if (st.silentMode || !st.deviceReady || !isMusicValid(record.music)) {
+    if (st.silentMode || !st.deviceReady || !isMusicPlayable(record)) {
+        return status;
+    }
+
+    if (record.pcm) {
+        status.durationSeconds = record.pcm->durationSeconds();
+        if (record.voice != 0 && st.mixer) {
+            status.positionSeconds = std::min(st.mixer->voicePosition(record.voice).value_or(0.0f), status.durationSeconds);
+        }
         return status;
     }
 
@@ -1210,15 +2891,29 @@ bool AudioManager::reloadAll() {
 
     for (auto& [key, rec] : st.music) {
         (void)key;
-        stopMusicRecord(api, rec);
+        stopMusicRecord(st, api, rec);
     }
+    st.resolver.clear();
+    // Banks may have been rebuilt; sounds from them reload from the fresh mapping.
+    mountSoundBanksLocked(st, api);
 
     for (auto& [key, rec] : st.sounds) {
+        if (const auto* banked = findBankedSound(st, rec.originalIdentifier)) {
+            unloadSoundRecord(rec, api);
+            rec.resolvedPath = banked->path;
+            if (loadBankedSoundLocked(st, key, rec, api, *banked)) {
+                LogManager::info("AudioManager reloaded sound '{}' from bank '{}'", key, banked->bank->path().string());
+            } else {
+                LogManager::error("AudioManager failed to reload sound '{}' from bank '{}'", key, banked->bank->path().string());
+                allSucceeded = false;
+            }
+            continue;
+        }
         std::optional<std::filesystem::path> path;
         if (!rec.resolvedPath.empty()) {
             path = std::filesystem::path(rec.resolvedPath);
         } else {
-            path = resolvePath(rec.originalIdentifier, st.settings);
+            path = resolvePath(st, rec.originalIdentifier);
         }
 
         if (!path) {
@@ -1228,12 +2923,40 @@ bool AudioManager::reloadAll() {
             continue;
         }
 
+        if (canDecodeOnDemand(st, api, path->string())) {
+            unloadSoundRecord(rec, api);
+            rec.resolvedPath = path->string();
+            if (loadSoundForDecodeOnDemand(st, key, rec, api, path->string())) {
+                LogManager::info("AudioManager reloaded sound '{}' from '{}'", key, path->string());
+            } else {
+                LogManager::error("AudioManager failed to reload sound '{}' from '{}'", key, path->string());
+                allSucceeded = false;
+            }
+            continue;
+        }
+
+        if (st.mixer) {
+            auto pcm = loadPcm(api, path->string());
+            unloadSoundRecord(rec, api);
+            rec.resolvedPath = path->string();
+            if (pcm) {
+                rec.pcm = std::move(pcm);
+                rec.placeholder = false;
+                LogManager::info("AudioManager reloaded sound '{}' from '{}'", key, path->string());
+            } else {
+                LogManager::error("AudioManager failed to reload sound '{}' from '{}'", key, path->string());
+                allSucceeded = false;
+            }
+            continue;
+        }
+
         Sound handle = api.loadSound(path->string().c_str());
         if (isSoundValid(handle)) {
             unloadSoundRecord(rec, api);
             rec.sound = handle;
             rec.placeholder = false;
             rec.resolvedPath = path->string();
+            prewarmAliasPool(st, key, rec, api);
             LogManager::info("AudioManager reloaded sound '{}' from '{}'", key, path->string());
         } else {
             LogManager::error("AudioManager failed to reload sound '{}' from '{}'", key, path->string());
@@ -1248,26 +2971,42 @@ bool AudioManager::reloadAll() {
         if (!rec.resolvedPath.empty()) {
             path = std::filesystem::path(rec.resolvedPath);
         } else {
-            path = resolvePath(rec.originalIdentifier, st.settings);
+            path = resolvePath(st, rec.originalIdentifier);
         }
 
         if (!path) {
             LogManager::warn("AudioManager failed to resolve path for music '{}' during reload", key);
-            unloadMusicRecord(rec, api);
+            unloadMusicRecord(st, rec, api);
             allSucceeded = false;
             continue;
         }
 
-        Music handle = api.loadMusicStream(path->string().c_str());
+        if (st.mixer) {
+            auto pcm = loadPcm(api, path->string());
+            unloadMusicRecord(st, rec, api);
+            rec.resolvedPath = path->string();
+            if (pcm) {
+                rec.pcm = std::move(pcm);
+                rec.placeholder = false;
+                LogManager::info("AudioManager reloaded music '{}' from '{}'", key, path->string());
+            } else {
+                LogManager::error("AudioManager failed to reload music '{}' from '{}'", key, path->string());
+                allSucceeded = false;
+            }
+            continue;
+        }
+
+        Music handle = loadMusicStreamBuffered(st, api, path->string());
         if (isMusicValid(handle)) {
-            unloadMusicRecord(rec, api);
+            unloadMusicRecord(st, rec, api);
             rec.music = handle;
+            rec.bufferedSeconds = musicBufferedSeconds(st, handle);
             rec.placeholder = false;
             rec.resolvedPath = path->string();
             LogManager::info("AudioManager reloaded music '{}' from '{}'", key, path->string());
         } else {
             LogManager::error("AudioManager failed to reload music '{}' from '{}'", key, path->string());
-            unloadMusicRecord(rec, api);
+            unloadMusicRecord(st, rec, api);
             rec.resolvedPath = path->string();
             allSucceeded = false;
         }
@@ -1287,24 +3026,135 @@ AudioMetrics AudioManager::metrics() {
     m.loadedMusic = st.music.size();
     m.activeSoundInstances = st.activeSoundInstances;
     m.maxSoundSlots = st.settings.maxConcurrentSounds;
+    m.voicesStolen = st.voicesStolen;
+    m.voicesDropped = st.voicesDropped;
+    m.instanceCapHits = st.instanceCapHits;
+    m.aliasPoolHits = st.aliasPoolHits;
+    m.aliasPoolMisses = st.aliasPoolMisses;
+    for (const auto& [key, record] : st.sounds) {
+        (void)key;
+        m.pooledAliases += record.aliasPool.size();
+        m.soundMemoryBytes += soundRecordBytes(record);
+        m.encodedSoundBytes += record.encoded.size();
+    }
+    for (const auto& [key, record] : st.music) {
+        (void)key;
+        m.musicMemoryBytes += musicRecordBytes(record);
+    }
+    m.memoryBudgetBytes = st.settings.memoryBudgetBytes;
+    m.retainedSounds = st.soundLru.size();
+    m.soundsEvicted = st.soundsEvicted;
+    m.evictedSoundBytes = st.evictedSoundBytes;
+    m.soundsDecodedOnDemand = st.soundsDecodedOnDemand;
+    m.decodedSoundsDropped = st.decodedSoundsDropped;
+    m.commandsPosted = st.commandsPosted.load(std::memory_order_relaxed);
+    m.commandsApplied = st.commandsApplied;
+    m.commandsRejected = st.commandsRejected.load(std::memory_order_relaxed);
+    m.commandsPending = st.commands.sizeApprox();
+    m.eventsPublished = st.eventsPublished;
+    m.eventsCoalesced = st.eventsCoalesced;
+    m.eventBatchesDelivered = st.eventBatchesDelivered.load(std::memory_order_relaxed);
+    m.soundBanks = st.soundBanks.size();
+    m.bankedSounds = st.bankedSounds.size();
+    for (const auto& bank : st.soundBanks) {
+        m.soundBankBytes += bank->sizeBytes();
+    }
+    for (const auto& slot : st.soundSlots) {
+        m.positionalVoices += slot.active && slot.positional ? 1 : 0;
+    }
+    m.spatialCulled = st.spatialCulled;
+    m.spatialUpdates = st.spatialUpdates;
+    m.musicStreamThread = st.musicThreadActive;
+    m.musicStreamUpdates = st.musicStreamUpdates;
+    m.musicUnderruns = st.musicUnderruns;
+    m.musicLongestGapMs = st.musicLongestGapMs;
+    m.mixerActive = st.mixer != nullptr;
+    if (st.mixer) {
+        m.mixerVoices = st.mixer->activeVoices();
+        m.mixerFramesRendered = st.mixer->framesRendered();
+    }
+    const auto paths = st.resolver.stats();
+    m.pathLookups = paths.lookups;
+    m.pathCacheHits = paths.hits;
+    m.pathProbes = paths.probes;
+    m.pathProbesAvoided = paths.probesAvoided;
     return m;
 }
 
+bool AudioManager::isMixerActive() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return st.mixer != nullptr;
+}
+
+std::vector<MixerBusMeter> AudioManager::mixerMeters() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.mixer) {
+        return {};
+    }
+    return st.mixer->meters();
+}
+
+bool AudioManager::setMixerBusSettings(const std::string& bus, const MixerBusSettings& settings) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return st.mixer && st.mixer->setBusSettings(bus, settings);
+}
+
+bool AudioManager::setMixerBusEffects(const std::string& bus, const std::vector<MixerEffectSettings>& effects) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return st.mixer && st.mixer->setBusEffects(bus, effects);
+}
+
+std::size_t AudioManager::renderMixer(float* out, std::size_t frames) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.mixer || st.settings.mixerOutput != MixerOutputMode::Offline || out == nullptr) {
+        return 0;
+    }
+    st.mixer->render(out, frames);
+    return frames;
+}
+
 std::vector<SoundInventoryRecord> AudioManager::captureSoundInventorySnapshot() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
     
     std::vector<SoundInventoryRecord> snapshot;
     snapshot.reserve(st.sounds.size());
+    std::unordered_map<std::string_view, std::size_t> evictionRanks;
+    evictionRanks.reserve(st.soundLru.size());
+    for (const auto& key : st.soundLru) {
+        evictionRanks.emplace(key, evictionRanks.size());
+    }
     
     for (const auto& [key, record] : st.sounds) {
         SoundInventoryRecord rec;
         rec.key = key;
         rec.path = record.resolvedPath;
+        if (record.bank) {
+            rec.bank = record.bank->path().string();
+        }
         rec.refCount = record.refCount;
         rec.placeholder = record.placeholder;
+        rec.bytes = soundRecordBytes(record);
+        rec.decodeOnDemand = !record.encoded.empty();
+        rec.decoded = isSoundDecoded(record);
+        if (auto rankIt = evictionRanks.find(key); rankIt != evictionRanks.end()) {
+            rec.evictionRank = rankIt->second;
+        }
         
-        if (!record.placeholder && record.sound.stream.buffer) {
+        if (!record.placeholder && !rec.decoded && rec.decodeOnDemand && record.encodedSampleRate > 0) {
+            rec.sampleRate = record.encodedSampleRate;
+            rec.channels = record.encodedChannels;
+            rec.durationSeconds = static_cast<float>(record.encodedFrames) / static_cast<float>(record.encodedSampleRate);
+        } else if (!record.placeholder && record.pcm) {
+            rec.sampleRate = record.pcm->sampleRate;
+            rec.channels = record.pcm->channels;
+            rec.durationSeconds = record.pcm->durationSeconds();
+        } else if (!record.placeholder && record.sound.stream.buffer) {
             // Extract audio properties from raylib Sound
             rec.sampleRate = record.sound.stream.sampleRate;
             rec.channels = record.sound.stream.channels;
@@ -1331,8 +3181,13 @@ std::vector<MusicInventoryRecord> AudioManager::captureMusicInventorySnapshot()
         rec.path = record.resolvedPath;
         rec.refCount = record.refCount;
         rec.placeholder = record.placeholder;
+        rec.bytes = musicRecordBytes(record);
         
-        if (!record.placeholder && record.music.stream.buffer) {
+        if (!record.placeholder && record.pcm) {
+            rec.sampleRate = record.pcm->sampleRate;
+            rec.channels = record.pcm->channels;
+            rec.durationSeconds = record.pcm->durationSeconds();
+        } else if (!record.placeholder && record.music.stream.buffer) {
             // Extract audio properties from raylib Music
             rec.sampleRate = record.music.stream.sampleRate;
             rec.channels = record.music.stream.channels;
@@ -1360,6 +3215,8 @@ AudioEventSubscription AudioManager::subscribeToAudioEvents(AudioEventSink* sink
     subscription.active = true;
     
     st.eventSubscriptions.push_back(subscription);
+    ++st.activeSubscriptions;
+    st.subscriptionsVersion.fetch_add(1, std::memory_order_release);
     
     return subscription;
 }
@@ -1370,6 +3227,11 @@ bool AudioManager::unsubscribeFromAudioEvents(AudioEventSubscription& subscripti
     }
     
     auto& st = state();
+    // Wait out a delivery in flight on another thread so the sink is not called after we return.
+    std::unique_lock<std::mutex> delivery(st.deliveryMutex, std::defer_lock);
+    if (!deliveringAudioEvents) {
+        delivery.lock();
+    }
     std::scoped_lock lock(st.mutex);
     
     auto it = std::find_if(st.eventSubscriptions.begin(), st.eventSubscriptions.end(),
@@ -1380,12 +3242,18 @@ bool AudioManager::unsubscribeFromAudioEvents(AudioEventSubscription& subscripti
     if (it != st.eventSubscriptions.end()) {
         it->active = false;
         subscription.active = false;
+        --st.activeSubscriptions;
+        st.subscriptionsVersion.fetch_add(1, std::memory_order_release);
         return true;
     }
     
     return false;
 }
 
+void AudioManager::flushEvents() {
+    deliverPendingEvents(state());
+}
+
 std::size_t AudioManager::activeSubscriptionCountForTesting() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
@@ -1405,6 +3273,14 @@ void AudioManager::setRaylibHooksForTesting(const RaylibHooks* hookTable) {
     st.overrideHooks = hookTable;
 }
 
+void AudioManager::useManualMusicClockForTesting(bool enabled) {
+    state().musicThread.useManualClock(enabled);
+}
+
+void AudioManager::advanceMusicClockForTesting(std::chrono::milliseconds step) {
+    state().musicThread.advanceManualClock(step);
+}
+
 void AudioManager::resetForTesting() {
     shutdown();
     auto& st = state();
@@ -1421,11 +3297,28 @@ void AudioManager::resetForTesting() {
     st.overrideHooks = nullptr;
     st.sounds.clear();
     st.music.clear();
+    st.soundLru.clear();
     st.generationCounter = 1;
     st.activeSoundInstances = 0;
     st.soundSlots.clear();
+    st.playSequence = 0;
+    st.voicePeaks.clear();
+    st.listener = AudioListener{};
+    st.listenerMoved = false;
     st.eventSubscriptions.clear();
     st.nextSubscriptionId = 1;
+    st.activeSubscriptions = 0;
+    st.pendingEvents.clear();
+    st.eventsPending.store(false, std::memory_order_relaxed);
+    while (st.commands.tryPop()) {
+    }
+    st.commandsPosted.store(0, std::memory_order_relaxed);
+    st.commandsRejected.store(0, std::memory_order_relaxed);
+    st.commandsApplied = 0;
+    st.musicStreamUpdates = 0;
+    st.musicUnderruns = 0;
+    st.musicLongestGapMs = 0.0f;
+    st.musicThread.useManualClock(false);
 }
 
 } // namespace gb2d::audio
@@ -1,26 +1,66 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "raylib.h"
+#include "AudioMixer.h"
+#include "SpatialAudio.h"
 
 namespace gb2d::audio {
 
+// What playSound does when every sound slot is busy. Voices of higher priority than the request
+// are never stolen.
+enum class VoiceStealPolicy {
+    None,           // drop the request
+    Oldest,         // replace the longest-playing voice of equal or lower priority
+    Quietest,       // replace the quietest voice of equal or lower priority
+    LowestPriority  // replace the lowest-priority voice below the request's (oldest on ties)
+};
+
+struct SoundVoiceSettings {
+    int priority{0};              // higher wins when voices compete for slots
+    std::size_t maxInstances{0};  // simultaneous voices of this sound; 0 = limited by the pool only
+    std::string bus{};            // software mixer bus; empty = "sfx"
+};
+
+// Where the software mixer's output goes: a raylib audio stream on the device, or nowhere until
+// the caller pulls it with AudioManager::renderMixer (tests, offline rendering).
+enum class MixerOutputMode {
+    Device,
+    Offline
+};
+
 struct AudioConfig {
     bool enabled{true};
     bool diagnosticsLoggingEnabled{true};
+    bool coalesceEvents{false};
     float masterVolume{1.0f};
     float musicVolume{1.0f};
     float sfxVolume{1.0f};
     std::size_t maxConcurrentSounds{16};
+    std::size_t aliasPoolSize{2};
+    VoiceStealPolicy stealPolicy{VoiceStealPolicy::LowestPriority};
+    bool mixerEnabled{false};
+    std::uint32_t mixerSampleRate{48000};
+    MixerOutputMode mixerOutput{MixerOutputMode::Device};
+    bool musicStreamThread{true};
+    std::uint32_t musicBufferFrames{4096};
+    std::uint32_t musicUpdateIntervalMs{5};
+    SpatialSettings spatial{};
+    float spatialCullVolume{0.001f};
+    std::size_t memoryBudgetBytes{0};    // 0 = unlimited
+    float decodeOnDemandSeconds{0.0f};   // 0 = decode every sound when acquired
     std::vector<std::string> searchPaths{};
     std::vector<std::string> preloadSounds{};
     std::vector<std::string> preloadMusic{};
+    std::vector<std::string> soundBanks{};
     std::unordered_map<std::string, std::string> soundAliases{};
     std::unordered_map<std::string, std::string> musicAliases{};
 };
@@ -33,6 +73,63 @@ struct AudioMetrics {
     std::size_t loadedMusic{0};
     std::size_t activeSoundInstances{0};
     std::size_t maxSoundSlots{0};
+    // Voice scheduling since init: voices replaced to make room, and requests dropped because the
+    // pool was full of more important voices or the sound hit its instance cap.
+    std::size_t voicesStolen{0};
+    std::size_t voicesDropped{0};
+    std::size_t instanceCapHits{0};
+    // Sound aliases: plays served from a sound's pre-created pool vs. ones that had to create an
+    // alias, and idle aliases currently held across all pools.
+    std::size_t aliasPoolHits{0};
+    std::size_t aliasPoolMisses{0};
+    std::size_t pooledAliases{0};
+    // Command queue fed by the post*() calls and drained by tick().
+    std::size_t commandsPosted{0};
+    std::size_t commandsApplied{0};
+    std::size_t commandsRejected{0}; // queue was full
+    std::size_t commandsPending{0};
+    // Audio events since init: published while someone was subscribed, folded into an earlier
+    // event by audio.core.coalesce_events, and batches handed to sinks (one per sink per delivery).
+    std::size_t eventsPublished{0};
+    std::size_t eventsCoalesced{0};
+    std::size_t eventBatchesDelivered{0};
+    // Positional voices playing now; playSoundAt calls culled as inaudible since init, and voice
+    // volume/pan changes tick() pushed after emitters or the listener moved.
+    std::size_t positionalVoices{0};
+    std::size_t spatialCulled{0};
+    std::size_t spatialUpdates{0};
+    // Audio memory: decoded samples (and encoded files kept for decode-on-demand) held by sound
+    // records, and stream buffers or decoded tracks held by music. Released sounds stay resident
+    // while audio.memory.max_bytes is set, and are evicted least recently released first.
+    std::size_t soundMemoryBytes{0};
+    std::size_t encodedSoundBytes{0}; // part of soundMemoryBytes
+    std::size_t musicMemoryBytes{0};
+    std::size_t memoryBudgetBytes{0};
+    std::size_t retainedSounds{0};
+    std::size_t soundsEvicted{0};
+    std::size_t evictedSoundBytes{0};
+    // Decode-on-demand sounds decoded at play time, and decoded copies dropped to meet the budget.
+    std::size_t soundsDecodedOnDemand{0};
+    std::size_t decodedSoundsDropped{0};
+    // Mounted sound banks, the sounds they hold, and the bytes mapped for them.
+    std::size_t soundBanks{0};
+    std::size_t bankedSounds{0};
+    std::size_t soundBankBytes{0};
+    // Music streaming since init: refills of raylib music streams, and refills that came after the
+    // stream's buffer had run out (an audible gap). The longest time a playing stream went unserviced.
+    bool musicStreamThread{false};
+    std::size_t musicStreamUpdates{0};
+    std::size_t musicUnderruns{0};
+    float musicLongestGapMs{0.0f};
+    // Software mixer; inactive when disabled or when the hooks/device could not support it.
+    bool mixerActive{false};
+    std::size_t mixerVoices{0};
+    std::uint64_t mixerFramesRendered{0};
+    // Identifier -> file resolution; cached answers (including misses) skip the search-path walk.
+    std::size_t pathLookups{0};
+    std::size_t pathCacheHits{0};
+    std::size_t pathProbes{0};
+    std::size_t pathProbesAvoided{0};
 };
 
 struct AcquireSoundResult {
@@ -53,16 +150,26 @@ struct PlaybackParams {
     float volume{1.0f};
     float pitch{1.0f};
     float pan{0.5f}; // 0.0 = left, 0.5 = center, 1.0 = right
+    std::optional<int> priority{}; // overrides the sound's SoundVoiceSettings::priority
+    std::optional<SpatialSettings> spatial{}; // playSoundAt only; audio.spatial when unset
 };
 
 struct SoundInventoryRecord {
     std::string key;
     std::string path;
+    std::string bank; // sound bank the sound was loaded from; empty for individual files
     float durationSeconds{0.0f};
     std::size_t refCount{0};
     bool placeholder{false};
     std::uint32_t sampleRate{0};
     std::uint32_t channels{0};
+    std::size_t bytes{0};
+    // Kept encoded and decoded when played (audio.memory.decode_on_demand_seconds); `decoded` is
+    // false until the first play and again after the budget dropped the decoded copy.
+    bool decodeOnDemand{false};
+    bool decoded{false};
+    // Position in the eviction queue (0 = evicted first); empty while the sound is referenced.
+    std::optional<std::size_t> evictionRank{};
 };
 
 struct MusicInventoryRecord {
@@ -73,6 +180,7 @@ struct MusicInventoryRecord {
     bool placeholder{false};
     std::uint32_t sampleRate{0};
     std::uint32_t channels{0};
+    std::size_t bytes{0};
 };
 
 struct MusicPlaybackStatus {
@@ -105,12 +213,20 @@ struct AudioEvent {
     std::string key; // asset key, empty for global events
     std::uint64_t timestampMs;
     std::string details; // additional info
+    std::uint32_t count{1}; // > 1 when repeats were coalesced into this event
 };
 
 class AudioEventSink {
 public:
     virtual ~AudioEventSink() = default;
-    virtual void onAudioEvent(const AudioEvent& event) = 0;
+    virtual void onAudioEvent(const AudioEvent& /*event*/) {}
+    // Called once per delivery with every event published since the previous one, in publishing
+    // order. The span and its strings are only valid during the call; copy what you keep.
+    virtual void onAudioEvents(std::span<const AudioEvent> events) {
+        for (const auto& event : events) {
+            onAudioEvent(event);
+        }
+    }
 };
 
 struct AudioEventSubscription {
@@ -125,6 +241,11 @@ struct PlaybackHandle {
     bool valid() const { return slot >= 0; }
 };
 
+struct EmitterPosition {
+    PlaybackHandle handle{};
+    Vector2 position{0.0f, 0.0f};
+};
+
 class AudioManager {
 public:
     static bool init();
@@ -135,6 +256,9 @@ public:
 
     static AudioConfig config();
 
+    // With audio.memory.max_bytes set, a sound released to zero references stays resident until
+    // the budget needs its bytes, and acquiring it again reuses it. The `sound` of a sound kept
+    // encoded by audio.memory.decode_on_demand_seconds stays empty until its first play.
     static AcquireSoundResult acquireSound(const std::string& identifier,
                                            std::optional<std::string> alias = std::nullopt);
     static const Sound* tryGetSound(const std::string& key);
@@ -150,6 +274,33 @@ public:
     static bool stopAllSounds();
     static bool isHandleActive(PlaybackHandle handle);
     static bool updateSoundPlayback(PlaybackHandle handle, const PlaybackParams& params);
+    // Voice settings start from audio.engine.voices when the sound is acquired; the setter
+    // overrides them for as long as the sound stays loaded.
+    static bool setSoundVoiceSettings(const std::string& key, const SoundVoiceSettings& settings);
+    static std::optional<SoundVoiceSettings> soundVoiceSettings(const std::string& key);
+
+    // Positional sounds, placed in world units. The voice's volume is params.volume scaled by the
+    // attenuation curve, and its pan follows the horizontal offset from the listener; params.pan
+    // is ignored. A sound quieter than audio.spatial.cull_volume after attenuation is not started
+    // and takes no slot. Emitter and listener moves are stored and applied to every positional
+    // voice in one pass by the next tick().
+    static PlaybackHandle playSoundAt(const std::string& key, Vector2 position, const PlaybackParams& params = {});
+    static bool setSoundPosition(PlaybackHandle handle, Vector2 position);
+    // Moves many emitters under one lock; returns how many handles were still playing.
+    static std::size_t setSoundPositions(std::span<const EmitterPosition> emitters);
+    static void setListener(const AudioListener& listener);
+    static AudioListener listener();
+
+    // Non-blocking counterparts for game and worker threads. The call is queued without taking
+    // the manager lock and applied by the next tick(), in posting order. A posted play has no
+    // handle to return; use playSound when the caller needs one. Returns false if the queue is full.
+    static bool postPlaySound(const std::string& key, const PlaybackParams& params = {});
+    static bool postPlaySoundAt(const std::string& key, Vector2 position, const PlaybackParams& params = {});
+    static bool postSetSoundPosition(PlaybackHandle handle, Vector2 position);
+    static bool postStopSound(PlaybackHandle handle);
+    static bool postUpdateSoundPlayback(PlaybackHandle handle, const PlaybackParams& params);
+    static bool postStopAllSounds();
+    static bool postSetMusicVolume(const std::string& key, float volume);
 
     static bool playMusic(const std::string& key);
     static bool pauseMusic(const std::string& key);
@@ -162,11 +313,26 @@ public:
     static bool reloadAll();
     static AudioMetrics metrics();
 
+    // Software mixer (audio.mixer). While it is active, sounds and music are decoded to PCM and
+    // mixed in-process through its buses instead of playing as raylib sounds and streams. Bus
+    // changes made here last until shutdown or the next configuration reload.
+    static bool isMixerActive();
+    static std::vector<MixerBusMeter> mixerMeters();
+    static bool setMixerBusSettings(const std::string& bus, const MixerBusSettings& settings);
+    static bool setMixerBusEffects(const std::string& bus, const std::vector<MixerEffectSettings>& effects);
+    // Offline output only: mixes the next `frames` frames of interleaved stereo into `out`.
+    // Returns the number of frames written, 0 when the mixer is inactive or feeds the device.
+    static std::size_t renderMixer(float* out, std::size_t frames);
+
     // Inventory and event APIs for AudioManagerWindow
     static std::vector<SoundInventoryRecord> captureSoundInventorySnapshot();
     static std::vector<MusicInventoryRecord> captureMusicInventorySnapshot();
+    // Events are buffered while anyone is subscribed (and dropped unread otherwise) and delivered
+    // by tick() in one onAudioEvents call per sink, outside the manager lock. flushEvents()
+    // delivers them immediately, for tools that do not tick.
     static AudioEventSubscription subscribeToAudioEvents(AudioEventSink* sink);
     static bool unsubscribeFromAudioEvents(AudioEventSubscription& subscription);
+    static void flushEvents();
     static std::size_t activeSubscriptionCountForTesting();
 
     struct Backend {
@@ -175,35 +341,63 @@ public:
         virtual void closeDevice() = 0;
         virtual bool isDeviceReady() = 0;
         virtual void setMasterVolume(float volume) = 0;
+        // Offline backends (see OfflineAudioBackend.h) return their sample rate here. init() then
+        // runs the software mixer at that rate with offline output regardless of audio.mixer, and
+        // each tick(dt) renders dt seconds of it into consumeOfflineAudio. That call is made under
+        // the manager lock, so it must not call back into AudioManager.
+        virtual std::uint32_t offlineSampleRate() { return 0; }
+        virtual void consumeOfflineAudio(const float* /*interleavedStereo*/, std::size_t /*frames*/) {}
     };
 
+    // Build tables with designated initializers (.loadSound = &LoadSound); hooks left out stay null.
     struct RaylibHooks {
-        Sound (*loadSound)(const char* path);
-        void (*unloadSound)(Sound sound);
-        Sound (*loadSoundAlias)(Sound sound);
-        void (*unloadSoundAlias)(Sound sound);
-        void (*playSound)(Sound sound);
-        void (*stopSound)(Sound sound);
-        bool (*isSoundPlaying)(Sound sound);
-        void (*setSoundVolume)(Sound sound, float volume);
-        void (*setSoundPitch)(Sound sound, float pitch);
-        void (*setSoundPan)(Sound sound, float pan);
-        Music (*loadMusicStream)(const char* path);
-        void (*unloadMusicStream)(Music music);
-        void (*playMusicStream)(Music music);
-        void (*pauseMusicStream)(Music music);
-        void (*resumeMusicStream)(Music music);
-        void (*stopMusicStream)(Music music);
-        void (*updateMusicStream)(Music music);
-        bool (*isMusicStreamPlaying)(Music music);
-        void (*setMusicVolume)(Music music, float volume);
-        void (*seekMusicStream)(Music music, float positionSeconds);
-        float (*getMusicTimeLength)(Music music);
-        float (*getMusicTimePlayed)(Music music);
+        Sound (*loadSound)(const char* path){nullptr};
+        void (*unloadSound)(Sound sound){nullptr};
+        Sound (*loadSoundAlias)(Sound sound){nullptr};
+        void (*unloadSoundAlias)(Sound sound){nullptr};
+        void (*playSound)(Sound sound){nullptr};
+        void (*stopSound)(Sound sound){nullptr};
+        bool (*isSoundPlaying)(Sound sound){nullptr};
+        void (*setSoundVolume)(Sound sound, float volume){nullptr};
+        void (*setSoundPitch)(Sound sound, float pitch){nullptr};
+        void (*setSoundPan)(Sound sound, float pan){nullptr};
+        Music (*loadMusicStream)(const char* path){nullptr};
+        void (*unloadMusicStream)(Music music){nullptr};
+        void (*playMusicStream)(Music music){nullptr};
+        void (*pauseMusicStream)(Music music){nullptr};
+        void (*resumeMusicStream)(Music music){nullptr};
+        void (*stopMusicStream)(Music music){nullptr};
+        void (*updateMusicStream)(Music music){nullptr};
+        bool (*isMusicStreamPlaying)(Music music){nullptr};
+        void (*setMusicVolume)(Music music, float volume){nullptr};
+        void (*seekMusicStream)(Music music, float positionSeconds){nullptr};
+        float (*getMusicTimeLength)(Music music){nullptr};
+        float (*getMusicTimePlayed)(Music music){nullptr};
+        // Used only by the software mixer; tables without them fall back to raylib playback.
+        Wave (*loadWave)(const char* path){nullptr};
+        void (*unloadWave)(Wave wave){nullptr};
+        float* (*loadWaveSamples)(Wave wave){nullptr};
+        void (*unloadWaveSamples)(float* samples){nullptr};
+        AudioStream (*loadAudioStream)(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels){nullptr};
+        void (*unloadAudioStream)(AudioStream stream){nullptr};
+        void (*setAudioStreamCallback)(AudioStream stream, AudioCallback callback){nullptr};
+        void (*playAudioStream)(AudioStream stream){nullptr};
+        void (*stopAudioStream)(AudioStream stream){nullptr};
+        // Sizes music streams loaded next (audio.music.buffer_frames); optional.
+        void (*setAudioStreamBufferSizeDefault)(int frames){nullptr};
+        // Loads sounds from mapped sound banks; without it banks are ignored outside the mixer.
+        Sound (*loadSoundFromWave)(Wave wave){nullptr};
+        // Decodes files kept in memory for audio.memory.decode_on_demand_seconds; optional.
+        Wave (*loadWaveFromMemory)(const char* fileType, const unsigned char* data, int dataSize){nullptr};
     };
 
     static void setBackendForTesting(Backend* backend);
     static void setRaylibHooksForTesting(const RaylibHooks* hooks);
+    // Puts music streaming on a clock that only moves in advanceMusicClockForTesting: the stream
+    // thread wakes on it and stream gaps are measured in it. Set before init().
+    static void useManualMusicClockForTesting(bool enabled);
+    // Returns once the stream thread, if running, has made the pass that fell due.
+    static void advanceMusicClockForTesting(std::chrono::milliseconds step);
     static void resetForTesting();
 };
 
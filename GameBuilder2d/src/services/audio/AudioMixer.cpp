@@ -0,0 +1,622 @@
+#include "AudioMixer.h"
+#include "MixerKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
+namespace gb2d::audio {
+namespace {
+
+constexpr float kPi = 3.14159265358979323846f;
+
+float dbToLinear(float db) {
+    return std::pow(10.0f, db / 20.0f);
+}
+
+// Balance pan, as raylib's SetSoundPan: the center leaves both channels at full gain and each side
+// fades the opposite channel out.
+std::pair<float, float> panGains(const MixerVoiceParams& params) {
+    const float pan = std::clamp(params.pan, 0.0f, 1.0f);
+    const float gain = std::max(params.gain, 0.0f);
+    return {gain * std::min(1.0f, 2.0f * (1.0f - pan)), gain * std::min(1.0f, 2.0f * pan)};
+}
+
+class Effect {
+public:
+    virtual ~Effect() = default;
+    virtual void process(float* stereo, std::size_t frames) = 0;
+};
+
+// RBJ cookbook low-pass in transposed direct form II.
+class LowPassEffect final : public Effect {
+public:
+    LowPassEffect(const MixerEffectSettings& settings, std::uint32_t sampleRate) {
+        const float nyquist = 0.5f * static_cast<float>(sampleRate);
+        const float cutoff = std::clamp(settings.cutoffHz, 10.0f, nyquist * 0.95f);
+        const float q = std::max(settings.resonance, 0.1f);
+        const float w0 = 2.0f * kPi * cutoff / static_cast<float>(sampleRate);
+        const float cosW0 = std::cos(w0);
+        const float alpha = std::sin(w0) / (2.0f * q);
+        const float a0 = 1.0f + alpha;
+        b0_ = (1.0f - cosW0) * 0.5f / a0;
+        b1_ = (1.0f - cosW0) / a0;
+        b2_ = b0_;
+        a1_ = -2.0f * cosW0 / a0;
+        a2_ = (1.0f - alpha) / a0;
+    }
+
+    void process(float* stereo, std::size_t frames) override {
+        for (std::size_t i = 0; i < frames; ++i) {
+            for (std::size_t c = 0; c < 2; ++c) {
+                const float x = stereo[i * 2 + c];
+                const float y = b0_ * x + z1_[c];
+                z1_[c] = b1_ * x - a1_ * y + z2_[c];
+                z2_[c] = b2_ * x - a2_ * y;
+                stereo[i * 2 + c] = y;
+            }
+        }
+    }
+
+private:
+    float b0_{1.0f}, b1_{0.0f}, b2_{0.0f}, a1_{0.0f}, a2_{0.0f};
+    std::array<float, 2> z1_{0.0f, 0.0f};
+    std::array<float, 2> z2_{0.0f, 0.0f};
+};
+
+// Feed-forward compressor keyed on the louder channel, with the gain reduction smoothed in dB.
+class CompressorEffect final : public Effect {
+public:
+    CompressorEffect(const MixerEffectSettings& settings, std::uint32_t sampleRate)
+        : thresholdDb_(settings.thresholdDb),
+          slope_(1.0f - 1.0f / std::max(settings.ratio, 1.0f)),
+          makeupDb_(settings.makeupDb) {
+        const float rate = static_cast<float>(sampleRate);
+        attack_ = std::exp(-1.0f / (std::max(settings.attackMs, 0.01f) * 0.001f * rate));
+        release_ = std::exp(-1.0f / (std::max(settings.releaseMs, 0.01f) * 0.001f * rate));
+    }
+
+    void process(float* stereo, std::size_t frames) override {
+        for (std::size_t i = 0; i < frames; ++i) {
+            const float level = std::max(std::fabs(stereo[i * 2]), std::fabs(stereo[i * 2 + 1]));
+            const float levelDb = 20.0f * std::log10(level + 1e-9f);
+            const float target = std::max(levelDb - thresholdDb_, 0.0f) * slope_;
+            const float coeff = target > reductionDb_ ? attack_ : release_;
+            reductionDb_ = target + coeff * (reductionDb_ - target);
+            const float gain = dbToLinear(makeupDb_ - reductionDb_);
+            stereo[i * 2] *= gain;
+            stereo[i * 2 + 1] *= gain;
+        }
+    }
+
+private:
+    float thresholdDb_;
+    float slope_;
+    float makeupDb_;
+    float attack_{0.0f};
+    float release_{0.0f};
+    float reductionDb_{0.0f};
+};
+
+// Freeverb with half the combs: four damped feedback combs in parallel, then two allpasses, per
+// channel. The right channel's delays are offset so the tail decorrelates.
+class ReverbEffect final : public Effect {
+public:
+    ReverbEffect(const MixerEffectSettings& settings, std::uint32_t sampleRate)
+        : feedback_(0.7f + 0.28f * std::clamp(settings.roomSize, 0.0f, 1.0f)),
+          damping_(0.4f * std::clamp(settings.damping, 0.0f, 1.0f)),
+          wet_(std::clamp(settings.wet, 0.0f, 1.0f)) {
+        constexpr std::array<int, 4> kCombTunings{1116, 1188, 1277, 1356};
+        constexpr std::array<int, 2> kAllpassTunings{556, 441};
+        constexpr int kStereoSpread = 23;
+        const float scale = static_cast<float>(sampleRate) / 44100.0f;
+        const auto delay = [scale](int tuning) {
+            return std::max<std::size_t>(1, static_cast<std::size_t>(static_cast<float>(tuning) * scale));
+        };
+        for (std::size_t c = 0; c < 2; ++c) {
+            const int spread = c == 0 ? 0 : kStereoSpread;
+            for (std::size_t k = 0; k < kCombTunings.size(); ++k) {
+                combs_[c][k].buffer.assign(delay(kCombTunings[k] + spread), 0.0f);
+            }
+            for (std::size_t k = 0; k < kAllpassTunings.size(); ++k) {
+                allpasses_[c][k].buffer.assign(delay(kAllpassTunings[k] + spread), 0.0f);
+            }
+        }
+    }
+
+    void process(float* stereo, std::size_t frames) override {
+        constexpr float kInputGain = 0.04f;
+        for (std::size_t i = 0; i < frames; ++i) {
+            const float input = (stereo[i * 2] + stereo[i * 2 + 1]) * kInputGain;
+            for (std::size_t c = 0; c < 2; ++c) {
+                float out = 0.0f;
+                for (auto& comb : combs_[c]) {
+                    const float delayed = comb.buffer[comb.index];
+                    comb.store = delayed * (1.0f - damping_) + comb.store * damping_;
+                    comb.buffer[comb.index] = input + comb.store * feedback_;
+                    comb.index = (comb.index + 1) % comb.buffer.size();
+                    out += delayed;
+                }
+                for (auto& allpass : allpasses_[c]) {
+                    const float delayed = allpass.buffer[allpass.index];
+                    allpass.buffer[allpass.index] = out + delayed * 0.5f;
+                    allpass.index = (allpass.index + 1) % allpass.buffer.size();
+                    out = delayed - out;
+                }
+                float& sample = stereo[i * 2 + c];
+                sample = sample * (1.0f - wet_) + out * wet_;
+            }
+        }
+    }
+
+private:
+    struct Comb {
+        std::vector<float> buffer{};
+        std::size_t index{0};
+        float store{0.0f};
+    };
+    struct Allpass {
+        std::vector<float> buffer{};
+        std::size_t index{0};
+    };
+
+    float feedback_;
+    float damping_;
+    float wet_;
+    std::array<std::array<Comb, 4>, 2> combs_{};
+    std::array<std::array<Allpass, 2>, 2> allpasses_{};
+};
+
+std::unique_ptr<Effect> makeEffect(const MixerEffectSettings& settings, std::uint32_t sampleRate) {
+    switch (settings.type) {
+        case MixerEffectType::LowPass:
+            return std::make_unique<LowPassEffect>(settings, sampleRate);
+        case MixerEffectType::Compressor:
+            return std::make_unique<CompressorEffect>(settings, sampleRate);
+        case MixerEffectType::Reverb:
+            return std::make_unique<ReverbEffect>(settings, sampleRate);
+    }
+    return nullptr;
+}
+
+} // namespace
+
+struct AudioMixer::Bus {
+    std::string name{};
+    int parent{-1};
+    MixerBusSettings settings{};
+    float appliedGain{1.0f}; // gain reached at the end of the last block; ramps start here
+    bool audible{true};
+    std::vector<MixerEffectSettings> effectSettings{};
+    std::vector<std::unique_ptr<Effect>> effects{};
+    std::vector<float> buffer = std::vector<float>(kBlockFrames * 2, 0.0f);
+    // Accumulated across the blocks of one render() call, then published to lastPeak/lastRms.
+    std::array<float, 2> peak{0.0f, 0.0f};
+    std::array<double, 2> sumSquares{0.0, 0.0};
+    std::array<float, 2> lastPeak{0.0f, 0.0f};
+    std::array<float, 2> lastRms{0.0f, 0.0f};
+};
+
+AudioMixer::AudioMixer(std::uint32_t sampleRate) : sampleRate_(sampleRate == 0 ? 48000 : sampleRate) {
+    auto master = std::make_unique<Bus>();
+    master->name = kMasterBus;
+    buses_.push_back(std::move(master));
+    addBus(kMusicBus);
+    addBus(kSfxBus);
+    addBus(kUiBus);
+}
+
+AudioMixer::~AudioMixer() = default;
+
+int AudioMixer::findBusLocked(const std::string& name) const {
+    for (std::size_t i = 0; i < buses_.size(); ++i) {
+        if (buses_[i]->name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool AudioMixer::addBus(const std::string& name, const std::string& parent) {
+    std::scoped_lock lock(mutex_);
+    if (name.empty() || findBusLocked(name) >= 0) {
+        return false;
+    }
+    const int parentIndex = findBusLocked(parent.empty() ? kMasterBus : parent);
+    if (parentIndex < 0) {
+        return false;
+    }
+    auto bus = std::make_unique<Bus>();
+    bus->name = name;
+    bus->parent = parentIndex;
+    buses_.push_back(std::move(bus));
+    refreshAudibleLocked();
+    return true;
+}
+
+bool AudioMixer::hasBus(const std::string& name) const {
+    std::scoped_lock lock(mutex_);
+    return findBusLocked(name) >= 0;
+}
+
+bool AudioMixer::setBusSettings(const std::string& name, const MixerBusSettings& settings) {
+    std::scoped_lock lock(mutex_);
+    const int index = findBusLocked(name);
+    if (index < 0) {
+        return false;
+    }
+    auto& bus = *buses_[static_cast<std::size_t>(index)];
+    bus.settings = settings;
+    bus.settings.gain = std::max(settings.gain, 0.0f);
+    if (framesRendered_ == 0) {
+        bus.appliedGain = bus.settings.gain; // nothing to ramp from before the first render
+    }
+    refreshAudibleLocked();
+    return true;
+}
+
+std::optional<MixerBusSettings> AudioMixer::busSettings(const std::string& name) const {
+    std::scoped_lock lock(mutex_);
+    const int index = findBusLocked(name);
+    if (index < 0) {
+        return std::nullopt;
+    }
+    return buses_[static_cast<std::size_t>(index)]->settings;
+}
+
+bool AudioMixer::setBusEffects(const std::string& name, const std::vector<MixerEffectSettings>& effects) {
+    std::vector<std::unique_ptr<Effect>> chain;
+    for (const auto& effect : effects) {
+        chain.push_back(makeEffect(effect, sampleRate_));
+    }
+    std::scoped_lock lock(mutex_);
+    const int index = findBusLocked(name);
+    if (index < 0) {
+        return false;
+    }
+    auto& bus = *buses_[static_cast<std::size_t>(index)];
+    bus.effectSettings = effects;
+    bus.effects = std::move(chain);
+    return true;
+}
+
+std::vector<std::string> AudioMixer::applyBusConfig(const std::vector<MixerBusConfig>& buses) {
+    std::vector<const MixerBusConfig*> pending;
+    for (const auto& bus : buses) {
+        pending.push_back(&bus);
+    }
+    bool progress = true;
+    while (progress && !pending.empty()) {
+        progress = false;
+        for (auto it = pending.begin(); it != pending.end();) {
+            const auto& bus = **it;
+            if (!hasBus(bus.name) && !addBus(bus.name, bus.parent)) {
+                ++it;
+                continue;
+            }
+            setBusSettings(bus.name, bus.settings);
+            setBusEffects(bus.name, bus.effects);
+            it = pending.erase(it);
+            progress = true;
+        }
+    }
+    std::vector<std::string> rejected;
+    for (const auto* bus : pending) {
+        rejected.push_back(bus->name);
+    }
+    return rejected;
+}
+
+// A muted bus silences everything below it. While any bus is soloed, only soloed buses, the buses
+// feeding them and the path up to master stay audible.
+void AudioMixer::refreshAudibleLocked() {
+    const auto isWithin = [this](std::size_t index, std::size_t ancestor) {
+        for (int at = static_cast<int>(index); at >= 0; at = buses_[static_cast<std::size_t>(at)]->parent) {
+            if (static_cast<std::size_t>(at) == ancestor) {
+                return true;
+            }
+        }
+        return false;
+    };
+    std::vector<std::size_t> soloed;
+    for (std::size_t i = 0; i < buses_.size(); ++i) {
+        if (buses_[i]->settings.solo) {
+            soloed.push_back(i);
+        }
+    }
+    for (std::size_t i = 0; i < buses_.size(); ++i) {
+        bool audible = true;
+        for (int at = static_cast<int>(i); at >= 0; at = buses_[static_cast<std::size_t>(at)]->parent) {
+            audible = audible && !buses_[static_cast<std::size_t>(at)]->settings.muted;
+        }
+        if (audible && !soloed.empty()) {
+            audible = std::any_of(soloed.begin(), soloed.end(), [&](std::size_t solo) {
+                return isWithin(i, solo) || isWithin(solo, i);
+            });
+        }
+        buses_[i]->audible = audible;
+    }
+}
+
+void AudioMixer::setOutputGain(float gain) {
+    std::scoped_lock lock(mutex_);
+    outputGain_ = std::max(gain, 0.0f);
+    if (framesRendered_ == 0) {
+        appliedOutputGain_ = outputGain_;
+    }
+}
+
+MixerVoiceId AudioMixer::startVoice(std::shared_ptr<const PcmBuffer> pcm,
+                                    const std::string& bus,
+                                    const MixerVoiceParams& params,
+                                    bool loop) {
+    if (!pcm || pcm->frames() == 0 || pcm->sampleRate == 0 || pcm->channels == 0 || pcm->channels > 2) {
+        return 0;
+    }
+    std::scoped_lock lock(mutex_);
+    // Stopped voices normally leave during render(); drop them here too in case nothing renders.
+    voices_.erase(std::remove_if(voices_.begin(), voices_.end(), [](const Voice& voice) { return voice.finished; }),
+                  voices_.end());
+    Voice voice;
+    voice.id = nextVoiceId_++;
+    voice.pcm = std::move(pcm);
+    const int busIndex = findBusLocked(bus);
+    voice.bus = busIndex >= 0 ? busIndex : findBusLocked(kSfxBus);
+    voice.params = params;
+    std::tie(voice.gainLeft, voice.gainRight) = panGains(params);
+    voice.loop = loop;
+    voices_.push_back(std::move(voice));
+    return voices_.back().id;
+}
+
+bool AudioMixer::setVoiceParams(MixerVoiceId id, const MixerVoiceParams& params) {
+    std::scoped_lock lock(mutex_);
+    for (auto& voice : voices_) {
+        if (voice.id == id && !voice.finished) {
+            voice.params = params;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AudioMixer::setVoicePaused(MixerVoiceId id, bool paused) {
+    std::scoped_lock lock(mutex_);
+    for (auto& voice : voices_) {
+        if (voice.id == id && !voice.finished) {
+            voice.paused = paused;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AudioMixer::seekVoice(MixerVoiceId id, float positionSeconds) {
+    std::scoped_lock lock(mutex_);
+    for (auto& voice : voices_) {
+        if (voice.id == id && !voice.finished) {
+            const double frame = std::max(0.0, static_cast<double>(positionSeconds) * voice.pcm->sampleRate);
+            voice.position = std::min(frame, static_cast<double>(voice.pcm->frames()));
+            return true;
+        }
+    }
+    return false;
+}
+
+std::optional<float> AudioMixer::voicePosition(MixerVoiceId id) const {
+    std::scoped_lock lock(mutex_);
+    for (const auto& voice : voices_) {
+        if (voice.id == id) {
+            return static_cast<float>(voice.position / voice.pcm->sampleRate);
+        }
+    }
+    return std::nullopt;
+}
+
+bool AudioMixer::stopVoice(MixerVoiceId id) {
+    std::scoped_lock lock(mutex_);
+    for (auto& voice : voices_) {
+        if (voice.id == id && !voice.finished) {
+            voice.finished = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AudioMixer::isVoicePlaying(MixerVoiceId id) const {
+    std::scoped_lock lock(mutex_);
+    for (const auto& voice : voices_) {
+        if (voice.id == id) {
+            return !voice.finished;
+        }
+    }
+    return false;
+}
+
+void AudioMixer::stopAllVoices() {
+    std::scoped_lock lock(mutex_);
+    voices_.clear();
+}
+
+std::size_t AudioMixer::activeVoices() const {
+    std::scoped_lock lock(mutex_);
+    return static_cast<std::size_t>(std::count_if(voices_.begin(), voices_.end(), [](const Voice& voice) {
+        return !voice.finished && !voice.paused;
+    }));
+}
+
+// Unity-rate voices with steady gains copy straight from the source through the SIMD kernels;
+// pitched, resampled or ramping voices take the interpolating path.
+void AudioMixer::mixVoiceLocked(Voice& voice, float* dst, std::size_t frames) {
+    const PcmBuffer& pcm = *voice.pcm;
+    const std::size_t sourceFrames = pcm.frames();
+    const bool stereo = pcm.channels == 2;
+    const auto [targetLeft, targetRight] = panGains(voice.params);
+    const double step = static_cast<double>(std::clamp(voice.params.pitch, 0.125f, 4.0f)) *
+                        static_cast<double>(pcm.sampleRate) / static_cast<double>(sampleRate_);
+
+    if (step == 1.0 && targetLeft == voice.gainLeft && targetRight == voice.gainRight &&
+        voice.position == std::floor(voice.position)) {
+        auto position = static_cast<std::size_t>(voice.position);
+        while (frames > 0) {
+            if (position >= sourceFrames) {
+                if (!voice.loop) {
+                    voice.finished = true;
+                    break;
+                }
+                position = 0;
+            }
+            const std::size_t take = std::min(frames, sourceFrames - position);
+            if (stereo) {
+                kernels::mixStereo(dst, pcm.samples.data() + position * 2, take, targetLeft, targetRight);
+            } else {
+                kernels::mixMonoToStereo(dst, pcm.samples.data() + position, take, targetLeft, targetRight);
+            }
+            dst += take * 2;
+            frames -= take;
+            position += take;
+        }
+        if (!voice.loop && position >= sourceFrames) {
+            voice.finished = true;
+        }
+        voice.position = static_cast<double>(position);
+        return;
+    }
+
+    const auto sampleAt = [&](std::size_t frame, std::size_t channel) {
+        return pcm.samples[frame * pcm.channels + (stereo ? channel : 0)];
+    };
+    const float startLeft = voice.gainLeft;
+    const float startRight = voice.gainRight;
+    const float blockFrames = static_cast<float>(frames);
+    double position = voice.position;
+    for (std::size_t i = 0; i < frames; ++i) {
+        if (position >= static_cast<double>(sourceFrames)) {
+            if (!voice.loop) {
+                voice.finished = true;
+                break;
+            }
+            position = std::fmod(position, static_cast<double>(sourceFrames));
+        }
+        const auto index = static_cast<std::size_t>(position);
+        const auto frac = static_cast<float>(position - static_cast<double>(index));
+        std::size_t next = index + 1;
+        if (next >= sourceFrames) {
+            next = voice.loop ? 0 : index;
+        }
+        const float t = static_cast<float>(i + 1) / blockFrames;
+        const float gainLeft = startLeft + (targetLeft - startLeft) * t;
+        const float gainRight = startRight + (targetRight - startRight) * t;
+        const float left = sampleAt(index, 0) + (sampleAt(next, 0) - sampleAt(index, 0)) * frac;
+        const float right = sampleAt(index, 1) + (sampleAt(next, 1) - sampleAt(index, 1)) * frac;
+        dst[i * 2] += left * gainLeft;
+        dst[i * 2 + 1] += right * gainRight;
+        position += step;
+    }
+    if (!voice.loop && position >= static_cast<double>(sourceFrames)) {
+        voice.finished = true;
+    }
+    voice.position = position;
+    voice.gainLeft = targetLeft;
+    voice.gainRight = targetRight;
+}
+
+void AudioMixer::renderBlockLocked(float* out, std::size_t frames) {
+    const std::size_t count = frames * 2;
+    for (auto& bus : buses_) {
+        std::fill(bus->buffer.begin(), bus->buffer.begin() + static_cast<std::ptrdiff_t>(count), 0.0f);
+    }
+
+    for (auto& voice : voices_) {
+        if (!voice.paused && !voice.finished) {
+            mixVoiceLocked(voice, buses_[static_cast<std::size_t>(voice.bus)]->buffer.data(), frames);
+        }
+    }
+
+    // Children sit after their parents, so walking backwards finishes every bus before its parent.
+    for (std::size_t i = buses_.size(); i-- > 0;) {
+        auto& bus = *buses_[i];
+        if (!bus.audible) {
+            bus.appliedGain = 0.0f;
+            continue;
+        }
+        for (std::size_t e = 0; e < bus.effects.size(); ++e) {
+            if (!bus.effectSettings[e].bypass && bus.effects[e]) {
+                bus.effects[e]->process(bus.buffer.data(), frames);
+            }
+        }
+        const float gain = bus.settings.gain;
+        if (bus.appliedGain != gain) {
+            kernels::applyGainRamp(bus.buffer.data(), frames, bus.appliedGain, gain);
+            bus.appliedGain = gain;
+        } else if (gain != 1.0f) {
+            kernels::applyGain(bus.buffer.data(), count, gain);
+        }
+        const auto levels = kernels::measureStereo(bus.buffer.data(), frames);
+        for (std::size_t c = 0; c < 2; ++c) {
+            bus.peak[c] = std::max(bus.peak[c], levels.peak[c]);
+            bus.sumSquares[c] += levels.sumSquares[c];
+        }
+        if (bus.parent >= 0) {
+            kernels::mixScaled(buses_[static_cast<std::size_t>(bus.parent)]->buffer.data(), bus.buffer.data(), count, 1.0f);
+        }
+    }
+
+    std::copy_n(buses_.front()->buffer.begin(), count, out);
+    if (appliedOutputGain_ != outputGain_) {
+        kernels::applyGainRamp(out, frames, appliedOutputGain_, outputGain_);
+        appliedOutputGain_ = outputGain_;
+    } else if (outputGain_ != 1.0f) {
+        kernels::applyGain(out, count, outputGain_);
+    }
+}
+
+void AudioMixer::render(float* out, std::size_t frames) {
+    std::scoped_lock lock(mutex_);
+    for (auto& bus : buses_) {
+        bus->peak = {0.0f, 0.0f};
+        bus->sumSquares = {0.0, 0.0};
+    }
+    for (std::size_t done = 0; done < frames;) {
+        const std::size_t block = std::min(kBlockFrames, frames - done);
+        renderBlockLocked(out + done * 2, block);
+        done += block;
+    }
+    voices_.erase(std::remove_if(voices_.begin(), voices_.end(), [](const Voice& voice) { return voice.finished; }),
+                  voices_.end());
+    for (auto& bus : buses_) {
+        for (std::size_t c = 0; c < 2; ++c) {
+            bus->lastPeak[c] = bus->peak[c];
+            bus->lastRms[c] = frames == 0 ? 0.0f : static_cast<float>(std::sqrt(bus->sumSquares[c] / static_cast<double>(frames)));
+        }
+    }
+    framesRendered_ += frames;
+}
+
+std::vector<MixerBusMeter> AudioMixer::meters() const {
+    std::scoped_lock lock(mutex_);
+    std::vector<MixerBusMeter> result;
+    result.reserve(buses_.size());
+    for (const auto& bus : buses_) {
+        MixerBusMeter meter;
+        meter.name = bus->name;
+        if (bus->parent >= 0) {
+            meter.parent = buses_[static_cast<std::size_t>(bus->parent)]->name;
+        }
+        meter.settings = bus->settings;
+        meter.audible = bus->audible;
+        meter.peak = bus->lastPeak;
+        meter.rms = bus->lastRms;
+        result.push_back(std::move(meter));
+    }
+    return result;
+}
+
+std::uint64_t AudioMixer::framesRendered() const {
+    std::scoped_lock lock(mutex_);
+    return framesRendered_;
+}
+
+} // namespace gb2d::audio
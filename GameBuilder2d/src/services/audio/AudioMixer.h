@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace gb2d::audio {
+
+// Decoded sample data shared by every voice that plays it. Interleaved, one or two channels.
+struct PcmBuffer {
+    std::vector<float> samples{};
+    std::uint32_t sampleRate{0};
+    std::uint32_t channels{0};
+
+    std::size_t frames() const { return channels == 0 ? 0 : samples.size() / channels; }
+    float durationSeconds() const {
+        return sampleRate == 0 ? 0.0f : static_cast<float>(frames()) / static_cast<float>(sampleRate);
+    }
+};
+
+enum class MixerEffectType {
+    LowPass,    // 12 dB/octave biquad
+    Compressor, // stereo-linked feed-forward peak compressor
+    Reverb      // Schroeder/Freeverb-style comb + allpass network
+};
+
+// One insert effect on a bus. Only the fields of the chosen type are read.
+struct MixerEffectSettings {
+    MixerEffectType type{MixerEffectType::LowPass};
+    bool bypass{false};
+    // LowPass
+    float cutoffHz{8000.0f};
+    float resonance{0.707f};
+    // Compressor
+    float thresholdDb{-12.0f};
+    float ratio{4.0f};
+    float attackMs{5.0f};
+    float releaseMs{100.0f};
+    float makeupDb{0.0f};
+    // Reverb
+    float roomSize{0.5f};
+    float damping{0.5f};
+    float wet{0.25f};
+};
+
+struct MixerBusSettings {
+    float gain{1.0f};
+    bool muted{false};
+    bool solo{false};
+};
+
+// A bus declared in configuration; parent defaults to master.
+struct MixerBusConfig {
+    std::string name{};
+    std::string parent{};
+    MixerBusSettings settings{};
+    std::vector<MixerEffectSettings> effects{};
+};
+
+// Levels of a bus after its effects and gain, over the most recent render() call.
+struct MixerBusMeter {
+    std::string name{};
+    std::string parent{};
+    MixerBusSettings settings{};
+    bool audible{true}; // false when muted, or silenced by a solo elsewhere
+    std::array<float, 2> peak{0.0f, 0.0f};
+    std::array<float, 2> rms{0.0f, 0.0f};
+};
+
+struct MixerVoiceParams {
+    float gain{1.0f};
+    float pan{0.5f};   // 0.0 = left, 0.5 = center, 1.0 = right
+    float pitch{1.0f}; // playback rate multiplier
+};
+
+using MixerVoiceId = std::uint64_t; // 0 is never a valid voice
+
+// In-process float mixer. Voices play PcmBuffers into named buses; each bus runs its insert
+// effects, applies gain/mute/solo and sums into its parent, ending at "master". The built-in buses
+// are master, music, sfx and ui. render() produces interleaved stereo at the mixer's sample rate:
+// the device output calls it from the audio thread and the offline output from the caller. All
+// methods lock an internal mutex, so control calls may come from any thread; they are short, and
+// render() holds the lock only while it mixes, in blocks of kBlockFrames.
+class AudioMixer {
+public:
+    static constexpr const char* kMasterBus = "master";
+    static constexpr const char* kMusicBus = "music";
+    static constexpr const char* kSfxBus = "sfx";
+    static constexpr const char* kUiBus = "ui";
+    static constexpr std::size_t kBlockFrames = 256;
+
+    explicit AudioMixer(std::uint32_t sampleRate = 48000);
+    ~AudioMixer();
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    std::uint32_t sampleRate() const { return sampleRate_; }
+
+    // Adds a bus under `parent` (master when empty). Fails if the name is taken or the parent is unknown.
+    bool addBus(const std::string& name, const std::string& parent = {});
+    bool hasBus(const std::string& name) const;
+    bool setBusSettings(const std::string& name, const MixerBusSettings& settings);
+    std::optional<MixerBusSettings> busSettings(const std::string& name) const;
+    // Replaces the bus's insert chain; effect state (filter history, reverb tail) starts fresh.
+    bool setBusEffects(const std::string& name, const std::vector<MixerEffectSettings>& effects);
+    // Creates or updates buses from configuration, parents before children. Returns the names
+    // that could not be applied (unknown parent or a cycle).
+    std::vector<std::string> applyBusConfig(const std::vector<MixerBusConfig>& buses);
+
+    // Trim after the master bus, e.g. the user's master volume.
+    void setOutputGain(float gain);
+
+    // Starts a voice on `bus` (sfx when unknown). Returns 0 if the buffer is empty.
+    MixerVoiceId startVoice(std::shared_ptr<const PcmBuffer> pcm,
+                            const std::string& bus,
+                            const MixerVoiceParams& params,
+                            bool loop = false);
+    bool setVoiceParams(MixerVoiceId id, const MixerVoiceParams& params);
+    bool setVoicePaused(MixerVoiceId id, bool paused);
+    bool seekVoice(MixerVoiceId id, float positionSeconds);
+    std::optional<float> voicePosition(MixerVoiceId id) const; // seconds into the source
+    bool stopVoice(MixerVoiceId id);
+    // True until the voice is stopped or a non-looping voice reaches its end.
+    bool isVoicePlaying(MixerVoiceId id) const;
+    void stopAllVoices();
+    std::size_t activeVoices() const;
+
+    // Mixes `frames` frames of interleaved stereo into `out`, overwriting it.
+    void render(float* out, std::size_t frames);
+
+    std::vector<MixerBusMeter> meters() const;
+    std::uint64_t framesRendered() const;
+
+private:
+    struct Bus;
+    struct Voice {
+        MixerVoiceId id{0};
+        std::shared_ptr<const PcmBuffer> pcm{};
+        int bus{0};
+        MixerVoiceParams params{};
+        float gainLeft{0.0f}; // gains reached at the end of the last block; ramps start here
+        float gainRight{0.0f};
+        double position{0.0}; // in source frames
+        bool loop{false};
+        bool paused{false};
+        bool finished{false};
+    };
+
+    int findBusLocked(const std::string& name) const;
+    void refreshAudibleLocked();
+    void mixVoiceLocked(Voice& voice, float* dst, std::size_t frames);
+    void renderBlockLocked(float* out, std::size_t frames);
+
+    mutable std::mutex mutex_;
+    std::uint32_t sampleRate_{48000};
+    std::vector<std::unique_ptr<Bus>> buses_{}; // parents always precede their children
+    std::vector<Voice> voices_{};
+    MixerVoiceId nextVoiceId_{1};
+    float outputGain_{1.0f};
+    float appliedOutputGain_{1.0f};
+    std::uint64_t framesRendered_{0};
+};
+
+} // namespace gb2d::audio
@@ -0,0 +1,299 @@
+#include "MixerKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GB2D_MIXER_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define GB2D_MIXER_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace gb2d::audio::kernels {
+
+#if defined(GB2D_MIXER_SSE2)
+
+void mixScaled(float* dst, const float* src, std::size_t count, float gain) {
+    const __m128 g = _mm_set1_ps(gain);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128 a = _mm_loadu_ps(dst + i);
+        __m128 b = _mm_loadu_ps(dst + i + 4);
+        a = _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(src + i), g));
+        b = _mm_add_ps(b, _mm_mul_ps(_mm_loadu_ps(src + i + 4), g));
+        _mm_storeu_ps(dst + i, a);
+        _mm_storeu_ps(dst + i + 4, b);
+    }
+    for (; i < count; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+void mixStereo(float* dst, const float* src, std::size_t frames, float leftGain, float rightGain) {
+    const __m128 g = _mm_setr_ps(leftGain, rightGain, leftGain, rightGain);
+    const std::size_t count = frames * 2;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+    }
+    for (; i < count; i += 2) {
+        dst[i] += src[i] * leftGain;
+        dst[i + 1] += src[i + 1] * rightGain;
+    }
+}
+
+void mixMonoToStereo(float* dst, const float* mono, std::size_t frames, float leftGain, float rightGain) {
+    const __m128 g = _mm_setr_ps(leftGain, rightGain, leftGain, rightGain);
+    std::size_t i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        const __m128 m = _mm_loadu_ps(mono + i);
+        float* out = dst + i * 2;
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_unpacklo_ps(m, m), g)));
+        _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_unpackhi_ps(m, m), g)));
+    }
+    for (; i < frames; ++i) {
+        dst[i * 2] += mono[i] * leftGain;
+        dst[i * 2 + 1] += mono[i] * rightGain;
+    }
+}
+
+void applyGain(float* samples, std::size_t count, float gain) {
+    const __m128 g = _mm_set1_ps(gain);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_loadu_ps(samples + i), g));
+    }
+    for (; i < count; ++i) {
+        samples[i] *= gain;
+    }
+}
+
+void applyGainRamp(float* samples, std::size_t frames, float startGain, float endGain) {
+    if (frames == 0) {
+        return;
+    }
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    // Two frames per vector. Each gain is start + step * (frame + 1), exactly as in the scalar
+    // build, so offline renders are bit-identical across kernels.
+    const __m128 start = _mm_set1_ps(startGain);
+    const __m128 steps = _mm_set1_ps(step);
+    const __m128 two = _mm_set1_ps(2.0f);
+    __m128 index = _mm_setr_ps(1.0f, 1.0f, 2.0f, 2.0f);
+    std::size_t frame = 0;
+    for (; frame + 2 <= frames; frame += 2) {
+        float* out = samples + frame * 2;
+        const __m128 g = _mm_add_ps(start, _mm_mul_ps(steps, index));
+        _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(out), g));
+        index = _mm_add_ps(index, two);
+    }
+    for (; frame < frames; ++frame) {
+        const float gain = startGain + step * static_cast<float>(frame + 1);
+        samples[frame * 2] *= gain;
+        samples[frame * 2 + 1] *= gain;
+    }
+}
+
+StereoLevels measureStereo(const float* samples, std::size_t frames) {
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 peak = _mm_setzero_ps();
+    __m128 sum = _mm_setzero_ps();
+    const std::size_t count = frames * 2;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(samples + i);
+        peak = _mm_max_ps(peak, _mm_and_ps(v, absMask));
+        sum = _mm_add_ps(sum, _mm_mul_ps(v, v));
+    }
+    alignas(16) float peaks[4];
+    alignas(16) float sums[4];
+    _mm_store_ps(peaks, peak);
+    _mm_store_ps(sums, sum);
+    StereoLevels levels;
+    levels.peak = {std::max(peaks[0], peaks[2]), std::max(peaks[1], peaks[3])};
+    levels.sumSquares = {static_cast<double>(sums[0]) + sums[2], static_cast<double>(sums[1]) + sums[3]};
+    for (; i < count; i += 2) {
+        for (std::size_t c = 0; c < 2; ++c) {
+            const float v = samples[i + c];
+            levels.peak[c] = std::max(levels.peak[c], std::fabs(v));
+            levels.sumSquares[c] += static_cast<double>(v) * v;
+        }
+    }
+    return levels;
+}
+
+const char* instructionSet() {
+    return "sse2";
+}
+
+#elif defined(GB2D_MIXER_NEON)
+
+void mixScaled(float* dst, const float* src, std::size_t count, float gain) {
+    const float32x4_t g = vdupq_n_f32(gain);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+        vst1q_f32(dst + i + 4, vmlaq_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), g));
+    }
+    for (; i < count; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+void mixStereo(float* dst, const float* src, std::size_t frames, float leftGain, float rightGain) {
+    const float lanes[4] = {leftGain, rightGain, leftGain, rightGain};
+    const float32x4_t g = vld1q_f32(lanes);
+    const std::size_t count = frames * 2;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+    }
+    for (; i < count; i += 2) {
+        dst[i] += src[i] * leftGain;
+        dst[i + 1] += src[i + 1] * rightGain;
+    }
+}
+
+void mixMonoToStereo(float* dst, const float* mono, std::size_t frames, float leftGain, float rightGain) {
+    const float lanes[4] = {leftGain, rightGain, leftGain, rightGain};
+    const float32x4_t g = vld1q_f32(lanes);
+    std::size_t i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        const float32x4_t m = vld1q_f32(mono + i);
+        const float32x4x2_t pairs = vzipq_f32(m, m);
+        float* out = dst + i * 2;
+        vst1q_f32(out, vmlaq_f32(vld1q_f32(out), pairs.val[0], g));
+        vst1q_f32(out + 4, vmlaq_f32(vld1q_f32(out + 4), pairs.val[1], g));
+    }
+    for (; i < frames; ++i) {
+        dst[i * 2] += mono[i] * leftGain;
+        dst[i * 2 + 1] += mono[i] * rightGain;
+    }
+}
+
+void applyGain(float* samples, std::size_t count, float gain) {
+    const float32x4_t g = vdupq_n_f32(gain);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(samples + i, vmulq_f32(vld1q_f32(samples + i), g));
+    }
+    for (; i < count; ++i) {
+        samples[i] *= gain;
+    }
+}
+
+void applyGainRamp(float* samples, std::size_t frames, float startGain, float endGain) {
+    if (frames == 0) {
+        return;
+    }
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    const float lanes[4] = {1.0f, 1.0f, 2.0f, 2.0f};
+    const float32x4_t start = vdupq_n_f32(startGain);
+    const float32x4_t steps = vdupq_n_f32(step);
+    const float32x4_t two = vdupq_n_f32(2.0f);
+    float32x4_t index = vld1q_f32(lanes);
+    std::size_t frame = 0;
+    for (; frame + 2 <= frames; frame += 2) {
+        float* out = samples + frame * 2;
+        const float32x4_t g = vaddq_f32(start, vmulq_f32(steps, index));
+        vst1q_f32(out, vmulq_f32(vld1q_f32(out), g));
+        index = vaddq_f32(index, two);
+    }
+    for (; frame < frames; ++frame) {
+        const float gain = startGain + step * static_cast<float>(frame + 1);
+        samples[frame * 2] *= gain;
+        samples[frame * 2 + 1] *= gain;
+    }
+}
+
+StereoLevels measureStereo(const float* samples, std::size_t frames) {
+    float32x4_t peak = vdupq_n_f32(0.0f);
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    const std::size_t count = frames * 2;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t v = vld1q_f32(samples + i);
+        peak = vmaxq_f32(peak, vabsq_f32(v));
+        sum = vmlaq_f32(sum, v, v);
+    }
+    float peaks[4];
+    float sums[4];
+    vst1q_f32(peaks, peak);
+    vst1q_f32(sums, sum);
+    StereoLevels levels;
+    levels.peak = {std::max(peaks[0], peaks[2]), std::max(peaks[1], peaks[3])};
+    levels.sumSquares = {static_cast<double>(sums[0]) + sums[2], static_cast<double>(sums[1]) + sums[3]};
+    for (; i < count; i += 2) {
+        for (std::size_t c = 0; c < 2; ++c) {
+            const float v = samples[i + c];
+            levels.peak[c] = std::max(levels.peak[c], std::fabs(v));
+            levels.sumSquares[c] += static_cast<double>(v) * v;
+        }
+    }
+    return levels;
+}
+
+const char* instructionSet() {
+    return "neon";
+}
+
+#else
+
+void mixScaled(float* dst, const float* src, std::size_t count, float gain) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+void mixStereo(float* dst, const float* src, std::size_t frames, float leftGain, float rightGain) {
+    for (std::size_t i = 0; i < frames; ++i) {
+        dst[i * 2] += src[i * 2] * leftGain;
+        dst[i * 2 + 1] += src[i * 2 + 1] * rightGain;
+    }
+}
+
+void mixMonoToStereo(float* dst, const float* mono, std::size_t frames, float leftGain, float rightGain) {
+    for (std::size_t i = 0; i < frames; ++i) {
+        dst[i * 2] += mono[i] * leftGain;
+        dst[i * 2 + 1] += mono[i] * rightGain;
+    }
+}
+
+void applyGain(float* samples, std::size_t count, float gain) {
+    for (std::size_t i = 0; i < count; ++i) {
+        samples[i] *= gain;
+    }
+}
+
+void applyGainRamp(float* samples, std::size_t frames, float startGain, float endGain) {
+    if (frames == 0) {
+        return;
+    }
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        const float gain = startGain + step * static_cast<float>(frame + 1);
+        samples[frame * 2] *= gain;
+        samples[frame * 2 + 1] *= gain;
+    }
+}
+
+StereoLevels measureStereo(const float* samples, std::size_t frames) {
+    StereoLevels levels;
+    for (std::size_t i = 0; i < frames; ++i) {
+        for (std::size_t c = 0; c < 2; ++c) {
+            const float v = samples[i * 2 + c];
+            levels.peak[c] = std::max(levels.peak[c], std::fabs(v));
+            levels.sumSquares[c] += static_cast<double>(v) * v;
+        }
+    }
+    return levels;
+}
+
+const char* instructionSet() {
+    return "scalar";
+}
+
+#endif
+
+} // namespace gb2d::audio::kernels
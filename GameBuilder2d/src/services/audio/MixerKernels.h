@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace gb2d::audio::kernels {
+
+// Inner loops of the software mixer. Buffers are interleaved stereo floats unless noted. Each
+// kernel has an SSE2 (x86-64) or NEON (arm64) body with a scalar tail, and a plain scalar build
+// elsewhere; all variants produce the same results up to float rounding.
+
+// dst[i] += src[i] * gain over `count` floats.
+void mixScaled(float* dst, const float* src, std::size_t count, float gain);
+
+// dst += src with separate left/right gains.
+void mixStereo(float* dst, const float* src, std::size_t frames, float leftGain, float rightGain);
+
+// dst += mono source spread to both channels with separate left/right gains.
+void mixMonoToStereo(float* dst, const float* mono, std::size_t frames, float leftGain, float rightGain);
+
+// samples *= gain over `count` floats.
+void applyGain(float* samples, std::size_t count, float gain);
+
+// Ramps the gain linearly from `startGain` to `endGain` across the block to avoid zipper noise.
+void applyGainRamp(float* samples, std::size_t frames, float startGain, float endGain);
+
+struct StereoLevels {
+    std::array<float, 2> peak{0.0f, 0.0f};
+    std::array<double, 2> sumSquares{0.0, 0.0};
+};
+
+StereoLevels measureStereo(const float* samples, std::size_t frames);
+
+// "sse2", "neon" or "scalar".
+const char* instructionSet();
+
+} // namespace gb2d::audio::kernels
@@ -0,0 +1,151 @@
+#include "OfflineAudioBackend.h"
+
+#include "services/logger/LogManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace gb2d::audio {
+
+using gb2d::logging::LogManager;
+
+namespace {
+
+Sound inertLoadSound(const char*) { return Sound{}; }
+Sound inertLoadSoundAlias(Sound) { return Sound{}; }
+void inertSound(Sound) {}
+bool inertSoundPlaying(Sound) { return false; }
+void inertSoundFloat(Sound, float) {}
+Music inertLoadMusic(const char*) { return Music{}; }
+void inertMusic(Music) {}
+bool inertMusicPlaying(Music) { return false; }
+void inertMusicFloat(Music, float) {}
+float inertMusicTime(Music) { return 0.0f; }
+
+void putU16(std::vector<std::uint8_t>& out, std::uint16_t value) {
+    out.push_back(static_cast<std::uint8_t>(value & 0xFF));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void putU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<std::uint8_t>((value >> shift) & 0xFF));
+    }
+}
+
+void putTag(std::vector<std::uint8_t>& out, const char (&tag)[5]) {
+    out.insert(out.end(), tag, tag + 4);
+}
+
+} // namespace
+
+OfflineAudioBackend::OfflineAudioBackend(std::uint32_t sampleRate)
+    : sampleRate_(std::clamp<std::uint32_t>(sampleRate, 8000, 192000)) {}
+
+void OfflineAudioBackend::consumeOfflineAudio(const float* interleavedStereo, std::size_t frames) {
+    samples_.insert(samples_.end(), interleavedStereo, interleavedStereo + frames * 2);
+}
+
+const AudioManager::RaylibHooks& OfflineAudioBackend::hooks() {
+    static const AudioManager::RaylibHooks api{
+        .loadSound = inertLoadSound,
+        .unloadSound = inertSound,
+        .loadSoundAlias = inertLoadSoundAlias,
+        .unloadSoundAlias = inertSound,
+        .playSound = inertSound,
+        .stopSound = inertSound,
+        .isSoundPlaying = inertSoundPlaying,
+        .setSoundVolume = inertSoundFloat,
+        .setSoundPitch = inertSoundFloat,
+        .setSoundPan = inertSoundFloat,
+        .loadMusicStream = inertLoadMusic,
+        .unloadMusicStream = inertMusic,
+        .playMusicStream = inertMusic,
+        .pauseMusicStream = inertMusic,
+        .resumeMusicStream = inertMusic,
+        .stopMusicStream = inertMusic,
+        .updateMusicStream = inertMusic,
+        .isMusicStreamPlaying = inertMusicPlaying,
+        .setMusicVolume = inertMusicFloat,
+        .seekMusicStream = inertMusicFloat,
+        .getMusicTimeLength = inertMusicTime,
+        .getMusicTimePlayed = inertMusicTime,
+        .loadWave = &LoadWave,
+        .unloadWave = &UnloadWave,
+        .loadWaveSamples = &LoadWaveSamples,
+        .unloadWaveSamples = &UnloadWaveSamples,
+        .loadWaveFromMemory = &LoadWaveFromMemory};
+    return api;
+}
+
+void OfflineAudioBackend::install() {
+    AudioManager::setBackendForTesting(this);
+    AudioManager::setRaylibHooksForTesting(&hooks());
+}
+
+std::vector<std::int16_t> OfflineAudioBackend::pcm16() const {
+    std::vector<std::int16_t> pcm(samples_.size());
+    std::transform(samples_.begin(), samples_.end(), pcm.begin(), [](float sample) {
+        const float clamped = std::clamp(sample, -1.0f, 1.0f);
+        return static_cast<std::int16_t>(std::lround(clamped * 32767.0f));
+    });
+    return pcm;
+}
+
+std::vector<std::uint8_t> OfflineAudioBackend::encodeWav() const {
+    constexpr std::uint16_t kChannels = 2;
+    constexpr std::uint16_t kBitsPerSample = 16;
+    constexpr std::uint16_t kBlockAlign = kChannels * kBitsPerSample / 8;
+    const auto pcm = pcm16();
+    const auto dataBytes = static_cast<std::uint32_t>(pcm.size() * sizeof(std::int16_t));
+
+    std::vector<std::uint8_t> out;
+    out.reserve(44 + dataBytes);
+    putTag(out, "RIFF");
+    putU32(out, 36 + dataBytes);
+    putTag(out, "WAVE");
+    putTag(out, "fmt ");
+    putU32(out, 16);
+    putU16(out, 1); // PCM
+    putU16(out, kChannels);
+    putU32(out, sampleRate_);
+    putU32(out, sampleRate_ * kBlockAlign);
+    putU16(out, kBlockAlign);
+    putU16(out, kBitsPerSample);
+    putTag(out, "data");
+    putU32(out, dataBytes);
+    for (std::int16_t sample : pcm) {
+        putU16(out, static_cast<std::uint16_t>(sample));
+    }
+    return out;
+}
+
+bool OfflineAudioBackend::writeWav(const std::filesystem::path& path) const {
+    const auto bytes = encodeWav();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        LogManager::error("OfflineAudioBackend could not open '{}' for writing", path.string());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        LogManager::error("OfflineAudioBackend failed to write '{}'", path.string());
+        return false;
+    }
+    return true;
+}
+
+std::uint64_t OfflineAudioBackend::checksum() const {
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::int16_t sample : pcm16()) {
+        const auto bits = static_cast<std::uint16_t>(sample);
+        for (std::uint16_t byte : {static_cast<std::uint16_t>(bits & 0xFF), static_cast<std::uint16_t>(bits >> 8)}) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+} // namespace gb2d::audio
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "AudioManager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace gb2d::audio {
+
+// Audio backend for CI and regression tests: no device is opened. Once installed, init() runs the
+// software mixer at this backend's sample rate, and every AudioManager::tick(dt) appends dt
+// seconds of the mix to an in-memory capture. A scripted session therefore renders as fast as
+// the CPU allows, and identical scripts yield identical samples, which checksum() condenses for
+// golden comparisons.
+//
+// The capture is not synchronized: read it from the thread that ticks, between ticks.
+class OfflineAudioBackend final : public AudioManager::Backend {
+public:
+    explicit OfflineAudioBackend(std::uint32_t sampleRate = 48000);
+
+    void initDevice() override { ready_ = true; }
+    void closeDevice() override { ready_ = false; }
+    bool isDeviceReady() override { return ready_; }
+    void setMasterVolume(float) override {} // the mixer applies the master volume itself
+    std::uint32_t offlineSampleRate() override { return sampleRate_; }
+    void consumeOfflineAudio(const float* interleavedStereo, std::size_t frames) override;
+
+    // Decodes files with raylib's LoadWave/LoadWaveSamples, which need no audio device. Sound and
+    // stream entry points are inert because the mixer never uses them.
+    static const AudioManager::RaylibHooks& hooks();
+
+    // Points AudioManager at this backend and hooks(). Call before AudioManager::init(); undo with
+    // AudioManager::resetForTesting().
+    void install();
+
+    std::uint32_t sampleRate() const { return sampleRate_; }
+    const std::vector<float>& samples() const { return samples_; } // interleaved stereo
+    std::size_t frames() const { return samples_.size() / 2; }
+    double durationSeconds() const { return static_cast<double>(frames()) / sampleRate_; }
+    void clear() { samples_.clear(); }
+
+    // The capture as 16-bit PCM (clamped, rounded to nearest), as written to WAV files.
+    std::vector<std::int16_t> pcm16() const;
+    // A complete 16-bit stereo RIFF/WAVE file.
+    std::vector<std::uint8_t> encodeWav() const;
+    bool writeWav(const std::filesystem::path& path) const;
+    // FNV-1a over the 16-bit PCM. Quantizing first keeps the value stable under float rounding
+    // differences too small to hear.
+    std::uint64_t checksum() const;
+
+private:
+    std::uint32_t sampleRate_{48000};
+    bool ready_{false};
+    std::vector<float> samples_{};
+};
+
+} // namespace gb2d::audio
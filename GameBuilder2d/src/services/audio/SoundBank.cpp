@@ -0,0 +1,250 @@
+#include "SoundBank.h"
+
+#include "services/logger/LogManager.h"
+
+#include <raylib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <system_error>
+#include <type_traits>
+
+namespace gb2d::audio {
+
+using gb2d::logging::LogManager;
+
+namespace {
+
+// On-disk layout (host byte order; every supported target is little-endian):
+//   FileHeader | SoundRecord[soundCount], sorted by name | name blob | PCM data
+// Sections and each sound's PCM are 8-byte aligned. Names in the blob are not NUL-terminated.
+constexpr char kMagic[8] = {'G', 'B', '2', 'D', 'B', 'N', 'K', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t soundCount;
+    std::uint32_t recordsOffset;
+    std::uint32_t namesOffset;
+    std::uint32_t namesSize;
+    std::uint32_t reserved;
+};
+
+struct SoundRecord {
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+    std::uint32_t sampleRate;
+    std::uint32_t channels;
+    std::uint32_t frameCount;
+    std::uint32_t reserved;
+    std::uint64_t dataOffset;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) == 32);
+static_assert(std::is_trivially_copyable_v<SoundRecord> && sizeof(SoundRecord) == 32);
+
+std::uint64_t alignTo8(std::uint64_t value) {
+    return (value + 7u) & ~std::uint64_t{7};
+}
+
+template <typename T>
+T readPod(const std::byte* source) {
+    T value;
+    std::memcpy(&value, source, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+std::shared_ptr<const SoundBank> SoundBank::open(const std::filesystem::path& path) {
+    auto mapped = filesystem::MappedFile::open(path);
+    if (!mapped || mapped->size() < sizeof(FileHeader)) {
+        return nullptr;
+    }
+
+    const auto header = readPod<FileHeader>(mapped->data());
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+        return nullptr;
+    }
+    const std::uint64_t fileSize = mapped->size();
+    const auto fits = [fileSize](std::uint64_t offset, std::uint64_t count, std::uint64_t stride) {
+        return offset <= fileSize && count * stride <= fileSize - offset;
+    };
+    if (!fits(header.recordsOffset, header.soundCount, sizeof(SoundRecord)) ||
+        !fits(header.namesOffset, header.namesSize, 1)) {
+        return nullptr;
+    }
+    // Every sound's PCM must lie inside the file; checked once here so sound() can trust it.
+    const std::byte* base = mapped->data();
+    for (std::uint32_t i = 0; i < header.soundCount; ++i) {
+        const auto record = readPod<SoundRecord>(base + header.recordsOffset + i * sizeof(SoundRecord));
+        if (record.channels == 0 || record.sampleRate == 0 || record.dataOffset % alignof(std::int16_t) != 0 ||
+            static_cast<std::uint64_t>(record.nameOffset) + record.nameLength > header.namesSize ||
+            !fits(record.dataOffset, static_cast<std::uint64_t>(record.frameCount) * record.channels, sizeof(std::int16_t))) {
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<SoundBank> bank(new SoundBank());
+    bank->records_ = base + header.recordsOffset;
+    bank->names_ = reinterpret_cast<const char*>(base + header.namesOffset);
+    bank->file_ = std::move(*mapped);
+    bank->path_ = path;
+    bank->soundCount_ = header.soundCount;
+    bank->namesSize_ = header.namesSize;
+    return bank;
+}
+
+bool SoundBank::write(const std::filesystem::path& path, std::span<const SoundBankEntry> sounds) {
+    std::vector<std::size_t> order(sounds.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&sounds](std::size_t a, std::size_t b) {
+        return sounds[a].name < sounds[b].name;
+    });
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        if (sounds[order[i - 1]].name == sounds[order[i]].name) {
+            return false;
+        }
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.soundCount = static_cast<std::uint32_t>(sounds.size());
+    header.recordsOffset = static_cast<std::uint32_t>(alignTo8(sizeof(FileHeader)));
+
+    std::string names;
+    std::vector<SoundRecord> records(sounds.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const SoundBankEntry& sound = sounds[order[i]];
+        if (sound.channels == 0 || sound.sampleRate == 0 || sound.samples.size() % sound.channels != 0) {
+            return false;
+        }
+        SoundRecord& record = records[i];
+        record = SoundRecord{};
+        record.nameOffset = static_cast<std::uint32_t>(names.size());
+        record.nameLength = static_cast<std::uint32_t>(sound.name.size());
+        record.sampleRate = sound.sampleRate;
+        record.channels = sound.channels;
+        record.frameCount = static_cast<std::uint32_t>(sound.samples.size() / sound.channels);
+        names += sound.name;
+    }
+    header.namesOffset = static_cast<std::uint32_t>(alignTo8(header.recordsOffset + records.size() * sizeof(SoundRecord)));
+    header.namesSize = static_cast<std::uint32_t>(names.size());
+
+    std::uint64_t dataOffset = alignTo8(header.namesOffset + names.size());
+    std::uint64_t fileSize = dataOffset;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        records[i].dataOffset = dataOffset;
+        fileSize = dataOffset + sounds[order[i]].samples.size() * sizeof(std::int16_t);
+        dataOffset = alignTo8(fileSize);
+    }
+
+    std::vector<std::byte> buffer(static_cast<std::size_t>(fileSize));
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + header.recordsOffset, records.data(), records.size() * sizeof(SoundRecord));
+    std::memcpy(buffer.data() + header.namesOffset, names.data(), names.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const auto& samples = sounds[order[i]].samples;
+        std::memcpy(buffer.data() + records[i].dataOffset, samples.data(), samples.size() * sizeof(std::int16_t));
+    }
+
+    // Write beside the target and rename so a running game never maps a half-written bank.
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+bool SoundBank::pack(const std::filesystem::path& path,
+                     const std::filesystem::path& root,
+                     std::span<const std::string> identifiers) {
+    std::vector<SoundBankEntry> sounds;
+    sounds.reserve(identifiers.size());
+    for (const auto& identifier : identifiers) {
+        const auto file = (root / identifier).string();
+        Wave wave = LoadWave(file.c_str());
+        if (wave.frameCount == 0 || wave.channels == 0 || wave.data == nullptr) {
+            LogManager::error("SoundBank could not decode '{}'", file);
+            return false;
+        }
+        float* decoded = LoadWaveSamples(wave);
+        if (!decoded) {
+            UnloadWave(wave);
+            LogManager::error("SoundBank could not decode '{}'", file);
+            return false;
+        }
+        SoundBankEntry entry;
+        entry.name = std::filesystem::path(identifier).generic_string();
+        entry.sampleRate = wave.sampleRate;
+        entry.channels = wave.channels;
+        entry.samples.resize(static_cast<std::size_t>(wave.frameCount) * wave.channels);
+        // LoadWaveSamples divides 16-bit samples by 32768, so 16-bit sources round-trip exactly.
+        std::transform(decoded, decoded + entry.samples.size(), entry.samples.begin(), [](float sample) {
+            return static_cast<std::int16_t>(std::clamp<long>(std::lround(sample * 32768.0f), -32768, 32767));
+        });
+        UnloadWaveSamples(decoded);
+        UnloadWave(wave);
+        sounds.push_back(std::move(entry));
+    }
+    if (!write(path, sounds)) {
+        LogManager::error("SoundBank failed to write '{}'", path.string());
+        return false;
+    }
+    LogManager::info("SoundBank packed {} sound(s) into '{}'", sounds.size(), path.string());
+    return true;
+}
+
+std::optional<std::size_t> SoundBank::find(std::string_view name) const {
+    std::size_t low = 0;
+    std::size_t high = soundCount_;
+    while (low < high) {
+        const std::size_t middle = low + (high - low) / 2;
+        const auto record = readPod<SoundRecord>(records_ + middle * sizeof(SoundRecord));
+        const std::string_view candidate(names_ + record.nameOffset, record.nameLength);
+        if (candidate == name) {
+            return middle;
+        }
+        if (candidate < name) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return std::nullopt;
+}
+
+SoundBankSound SoundBank::sound(std::size_t index) const {
+    SoundBankSound sound{};
+    if (index >= soundCount_) {
+        return sound;
+    }
+    const auto record = readPod<SoundRecord>(records_ + index * sizeof(SoundRecord));
+    sound.name = std::string_view(names_ + record.nameOffset, record.nameLength);
+    sound.sampleRate = record.sampleRate;
+    sound.channels = record.channels;
+    sound.frameCount = record.frameCount;
+    sound.samples = reinterpret_cast<const std::int16_t*>(file_.data() + record.dataOffset);
+    return sound;
+}
+
+} // namespace gb2d::audio
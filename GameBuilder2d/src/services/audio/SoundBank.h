@@ -0,0 +1,70 @@
+#pragma once
+
+#include "services/filesystem/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gb2d::audio {
+
+// One sound to pack: 16-bit interleaved PCM under the identifier games pass to acquireSound.
+struct SoundBankEntry {
+    std::string name{};
+    std::uint32_t sampleRate{0};
+    std::uint32_t channels{0};
+    std::vector<std::int16_t> samples{};
+};
+
+// A sound inside a mapped bank. `samples` points into the mapping and lives as long as the bank.
+struct SoundBankSound {
+    std::string_view name{};
+    std::uint32_t sampleRate{0};
+    std::uint32_t channels{0};
+    std::uint32_t frameCount{0};
+    const std::int16_t* samples{nullptr};
+};
+
+// Memory-mapped ".gb2dbank" file: many sound effects decoded ahead of time to 16-bit PCM, with a
+// name-sorted index. Opening a bank maps it and validates the header; sounds are read straight
+// from the mapping, so loading one costs no filesystem probe and no decode.
+class SoundBank {
+public:
+    static constexpr std::string_view kExtension = ".gb2dbank";
+
+    static std::shared_ptr<const SoundBank> open(const std::filesystem::path& path);
+
+    // Names must be unique. They are the identifiers the packed files would be acquired with,
+    // relative to the bank's directory (e.g. "spaceinvaders/hit.wav").
+    static bool write(const std::filesystem::path& path, std::span<const SoundBankEntry> sounds);
+
+    // Decodes root/identifier for every identifier with raylib's LoadWave and writes the bank.
+    // Fails without writing anything if a file cannot be decoded.
+    static bool pack(const std::filesystem::path& path,
+                     const std::filesystem::path& root,
+                     std::span<const std::string> identifiers);
+
+    std::size_t soundCount() const { return soundCount_; }
+    std::optional<std::size_t> find(std::string_view name) const;
+    SoundBankSound sound(std::size_t index) const;
+    const std::filesystem::path& path() const { return path_; }
+    std::size_t sizeBytes() const { return file_.size(); }
+
+private:
+    SoundBank() = default;
+
+    filesystem::MappedFile file_{};
+    std::filesystem::path path_{};
+    std::size_t soundCount_{0};
+    const std::byte* records_{nullptr};
+    const char* names_{nullptr};
+    std::uint32_t namesSize_{0};
+};
+
+} // namespace gb2d::audio
@@ -0,0 +1,45 @@
+#include "SpatialAudio.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gb2d::audio {
+
+float spatialGain(const SpatialSettings& settings, float distance) {
+    const float minDistance = std::max(settings.minDistance, 0.0f);
+    const float maxDistance = std::max(settings.maxDistance, minDistance);
+    if (settings.curve == AttenuationCurve::None || distance <= minDistance) {
+        return 1.0f;
+    }
+    if (distance >= maxDistance) {
+        return 0.0f;
+    }
+    const float rolloff = std::max(settings.rolloff, 0.0f);
+    switch (settings.curve) {
+        case AttenuationCurve::Linear:
+            return 1.0f - (distance - minDistance) / (maxDistance - minDistance);
+        case AttenuationCurve::Inverse:
+            if (minDistance <= 0.0f) {
+                return 0.0f;
+            }
+            return minDistance / (minDistance + rolloff * (distance - minDistance));
+        case AttenuationCurve::Exponential:
+            if (minDistance <= 0.0f) {
+                return 0.0f;
+            }
+            return std::pow(distance / minDistance, -rolloff);
+        case AttenuationCurve::None:
+            break;
+    }
+    return 1.0f;
+}
+
+float spatialPan(const AudioListener& listener, Vector2 position) {
+    if (listener.panWidth <= 0.0f) {
+        return 0.5f;
+    }
+    const float offset = (position.x - listener.position.x) / listener.panWidth;
+    return 0.5f + 0.5f * std::clamp(offset, -1.0f, 1.0f);
+}
+
+} // namespace gb2d::audio
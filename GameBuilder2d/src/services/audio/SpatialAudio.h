@@ -0,0 +1,37 @@
+#pragma once
+
+#include "raylib.h"
+
+namespace gb2d::audio {
+
+// How a positional sound fades with its distance `d` from the listener. Every curve is 1 inside
+// minDistance; all but None are 0 from maxDistance on.
+enum class AttenuationCurve {
+    None,        // no fading; the sound is only panned
+    Linear,      // 1 - (d - min) / (max - min)
+    Inverse,     // min / (min + rolloff * (d - min)), as OpenAL's clamped inverse model
+    Exponential  // (d / min) ^ -rolloff
+};
+
+struct SpatialSettings {
+    AttenuationCurve curve{AttenuationCurve::Linear};
+    float minDistance{64.0f};
+    float maxDistance{1024.0f};
+    float rolloff{1.0f};
+};
+
+// Where sounds are heard from, in the same world units as emitter positions. A sound panWidth
+// units to either side of the listener is panned fully to that side. Panning depends on the
+// horizontal offset only and there is no doppler shift.
+struct AudioListener {
+    Vector2 position{0.0f, 0.0f};
+    float panWidth{512.0f};
+};
+
+// Gain in [0, 1] for a sound `distance` units from the listener.
+float spatialGain(const SpatialSettings& settings, float distance);
+
+// Pan in [0, 1] (0.5 = center) for a sound at `position`.
+float spatialPan(const AudioListener& listener, Vector2 position);
+
+} // namespace gb2d::audio
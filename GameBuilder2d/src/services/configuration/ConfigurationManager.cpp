@@ -201,9 +201,74 @@ json buildHotkeyDefaultsArray() {
 					.defaultBool(false)
 					.advanced();
 			});
+			section.field("textures.bake_atlases", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Bake Atlases")
+					.description("Write a binary .gb2datlas next to each atlas JSON after parsing it. Up-to-date baked files are always preferred over the JSON.")
+					.defaultBool(false)
+					.advanced();
+			});
+			section.field("textures.compressed_upload", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Keep Textures Compressed")
+					.description("Upload BC1/BC3/ETC2 textures from .dds/.ktx2 files in their compressed form. When disabled, or when the GPU rejects the format, they are decoded to RGBA8 on the CPU.")
+					.defaultBool(true)
+					.advanced();
+			});
+			section.field("textures.decoded_cache_dir", ConfigFieldType::Path, [](ConfigFieldBuilder& field) {
+				field.label("Decoded Image Cache")
+					.description("Directory holding decoded PNG/JPG/BMP pixels keyed by file content, so later launches skip decoding. Leave empty to disable.")
+					.defaultString("")
+					.advanced();
+				field.uiHint("pathMode", "directory");
+				field.uiHint("placeholder", "cache/textures");
+			});
+			section.field("textures.decoded_cache_max_bytes", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Decoded Image Cache Limit (bytes)")
+					.description("Size cap for the decoded image cache. Oldest entries are deleted at startup until the cache fits. 0 disables the limit.")
+					.defaultInt(268435456)
+					.min(0.0)
+					.step(1048576.0)
+					.advanced();
+				field.uiHint("placeholder", "0 (unlimited)");
+			});
+			section.field("textures.preload", ConfigFieldType::JsonBlob, [](ConfigFieldBuilder& field) {
+				field.label("Preload Groups")
+					.description("Textures loaded in parallel before they are needed: an object mapping a group (\"startup\" or a game id) to a list of identifiers.")
+					.defaultJson(json::object())
+					.advanced();
+			});
+			section.field("textures.hot_reload", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Hot Reload")
+					.description("Watch loaded textures and atlas JSON files and reload the ones whose contents change.")
+					.defaultBool(false)
+					.advanced();
+			});
+			section.field("textures.hot_reload_polling", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Hot Reload Polling")
+					.description("Poll file timestamps instead of using native file events (e.g. for network drives).")
+					.defaultBool(false)
+					.advanced();
+			});
+			section.field("textures.hot_reload_debounce_ms", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Hot Reload Debounce (ms)")
+					.description("A changed file is reloaded once it has seen no further writes for this long.")
+					.defaultInt(200)
+					.min(0.0)
+					.max(5000.0)
+					.step(50.0)
+					.advanced();
+			});
+			section.field("textures.hot_reload_poll_ms", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Hot Reload Poll Interval (ms)")
+					.description("How often watched files are checked when polling.")
+					.defaultInt(500)
+					.min(0.0)
+					.max(10000.0)
+					.step(100.0)
+					.advanced();
+			});
 			section.field("textures.max_bytes", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
 				field.label("Memory Budget (bytes)")
-					.description("Optional soft cap for texture memory. 0 disables the limit.")
+					.description("Texture memory budget. Released textures stay cached and are evicted least-recently-used first when over budget. 0 disables the limit.")
 					.defaultInt(0)
 					.min(0.0)
 					.step(1048576.0)
@@ -218,6 +283,65 @@ json buildHotkeyDefaultsArray() {
 				field.uiHint("pathMode", "file");
 				field.uiHint("placeholder", "assets/textures/missing.png");
 			});
+			section.field("textures.pack_small_textures", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Pack Small Sprites")
+					.description("Pack images requested through acquireSprite into shared atlas pages to cut texture binds.")
+					.defaultBool(false)
+					.advanced();
+			});
+			section.field("textures.pack_max_dimension", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Packed Sprite Max Size")
+					.description("Images whose width and height are at or below this size (pixels) are packed.")
+					.defaultInt(64)
+					.min(8.0)
+					.max(1024.0)
+					.step(8.0)
+					.advanced();
+			});
+			section.field("textures.pack_page_size", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Sprite Page Size")
+					.description("Width and height of each shared sprite page texture.")
+					.defaultInt(1024)
+					.min(256.0)
+					.max(8192.0)
+					.step(256.0)
+					.advanced();
+			});
+			section.field("textures.pack_padding", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Sprite Padding")
+					.description("Transparent gutter (pixels) between packed sprites to avoid filtering bleed.")
+					.defaultInt(1)
+					.min(0.0)
+					.max(16.0)
+					.step(1.0)
+					.advanced();
+			});
+			section.field("textures.async_workers", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Async Decode Workers")
+					.description("Worker threads used to decode images requested through acquireAsync.")
+					.defaultInt(2)
+					.min(1.0)
+					.max(16.0)
+					.step(1.0)
+					.advanced();
+			});
+			section.field("textures.async_uploads_per_frame", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Async Uploads Per Frame")
+					.description("Maximum decoded images uploaded to the GPU per frame. 0 uploads everything that is ready.")
+					.defaultInt(4)
+					.min(0.0)
+					.step(1.0)
+					.advanced();
+			});
+			section.field("textures.async_upload_budget_ms", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+				field.label("Async Upload Budget (ms)")
+					.description("Per-frame time budget for async texture uploads. 0 disables the time limit.")
+					.defaultFloat(2.0)
+					.min(0.0)
+					.step(0.5)
+					.precision(1)
+					.advanced();
+			});
 		});
 
 		builder.section("audio", [](ConfigSectionBuilder& section) {
@@ -237,6 +361,12 @@ json buildHotkeyDefaultsArray() {
 						.defaultBool(true)
 						.advanced();
 				});
+				core.field("audio.core.coalesce_events", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+					field.label("Coalesce Events")
+						.description("Fold repeats of an audio event within a frame into one event with a count.")
+						.defaultBool(false)
+						.advanced();
+				});
 			});
 
 			section.section("audio.volumes", [](ConfigSectionBuilder& volumes) {
@@ -281,6 +411,15 @@ json buildHotkeyDefaultsArray() {
 						.step(1.0)
 						.advanced();
 				});
+				engine.field("audio.engine.alias_pool_size", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+					field.label("Alias Pool Size")
+						.description("Playback aliases pre-created per sound when it loads. Sounds that have played more copies at once pre-create that many instead.")
+						.defaultInt(2)
+						.min(0.0)
+						.max(32.0)
+						.step(1.0)
+						.advanced();
+				});
 				engine.field("audio.engine.search_paths", ConfigFieldType::List, [](ConfigFieldBuilder& field) {
 					field.label("Asset Search Paths")
 						.description("Directories scanned when resolving audio assets.")
@@ -288,6 +427,162 @@ json buildHotkeyDefaultsArray() {
 					field.uiHint("itemPlaceholder", "assets/audio");
 					field.uiHint("pathMode", "directory");
 				});
+				engine.field("audio.engine.steal_policy", ConfigFieldType::Enum, [](ConfigFieldBuilder& field) {
+					field.label("Voice Stealing")
+						.description("Which playing sound gives up its slot when every slot is busy. A sound is never replaced by one of lower priority.")
+						.defaultString("lowest_priority")
+						.enumValues({"none", "oldest", "quietest", "lowest_priority"})
+						.advanced();
+					field.uiHint("enumLabels", json::object({
+						{"none", "None (drop new sounds)"},
+						{"oldest", "Oldest"},
+						{"quietest", "Quietest"},
+						{"lowest_priority", "Lowest Priority"}
+					}));
+				});
+				engine.field("audio.engine.voices", ConfigFieldType::JsonBlob, [](ConfigFieldBuilder& field) {
+					field.label("Voice Settings")
+						.description("Per-sound scheduling: an object mapping an identifier or alias to {\"priority\": int, \"max_instances\": int, \"bus\": string}.")
+						.defaultJson(json::object())
+						.advanced();
+				});
+			});
+
+			section.section("audio.mixer", [](ConfigSectionBuilder& mixer) {
+				mixer.label("Mixer");
+				mixer.field("audio.mixer.enabled", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+					field.label("Software Mixer")
+						.description("Mix sounds and music in-process through buses with insert effects and meters. Requires an audio restart.")
+						.defaultBool(false)
+						.advanced();
+				});
+				mixer.field("audio.mixer.sample_rate", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+					field.label("Mixer Sample Rate")
+						.description("Output rate of the software mixer in Hz.")
+						.defaultInt(48000)
+						.min(8000.0)
+						.max(192000.0)
+						.step(1.0)
+						.advanced();
+				});
+				mixer.field("audio.mixer.output", ConfigFieldType::Enum, [](ConfigFieldBuilder& field) {
+					field.label("Mixer Output")
+						.description("Where the mix goes: the audio device, or an offline buffer pulled by the caller.")
+						.defaultString("device")
+						.enumValues({"device", "offline"})
+						.advanced();
+					field.uiHint("enumLabels", json::object({
+						{"device", "Audio Device"},
+						{"offline", "Offline (render on demand)"}
+					}));
+				});
+				mixer.field("audio.mixer.buses", ConfigFieldType::JsonBlob, [](ConfigFieldBuilder& field) {
+					field.label("Buses")
+						.description("Extra or adjusted buses: an object mapping a bus name to {\"parent\", \"gain\", \"muted\", \"solo\", \"effects\": [{\"type\": \"low_pass\" | \"compressor\" | \"reverb\", ...}]}.")
+						.defaultJson(json::object())
+						.advanced();
+				});
+			});
+
+			section.section("audio.music", [](ConfigSectionBuilder& music) {
+				music.label("Music Streaming");
+				music.field("audio.music.stream_thread", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+					field.label("Streaming Thread")
+						.description("Refill music streams from a dedicated audio thread so long frames do not starve them. Requires an audio restart.")
+						.defaultBool(true)
+						.advanced();
+				});
+				music.field("audio.music.buffer_frames", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+					field.label("Stream Buffer Frames")
+						.description("Decoded frames buffered per music stream. Larger values ride out longer stalls at the cost of memory and seek latency.")
+						.defaultInt(4096)
+						.min(256.0)
+						.max(65536.0)
+						.step(256.0)
+						.advanced();
+				});
+				music.field("audio.music.update_interval_ms", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+					field.label("Stream Update Interval (ms)")
+						.description("How often the streaming thread refills music streams.")
+						.defaultInt(5)
+						.min(1.0)
+						.max(100.0)
+						.step(1.0)
+						.advanced();
+				});
+			});
+
+			section.section("audio.spatial", [](ConfigSectionBuilder& spatial) {
+				spatial.label("Spatial Audio");
+				spatial.field("audio.spatial.curve", ConfigFieldType::Enum, [](ConfigFieldBuilder& field) {
+					field.label("Attenuation Curve")
+						.description("How positional sounds fade between the minimum and maximum distance from the listener.")
+						.defaultString("linear")
+						.enumValues({"none", "linear", "inverse", "exponential"})
+						.advanced();
+					field.uiHint("enumLabels", json::object({
+						{"none", "None (pan only)"},
+						{"linear", "Linear"},
+						{"inverse", "Inverse Distance"},
+						{"exponential", "Exponential"}
+					}));
+				});
+				spatial.field("audio.spatial.min_distance", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+					field.label("Minimum Distance")
+						.description("World units from the listener within which positional sounds play at full volume.")
+						.defaultFloat(64.0)
+						.min(0.0)
+						.step(8.0)
+						.advanced();
+				});
+				spatial.field("audio.spatial.max_distance", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+					field.label("Maximum Distance")
+						.description("World units from the listener beyond which positional sounds are silent and never take a voice.")
+						.defaultFloat(1024.0)
+						.min(0.0)
+						.step(64.0)
+						.advanced();
+				});
+				spatial.field("audio.spatial.rolloff", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+					field.label("Rolloff")
+						.description("Steepness of the inverse and exponential curves.")
+						.defaultFloat(1.0)
+						.min(0.0)
+						.max(10.0)
+						.step(0.1)
+						.advanced();
+				});
+				spatial.field("audio.spatial.cull_volume", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+					field.label("Cull Volume")
+						.description("Positional sounds quieter than this after attenuation are not started.")
+						.defaultFloat(0.001)
+						.min(0.0)
+						.max(1.0)
+						.step(0.001)
+						.advanced();
+				});
+			});
+
+			section.section("audio.memory", [](ConfigSectionBuilder& memory) {
+				memory.label("Memory");
+				memory.field("audio.memory.max_bytes", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+					field.label("Memory Budget (bytes)")
+						.description("Audio memory budget. Released sounds stay cached and are evicted least-recently-released first when over budget. 0 disables the limit.")
+						.defaultInt(0)
+						.min(0.0)
+						.step(1048576.0)
+						.advanced();
+					field.uiHint("placeholder", "0 (unlimited)");
+				});
+				memory.field("audio.memory.decode_on_demand_seconds", ConfigFieldType::Float, [](ConfigFieldBuilder& field) {
+					field.label("Decode On Demand After (s)")
+						.description("OGG, MP3, FLAC and QOA sounds longer than this stay compressed in memory and are decoded when first played. 0 decodes every sound when it is acquired.")
+						.defaultFloat(0.0)
+						.min(0.0)
+						.max(600.0)
+						.step(0.5)
+						.advanced();
+				});
 			});
 
 			section.section("audio.preload", [](ConfigSectionBuilder& preload) {
@@ -308,6 +603,14 @@ json buildHotkeyDefaultsArray() {
 					field.uiHint("pathMode", "file");
 					field.uiHint("itemPlaceholder", "assets/audio/music/theme.ogg");
 				});
+				preload.field("audio.preload.sound_banks", ConfigFieldType::List, [](ConfigFieldBuilder& field) {
+					field.label("Sound Banks")
+						.description("Packed .gb2dbank files mapped at startup. Sounds in a bank are acquired without touching their own files.")
+						.defaultStringList(std::vector<std::string>{})
+						.advanced();
+					field.uiHint("pathMode", "file");
+					field.uiHint("itemPlaceholder", "sfx.gb2dbank");
+				});
 			});
 		});
 
@@ -327,6 +630,70 @@ json buildHotkeyDefaultsArray() {
 			});
 		});
 
+		builder.section("logging", [](ConfigSectionBuilder& section) {
+			section.label("Logging")
+				.description("Log output behavior for the editor and games.");
+			section.field("logging.async", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Asynchronous Logging")
+					.description("Queue log messages and write them to the console and log window from a background thread, so logging calls never wait on output.")
+					.defaultBool(false)
+					.advanced();
+			});
+			section.field("logging.async_queue_size", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Async Queue Size")
+					.description("Messages the async queue holds before the overflow policy applies. Rounded up to a power of two.")
+					.defaultInt(8192)
+					.min(64.0)
+					.max(1048576.0)
+					.step(64.0)
+					.advanced();
+			});
+			section.field("logging.async_overflow", ConfigFieldType::Enum, [](ConfigFieldBuilder& field) {
+				field.label("Async Overflow")
+					.description("What a logging call does when the async queue is full.")
+					.defaultString("block")
+					.enumValues({"block", "drop_oldest", "drop_newest"})
+					.advanced();
+				field.uiHint("enumLabels", json::object({
+					{"block", "Wait for room"},
+					{"drop_oldest", "Drop oldest message"},
+					{"drop_newest", "Drop newest message"}
+				}));
+			});
+			section.field("logging.binary_dir", ConfigFieldType::Path, [](ConfigFieldBuilder& field) {
+				field.label("Binary Log Directory")
+					.description("Also write every message to compact binary segment files in this directory, for long sessions. Read them with gb2d_log_decoder. Leave empty to disable.")
+					.defaultString("")
+					.advanced();
+				field.uiHint("pathMode", "directory");
+				field.uiHint("placeholder", "logs");
+			});
+			section.field("logging.binary_segment_mb", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Binary Log Segment Size (MB)")
+					.description("Size of one binary log segment. A full segment is closed and a new one started.")
+					.defaultInt(8)
+					.min(1.0)
+					.max(1024.0)
+					.step(1.0)
+					.advanced();
+			});
+			section.field("logging.binary_max_segments", ConfigFieldType::Integer, [](ConfigFieldBuilder& field) {
+				field.label("Binary Log Segments Kept")
+					.description("Oldest segments beyond this count are deleted, including those from earlier runs.")
+					.defaultInt(8)
+					.min(1.0)
+					.max(1000.0)
+					.step(1.0)
+					.advanced();
+			});
+			section.field("logging.binary_only", ConfigFieldType::Boolean, [](ConfigFieldBuilder& field) {
+				field.label("Binary Log Only")
+					.description("While the binary log is on, skip the console and log window so messages are never formatted as text.")
+					.defaultBool(false)
+					.advanced();
+			});
+		});
+
 		builder.section("debug", [](ConfigSectionBuilder& section) {
 			section.label("Debug")
 				.description("Reserved for developer diagnostics and feature flags.")
@@ -432,6 +799,9 @@ json buildHotkeyDefaultsArray() {
 		if (!core.contains("diagnostics_logging") || !core["diagnostics_logging"].is_boolean()) {
 			core["diagnostics_logging"] = true;
 		}
+		if (!core.contains("coalesce_events") || !core["coalesce_events"].is_boolean()) {
+			core["coalesce_events"] = false;
+		}
 
 		json& volumes = ensure_json_path(root, "audio.volumes");
 		if (!volumes.is_object()) {
@@ -454,10 +824,83 @@ json buildHotkeyDefaultsArray() {
 		if (!engine.contains("max_concurrent_sounds") || !engine["max_concurrent_sounds"].is_number_integer()) {
 			engine["max_concurrent_sounds"] = 16;
 		}
+		if (!engine.contains("alias_pool_size") || !engine["alias_pool_size"].is_number_integer()) {
+			engine["alias_pool_size"] = 2;
+		}
 		json& searchPaths = ensure_json_path(root, "audio.engine.search_paths");
 		if (!searchPaths.is_array()) {
 			searchPaths = json::array();
 		}
+		if (!engine.contains("steal_policy") || !engine["steal_policy"].is_string()) {
+			engine["steal_policy"] = "lowest_priority";
+		}
+		json& voices = ensure_json_path(root, "audio.engine.voices");
+		if (!voices.is_object()) {
+			voices = json::object();
+		}
+
+		json& mixer = ensure_json_path(root, "audio.mixer");
+		if (!mixer.is_object()) {
+			mixer = json::object();
+		}
+		if (!mixer.contains("enabled") || !mixer["enabled"].is_boolean()) {
+			mixer["enabled"] = false;
+		}
+		if (!mixer.contains("sample_rate") || !mixer["sample_rate"].is_number_integer()) {
+			mixer["sample_rate"] = 48000;
+		}
+		if (!mixer.contains("output") || !mixer["output"].is_string()) {
+			mixer["output"] = "device";
+		}
+		json& buses = ensure_json_path(root, "audio.mixer.buses");
+		if (!buses.is_object()) {
+			buses = json::object();
+		}
+
+		json& spatial = ensure_json_path(root, "audio.spatial");
+		if (!spatial.is_object()) {
+			spatial = json::object();
+		}
+		if (!spatial.contains("curve") || !spatial["curve"].is_string()) {
+			spatial["curve"] = "linear";
+		}
+		if (!spatial.contains("min_distance") || !spatial["min_distance"].is_number()) {
+			spatial["min_distance"] = 64.0;
+		}
+		if (!spatial.contains("max_distance") || !spatial["max_distance"].is_number()) {
+			spatial["max_distance"] = 1024.0;
+		}
+		if (!spatial.contains("rolloff") || !spatial["rolloff"].is_number()) {
+			spatial["rolloff"] = 1.0;
+		}
+		if (!spatial.contains("cull_volume") || !spatial["cull_volume"].is_number()) {
+			spatial["cull_volume"] = 0.001;
+		}
+
+		json& memory = ensure_json_path(root, "audio.memory");
+		if (!memory.is_object()) {
+			memory = json::object();
+		}
+		if (!memory.contains("max_bytes") || !memory["max_bytes"].is_number_integer()) {
+			memory["max_bytes"] = 0;
+		}
+		if (!memory.contains("decode_on_demand_seconds") || !memory["decode_on_demand_seconds"].is_number()) {
+			memory["decode_on_demand_seconds"] = 0.0;
+		}
+
+		json& music = ensure_json_path(root, "audio.music");
+		if (!music.is_object()) {
+			music = json::object();
+		}
+		if (!music.contains("stream_thread") || !music["stream_thread"].is_boolean()) {
+			music["stream_thread"] = true;
+		}
+		if (!music.contains("buffer_frames") || !music["buffer_frames"].is_number_integer()) {
+			music["buffer_frames"] = 4096;
+		}
+		if (!music.contains("update_interval_ms") || !music["update_interval_ms"].is_number_integer()) {
+			music["update_interval_ms"] = 5;
+		}
 
 		json& preload = ensure_json_path(root, "audio.preload");
 		if (!preload.is_object()) {
@@ -471,6 +914,10 @@ json buildHotkeyDefaultsArray() {
 		if (!preloadMusic.is_array()) {
 			preloadMusic = json::array();
 		}
+		json& soundBanks = ensure_json_path(root, "audio.preload.sound_banks");
+		if (!soundBanks.is_array()) {
+			soundBanks = json::array();
+		}
 		json& soundAliases = ensure_json_path(root, "audio.preload.sound_aliases");
 		if (!soundAliases.is_object()) {
 			soundAliases = json::object();
@@ -888,12 +1335,36 @@ void ConfigurationManager::loadOrDefault() {
 	ensure_json_path(c, "textures.default_filter") = "bilinear";
 	ensure_json_path(c, "textures.generate_mipmaps") = false;
 	ensure_json_path(c, "textures.log_atlas_contents") = false;
+	ensure_json_path(c, "textures.bake_atlases") = false;
+	ensure_json_path(c, "textures.compressed_upload") = true;
+	ensure_json_path(c, "textures.decoded_cache_dir") = "";
+	ensure_json_path(c, "textures.decoded_cache_max_bytes") = 268435456;
+	ensure_json_path(c, "textures.preload") = json::object();
+	ensure_json_path(c, "textures.hot_reload") = false;
+	ensure_json_path(c, "textures.hot_reload_polling") = false;
+	ensure_json_path(c, "textures.hot_reload_debounce_ms") = 200;
+	ensure_json_path(c, "textures.hot_reload_poll_ms") = 500;
 	ensure_json_path(c, "textures.max_bytes") = 0;
 	ensure_json_path(c, "textures.placeholder_path") = "";
+	ensure_json_path(c, "textures.pack_small_textures") = false;
+	ensure_json_path(c, "textures.pack_max_dimension") = 64;
+	ensure_json_path(c, "textures.pack_page_size") = 1024;
+	ensure_json_path(c, "textures.pack_padding") = 1;
+	ensure_json_path(c, "textures.async_workers") = 2;
+	ensure_json_path(c, "textures.async_uploads_per_frame") = 4;
+	ensure_json_path(c, "textures.async_upload_budget_ms") = 2.0;
+	ensure_json_path(c, "logging.async") = false;
+	ensure_json_path(c, "logging.async_queue_size") = 8192;
+	ensure_json_path(c, "logging.async_overflow") = "block";
+	ensure_json_path(c, "logging.binary_dir") = "";
+	ensure_json_path(c, "logging.binary_segment_mb") = 8;
+	ensure_json_path(c, "logging.binary_max_segments") = 8;
+	ensure_json_path(c, "logging.binary_only") = false;
 	auto& audioCore = ensure_json_path(c, "audio.core");
 	audioCore = json::object();
 	ensure_json_path(c, "audio.core.enabled") = true;
 	ensure_json_path(c, "audio.core.diagnostics_logging") = true;
+	ensure_json_path(c, "audio.core.coalesce_events") = false;
 	auto& audioVolumes = ensure_json_path(c, "audio.volumes");
 	audioVolumes = json::object();
 	ensure_json_path(c, "audio.volumes.master") = 1.0;
@@ -902,13 +1373,39 @@ void ConfigurationManager::loadOrDefault() {
 	auto& audioEngine = ensure_json_path(c, "audio.engine");
 	audioEngine = json::object();
 	ensure_json_path(c, "audio.engine.max_concurrent_sounds") = 16;
+	ensure_json_path(c, "audio.engine.alias_pool_size") = 2;
 	auto& audioSearch = ensure_json_path(c, "audio.engine.search_paths");
 	audioSearch = json::array();
 	audioSearch.push_back("assets/audio");
+	ensure_json_path(c, "audio.engine.steal_policy") = "lowest_priority";
+	ensure_json_path(c, "audio.engine.voices") = json::object();
+	auto& audioMixer = ensure_json_path(c, "audio.mixer");
+	audioMixer = json::object();
+	ensure_json_path(c, "audio.mixer.enabled") = false;
+	ensure_json_path(c, "audio.mixer.sample_rate") = 48000;
+	ensure_json_path(c, "audio.mixer.output") = "device";
+	ensure_json_path(c, "audio.mixer.buses") = json::object();
+	auto& audioMusic = ensure_json_path(c, "audio.music");
+	audioMusic = json::object();
+	ensure_json_path(c, "audio.music.stream_thread") = true;
+	ensure_json_path(c, "audio.music.buffer_frames") = 4096;
+	ensure_json_path(c, "audio.music.update_interval_ms") = 5;
+	auto& audioSpatial = ensure_json_path(c, "audio.spatial");
+	audioSpatial = json::object();
+	ensure_json_path(c, "audio.spatial.curve") = "linear";
+	ensure_json_path(c, "audio.spatial.min_distance") = 64.0;
+	ensure_json_path(c, "audio.spatial.max_distance") = 1024.0;
+	ensure_json_path(c, "audio.spatial.rolloff") = 1.0;
+	ensure_json_path(c, "audio.spatial.cull_volume") = 0.001;
+	auto& audioMemory = ensure_json_path(c, "audio.memory");
+	audioMemory = json::object();
+	ensure_json_path(c, "audio.memory.max_bytes") = 0;
+	ensure_json_path(c, "audio.memory.decode_on_demand_seconds") = 0.0;
 	auto& audioPreload = ensure_json_path(c, "audio.preload");
 	audioPreload = json::object();
 	ensure_json_path(c, "audio.preload.sounds") = json::array();
 	ensure_json_path(c, "audio.preload.music") = json::array();
+	ensure_json_path(c, "audio.preload.sound_banks") = json::array();
 	ensure_json_path(c, "audio.preload.sound_aliases") = json::object();
 	ensure_json_path(c, "audio.preload.music_aliases") = json::object();
 	ensure_audio_structure(c);
@@ -0,0 +1,285 @@
+#include "FileWatcher.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <system_error>
+
+#if defined(__linux__)
+#  include <cerrno>
+#  include <climits>
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#endif
+
+namespace gb2d::filesystem {
+
+namespace {
+
+bool sameMetadata(const FileStamp& a, const FileStamp& b) {
+    return a.size == b.size && a.modified == b.modified;
+}
+
+} // namespace
+
+std::string normalizeWatchPath(const std::filesystem::path& path) {
+    std::error_code ec;
+    auto absolute = std::filesystem::absolute(path, ec);
+    return (ec ? path : absolute).lexically_normal().string();
+}
+
+std::optional<FileStamp> statFile(const std::filesystem::path& path) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto modified = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    FileStamp stamp;
+    stamp.size = size;
+    stamp.modified = static_cast<std::int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(modified.time_since_epoch()).count());
+    return stamp;
+}
+
+// FNV-1a over the mapped file; only run when size or mtime moved, so cost is bounded by edits.
+std::optional<std::uint64_t> hashFile(const std::filesystem::path& path) {
+    auto mapped = MappedFile::open(path);
+    if (!mapped) {
+        return std::nullopt;
+    }
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::byte byte : mapped->bytes()) {
+        hash ^= static_cast<std::uint64_t>(byte);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+#if defined(__linux__)
+
+struct FileWatcher::Native {
+    struct Directory {
+        int wd{-1};
+        std::size_t files{0};
+    };
+
+    int fd{-1};
+    std::unordered_map<int, std::filesystem::path> byDescriptor{};
+    std::unordered_map<std::string, Directory> byPath{};
+
+    ~Native() {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    bool add(const std::filesystem::path& file) {
+        const auto dir = file.parent_path();
+        auto& entry = byPath[dir.string()];
+        if (entry.files == 0) {
+            constexpr std::uint32_t mask = IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE | IN_ATTRIB;
+            const int wd = inotify_add_watch(fd, dir.c_str(), mask);
+            if (wd < 0) {
+                byPath.erase(dir.string());
+                return false;
+            }
+            entry.wd = wd;
+            byDescriptor[wd] = dir;
+        }
+        entry.files++;
+        return true;
+    }
+
+    void remove(const std::filesystem::path& file) {
+        auto it = byPath.find(file.parent_path().string());
+        if (it == byPath.end() || --it->second.files > 0) {
+            return;
+        }
+        inotify_rm_watch(fd, it->second.wd);
+        byDescriptor.erase(it->second.wd);
+        byPath.erase(it);
+    }
+
+    // Returns false when the kernel queue overflowed and events were lost.
+    template <typename Fn>
+    bool drain(Fn&& onPath) {
+        alignas(inotify_event) char buffer[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+        bool complete = true;
+        for (;;) {
+            const ssize_t length = ::read(fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break;
+            }
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                if (event->mask & IN_Q_OVERFLOW) {
+                    complete = false;
+                    continue;
+                }
+                auto dir = byDescriptor.find(event->wd);
+                if (dir != byDescriptor.end() && event->len > 0) {
+                    onPath((dir->second / event->name).string());
+                }
+            }
+        }
+        return complete;
+    }
+};
+
+#else
+
+struct FileWatcher::Native {
+    int fd{-1};
+    bool add(const std::filesystem::path&) { return false; }
+    void remove(const std::filesystem::path&) {}
+    template <typename Fn>
+    bool drain(Fn&&) { return true; }
+};
+
+#endif
+
+FileWatcher::FileWatcher() : FileWatcher(Options{}) {}
+
+FileWatcher::FileWatcher(Options options) : options_(options) {
+#if defined(__linux__)
+    if (options_.backend == Backend::Auto) {
+        const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd >= 0) {
+            native_ = std::make_unique<Native>();
+            native_->fd = fd;
+        }
+    }
+#endif
+}
+
+FileWatcher::~FileWatcher() = default;
+
+bool FileWatcher::nativeEvents() const {
+    return native_ != nullptr;
+}
+
+void FileWatcher::watch(const std::filesystem::path& path) {
+    const auto key = normalizeWatchPath(path);
+    auto& entry = entries_[key];
+    if (entry.refCount++ > 0) {
+        return;
+    }
+    refresh(key);
+    if (native_ && !native_->add(key)) {
+        // Directory missing or watch limit reached; this path is picked up by polling instead.
+        entry.polled = true;
+    } else {
+        entry.polled = !native_;
+    }
+}
+
+void FileWatcher::unwatch(const std::filesystem::path& path) {
+    auto it = entries_.find(normalizeWatchPath(path));
+    if (it == entries_.end() || --it->second.refCount > 0) {
+        return;
+    }
+    if (native_ && !it->second.polled) {
+        native_->remove(it->first);
+    }
+    entries_.erase(it);
+}
+
+bool FileWatcher::watching(const std::filesystem::path& path) const {
+    return entries_.find(normalizeWatchPath(path)) != entries_.end();
+}
+
+void FileWatcher::refresh(const std::filesystem::path& path) {
+    auto it = entries_.find(normalizeWatchPath(path));
+    if (it == entries_.end()) {
+        return;
+    }
+    auto stamp = statFile(it->first);
+    if (stamp) {
+        stamp->hash = hashFile(it->first).value_or(0);
+    }
+    it->second.stamp = stamp;
+}
+
+void FileWatcher::markChanged(const std::string& key, Clock::time_point now) {
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        it->second.lastEvent = now;
+    }
+}
+
+bool FileWatcher::confirm(const std::string& key, Entry& entry) {
+    auto current = statFile(key);
+    if (!current) {
+        // Mid-save (deleted before the rename lands) or gone; report once it reappears.
+        return false;
+    }
+    if (entry.stamp && sameMetadata(*entry.stamp, *current)) {
+        return false;
+    }
+    const auto hash = hashFile(key);
+    if (!hash) {
+        return false;
+    }
+    current->hash = *hash;
+    const bool changed = !entry.stamp || entry.stamp->hash != current->hash;
+    entry.stamp = current;
+    return changed;
+}
+
+std::vector<std::filesystem::path> FileWatcher::poll(Clock::time_point now) {
+    if (native_) {
+        const bool complete = native_->drain([&](const std::string& key) { markChanged(key, now); });
+        if (!complete) {
+            for (auto& [key, entry] : entries_) {
+                entry.lastEvent = now;
+            }
+        }
+    }
+
+    if (now - lastPoll_ >= options_.pollInterval) {
+        lastPoll_ = now;
+        for (auto& [key, entry] : entries_) {
+            if (!entry.polled || entry.lastEvent) {
+                continue;
+            }
+            auto current = statFile(key);
+            if (current.has_value() != entry.stamp.has_value() ||
+                (current && !sameMetadata(*current, *entry.stamp))) {
+                entry.lastEvent = now;
+            }
+        }
+    }
+
+    std::vector<std::filesystem::path> changed;
+    for (auto& [key, entry] : entries_) {
+        if (!entry.lastEvent || now - *entry.lastEvent < options_.debounce) {
+            continue;
+        }
+        entry.lastEvent.reset();
+        if (confirm(key, entry)) {
+            changed.emplace_back(key);
+        }
+    }
+    std::sort(changed.begin(), changed.end());
+    return changed;
+}
+
+std::vector<std::filesystem::path> FileWatcher::scan() {
+    if (native_) {
+        native_->drain([](const std::string&) {});
+    }
+    std::vector<std::filesystem::path> changed;
+    for (auto& [key, entry] : entries_) {
+        entry.lastEvent.reset();
+        if (confirm(key, entry)) {
+            changed.emplace_back(key);
+        }
+    }
+    std::sort(changed.begin(), changed.end());
+    return changed;
+}
+
+} // namespace gb2d::filesystem
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gb2d::filesystem {
+
+// Size, modification time and content hash of a file. Two stamps with equal size and mtime are
+// assumed identical without hashing; the hash only decides whether a touched file really changed.
+struct FileStamp {
+    std::uintmax_t size{0};
+    std::int64_t modified{0};
+    std::uint64_t hash{0};
+};
+
+// Absolute, lexically normal form used as the watch key; compare caller paths through it too.
+std::string normalizeWatchPath(const std::filesystem::path& path);
+std::optional<FileStamp> statFile(const std::filesystem::path& path);
+std::optional<std::uint64_t> hashFile(const std::filesystem::path& path);
+
+// Reports files whose contents changed. Uses inotify on Linux (one watch per parent directory)
+// and falls back to stat-polling elsewhere or when inotify is unavailable. Events are debounced:
+// a path is reported once it has been quiet for `debounce`, so an editor's write/rename burst
+// yields one change. Not thread-safe; the owner serializes calls.
+class FileWatcher {
+public:
+    enum class Backend {
+        Auto,    // native events where available, polling otherwise
+        Polling, // stat every watched path each pollInterval
+    };
+
+    struct Options {
+        Backend backend{Backend::Auto};
+        std::chrono::milliseconds debounce{200};
+        std::chrono::milliseconds pollInterval{500};
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    FileWatcher();
+    explicit FileWatcher(Options options);
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Reference counted per path; the stamp is taken on the first watch() call.
+    void watch(const std::filesystem::path& path);
+    void unwatch(const std::filesystem::path& path);
+    bool watching(const std::filesystem::path& path) const;
+    std::size_t watchedCount() const { return entries_.size(); }
+    bool nativeEvents() const;
+
+    // Collects pending events and returns the paths that settled and differ from their last stamp.
+    std::vector<std::filesystem::path> poll(Clock::time_point now = Clock::now());
+    // Stats every watched path right away, ignoring debounce; used for explicit reload requests.
+    std::vector<std::filesystem::path> scan();
+
+    // Takes a fresh stamp, e.g. after the owner reloaded the file through another code path.
+    void refresh(const std::filesystem::path& path);
+
+private:
+    struct Entry {
+        std::size_t refCount{0};
+        std::optional<FileStamp> stamp{};
+        std::optional<Clock::time_point> lastEvent{};
+        bool polled{false}; // no native watch covers this path
+    };
+
+    struct Native;
+
+    void markChanged(const std::string& key, Clock::time_point now);
+    bool confirm(const std::string& key, Entry& entry);
+
+    Options options_{};
+    std::unordered_map<std::string, Entry> entries_{};
+    std::unique_ptr<Native> native_{};
+    Clock::time_point lastPoll_{};
+};
+
+} // namespace gb2d::filesystem
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace gb2d::filesystem {
+
+// Read-only memory mapping of a whole file. Move-only; the view stays valid for the lifetime of
+// the object. Empty files map successfully with an empty view.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    static std::optional<MappedFile> open(const std::filesystem::path& path);
+
+    const std::byte* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    std::span<const std::byte> bytes() const { return {data_, size_}; }
+
+private:
+    void close();
+
+    const std::byte* data_{nullptr};
+    std::size_t size_{0};
+#if defined(_WIN32)
+    void* file_{nullptr};
+    void* mapping_{nullptr};
+#endif
+};
+
+} // namespace gb2d::filesystem
@@ -0,0 +1,126 @@
+#include "PathResolver.h"
+
+#include <system_error>
+#include <utility>
+
+namespace gb2d::filesystem {
+
+PathResolver::PathResolver(std::vector<std::filesystem::path> searchPaths)
+    : searchPaths_(std::move(searchPaths)) {}
+
+bool PathResolver::setSearchPaths(std::vector<std::filesystem::path> searchPaths) {
+    if (searchPaths == searchPaths_) {
+        return false;
+    }
+    searchPaths_ = std::move(searchPaths);
+    dropAll();
+    return true;
+}
+
+std::optional<std::filesystem::path> PathResolver::probe(const std::filesystem::path& candidate) {
+    stats_.probes++;
+    std::error_code ec;
+    if (!std::filesystem::exists(candidate, ec)) {
+        return std::nullopt;
+    }
+    auto canonical = std::filesystem::weakly_canonical(candidate, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return canonical;
+}
+
+std::optional<std::filesystem::path> PathResolver::resolve(const std::string& identifier) {
+    if (identifier.empty()) {
+        return std::nullopt;
+    }
+    stats_.lookups++;
+
+    // Relative roots and identifiers hang off the working directory; a chdir invalidates them all.
+    std::error_code ec;
+    auto cwd = std::filesystem::current_path(ec);
+    if (ec) {
+        cwd.clear();
+    }
+    if (cwd != workingDirectory_) {
+        dropAll();
+        workingDirectory_ = cwd;
+    }
+
+    if (auto it = entries_.find(identifier); it != entries_.end()) {
+        if (it->second.resolved || std::chrono::steady_clock::now() < it->second.expires) {
+            stats_.hits++;
+            stats_.probesAvoided += it->second.probes;
+            if (!it->second.resolved) {
+                stats_.negativeHits++;
+            }
+            return it->second.resolved;
+        }
+        entries_.erase(it);
+    }
+
+    const std::size_t probesBefore = stats_.probes;
+    std::optional<std::filesystem::path> found;
+    std::filesystem::path input(identifier);
+    if (input.is_absolute()) {
+        found = probe(input);
+    } else {
+        if (!cwd.empty()) {
+            found = probe(cwd / input);
+        }
+        for (auto root = searchPaths_.begin(); !found && root != searchPaths_.end(); ++root) {
+            const auto base = root->is_absolute() || cwd.empty() ? *root : cwd / *root;
+            found = probe(base / input);
+        }
+    }
+
+    if (found) {
+        entries_[identifier] = Entry{found, stats_.probes - probesBefore};
+    } else if (negativeTtl_.count() > 0) {
+        entries_[identifier] = Entry{std::nullopt, stats_.probes - probesBefore, std::chrono::steady_clock::now() + negativeTtl_};
+    }
+    return found;
+}
+
+void PathResolver::invalidatePath(const std::filesystem::path& path) {
+    std::error_code ec;
+    auto canonical = std::filesystem::weakly_canonical(path, ec);
+    if (ec) {
+        canonical = path.lexically_normal();
+    }
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (!it->second.resolved || *it->second.resolved == canonical) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    stats_.invalidations++;
+}
+
+void PathResolver::forget(const std::string& identifier) {
+    entries_.erase(identifier);
+}
+
+void PathResolver::clear() {
+    dropAll();
+}
+
+void PathResolver::dropAll() {
+    if (!entries_.empty()) {
+        entries_.clear();
+        stats_.invalidations++;
+    }
+}
+
+PathResolver::Stats PathResolver::stats() const {
+    Stats stats = stats_;
+    stats.entries = entries_.size();
+    return stats;
+}
+
+void PathResolver::resetStats() {
+    stats_ = Stats{};
+}
+
+} // namespace gb2d::filesystem
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gb2d::filesystem {
+
+// Maps asset identifiers to files over an ordered list of search roots and remembers the answer,
+// so repeated lookups cost no filesystem probes. Misses are remembered for negativeTtl() only, since
+// nothing reports a file appearing outside watched paths. Relative identifiers are tried
+// against the working directory first, then each root in order; the first existing candidate wins
+// and is returned weakly canonical. Not thread-safe; owners call it under their own lock.
+class PathResolver {
+public:
+    struct Stats {
+        std::size_t lookups{0};
+        std::size_t hits{0};          // answered from the cache, found or not
+        std::size_t negativeHits{0};  // cached misses among `hits`
+        std::size_t probes{0};        // existence checks performed
+        std::size_t probesAvoided{0}; // existence checks the cached answers replaced
+        std::size_t invalidations{0};
+        std::size_t entries{0};
+    };
+
+    PathResolver() = default;
+    explicit PathResolver(std::vector<std::filesystem::path> searchPaths);
+
+    // Drops the cache only when the roots actually change. Returns true if they did.
+    bool setSearchPaths(std::vector<std::filesystem::path> searchPaths);
+    const std::vector<std::filesystem::path>& searchPaths() const { return searchPaths_; }
+
+    // How long a miss is answered from the cache; zero disables negative caching.
+    void setNegativeTtl(std::chrono::milliseconds ttl) { negativeTtl_ = ttl; }
+    std::chrono::milliseconds negativeTtl() const { return negativeTtl_; }
+
+    std::optional<std::filesystem::path> resolve(const std::string& identifier);
+
+    // `path` changed, appeared or vanished: forgets lookups that resolved to it and every cached
+    // miss, since the file may now satisfy one of them.
+    void invalidatePath(const std::filesystem::path& path);
+    void forget(const std::string& identifier);
+    void clear();
+
+    Stats stats() const;
+    void resetStats();
+
+private:
+    struct Entry {
+        std::optional<std::filesystem::path> resolved{};
+        std::size_t probes{0}; // what a fresh lookup of this identifier costs
+        std::chrono::steady_clock::time_point expires{}; // misses only
+    };
+
+    std::optional<std::filesystem::path> probe(const std::filesystem::path& candidate);
+    void dropAll();
+
+    std::vector<std::filesystem::path> searchPaths_{};
+    std::filesystem::path workingDirectory_{};
+    std::unordered_map<std::string, Entry> entries_{};
+    std::chrono::milliseconds negativeTtl_{2000};
+    Stats stats_{};
+};
+
+} // namespace gb2d::filesystem
@@ -0,0 +1,159 @@
+#include "AsyncLogWriter.h"
+#include <spdlog/logger.h>
+#include <vector>
+
+namespace gb2d::logging {
+
+size_t AsyncLogWriter::ringCapacityFor(size_t requested) {
+    size_t size = 2;
+    while (size < requested) size <<= 1;
+    return size;
+}
+
+AsyncLogWriter::AsyncLogWriter(size_t capacity) : ring_(capacity) {}
+
+AsyncLogWriter::~AsyncLogWriter() { stop(); }
+
+void AsyncLogWriter::start(std::shared_ptr<spdlog::logger> logger, const AsyncOptions& opts) {
+    stop();
+    logger_ = std::move(logger);
+    batchSize_ = opts.batch_size > 0 ? opts.batch_size : 1;
+    written_.store(0, std::memory_order_relaxed);
+    batches_.store(0, std::memory_order_relaxed);
+    droppedOldest_.store(0, std::memory_order_relaxed);
+    droppedNewest_.store(0, std::memory_order_relaxed);
+    blocked_.store(0, std::memory_order_relaxed);
+    setOverflow(opts.overflow);
+    closed_.store(false, std::memory_order_relaxed);
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread([this] { run(); });
+}
+
+void AsyncLogWriter::stop() {
+    if (!thread_.joinable()) return;
+    running_.store(false, std::memory_order_seq_cst);
+    // A producer that saw running() just before the store may still be pushing; the writer keeps
+    // draining until it is done, so its record is written rather than left in the ring.
+    while (posting_.load(std::memory_order_seq_cst) != 0) std::this_thread::yield();
+    closed_.store(true, std::memory_order_seq_cst);
+    sleeping_.store(false, std::memory_order_seq_cst);
+    sleeping_.notify_one();
+    thread_.join();
+    logger_.reset();
+}
+
+void AsyncLogWriter::wake() {
+    // Pairs with the fence in run(): either the writer sees the record we just pushed before it
+    // sleeps, or we see it sleeping and wake it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed) && sleeping_.exchange(false, std::memory_order_seq_cst)) {
+        sleeping_.notify_one();
+    }
+}
+
+bool AsyncLogWriter::post(spdlog::level::level_enum level, std::string_view message) {
+    // Announce the post before checking running(); stop() clears running_ and then waits for the
+    // count to drop, so either we see the stop or stop() sees us.
+    struct Posting {
+        explicit Posting(std::atomic<size_t>& count) : count(count) { count.fetch_add(1, std::memory_order_seq_cst); }
+        ~Posting() { count.fetch_sub(1, std::memory_order_release); }
+        std::atomic<size_t>& count;
+    } posting(posting_);
+    if (!running_.load(std::memory_order_seq_cst)) return false;
+    LogRecord rec{ level, std::chrono::system_clock::now(), std::string(message) };
+    if (!ring_.tryPush(std::move(rec))) {
+        switch ((OverflowPolicy)overflow_.load(std::memory_order_relaxed)) {
+            case OverflowPolicy::drop_newest:
+                droppedNewest_.fetch_add(1, std::memory_order_relaxed);
+                wake();
+                return true;
+            case OverflowPolicy::drop_oldest:
+                do {
+                    if (ring_.tryPop()) droppedOldest_.fetch_add(1, std::memory_order_relaxed);
+                } while (!ring_.tryPush(std::move(rec)));
+                break;
+            case OverflowPolicy::block:
+            default:
+                blocked_.fetch_add(1, std::memory_order_relaxed);
+                for (int spins = 0; !ring_.tryPush(std::move(rec)); ++spins) {
+                    if (!running()) return false;
+                    wake();
+                    // Yielding alone lets a crowd of blocked producers starve the writer on a busy
+                    // machine; back off to short sleeps once it clearly needs more than a moment.
+                    if (spins < 64) std::this_thread::yield();
+                    else std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+                break;
+        }
+    }
+    wake();
+    return true;
+}
+
+void AsyncLogWriter::flush() {
+    const size_t ticket = ring_.enqueued();
+    while (completed_.load(std::memory_order_acquire) < ticket && running()) {
+        sleeping_.store(false, std::memory_order_seq_cst);
+        sleeping_.notify_one();
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+AsyncStats AsyncLogWriter::stats() const {
+    AsyncStats s;
+    s.active = running();
+    s.capacity = ring_.capacity();
+    s.queued = ring_.sizeApprox();
+    s.written = written_.load(std::memory_order_relaxed);
+    s.batches = batches_.load(std::memory_order_relaxed);
+    s.dropped_oldest = droppedOldest_.load(std::memory_order_relaxed);
+    s.dropped_newest = droppedNewest_.load(std::memory_order_relaxed);
+    s.blocked = blocked_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void AsyncLogWriter::run() {
+    std::vector<LogRecord> batch;
+    batch.reserve(batchSize_);
+    for (;;) {
+        batch.clear();
+        while (batch.size() < batchSize_) {
+            auto rec = ring_.tryPop();
+            if (!rec) break;
+            batch.push_back(std::move(*rec));
+        }
+        // Everything below this position was either popped above or evicted by a producer.
+        const size_t upto = ring_.dequeued();
+        if (!batch.empty()) {
+            for (const auto& rec : batch) {
+                try {
+                    logger_->log(rec.time, spdlog::source_loc{}, rec.level, rec.message);
+                } catch (...) {
+                    // a failing sink must not take the writer thread down
+                }
+            }
+            written_.fetch_add(batch.size(), std::memory_order_relaxed);
+            batches_.fetch_add(1, std::memory_order_relaxed);
+            if (batch.size() == batchSize_) {
+                completed_.store(upto, std::memory_order_release);
+                continue;
+            }
+            try { logger_->flush(); } catch (...) {}
+        }
+        completed_.store(upto, std::memory_order_release);
+
+        if (closed_.load(std::memory_order_acquire)) {
+            if (ring_.sizeApprox() == 0) break;
+            std::this_thread::yield(); // a producer is still filling its cell
+            continue;
+        }
+        sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ring_.sizeApprox() == 0 && !closed_.load(std::memory_order_acquire)) {
+            sleeping_.wait(true, std::memory_order_acquire);
+        }
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace gb2d::logging
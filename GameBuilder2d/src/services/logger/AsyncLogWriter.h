@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <spdlog/common.h>
+#include "LogManager.h"
+#include "LogRing.h"
+
+namespace gb2d::logging {
+
+struct LogRecord {
+    spdlog::level::level_enum level = spdlog::level::info;
+    std::chrono::system_clock::time_point time{};
+    std::string message;
+};
+
+// Background half of LogManager's async mode. Producers post already formatted messages into a
+// LogRing; one thread drains it and hands the records to the logger's sinks, a batch per pass,
+// keeping each record's original timestamp. The writer can be stopped and started again in place,
+// which LogManager relies on so that a pointer a producer loaded just before a stop stays valid.
+class AsyncLogWriter {
+public:
+    explicit AsyncLogWriter(size_t capacity);
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(const AsyncLogWriter&) = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+    void start(std::shared_ptr<spdlog::logger> logger, const AsyncOptions& opts);
+    // Turns new posts away, waits for posts already past the running() check, then drains what is
+    // queued, joins the thread and releases the logger.
+    void stop();
+    bool running() const { return running_.load(std::memory_order_acquire); }
+    size_t capacity() const { return ring_.capacity(); }
+    void setOverflow(OverflowPolicy policy) { overflow_.store((int)policy, std::memory_order_relaxed); }
+
+    // False when the writer is stopped; the caller should then log synchronously.
+    bool post(spdlog::level::level_enum level, std::string_view message);
+    // Returns once every record posted before the call has been written (or the writer stopped).
+    void flush();
+    AsyncStats stats() const;
+
+    static size_t ringCapacityFor(size_t requested);
+
+private:
+    void run();
+    void wake();
+
+    LogRing<LogRecord> ring_;
+    std::shared_ptr<spdlog::logger> logger_;
+    std::thread thread_;
+    size_t batchSize_ = 256;
+    std::atomic<int> overflow_{(int)OverflowPolicy::block};
+    std::atomic<bool> running_{false};
+    std::atomic<bool> closed_{false};           // set by stop() once no producer can push; the writer exits when drained
+    alignas(64) std::atomic<size_t> posting_{0}; // producers inside post()
+    alignas(64) std::atomic<bool> sleeping_{false};
+    alignas(64) std::atomic<size_t> completed_{0}; // dequeue position whose records are all written
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> batches_{0};
+    alignas(64) std::atomic<uint64_t> droppedOldest_{0};
+    std::atomic<uint64_t> droppedNewest_{0};
+    std::atomic<uint64_t> blocked_{0};
+};
+
+} // namespace gb2d::logging
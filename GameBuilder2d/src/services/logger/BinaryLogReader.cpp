@@ -0,0 +1,160 @@
+#include "BinaryLogReader.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#if defined(SPDLOG_FMT_EXTERNAL)
+#include <fmt/args.h>
+#else
+#include <spdlog/fmt/bundled/args.h>
+#endif
+
+namespace gb2d::logging::binlog {
+
+namespace {
+
+class RecordReader {
+public:
+    RecordReader(const char* p, const char* end) : p_(p), end_(end) {}
+    bool ok() const { return ok_; }
+    bool atEnd() const { return p_ >= end_; }
+    std::string_view rest() { std::string_view s(p_, (size_t)(end_ - p_)); p_ = end_; return s; }
+
+    template <typename T>
+    T raw() {
+        T v{};
+        if ((size_t)(end_ - p_) < sizeof(T)) { ok_ = false; return v; }
+        std::memcpy(&v, p_, sizeof(T));
+        p_ += sizeof(T);
+        return v;
+    }
+    uint8_t byte() { return raw<uint8_t>(); }
+    uint64_t varint() {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p_ >= end_) break;
+            const uint8_t b = (uint8_t)*p_++;
+            v |= (uint64_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        ok_ = false;
+        return 0;
+    }
+    std::string_view bytes(uint64_t n) {
+        if ((uint64_t)(end_ - p_) < n) { ok_ = false; return {}; }
+        std::string_view s(p_, (size_t)n);
+        p_ += n;
+        return s;
+    }
+
+private:
+    const char* p_;
+    const char* end_;
+    bool ok_ = true;
+};
+
+bool read_arg(RecordReader& r, DecodedArg& arg) {
+    arg = DecodedArg{};
+    arg.type = (ArgType)r.byte();
+    switch (arg.type) {
+        case ArgType::int64: {
+            const uint64_t z = r.varint();
+            arg.i = (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+            break;
+        }
+        case ArgType::uint64: arg.u = r.varint(); break;
+        case ArgType::float32: arg.f = r.raw<float>(); break;
+        case ArgType::float64: arg.f = r.raw<double>(); break;
+        case ArgType::boolean: arg.b = r.byte() != 0; break;
+        case ArgType::character: arg.c = (char)r.byte(); break;
+        case ArgType::string: arg.s = r.bytes(r.varint()); break;
+        case ArgType::pointer: arg.u = r.raw<uint64_t>(); break;
+        default: return false;
+    }
+    return r.ok();
+}
+
+} // namespace
+
+DecodeStatus decode_segment(std::string_view bytes, const std::function<void(const DecodedRecord&)>& onRecord,
+                            SegmentHeader* header) {
+    SegmentHeader h{};
+    if (bytes.size() < sizeof(h)) return DecodeStatus::not_a_segment;
+    std::memcpy(&h, bytes.data(), sizeof(h));
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 || h.version != kVersion || h.header_size < sizeof(h) ||
+        h.header_size > bytes.size()) {
+        return DecodeStatus::not_a_segment;
+    }
+    if (header) *header = h;
+
+    std::unordered_map<uint64_t, std::string_view> formats;
+    DecodedRecord record;
+    size_t pos = h.header_size;
+    while (pos + sizeof(uint32_t) <= bytes.size()) {
+        uint32_t size = 0;
+        std::memcpy(&size, bytes.data() + pos, sizeof(size));
+        if (size == 0) return DecodeStatus::ok; // unused tail of a segment that was never closed
+        if (size < sizeof(uint32_t) + 1 || size > bytes.size() - pos) return DecodeStatus::truncated;
+        RecordReader r(bytes.data() + pos + sizeof(uint32_t), bytes.data() + pos + size);
+        pos += size;
+
+        const auto kind = (RecordKind)r.byte();
+        if (kind == RecordKind::format) {
+            const uint64_t id = r.varint();
+            formats[id] = r.rest();
+            continue;
+        }
+        if (kind != RecordKind::event && kind != RecordKind::text) continue; // from a newer writer
+        record.level = r.byte();
+        record.time_ns = r.raw<int64_t>();
+        record.args.clear();
+        if (kind == RecordKind::text) {
+            record.is_text = true;
+            record.format = {};
+            record.text = r.rest();
+        } else {
+            record.is_text = false;
+            record.text = {};
+            const auto it = formats.find(r.varint());
+            if (it == formats.end()) return DecodeStatus::truncated;
+            record.format = it->second;
+            while (r.ok() && !r.atEnd()) {
+                DecodedArg arg;
+                if (!read_arg(r, arg)) return DecodeStatus::truncated;
+                record.args.push_back(arg);
+            }
+        }
+        if (!r.ok()) return DecodeStatus::truncated;
+        onRecord(record);
+    }
+    return pos == bytes.size() ? DecodeStatus::ok : DecodeStatus::truncated;
+}
+
+std::string render_message(const DecodedRecord& record) {
+    if (record.is_text) return std::string(record.text);
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    for (const auto& arg : record.args) {
+        switch (arg.type) {
+            case ArgType::int64: store.push_back(arg.i); break;
+            case ArgType::uint64: store.push_back(arg.u); break;
+            case ArgType::float32: store.push_back((float)arg.f); break;
+            case ArgType::float64: store.push_back(arg.f); break;
+            case ArgType::boolean: store.push_back(arg.b); break;
+            case ArgType::character: store.push_back(arg.c); break;
+            case ArgType::string: store.push_back(arg.s); break;
+            case ArgType::pointer: store.push_back((const void*)(uintptr_t)arg.u); break;
+        }
+    }
+    try {
+        return fmt::vformat(fmt::string_view(record.format.data(), record.format.size()), store);
+    } catch (const std::exception& e) {
+        return std::string(record.format) + " <format error: " + e.what() + ">";
+    }
+}
+
+const char* level_name(uint8_t level) {
+    static const char* const names[] = { "trace", "debug", "info", "warning", "error", "critical" };
+    return level < 6 ? names[level] : "off";
+}
+
+} // namespace gb2d::logging::binlog
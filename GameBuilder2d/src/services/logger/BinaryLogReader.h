@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "BinaryLogSink.h"
+
+namespace gb2d::logging::binlog {
+
+struct DecodedArg {
+    ArgType type{};
+    int64_t i = 0;          // int64
+    uint64_t u = 0;         // uint64, pointer
+    double f = 0.0;         // float32, float64
+    bool b = false;
+    char c = 0;
+    std::string_view s{};   // string; points into the segment
+};
+
+// One message from a segment. Event records carry the format string and arguments; text records
+// (messages whose arguments could not be packed) carry the finished message in `text`.
+struct DecodedRecord {
+    uint8_t level = 0;      // Level as an integer (trace = 0)
+    int64_t time_ns = 0;    // unix time
+    bool is_text = false;
+    std::string_view format{};
+    std::vector<DecodedArg> args{};
+    std::string_view text{};
+};
+
+struct RecordFilter {
+    uint8_t min_level = 0;
+    int64_t since_ns = std::numeric_limits<int64_t>::min();
+    int64_t until_ns = std::numeric_limits<int64_t>::max();
+    bool accepts(const DecodedRecord& r) const { return r.level >= min_level && r.time_ns >= since_ns && r.time_ns <= until_ns; }
+};
+
+enum class DecodeStatus { ok, not_a_segment, truncated };
+
+// Calls onRecord for every message in one segment, oldest first. Stops at the first record that
+// does not fit (a segment cut short by a crash) and reports `truncated`, after delivering every
+// complete record before it.
+DecodeStatus decode_segment(std::string_view bytes, const std::function<void(const DecodedRecord&)>& onRecord,
+                            SegmentHeader* header = nullptr);
+
+// The message as the text sinks would have shown it: the format string applied to the arguments.
+std::string render_message(const DecodedRecord& record);
+
+// "trace", "debug", "info", "warning", "error", "critical"; spdlog's names, as in the text log.
+const char* level_name(uint8_t level);
+
+} // namespace gb2d::logging::binlog
@@ -0,0 +1,298 @@
+#include "BinaryLogSink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+namespace gb2d::logging {
+
+namespace {
+
+constexpr size_t kMinSegmentBytes = 4096;
+constexpr size_t kRecordPrefix = sizeof(uint32_t) + 1;                       // size + kind
+constexpr size_t kTimedPrefix = kRecordPrefix + 1 + sizeof(int64_t);        // + level + time
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+size_t varint_size(uint64_t v) {
+    size_t n = 1;
+    while (v >= 0x80) { v >>= 7; ++n; }
+    return n;
+}
+
+// Writes a record into reserved segment memory.
+class RecordWriter {
+public:
+    explicit RecordWriter(char* p) : p_(p) {}
+    template <typename T>
+    void raw(const T& v) { std::memcpy(p_, &v, sizeof(T)); p_ += sizeof(T); }
+    void byte(uint8_t v) { *p_++ = (char)v; }
+    void varint(uint64_t v) {
+        while (v >= 0x80) { *p_++ = (char)((v & 0x7F) | 0x80); v >>= 7; }
+        *p_++ = (char)v;
+    }
+    void bytes(std::string_view s) { std::memcpy(p_, s.data(), s.size()); p_ += s.size(); }
+
+private:
+    char* p_;
+};
+
+} // namespace
+
+// A segment file mapped read-write at its full capacity; closing truncates it to the bytes used.
+class BinaryLogSink::Segment {
+public:
+    ~Segment() { close(); }
+
+    static std::unique_ptr<Segment> create(const std::filesystem::path& path, size_t capacity) {
+        auto segment = std::unique_ptr<Segment>(new Segment());
+        segment->path = path;
+        segment->capacity = capacity;
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+        segment->file_ = file;
+        const uint64_t size = capacity;
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)(size & 0xFFFFFFFFu), nullptr);
+        if (mapping == nullptr) return nullptr;
+        segment->mapping_ = mapping;
+        void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+        if (view == nullptr) return nullptr;
+        segment->data = static_cast<char*>(view);
+#else
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) return nullptr;
+        segment->fd_ = fd;
+        if (::ftruncate(fd, (off_t)capacity) != 0) return nullptr;
+        void* view = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (view == MAP_FAILED) return nullptr;
+        segment->data = static_cast<char*>(view);
+#endif
+        return segment;
+    }
+
+    void flush() {
+        if (data == nullptr) return;
+#if defined(_WIN32)
+        FlushViewOfFile(data, used);
+#else
+        ::msync(data, used, MS_ASYNC);
+#endif
+    }
+
+    void close() {
+#if defined(_WIN32)
+        if (data != nullptr) UnmapViewOfFile(data);
+        if (mapping_ != nullptr) CloseHandle(static_cast<HANDLE>(mapping_));
+        if (file_ != nullptr) {
+            LARGE_INTEGER end{};
+            end.QuadPart = (LONGLONG)used;
+            if (SetFilePointerEx(static_cast<HANDLE>(file_), end, nullptr, FILE_BEGIN)) SetEndOfFile(static_cast<HANDLE>(file_));
+            CloseHandle(static_cast<HANDLE>(file_));
+        }
+        mapping_ = nullptr;
+        file_ = nullptr;
+#else
+        if (data != nullptr) ::munmap(data, capacity);
+        if (fd_ >= 0) {
+            (void)::ftruncate(fd_, (off_t)used);
+            ::close(fd_);
+        }
+        fd_ = -1;
+#endif
+        data = nullptr;
+    }
+
+    bool fits(size_t bytes) const { return used + bytes <= capacity; }
+
+    std::filesystem::path path{};
+    char* data{nullptr};
+    size_t capacity{0};
+    size_t used{0};
+
+private:
+    Segment() = default;
+#if defined(_WIN32)
+    void* file_{nullptr};
+    void* mapping_{nullptr};
+#else
+    int fd_{-1};
+#endif
+};
+
+BinaryLogSink::BinaryLogSink(BinaryLogOptions options) : options_(std::move(options)) {
+    options_.segment_bytes = std::max(options_.segment_bytes, kMinSegmentBytes);
+    options_.max_segments = std::max<size_t>(options_.max_segments, 1);
+}
+
+BinaryLogSink::~BinaryLogSink() {
+    close();
+}
+
+bool BinaryLogSink::open() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (segment_) return true;
+    std::error_code ec;
+    std::filesystem::create_directories(options_.directory, ec);
+
+    // Continue numbering after segments left by earlier runs, and count them towards retention
+    retained_.clear();
+    const std::string prefix = options_.base_name + "-";
+    for (const auto& entry : std::filesystem::directory_iterator(options_.directory, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (entry.path().extension() != binlog::kExtension || name.rfind(prefix, 0) != 0) continue;
+        const std::string digits = entry.path().stem().string().substr(prefix.size());
+        if (digits.empty() || digits.size() > 18 || !std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; })) continue;
+        retained_.push_back(std::stoull(digits));
+    }
+    std::sort(retained_.begin(), retained_.end());
+    nextIndex_ = retained_.empty() ? 0 : retained_.back() + 1;
+    return openNextSegment(now_ns());
+}
+
+void BinaryLogSink::close() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    closeSegment();
+}
+
+void BinaryLogSink::flush() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (segment_) segment_->flush();
+}
+
+BinaryLogStats BinaryLogSink::stats() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    BinaryLogStats s = stats_;
+    s.active = segment_ != nullptr;
+    return s;
+}
+
+std::filesystem::path BinaryLogSink::currentSegmentPath() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return segment_ ? segment_->path : std::filesystem::path{};
+}
+
+std::filesystem::path BinaryLogSink::segmentPath(uint64_t index) const {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "-%06llu", (unsigned long long)index);
+    return options_.directory / (options_.base_name + suffix + std::string(binlog::kExtension));
+}
+
+bool BinaryLogSink::openNextSegment(int64_t nowNs) {
+    const uint64_t index = nextIndex_++;
+    segment_ = Segment::create(segmentPath(index), options_.segment_bytes);
+    if (!segment_) return false;
+
+    binlog::SegmentHeader header{};
+    std::memcpy(header.magic, binlog::kMagic, sizeof(binlog::kMagic));
+    header.version = binlog::kVersion;
+    header.header_size = sizeof(binlog::SegmentHeader);
+    header.index = index;
+    header.created_ns = nowNs;
+    std::memcpy(segment_->data, &header, sizeof(header));
+    segment_->used = sizeof(header);
+    defined_.assign(formats_.size(), 0);
+    ++stats_.segments;
+
+    retained_.push_back(index);
+    while (retained_.size() > options_.max_segments) {
+        std::error_code ec;
+        std::filesystem::remove(segmentPath(retained_.front()), ec);
+        retained_.erase(retained_.begin());
+    }
+    return true;
+}
+
+void BinaryLogSink::closeSegment() {
+    if (!segment_) return;
+    segment_->close();
+    segment_.reset();
+}
+
+uint32_t BinaryLogSink::formatId(std::string_view format) {
+    // Format strings are literals, so the address identifies the call site; the text check guards
+    // against a runtime string reusing an address.
+    auto it = ids_.find(format.data());
+    if (it != ids_.end() && formats_[it->second] == format) return it->second;
+    const uint32_t id = (uint32_t)formats_.size();
+    formats_.emplace_back(format);
+    defined_.push_back(0);
+    ids_[format.data()] = id;
+    return id;
+}
+
+void BinaryLogSink::writeEvent(uint8_t level, std::string_view format, std::string_view packedArgs) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!segment_) { ++stats_.dropped; return; }
+    const int64_t now = now_ns();
+    const uint32_t id = formatId(format);
+    const size_t eventSize = kTimedPrefix + varint_size(id) + packedArgs.size();
+    const size_t definitionSize = kRecordPrefix + varint_size(id) + format.size();
+    if (definitionSize + eventSize > options_.segment_bytes - sizeof(binlog::SegmentHeader)) { ++stats_.dropped; return; }
+    if (!segment_->fits((defined_[id] ? 0 : definitionSize) + eventSize)) {
+        closeSegment();
+        if (!openNextSegment(now)) { ++stats_.dropped; return; }
+    }
+
+    if (!defined_[id]) {
+        RecordWriter w(segment_->data + segment_->used);
+        w.raw((uint32_t)definitionSize);
+        w.byte((uint8_t)binlog::RecordKind::format);
+        w.varint(id);
+        w.bytes(format);
+        segment_->used += definitionSize;
+        stats_.bytes += definitionSize;
+        defined_[id] = 1;
+    }
+    RecordWriter w(segment_->data + segment_->used);
+    w.raw((uint32_t)eventSize);
+    w.byte((uint8_t)binlog::RecordKind::event);
+    w.byte(level);
+    w.raw(now);
+    w.varint(id);
+    w.bytes(packedArgs);
+    segment_->used += eventSize;
+    stats_.bytes += eventSize;
+    ++stats_.records;
+}
+
+void BinaryLogSink::writeText(uint8_t level, std::string_view message) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!segment_) { ++stats_.dropped; return; }
+    const int64_t now = now_ns();
+    const size_t size = kTimedPrefix + message.size();
+    if (size > options_.segment_bytes - sizeof(binlog::SegmentHeader)) { ++stats_.dropped; return; }
+    if (!segment_->fits(size)) {
+        closeSegment();
+        if (!openNextSegment(now)) { ++stats_.dropped; return; }
+    }
+    RecordWriter w(segment_->data + segment_->used);
+    w.raw((uint32_t)size);
+    w.byte((uint8_t)binlog::RecordKind::text);
+    w.byte(level);
+    w.raw(now);
+    w.bytes(message);
+    segment_->used += size;
+    stats_.bytes += size;
+    ++stats_.text_records;
+}
+
+} // namespace gb2d::logging
@@ -0,0 +1,182 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <spdlog/fmt/fmt.h>
+
+namespace gb2d::logging {
+
+// Binary log: every message becomes a compact record (timestamp, level, format-string id, packed
+// arguments) appended to memory-mapped segment files, with no text formatting on the caller.
+// gb2d_log_decoder turns the segments back into text or JSON.
+struct BinaryLogOptions {
+    bool enabled = false;
+    std::filesystem::path directory{};     // segments are <directory>/<base_name>-NNNNNN.gb2dlog
+    std::string base_name = "gb2d";
+    size_t segment_bytes = 8u << 20;       // a segment is closed and a new one started when full
+    size_t max_segments = 8;               // oldest segments beyond this are deleted, across runs too
+    bool text_sinks = true;                // false: skip stderr and the console window entirely
+};
+
+struct BinaryLogStats {
+    bool active = false;
+    uint64_t records = 0;       // messages written as format id + packed arguments
+    uint64_t text_records = 0;  // messages with an argument type that cannot be packed, written as text
+    uint64_t bytes = 0;
+    uint64_t segments = 0;      // segments opened since the sink started
+    uint64_t dropped = 0;       // records larger than a segment, or written while no segment is open
+};
+
+namespace binlog {
+
+inline constexpr std::string_view kExtension = ".gb2dlog";
+inline constexpr char kMagic[8] = {'G', 'B', '2', 'D', 'L', 'O', 'G', '\0'};
+inline constexpr uint32_t kVersion = 1;
+
+struct SegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t index;       // increases by one per segment, across runs
+    int64_t created_ns;   // unix time
+};
+
+// On-disk layout, little-endian as written by the host:
+//   SegmentHeader, then records back to back. Each record is
+//   u32 total size, u8 kind, then per kind:
+//     format: varint id, format string bytes            (sent before the first event using the id
+//                                                         in each segment, so segments stand alone)
+//     event:  u8 level, u64 unix time ns, varint format id, packed arguments
+//     text:   u8 level, u64 unix time ns, message bytes
+//   A zero size ends the segment (the unused tail of a mapped segment is zero).
+enum class RecordKind : uint8_t { format = 1, event = 2, text = 3 };
+enum class ArgType : uint8_t { int64 = 1, uint64, float32, float64, boolean, character, string, pointer };
+
+template <typename T>
+inline constexpr bool is_string_v = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                                    std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>;
+
+template <typename T>
+inline constexpr bool is_integer_v = std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+                                     !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+                                     !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+// Argument types stored as-is. A message with any other argument type (custom formatters, enums
+// with format_as, ...) is formatted on the caller and stored as a text record instead.
+template <typename T, typename D = std::remove_cvref_t<T>>
+inline constexpr bool is_packable_v = is_integer_v<D> || std::is_same_v<D, bool> || std::is_same_v<D, char> ||
+                                      std::is_same_v<D, float> || std::is_same_v<D, double> || is_string_v<D> ||
+                                      std::is_same_v<D, void*> || std::is_same_v<D, const void*> ||
+                                      std::is_same_v<D, std::nullptr_t>;
+
+inline void put_varint(fmt::memory_buffer& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((char)((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.push_back((char)v);
+}
+
+template <typename T>
+void put_raw(fmt::memory_buffer& out, const T& v) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &v, sizeof(T));
+    out.append(bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void pack(fmt::memory_buffer& out, const T& value) {
+    using D = std::remove_cvref_t<T>;
+    if constexpr (is_string_v<D>) {
+        std::string_view s;
+        if constexpr (std::is_pointer_v<D>) {
+            if (value) s = value;
+        } else {
+            s = value;
+        }
+        out.push_back((char)ArgType::string);
+        put_varint(out, s.size());
+        out.append(s.data(), s.data() + s.size());
+    } else if constexpr (std::is_same_v<D, bool>) {
+        out.push_back((char)ArgType::boolean);
+        out.push_back(value ? 1 : 0);
+    } else if constexpr (std::is_same_v<D, char>) {
+        out.push_back((char)ArgType::character);
+        out.push_back(value);
+    } else if constexpr (is_integer_v<D> && std::is_signed_v<D>) {
+        const int64_t v = value;
+        out.push_back((char)ArgType::int64);
+        put_varint(out, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63)); // zigzag
+    } else if constexpr (is_integer_v<D>) {
+        out.push_back((char)ArgType::uint64);
+        put_varint(out, (uint64_t)value);
+    } else if constexpr (std::is_same_v<D, float>) {
+        out.push_back((char)ArgType::float32);
+        put_raw(out, value);
+    } else if constexpr (std::is_same_v<D, double>) {
+        out.push_back((char)ArgType::float64);
+        put_raw(out, value);
+    } else {
+        out.push_back((char)ArgType::pointer);
+        put_raw(out, (uint64_t)(uintptr_t)value);
+    }
+}
+
+} // namespace binlog
+
+class BinaryLogSink {
+public:
+    explicit BinaryLogSink(BinaryLogOptions options);
+    ~BinaryLogSink();
+    BinaryLogSink(const BinaryLogSink&) = delete;
+    BinaryLogSink& operator=(const BinaryLogSink&) = delete;
+
+    // Creates the directory and the first segment. Returns false (and logs nothing) on failure.
+    bool open();
+    // Truncates the current segment to its used size. Later writes are dropped.
+    void close();
+    // Asks the OS to write dirty pages back; the mapping survives a crash of the process anyway.
+    void flush();
+
+    // `format` must be the string literal of the call site: ids are assigned per string address.
+    template <typename... Args>
+    void write(uint8_t level, std::string_view format, const Args&... args) {
+        static_assert((binlog::is_packable_v<Args> && ...), "use writeText for arguments that cannot be packed");
+        fmt::memory_buffer packed;
+        (binlog::pack(packed, args), ...);
+        writeEvent(level, format, std::string_view(packed.data(), packed.size()));
+    }
+    void writeEvent(uint8_t level, std::string_view format, std::string_view packedArgs);
+    void writeText(uint8_t level, std::string_view message);
+
+    const BinaryLogOptions& options() const { return options_; }
+    BinaryLogStats stats() const;
+    std::filesystem::path currentSegmentPath() const;
+
+private:
+    class Segment;
+
+    std::filesystem::path segmentPath(uint64_t index) const;
+    bool openNextSegment(int64_t nowNs);
+    void closeSegment();
+    uint32_t formatId(std::string_view format);
+
+    BinaryLogOptions options_;
+    mutable std::mutex mtx_;
+    std::unique_ptr<Segment> segment_;
+    uint64_t nextIndex_ = 0;
+    std::vector<uint64_t> retained_;                      // segment indices on disk, oldest first
+    std::unordered_map<const char*, uint32_t> ids_;      // format string address -> id
+    std::vector<std::string> formats_;                   // id -> format string
+    std::vector<uint8_t> defined_;                       // id -> sent in the current segment
+    BinaryLogStats stats_{};
+};
+
+} // namespace gb2d::logging
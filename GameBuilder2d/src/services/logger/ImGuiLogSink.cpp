@@ -1,4 +1,5 @@
 #include "ImGuiLogSink.h"
+#include <algorithm>
 
 namespace gb2d::logging {
 
@@ -7,37 +8,86 @@ ImGuiLogBuffer& ImGuiLogBuffer::instance() {
     return buf;
 }
 
+ImGuiLogBuffer::ImGuiLogBuffer() { slots_.resize(capacity_); }
+
+LogEntry& ImGuiLogBuffer::claimSlot() {
+    const uint64_t seq = next_++;
+    if (next_ - first_ > capacity_) first_ = next_ - capacity_;
+    LogEntry& slot = slots_[(size_t)(seq % capacity_)];
+    slot.seq = seq;
+    return slot;
+}
+
 void ImGuiLogBuffer::push(LogEntry e) {
     std::lock_guard<std::mutex> lock(mtx_);
-    if (entries_.size() >= capacity_) {
-        // drop oldest to keep within capacity
-        const size_t to_drop = entries_.size() - capacity_ + 1;
-        entries_.erase(entries_.begin(), entries_.begin() + (std::ptrdiff_t)to_drop);
-    }
-    entries_.emplace_back(std::move(e));
+    if (capacity_ == 0) return;
+    LogEntry& slot = claimSlot();
+    slot.level = e.level;
+    slot.time = e.time;
+    slot.message = std::move(e.message);
+}
+
+void ImGuiLogBuffer::push(spdlog::level::level_enum level, std::chrono::system_clock::time_point time, std::string_view message) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (capacity_ == 0) return;
+    LogEntry& slot = claimSlot();
+    slot.level = level;
+    slot.time = time;
+    slot.message.assign(message.data(), message.size());
 }
 
 void ImGuiLogBuffer::clear() {
     std::lock_guard<std::mutex> lock(mtx_);
-    entries_.clear();
+    first_ = next_;
 }
 
 void ImGuiLogBuffer::setCapacity(size_t cap) {
     std::lock_guard<std::mutex> lock(mtx_);
-    capacity_ = cap;
-    if (entries_.size() > capacity_) {
-        entries_.erase(entries_.begin(), entries_.begin() + (std::ptrdiff_t)(entries_.size() - capacity_));
+    if (cap == capacity_) return;
+    // Keep the newest entries and re-slot them for the new modulus; sequence numbers are unchanged.
+    const uint64_t keep = std::min<uint64_t>(next_ - first_, cap);
+    std::vector<LogEntry> resized(cap);
+    for (uint64_t seq = next_ - keep; seq < next_; ++seq) {
+        resized[(size_t)(seq % cap)] = std::move(slots_[(size_t)(seq % capacity_)]);
     }
+    slots_ = std::move(resized);
+    capacity_ = cap;
+    first_ = next_ - keep;
 }
 
 size_t ImGuiLogBuffer::size() const {
     std::lock_guard<std::mutex> lock(mtx_);
-    return entries_.size();
+    return (size_t)(next_ - first_);
+}
+
+size_t ImGuiLogBuffer::capacity() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return capacity_;
 }
 
 void ImGuiLogBuffer::snapshot(std::vector<LogEntry>& out) const {
+    out.clear();
+    (void)readSince(0, out);
+}
+
+uint64_t ImGuiLogBuffer::readSince(uint64_t seq, std::vector<LogEntry>& out) const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    const uint64_t from = std::max(seq, first_);
+    if (from < next_) out.reserve(out.size() + (size_t)(next_ - from));
+    for (uint64_t s = from; s < next_; ++s) {
+        out.push_back(slots_[(size_t)(s % capacity_)]);
+    }
+    return next_;
+}
+
+uint64_t ImGuiLogBuffer::firstSeq() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return first_;
+}
+
+uint64_t ImGuiLogBuffer::nextSeq() const {
     std::lock_guard<std::mutex> lock(mtx_);
-    out = entries_;
+    return next_;
 }
 
 std::shared_ptr<spdlog::sinks::sink> create_imgui_sink() {
@@ -1,9 +1,11 @@
 #pragma once
 #include <vector>
 #include <string>
+#include <string_view>
 #include <mutex>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 #include <spdlog/common.h>
 #include <spdlog/sinks/base_sink.h>
 
@@ -13,22 +15,41 @@ struct LogEntry {
     spdlog::level::level_enum level;
     std::chrono::system_clock::time_point time;
     std::string message;
+    uint64_t seq = 0; // assigned by ImGuiLogBuffer::push, increasing by one per entry
 };
 
+// Fixed-capacity ring of the most recent log entries. Pushing overwrites the oldest slot once
+// full, reusing its string storage. Every entry gets the next sequence number, and numbers are
+// never reused (not even across clear()), so a viewer can remember the last one it saw and pull
+// only what arrived since with readSince().
 class ImGuiLogBuffer {
 public:
+    ImGuiLogBuffer();
     void push(LogEntry e);
+    // Copies `message` into the slot being overwritten, reusing its storage once the ring is full.
+    void push(spdlog::level::level_enum level, std::chrono::system_clock::time_point time, std::string_view message);
     void clear();
     void setCapacity(size_t cap);
     size_t size() const;
-    void snapshot(std::vector<LogEntry>& out) const; // copy under lock
+    size_t capacity() const;
+    void snapshot(std::vector<LogEntry>& out) const; // copy under lock, oldest first
+    // Appends the retained entries whose seq is >= `seq`, oldest first, and returns the sequence
+    // number to pass next time. Entries already overwritten are skipped, so the first entry
+    // appended can have a larger seq than requested.
+    uint64_t readSince(uint64_t seq, std::vector<LogEntry>& out) const;
+    uint64_t firstSeq() const; // oldest retained entry, or nextSeq() when empty
+    uint64_t nextSeq() const;  // seq the next push will get
 
     static ImGuiLogBuffer& instance();
 
 private:
+    LogEntry& claimSlot(); // caller holds mtx_
+
     mutable std::mutex mtx_;
-    std::vector<LogEntry> entries_;
+    std::vector<LogEntry> slots_; // entry `seq` lives in slots_[seq % capacity_]
     size_t capacity_ = 2000;
+    uint64_t first_ = 0;
+    uint64_t next_ = 0;
 };
 
 // Custom spdlog sink that writes into ImGuiLogBuffer
@@ -38,11 +59,7 @@ protected:
     void sink_it_(const spdlog::details::log_msg& msg) override {
         spdlog::memory_buf_t formatted;
         this->formatter_->format(msg, formatted);
-        LogEntry e;
-        e.level = msg.level;
-        e.time = std::chrono::system_clock::now();
-        e.message.assign(formatted.data(), formatted.size());
-        ImGuiLogBuffer::instance().push(std::move(e));
+        ImGuiLogBuffer::instance().push(msg.level, msg.time, std::string_view(formatted.data(), formatted.size()));
     }
     void flush_() override {}
 };
@@ -1,13 +1,30 @@
 #include "LogManager.h"
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <atomic>
 #include <mutex>
+#include "AsyncLogWriter.h"
 #include "ImGuiLogSink.h"
 
 namespace gb2d::logging {
 namespace {
     std::shared_ptr<spdlog::logger> g_logger;
     std::mutex g_mtx;
+    std::vector<spdlog::sink_ptr> g_test_sinks;
+    // Async mode. g_async is what log_string reads without taking g_mtx; a producer may still be
+    // inside post() after it is cleared, so writers are stopped but never destroyed while the
+    // process runs. The current one is restarted in place, and one is only retired when the queue
+    // capacity changes.
+    std::atomic<AsyncLogWriter*> g_async{nullptr};
+    std::unique_ptr<AsyncLogWriter> g_writer;
+    std::vector<std::unique_ptr<AsyncLogWriter>> g_retired_writers;
+    std::unique_ptr<BinaryLogSink> g_binary;
+    std::vector<std::unique_ptr<BinaryLogSink>> g_retired_binary;
+
+    bool same_segments(const BinaryLogOptions& a, const BinaryLogOptions& b) {
+        return a.directory == b.directory && a.base_name == b.base_name && a.segment_bytes == b.segment_bytes &&
+               a.max_segments == b.max_segments;
+    }
 }
 
 std::shared_ptr<spdlog::logger>& LogManager::logger() { return g_logger; }
@@ -29,15 +46,63 @@ void LogManager::apply_config(const Config& cfg) {
     if (!g_logger) return;
     g_logger->set_level((spdlog::level::level_enum)to_spd(cfg.level));
     g_logger->set_pattern(cfg.pattern);
+    active_level_.store((int)cfg.level, std::memory_order_relaxed);
+    apply_async(cfg.async);
+    apply_binary(cfg.binary);
+}
+
+void LogManager::apply_async(const AsyncOptions& opts) {
+    AsyncLogWriter* current = g_async.load(std::memory_order_relaxed);
+    const size_t capacity = AsyncLogWriter::ringCapacityFor(opts.queue_capacity);
+    if (current) {
+        if (opts.enabled && current->capacity() == capacity) {
+            current->setOverflow(opts.overflow);
+            return;
+        }
+        g_async.store(nullptr, std::memory_order_release);
+        current->stop();
+    }
+    if (!opts.enabled || !g_logger) return;
+    if (g_writer && g_writer->capacity() != capacity) {
+        g_retired_writers.push_back(std::move(g_writer));
+    }
+    if (!g_writer) g_writer = std::make_unique<AsyncLogWriter>(capacity);
+    g_writer->start(g_logger, opts);
+    g_async.store(g_writer.get(), std::memory_order_release);
+}
+
+void LogManager::apply_binary(const BinaryLogOptions& opts) {
+    BinaryLogSink* current = binary_.load(std::memory_order_relaxed);
+    if (current && opts.enabled && same_segments(current->options(), opts)) {
+        text_sinks_.store(opts.text_sinks, std::memory_order_relaxed);
+        return;
+    }
+    if (current) {
+        binary_.store(nullptr, std::memory_order_release);
+        current->close();
+        g_retired_binary.push_back(std::move(g_binary));
+    }
+    text_sinks_.store(true, std::memory_order_relaxed);
+    if (!opts.enabled || !g_logger) return;
+    auto sink = std::make_unique<BinaryLogSink>(opts);
+    if (!sink->open()) {
+        g_logger->warn("Binary log: cannot create a segment in '{}'", opts.directory.string());
+        return;
+    }
+    text_sinks_.store(opts.text_sinks, std::memory_order_relaxed);
+    g_binary = std::move(sink);
+    binary_.store(g_binary.get(), std::memory_order_release);
 }
 
 Status LogManager::init(const Config& cfg) {
     std::lock_guard<std::mutex> lock(g_mtx);
     if (g_logger) return Status::already_initialized;
     try {
-        auto console_sink = std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
-        auto imgui_sink = create_imgui_sink();
-        std::vector<spdlog::sink_ptr> sinks{ console_sink, imgui_sink };
+        std::vector<spdlog::sink_ptr> sinks = g_test_sinks;
+        if (sinks.empty()) {
+            sinks.push_back(std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+            sinks.push_back(create_imgui_sink());
+        }
         g_logger = std::make_shared<spdlog::logger>(cfg.name, sinks.begin(), sinks.end());
         spdlog::register_logger(g_logger);
         apply_config(cfg);
@@ -62,15 +127,53 @@ Status LogManager::shutdown() {
     std::lock_guard<std::mutex> lock(g_mtx);
     if (!g_logger) return Status::not_initialized;
     try {
+        apply_async(AsyncOptions{});
+        apply_binary(BinaryLogOptions{});
         spdlog::drop(g_logger->name());
         g_logger.reset();
+        // A later log call re-initializes with the default config.
+        active_level_.store((int)Config{}.level, std::memory_order_relaxed);
         return Status::ok;
     } catch (...) {
         return Status::error;
     }
 }
 
+void LogManager::flush() {
+    std::shared_ptr<spdlog::logger> local;
+    {
+        std::lock_guard<std::mutex> lock(g_mtx);
+        local = g_logger;
+    }
+    if (AsyncLogWriter* writer = g_async.load(std::memory_order_acquire)) writer->flush();
+    if (BinaryLogSink* binary = binary_.load(std::memory_order_acquire)) binary->flush();
+    if (local) {
+        try { local->flush(); } catch (...) {}
+    }
+}
+
+AsyncStats LogManager::asyncStats() {
+    std::lock_guard<std::mutex> lock(g_mtx);
+    AsyncLogWriter* writer = g_async.load(std::memory_order_relaxed);
+    return writer ? writer->stats() : AsyncStats{};
+}
+
+BinaryLogStats LogManager::binaryStats() {
+    std::lock_guard<std::mutex> lock(g_mtx);
+    BinaryLogSink* binary = binary_.load(std::memory_order_relaxed);
+    return binary ? binary->stats() : BinaryLogStats{};
+}
+
+void LogManager::setSinksForTesting(std::vector<std::shared_ptr<spdlog::sinks::sink>> sinks) {
+    std::lock_guard<std::mutex> lock(g_mtx);
+    g_test_sinks = std::move(sinks);
+}
+
 void LogManager::log_string(Level lvl, std::string_view message) {
+    if (lvl == Level::off) return;
+    if (AsyncLogWriter* writer = g_async.load(std::memory_order_acquire)) {
+        if (writer->post((spdlog::level::level_enum)to_spd(lvl), message)) return;
+    }
     std::shared_ptr<spdlog::logger> local;
     {
         std::lock_guard<std::mutex> lock(g_mtx);
@@ -91,13 +194,8 @@ void LogManager::log_string(Level lvl, std::string_view message) {
     }
 }
 
-std::vector<LogLine> read_log_lines_snapshot(size_t max_lines) {
-    std::vector<LogEntry> raw;
-    ImGuiLogBuffer::instance().snapshot(raw);
-    std::vector<LogLine> out;
-    if (raw.size() > max_lines) raw.erase(raw.begin(), raw.end() - (std::ptrdiff_t)max_lines);
-    out.reserve(raw.size());
-    for (auto& e : raw) {
+namespace {
+    LogLine to_line(LogEntry& e) {
         Level lvl = Level::info;
         switch (e.level) {
             case spdlog::level::trace: lvl = Level::trace; break;
@@ -108,11 +206,30 @@ std::vector<LogLine> read_log_lines_snapshot(size_t max_lines) {
             case spdlog::level::critical: lvl = Level::critical; break;
             default: lvl = Level::info; break;
         }
-        out.push_back(LogLine{ lvl, e.message });
+        return LogLine{ lvl, std::move(e.message), e.seq };
     }
+}
+
+std::vector<LogLine> read_log_lines_snapshot(size_t max_lines) {
+    auto& buffer = ImGuiLogBuffer::instance();
+    const uint64_t next = buffer.nextSeq();
+    std::vector<LogEntry> raw;
+    buffer.readSince(next > max_lines ? next - max_lines : 0, raw);
+    if (raw.size() > max_lines) raw.erase(raw.begin(), raw.end() - (std::ptrdiff_t)max_lines);
+    std::vector<LogLine> out;
+    out.reserve(raw.size());
+    for (auto& e : raw) out.push_back(to_line(e));
     return out;
 }
 
+uint64_t read_log_lines_since(uint64_t seq, std::vector<LogLine>& out) {
+    std::vector<LogEntry> raw;
+    const uint64_t next = ImGuiLogBuffer::instance().readSince(seq, raw);
+    out.reserve(out.size() + raw.size());
+    for (auto& e : raw) out.push_back(to_line(e));
+    return next;
+}
+
 const char* level_to_label(Level l) {
     switch (l) {
         case Level::trace: return "TRACE";
@@ -1,20 +1,59 @@
 #pragma once
+#include <atomic>
 #include <string>
 #include <string_view>
 #include <memory>
 #include <vector>
+#include <cstdint>
 #include <spdlog/fmt/fmt.h>
+#include "BinaryLogSink.h"
 
-namespace spdlog { class logger; }
+// Log calls below this level compile to nothing in the translation units that see it
+// (0 trace, 1 debug, 2 info, 3 warn, 4 err, 5 critical, 6 off). Set it per build, e.g.
+// -DGB2D_LOG_ACTIVE_LEVEL=2 for release builds that never need trace or debug output.
+#ifndef GB2D_LOG_ACTIVE_LEVEL
+#define GB2D_LOG_ACTIVE_LEVEL 0
+#endif
+
+namespace spdlog { class logger; namespace sinks { class sink; } }
 
 namespace gb2d::logging {
 
 enum class Level { trace, debug, info, warn, err, critical, off };
 
+// What a caller does when the async queue is full.
+enum class OverflowPolicy {
+    block,       // wait for the writer thread to make room; nothing is lost
+    drop_oldest, // evict the oldest queued record to make room for the new one
+    drop_newest  // discard the new record
+};
+
+// Async mode: callers format their message and push it into a lock-free ring; a background
+// thread drains the ring and writes to the sinks in batches. Off by default.
+struct AsyncOptions {
+    bool enabled = false;
+    size_t queue_capacity = 8192; // rounded up to a power of two
+    OverflowPolicy overflow = OverflowPolicy::block;
+    size_t batch_size = 256;      // records written per wake-up before the writer re-checks
+};
+
 struct Config {
     std::string name = "GB2D";
     Level level = Level::info;
     std::string pattern = "[%H:%M:%S] [%l] %v";
+    AsyncOptions async{};
+    BinaryLogOptions binary{};
+};
+
+struct AsyncStats {
+    bool active = false;
+    size_t capacity = 0;
+    size_t queued = 0;             // approximate, racy by nature
+    uint64_t written = 0;          // records handed to the sinks by the writer thread
+    uint64_t batches = 0;
+    uint64_t dropped_oldest = 0;   // records evicted under OverflowPolicy::drop_oldest
+    uint64_t dropped_newest = 0;   // records discarded under OverflowPolicy::drop_newest
+    uint64_t blocked = 0;          // calls that had to wait under OverflowPolicy::block
 };
 
 enum class Status { ok, already_initialized, not_initialized, error };
@@ -25,39 +64,83 @@ public:
     static bool isInitialized();
     static Status reconfigure(const Config& cfg);
     static Status shutdown();
+    // Waits until every message logged before the call has reached the sinks, then flushes them.
+    static void flush();
+    static AsyncStats asyncStats(); // all zero while async mode is off
+    static BinaryLogStats binaryStats(); // all zero while the binary log is off
+    // Sinks used by the next init(); an empty list restores stderr + ImGui.
+    static void setSinksForTesting(std::vector<std::shared_ptr<spdlog::sinks::sink>> sinks);
 
+    // True when a message at `lvl` would currently be written. The log calls check this before
+    // formatting, so filtered-out calls cost one relaxed load.
+    static bool isEnabled(Level lvl) {
+        return lvl != Level::off && (int)lvl >= active_level_.load(std::memory_order_relaxed);
+    }
+
+    // Format strings are checked against the arguments at compile time.
     template <typename... Args>
-    static void trace(std::string_view fmt, Args&&... args) { log(Level::trace, fmt, std::forward<Args>(args)...); }
+    static void trace(fmt::format_string<Args...> fmt, Args&&... args) { log<Level::trace>(fmt, std::forward<Args>(args)...); }
     template <typename... Args>
-    static void debug(std::string_view fmt, Args&&... args) { log(Level::debug, fmt, std::forward<Args>(args)...); }
+    static void debug(fmt::format_string<Args...> fmt, Args&&... args) { log<Level::debug>(fmt, std::forward<Args>(args)...); }
     template <typename... Args>
-    static void info(std::string_view fmt, Args&&... args)  { log(Level::info,  fmt, std::forward<Args>(args)...); }
+    static void info(fmt::format_string<Args...> fmt, Args&&... args)  { log<Level::info>(fmt, std::forward<Args>(args)...); }
     template <typename... Args>
-    static void warn(std::string_view fmt, Args&&... args)  { log(Level::warn,  fmt, std::forward<Args>(args)...); }
+    static void warn(fmt::format_string<Args...> fmt, Args&&... args)  { log<Level::warn>(fmt, std::forward<Args>(args)...); }
     template <typename... Args>
-    static void error(std::string_view fmt, Args&&... args) { log(Level::err,   fmt, std::forward<Args>(args)...); }
+    static void error(fmt::format_string<Args...> fmt, Args&&... args) { log<Level::err>(fmt, std::forward<Args>(args)...); }
     template <typename... Args>
-    static void critical(std::string_view fmt, Args&&... args) { log(Level::critical, fmt, std::forward<Args>(args)...); }
+    static void critical(fmt::format_string<Args...> fmt, Args&&... args) { log<Level::critical>(fmt, std::forward<Args>(args)...); }
 
 private:
-    template <typename... Args>
-    static void log(Level lvl, std::string_view fmt, Args&&... args) {
-        try {
-            auto s = fmt::vformat(fmt, fmt::make_format_args(args...));
-            log_string(lvl, s);
-        } catch (...) {
-            // ignore formatting errors
+    template <Level L, typename... Args>
+    static void log(fmt::format_string<Args...> fmt, Args&&... args) {
+        if constexpr ((int)L < GB2D_LOG_ACTIVE_LEVEL) {
+            return;
+        } else {
+            if (!isEnabled(L)) return;
+            try {
+                // The binary log stores the format string and arguments; only text output formats.
+                BinaryLogSink* binary = binary_.load(std::memory_order_acquire);
+                const bool text = binary == nullptr || text_sinks_.load(std::memory_order_relaxed);
+                constexpr bool packable = (binlog::is_packable_v<Args> && ...);
+                if constexpr (packable) {
+                    if (binary) {
+                        const fmt::string_view format = fmt;
+                        binary->write((uint8_t)L, std::string_view(format.data(), format.size()), args...);
+                    }
+                    if (!text) return;
+                }
+                fmt::memory_buffer buf;
+                fmt::vformat_to(fmt::appender(buf), fmt, fmt::make_format_args(args...));
+                const std::string_view message(buf.data(), buf.size());
+                if constexpr (!packable) {
+                    if (binary) binary->writeText((uint8_t)L, message);
+                }
+                if (text) log_string(L, message);
+            } catch (...) {
+                // ignore formatting errors
+            }
         }
     }
+    static inline std::atomic<int> active_level_{(int)Level::info};
+    // Binary log sink, or null. Like async writers, sinks are closed but never destroyed while the
+    // process runs, so a caller that loaded the pointer just before a close never touches freed memory.
+    static inline std::atomic<BinaryLogSink*> binary_{nullptr};
+    static inline std::atomic<bool> text_sinks_{true};
     static void apply_config(const Config& cfg);
+    static void apply_async(const AsyncOptions& opts);
+    static void apply_binary(const BinaryLogOptions& opts);
     static int to_spd(Level lvl);
     static std::shared_ptr<spdlog::logger>& logger();
     static void log_string(Level lvl, std::string_view message);
 };
 
 // UI helpers
-struct LogLine { Level level; std::string text; };
+struct LogLine { Level level; std::string text; uint64_t seq = 0; };
 std::vector<LogLine> read_log_lines_snapshot(size_t max_lines = 1000);
+// Appends the buffered lines with seq >= `seq`, oldest first, and returns the seq to pass next
+// time. Start from 0; lines that were already overwritten are skipped.
+uint64_t read_log_lines_since(uint64_t seq, std::vector<LogLine>& out);
 const char* level_to_label(Level l);
 void clear_log_buffer();
 void set_log_buffer_capacity(size_t cap);
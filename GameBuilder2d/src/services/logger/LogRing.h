@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace gb2d::logging {
+
+// Bounded multi-producer queue in the style of Vyukov's array queue: each cell's sequence number
+// tells a producer whether the cell is free for its position and tells a popper whether the value
+// is published. Pushing is one CAS on the enqueue position; nobody takes a lock. Popping is also
+// safe from several threads, which the drop_oldest overflow policy relies on (a producer that
+// finds the ring full pops the oldest record itself). Capacity is rounded up to a power of two.
+template <typename T>
+class LogRing {
+public:
+    explicit LogRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    // False, with `value` untouched, when every cell is taken.
+    bool tryPush(T&& value) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = (std::intptr_t)seq - (std::intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Empty when nothing is queued or the oldest claimed cell is still being filled.
+    std::optional<T> tryPop() {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = (std::intptr_t)seq - (std::intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        std::optional<T> value(std::move(cell->value));
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // Positions handed out so far. Used as flush tickets: once the dequeue position passes a
+    // value read from enqueued(), every record claimed before that read has left the ring.
+    size_t enqueued() const { return enqueuePos_.load(std::memory_order_acquire); }
+    size_t dequeued() const { return dequeuePos_.load(std::memory_order_acquire); }
+
+    // Racy; for metrics and the writer's sleep check only.
+    size_t sizeApprox() const {
+        const size_t in = enqueuePos_.load(std::memory_order_relaxed);
+        const size_t out = dequeuePos_.load(std::memory_order_relaxed);
+        return in > out ? in - out : 0;
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+};
+
+} // namespace gb2d::logging
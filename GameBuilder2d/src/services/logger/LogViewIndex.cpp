@@ -0,0 +1,320 @@
+#include "LogViewIndex.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace gb2d::logging {
+
+namespace {
+
+char lowerAscii(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+
+std::string toLower(std::string_view s) {
+    std::string out(s);
+    for (char& c : out) c = lowerAscii(c);
+    return out;
+}
+
+uint16_t trigramBit(const char* p) {
+    const uint32_t t = (uint32_t)(uint8_t)p[0] | ((uint32_t)(uint8_t)p[1] << 8) | ((uint32_t)(uint8_t)p[2] << 16);
+    static_assert(LogViewIndex::kSignatureBits == 256);
+    return (uint16_t)((t * 2654435761u) >> 24);
+}
+
+// Signature bits of every trigram of a lowercase needle; empty when it is shorter than three.
+std::vector<uint16_t> signatureOf(std::string_view lowered) {
+    std::vector<uint16_t> sig;
+    for (size_t i = 0; i + 2 < lowered.size(); ++i) sig.push_back(trigramBit(lowered.data() + i));
+    std::sort(sig.begin(), sig.end());
+    sig.erase(std::unique(sig.begin(), sig.end()), sig.end());
+    return sig;
+}
+
+void setBit(std::vector<uint64_t>& bits, size_t s) { bits[s / 64] |= uint64_t{1} << (s % 64); }
+bool testBit(const std::vector<uint64_t>& bits, size_t s) { return (bits[s / 64] >> (s % 64)) & 1u; }
+
+template <typename Fn>
+void forEachBit(uint64_t word, size_t base, Fn fn) {
+    while (word) {
+        fn(base + (size_t)std::countr_zero(word));
+        word &= word - 1;
+    }
+}
+
+// Calls onHit(slot) once for every slot in [from, offsets.size()) whose line contains `needle`.
+// Searches the arena in one pass; the '\n' after each line keeps matches from spanning two lines.
+template <typename OnHit>
+void scanArena(std::string_view arena, const std::vector<uint64_t>& offsets, size_t from, std::string_view needle, OnHit onHit) {
+    const size_t n = offsets.size();
+    if (from >= n || needle.empty()) return;
+    size_t s = from;
+    size_t pos = (size_t)offsets[from];
+    while ((pos = arena.find(needle, pos)) != std::string_view::npos) {
+        while (s + 1 < n && offsets[s + 1] <= pos) ++s;
+        onHit(s);
+        if (s + 1 >= n) break;
+        pos = (size_t)offsets[s + 1];
+    }
+}
+
+} // namespace
+
+void LogViewIndex::setMaxLines(size_t maxLines) {
+    maxLines_ = std::max<size_t>(1, maxLines);
+    const size_t before = lineCount();
+    trimFront();
+    if (lineCount() != before) ++version_;
+}
+
+void LogViewIndex::append(Level level, std::string_view text) {
+    while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) text.remove_suffix(1);
+    for (;;) {
+        const size_t nl = text.find('\n');
+        std::string_view line = text.substr(0, nl);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        const size_t s = levels_.size();
+        const uint64_t id = firstLine_ + s;
+        if (s % 64 == 0) {
+            for (auto& bits : levelBits_) bits.push_back(0);
+            for (auto& bits : trigramBits_) bits.push_back(0);
+            textMatch_.push_back(0);
+        }
+        offsets_.push_back(text_.size());
+        text_.append(line);
+        text_.push_back('\n');
+        const size_t lowerStart = lower_.size();
+        lower_.append(line);
+        lower_.push_back('\n');
+        char* lowered = lower_.data() + lowerStart;
+        for (size_t i = 0; i < line.size(); ++i) lowered[i] = lowerAscii(lowered[i]);
+        for (size_t i = 0; i + 2 < line.size(); ++i) setBit(trigramBits_[trigramBit(lowered + i)], s);
+        levels_.push_back((uint8_t)level);
+        if (level != Level::off) setBit(levelBits_[(size_t)level], s);
+        if (filterNeedle_.empty() || lineLower(id).find(filterNeedle_) != std::string_view::npos) setBit(textMatch_, s);
+        if (passes(s)) {
+            visible_.push_back(id);
+            if (searchHit(id)) matches_.push_back(id);
+        }
+
+        if (nl == std::string_view::npos) break;
+        text.remove_prefix(nl + 1);
+    }
+    trimFront();
+    ++version_;
+}
+
+void LogViewIndex::clear() {
+    firstLine_ += levels_.size();
+    text_.clear();
+    lower_.clear();
+    offsets_.clear();
+    levels_.clear();
+    for (auto& bits : levelBits_) bits.clear();
+    for (auto& bits : trigramBits_) bits.clear();
+    textMatch_.clear();
+    head_ = 0;
+    visible_.clear();
+    visibleHead_ = 0;
+    matches_.clear();
+    matchHead_ = 0;
+    ++version_;
+}
+
+bool LogViewIndex::setFilter(uint32_t levelMask, std::string_view needle) {
+    std::string lowered = toLower(needle);
+    const bool needleChanged = lowered != filterNeedle_;
+    if (!needleChanged && levelMask == levelMask_) return false;
+    if (needleChanged) {
+        // A longer needle containing the old one can only match lines the old one matched.
+        const bool refine = !filterNeedle_.empty() && lowered.find(filterNeedle_) != std::string::npos;
+        filterNeedle_ = std::move(lowered);
+        filterSig_ = signatureOf(filterNeedle_);
+        matchText(refine);
+    }
+    levelMask_ = levelMask;
+    rebuildVisible();
+    rebuildMatches();
+    ++version_;
+    return true;
+}
+
+size_t LogViewIndex::rowOf(uint64_t line) const {
+    auto begin = visible_.begin() + (std::ptrdiff_t)visibleHead_;
+    auto it = std::lower_bound(begin, visible_.end(), line);
+    if (it == visible_.end() || *it != line) return rowCount();
+    return (size_t)(it - begin);
+}
+
+std::string LogViewIndex::visibleText() const {
+    std::string out;
+    const size_t rows = rowCount();
+    for (size_t r = 0; r < rows; ++r) {
+        if (r) out.push_back('\n');
+        out.append(rowText(r));
+    }
+    return out;
+}
+
+void LogViewIndex::setSearch(std::string_view needle, bool caseSensitive) {
+    std::string normalized = caseSensitive ? std::string(needle) : toLower(needle);
+    if (normalized == searchNeedle_ && caseSensitive == searchCaseSensitive_) return;
+    searchNeedle_ = std::move(normalized);
+    searchCaseSensitive_ = caseSensitive;
+    // Signatures are built from lowercase text, so a case-sensitive needle uses its lowercase form.
+    searchSig_ = signatureOf(caseSensitive ? toLower(searchNeedle_) : searchNeedle_);
+    rebuildMatches();
+}
+
+void LogViewIndex::searchSpans(size_t row, std::vector<std::pair<size_t, size_t>>& out) const {
+    out.clear();
+    if (searchNeedle_.empty()) return;
+    const uint64_t line = rowLine(row);
+    const std::string_view hay = searchCaseSensitive_ ? lineText(line) : lineLower(line);
+    size_t pos = 0;
+    while ((pos = hay.find(searchNeedle_, pos)) != std::string_view::npos) {
+        out.emplace_back(pos, pos + searchNeedle_.size());
+        pos += searchNeedle_.size();
+    }
+}
+
+std::string_view LogViewIndex::lineText(uint64_t line) const {
+    const size_t s = slot(line);
+    const size_t begin = (size_t)offsets_[s];
+    const size_t end = (s + 1 < offsets_.size() ? (size_t)offsets_[s + 1] : text_.size()) - 1;
+    return std::string_view(text_).substr(begin, end - begin);
+}
+
+std::string_view LogViewIndex::lineLower(uint64_t line) const {
+    const size_t s = slot(line);
+    const size_t begin = (size_t)offsets_[s];
+    const size_t end = (s + 1 < offsets_.size() ? (size_t)offsets_[s + 1] : lower_.size()) - 1;
+    return std::string_view(lower_).substr(begin, end - begin);
+}
+
+bool LogViewIndex::passes(size_t s) const {
+    return (levelMask_ & (1u << levels_[s])) && testBit(textMatch_, s);
+}
+
+// Bits of word `w` that are retained lines: not trimmed yet, not past the last line.
+uint64_t LogViewIndex::liveWord(size_t w) const {
+    uint64_t m = ~uint64_t{0};
+    if (w == head_ / 64) m &= ~uint64_t{0} << (head_ % 64);
+    const size_t n = levels_.size();
+    if (w == (n - 1) / 64 && n % 64 != 0) m &= ~(~uint64_t{0} << (n % 64));
+    return m;
+}
+
+uint64_t LogViewIndex::visibleWord(size_t w) const {
+    uint64_t levels = 0;
+    for (size_t l = 0; l < levelBits_.size(); ++l) {
+        if (levelMask_ & (1u << l)) levels |= levelBits_[l][w];
+    }
+    return levels & textMatch_[w] & liveWord(w);
+}
+
+uint64_t LogViewIndex::candidateWord(const std::vector<uint16_t>& sig, size_t w) const {
+    uint64_t m = ~uint64_t{0};
+    for (uint16_t bit : sig) m &= trigramBits_[bit][w];
+    return m;
+}
+
+bool LogViewIndex::searchHit(uint64_t line) const {
+    if (searchNeedle_.empty()) return false;
+    const std::string_view hay = searchCaseSensitive_ ? lineText(line) : lineLower(line);
+    return hay.find(searchNeedle_) != std::string_view::npos;
+}
+
+void LogViewIndex::matchText(bool refineOnly) {
+    const size_t words = textMatch_.size();
+    if (filterNeedle_.empty()) {
+        std::fill(textMatch_.begin() + (std::ptrdiff_t)(head_ / 64), textMatch_.end(), ~uint64_t{0});
+        return;
+    }
+    if (!filterSig_.empty()) {
+        for (size_t w = head_ / 64; w < words; ++w) {
+            uint64_t candidates = candidateWord(filterSig_, w) & liveWord(w);
+            if (refineOnly) candidates &= textMatch_[w];
+            uint64_t matched = 0;
+            forEachBit(candidates, w * 64, [&](size_t s) {
+                if (lineLower(firstLine_ + s).find(filterNeedle_) != std::string_view::npos) matched |= uint64_t{1} << (s % 64);
+            });
+            textMatch_[w] = matched;
+        }
+        return;
+    }
+    if (refineOnly) {
+        for (size_t w = head_ / 64; w < words; ++w) {
+            forEachBit(textMatch_[w] & liveWord(w), w * 64, [&](size_t s) {
+                if (lineLower(firstLine_ + s).find(filterNeedle_) == std::string_view::npos) textMatch_[w] &= ~(uint64_t{1} << (s % 64));
+            });
+        }
+        return;
+    }
+    std::fill(textMatch_.begin() + (std::ptrdiff_t)(head_ / 64), textMatch_.end(), uint64_t{0});
+    scanArena(lower_, offsets_, head_, filterNeedle_, [&](size_t s) { setBit(textMatch_, s); });
+}
+
+void LogViewIndex::rebuildVisible() {
+    visible_.clear();
+    visibleHead_ = 0;
+    const size_t words = textMatch_.size();
+    for (size_t w = head_ / 64; w < words; ++w) {
+        forEachBit(visibleWord(w), w * 64, [&](size_t s) { visible_.push_back(firstLine_ + s); });
+    }
+}
+
+void LogViewIndex::rebuildMatches() {
+    matches_.clear();
+    matchHead_ = 0;
+    if (searchNeedle_.empty()) return;
+    if (searchSig_.empty()) {
+        scanArena(searchCaseSensitive_ ? text_ : lower_, offsets_, head_, searchNeedle_, [&](size_t s) {
+            if (passes(s)) matches_.push_back(firstLine_ + s);
+        });
+        return;
+    }
+    const size_t words = textMatch_.size();
+    for (size_t w = head_ / 64; w < words; ++w) {
+        forEachBit(visibleWord(w) & candidateWord(searchSig_, w), w * 64, [&](size_t s) {
+            if (searchHit(firstLine_ + s)) matches_.push_back(firstLine_ + s);
+        });
+    }
+}
+
+void LogViewIndex::trimFront() {
+    while (lineCount() > maxLines_) {
+        const uint64_t dropped = firstLine_ + head_;
+        ++head_;
+        if (visibleHead_ < visible_.size() && visible_[visibleHead_] == dropped) ++visibleHead_;
+        if (matchHead_ < matches_.size() && matches_[matchHead_] == dropped) ++matchHead_;
+    }
+    // Dropped lines are only marked; storage shifts once half of it is dead, so trimming costs
+    // O(1) per line amortized.
+    if (head_ >= 4096 && head_ * 2 >= levels_.size()) compact();
+}
+
+void LogViewIndex::compact() {
+    // Bitmaps shift by whole words, so up to 63 dead slots stay in front.
+    const size_t dropWords = head_ / 64;
+    const size_t drop = dropWords * 64;
+    if (drop == 0) return;
+    const size_t base = drop < offsets_.size() ? (size_t)offsets_[drop] : text_.size();
+    text_.erase(0, base);
+    lower_.erase(0, base);
+    offsets_.erase(offsets_.begin(), offsets_.begin() + (std::ptrdiff_t)drop);
+    for (auto& off : offsets_) off -= base;
+    levels_.erase(levels_.begin(), levels_.begin() + (std::ptrdiff_t)drop);
+    auto dropFront = [dropWords](Bitmap& bits) { bits.erase(bits.begin(), bits.begin() + (std::ptrdiff_t)dropWords); };
+    for (auto& bits : levelBits_) dropFront(bits);
+    for (auto& bits : trigramBits_) dropFront(bits);
+    dropFront(textMatch_);
+    firstLine_ += drop;
+    head_ -= drop;
+    visible_.erase(visible_.begin(), visible_.begin() + (std::ptrdiff_t)visibleHead_);
+    visibleHead_ = 0;
+    matches_.erase(matches_.begin(), matches_.begin() + (std::ptrdiff_t)matchHead_);
+    matchHead_ = 0;
+}
+
+} // namespace gb2d::logging
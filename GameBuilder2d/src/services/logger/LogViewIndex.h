@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "LogManager.h"
+
+namespace gb2d::logging {
+
+// Headless model behind the console window: retains up to maxLines() log lines and keeps the
+// list of lines passing the current filter up to date as lines arrive and fall out.
+//
+// Lines live back to back in one text arena ('\n' after each), with a second arena holding the
+// same bytes lowercased once at append time, plus per-line offsets and levels. Alongside sit
+// bitmaps with one bit per line: one per level, one for "matches the text filter", and a
+// bit-sliced trigram signature (each lowercase trigram of a line sets one of kSignatureBits
+// bitmaps). A text filter or search ANDs the bitmaps of the needle's trigrams to get candidate
+// lines and only substring-checks those, so it touches a few hundred KB instead of the whole
+// arena. Toggling levels never searches text again, and typing more characters onto a filter
+// only re-checks the lines that matched before. Needles under three characters have no
+// trigrams and scan the lowercase arena instead.
+//
+// Lines have ids that increase by one per append and are never reused; rows are positions in the
+// filtered list (0 = oldest visible line).
+class LogViewIndex {
+public:
+    // Level bits as used by the console's level mask: bit N is Level N (trace = bit 0).
+    static constexpr uint32_t kAllLevels = 0x3F;
+    static constexpr size_t kSignatureBits = 256;
+    static uint32_t levelBit(Level lvl) { return lvl == Level::off ? 0u : 1u << (int)lvl; }
+
+    void setMaxLines(size_t maxLines);
+    size_t maxLines() const { return maxLines_; }
+    // A trailing newline is dropped and multi-line messages become one row per line.
+    void append(Level level, std::string_view text);
+    void clear();
+
+    // Case-insensitive substring filter plus level mask. Returns true when the visible rows changed.
+    bool setFilter(uint32_t levelMask, std::string_view needle);
+    uint32_t levelMask() const { return levelMask_; }
+
+    size_t lineCount() const { return levels_.size() - head_; }
+    size_t rowCount() const { return visible_.size() - visibleHead_; }
+    std::string_view rowText(size_t row) const { return lineText(rowLine(row)); }
+    Level rowLevel(size_t row) const { return (Level)levels_[slot(rowLine(row))]; }
+    uint64_t rowLine(size_t row) const { return visible_[visibleHead_ + row]; }
+    // Row showing `line`, or rowCount() when that line is filtered out or gone.
+    size_t rowOf(uint64_t line) const;
+    // Visible rows joined with '\n', e.g. for the clipboard.
+    std::string visibleText() const;
+
+    // Search within the visible rows; matches follow appends, trims and filter changes.
+    void setSearch(std::string_view needle, bool caseSensitive);
+    size_t searchMatchCount() const { return matches_.size() - matchHead_; }
+    uint64_t searchMatchLine(size_t i) const { return matches_[matchHead_ + i]; }
+    // [begin, end) byte ranges of the search needle within a row, for highlighting.
+    void searchSpans(size_t row, std::vector<std::pair<size_t, size_t>>& out) const;
+
+    // Bumped whenever rows are added, removed or re-filtered.
+    uint64_t version() const { return version_; }
+
+private:
+    using Bitmap = std::vector<uint64_t>;
+
+    size_t slot(uint64_t line) const { return (size_t)(line - firstLine_); }
+    std::string_view lineText(uint64_t line) const;
+    std::string_view lineLower(uint64_t line) const;
+    bool passes(size_t s) const;
+    uint64_t visibleWord(size_t w) const;
+    uint64_t liveWord(size_t w) const;
+    bool searchHit(uint64_t line) const;
+    // Lines in word `w` that contain every trigram whose signature bit is in `sig`.
+    uint64_t candidateWord(const std::vector<uint16_t>& sig, size_t w) const;
+    void matchText(bool refineOnly);
+    void rebuildVisible();
+    void rebuildMatches();
+    void trimFront();
+    void compact();
+
+    size_t maxLines_ = 1000;
+    std::string text_;                // original bytes, '\n' after each line
+    std::string lower_;               // same layout, ASCII-lowercased
+    std::vector<uint64_t> offsets_;   // arena offset of each line
+    std::vector<uint8_t> levels_;
+    std::array<Bitmap, 6> levelBits_;
+    std::array<Bitmap, kSignatureBits> trigramBits_;
+    Bitmap textMatch_;                // line contains filterNeedle_
+    size_t head_ = 0;                 // first retained slot; slots before it await compact()
+    uint64_t firstLine_ = 0;          // line id of slot 0
+
+    uint32_t levelMask_ = kAllLevels;
+    std::string filterNeedle_;        // lowercased
+    std::vector<uint16_t> filterSig_; // signature bits of filterNeedle_'s trigrams
+    std::vector<uint64_t> visible_;   // line ids passing the filter, ascending
+    size_t visibleHead_ = 0;
+
+    std::string searchNeedle_;        // lowercased unless searchCaseSensitive_
+    bool searchCaseSensitive_ = false;
+    std::vector<uint16_t> searchSig_;
+    std::vector<uint64_t> matches_;   // visible line ids containing the search needle
+    size_t matchHead_ = 0;
+
+    uint64_t version_ = 0;
+};
+
+} // namespace gb2d::logging
@@ -0,0 +1,164 @@
+#include "AtlasPacker.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+namespace gb2d::textures {
+
+SkylinePacker::SkylinePacker(int width, int height, int padding)
+    : width_(std::max(width, 0)), height_(std::max(height, 0)), padding_(std::max(padding, 0)) {
+    reset();
+}
+
+void SkylinePacker::reset() {
+    skyline_.clear();
+    // The bin is widened by the padding so sprites touching the right/bottom edge need no gutter.
+    skyline_.push_back(SkylineNode{0, 0, width_ + padding_});
+    usedArea_ = 0;
+    placedCount_ = 0;
+}
+
+double SkylinePacker::occupancy() const {
+    const double area = static_cast<double>(width_) * static_cast<double>(height_);
+    return area > 0.0 ? static_cast<double>(usedArea_) / area : 0.0;
+}
+
+std::optional<int> SkylinePacker::fitAt(std::size_t index, int width, int height) const {
+    const int x = skyline_[index].x;
+    if (x + width > width_ + padding_) {
+        return std::nullopt;
+    }
+    int remaining = width;
+    int y = skyline_[index].y;
+    for (std::size_t i = index; remaining > 0; ++i) {
+        if (i >= skyline_.size()) {
+            return std::nullopt;
+        }
+        y = std::max(y, skyline_[i].y);
+        if (y + height > height_ + padding_) {
+            return std::nullopt;
+        }
+        remaining -= skyline_[i].width;
+    }
+    return y;
+}
+
+void SkylinePacker::addLevel(std::size_t index, int x, int y, int width, int height) {
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(index), SkylineNode{x, y + height, width});
+
+    for (std::size_t i = index + 1; i < skyline_.size();) {
+        const auto& previous = skyline_[i - 1];
+        auto& current = skyline_[i];
+        const int previousEnd = previous.x + previous.width;
+        if (current.x >= previousEnd) {
+            break;
+        }
+        const int shrink = previousEnd - current.x;
+        current.x += shrink;
+        current.width -= shrink;
+        if (current.width > 0) {
+            break;
+        }
+        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    for (std::size_t i = 0; i + 1 < skyline_.size();) {
+        if (skyline_[i].y == skyline_[i + 1].y) {
+            skyline_[i].width += skyline_[i + 1].width;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+}
+
+std::optional<PackedRect> SkylinePacker::insert(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return std::nullopt;
+    }
+    const int paddedWidth = width + padding_;
+    const int paddedHeight = height + padding_;
+
+    int bestBottom = std::numeric_limits<int>::max();
+    int bestNodeWidth = std::numeric_limits<int>::max();
+    std::size_t bestIndex = skyline_.size();
+    int bestX = 0;
+    int bestY = 0;
+
+    for (std::size_t i = 0; i < skyline_.size(); ++i) {
+        auto y = fitAt(i, paddedWidth, paddedHeight);
+        if (!y) {
+            continue;
+        }
+        const int bottom = *y + paddedHeight;
+        if (bottom < bestBottom || (bottom == bestBottom && skyline_[i].width < bestNodeWidth)) {
+            bestBottom = bottom;
+            bestNodeWidth = skyline_[i].width;
+            bestIndex = i;
+            bestX = skyline_[i].x;
+            bestY = *y;
+        }
+    }
+
+    if (bestIndex == skyline_.size()) {
+        return std::nullopt;
+    }
+
+    addLevel(bestIndex, bestX, bestY, paddedWidth, paddedHeight);
+    usedArea_ += static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    placedCount_++;
+    return PackedRect{bestX, bestY, width, height};
+}
+
+PackResult packRects(std::span<const PackSize> sizes, int pageWidth, int pageHeight, int padding) {
+    PackResult result;
+    result.placements.resize(sizes.size());
+
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        if (sizes[a].height != sizes[b].height) {
+            return sizes[a].height > sizes[b].height;
+        }
+        return sizes[a].width > sizes[b].width;
+    });
+
+    std::vector<std::unique_ptr<SkylinePacker>> pages;
+    std::size_t placedArea = 0;
+    for (std::size_t index : order) {
+        const auto& size = sizes[index];
+        if (size.width <= 0 || size.height <= 0 || size.width > pageWidth || size.height > pageHeight) {
+            continue;
+        }
+        PackPlacement placement;
+        for (std::size_t page = 0; page < pages.size(); ++page) {
+            if (auto rect = pages[page]->insert(size.width, size.height)) {
+                placement.page = static_cast<int>(page);
+                placement.rect = *rect;
+                break;
+            }
+        }
+        if (placement.page < 0) {
+            pages.push_back(std::make_unique<SkylinePacker>(pageWidth, pageHeight, padding));
+            if (auto rect = pages.back()->insert(size.width, size.height)) {
+                placement.page = static_cast<int>(pages.size() - 1);
+                placement.rect = *rect;
+            }
+        }
+        if (placement.page >= 0) {
+            placedArea += static_cast<std::size_t>(size.width) * static_cast<std::size_t>(size.height);
+        }
+        result.placements[index] = placement;
+    }
+
+    result.pageCount = static_cast<int>(pages.size());
+    const double totalArea = static_cast<double>(result.pageCount) * static_cast<double>(pageWidth) * static_cast<double>(pageHeight);
+    if (totalArea > 0.0) {
+        result.occupancy = static_cast<double>(placedArea) / totalArea;
+    }
+    return result;
+}
+
+} // namespace gb2d::textures
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace gb2d::textures {
+
+struct PackedRect {
+    int x{0};
+    int y{0};
+    int width{0};
+    int height{0};
+};
+
+// Skyline bottom-left rectangle packer for a single fixed-size page. Pure CPU: it only tracks
+// occupancy, so it can be driven from tests and tools without a GL context. Space is never
+// reclaimed; a page is recycled as a whole once every sprite on it has been released.
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height, int padding = 0);
+
+    std::optional<PackedRect> insert(int width, int height);
+    void reset();
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+    int padding() const { return padding_; }
+    std::size_t usedArea() const { return usedArea_; }
+    std::size_t placedCount() const { return placedCount_; }
+    double occupancy() const;
+
+private:
+    struct SkylineNode {
+        int x{0};
+        int y{0};
+        int width{0};
+    };
+
+    std::optional<int> fitAt(std::size_t index, int width, int height) const;
+    void addLevel(std::size_t index, int x, int y, int width, int height);
+
+    int width_{0};
+    int height_{0};
+    int padding_{0};
+    std::vector<SkylineNode> skyline_{};
+    std::size_t usedArea_{0};
+    std::size_t placedCount_{0};
+};
+
+struct PackSize {
+    int width{0};
+    int height{0};
+};
+
+struct PackPlacement {
+    int page{-1}; // -1 when the rectangle can never fit a page
+    PackedRect rect{};
+};
+
+struct PackResult {
+    std::vector<PackPlacement> placements{}; // same order as the input sizes
+    int pageCount{0};
+    double occupancy{0.0};                   // placed area / (pageCount * page area)
+};
+
+// Offline variant: sorts by height (then width) before packing, which packs noticeably tighter
+// than inserting in arrival order. Pages are opened as needed.
+PackResult packRects(std::span<const PackSize> sizes, int pageWidth, int pageHeight, int padding = 0);
+
+} // namespace gb2d::textures
@@ -0,0 +1,384 @@
+#include "BakedAtlas.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace gb2d::textures {
+namespace {
+
+// On-disk layout (host byte order; every supported target is little-endian):
+//   FileHeader | FrameRecord[frameCount] | uint32 displacement[bucketCount]
+//   | uint32 slot[slotCount] | name blob
+// Sections are 8-byte aligned. Names in the blob are not NUL-terminated.
+constexpr char kMagic[8] = {'G', 'B', '2', 'D', 'A', 'T', 'L', '\0'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::uint32_t kEmptySlot = 0xFFFFFFFFu;
+constexpr std::uint32_t kRotatedFlag = 1u << 0;
+constexpr std::uint32_t kTrimmedFlag = 1u << 1;
+// Each round grows the slot table by 1/8; 32 rounds allow about 40x the key count.
+constexpr std::uint32_t kMaxHashRounds = 32;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t frameCount;
+    std::uint32_t bucketCount;
+    std::uint32_t slotCount;
+    std::uint64_t sourceSize;
+    std::int64_t sourceModified;
+    std::uint32_t framesOffset;
+    std::uint32_t displacementsOffset;
+    std::uint32_t slotsOffset;
+    std::uint32_t namesOffset;
+    std::uint32_t namesSize;
+    std::uint32_t imagePathOffset;
+    std::uint32_t imagePathLength;
+    std::uint32_t reserved;
+};
+
+struct FrameRecord {
+    float frame[4];
+    float source[4];
+    float pivot[2];
+    std::uint32_t flags;
+    std::uint32_t originalOffset;
+    std::uint32_t originalLength;
+    std::uint32_t canonicalOffset;
+    std::uint32_t canonicalLength;
+    std::uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) == 72);
+static_assert(std::is_trivially_copyable_v<FrameRecord> && sizeof(FrameRecord) == 64);
+
+std::uint64_t mix64(std::uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return value;
+}
+
+std::uint64_t hashName(std::string_view name) {
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (unsigned char ch : name) {
+        hash ^= ch;
+        hash *= 0x100000001B3ull;
+    }
+    return mix64(hash);
+}
+
+std::uint32_t bucketOf(std::uint64_t hash, std::uint32_t bucketCount) {
+    return static_cast<std::uint32_t>(hash % bucketCount);
+}
+
+std::uint32_t slotOf(std::uint64_t hash, std::uint32_t displacement, std::uint32_t slotCount) {
+    return static_cast<std::uint32_t>(mix64(hash ^ (0x9E3779B97F4A7C15ull * (displacement + 1ull))) % slotCount);
+}
+
+std::uint32_t alignTo8(std::size_t value) {
+    return static_cast<std::uint32_t>((value + 7u) & ~std::size_t{7});
+}
+
+struct PerfectHash {
+    std::vector<std::uint32_t> displacements{};
+    std::vector<std::uint32_t> slots{};
+};
+
+// Hash-and-displace (CHD): keys are grouped into buckets by their primary hash; buckets are
+// placed largest first, each searching for a displacement that sends all of its keys to free
+// slots. Starts minimal (one slot per key) and adds slack if a bucket cannot be placed.
+// Returns nullopt when two keys share a 64-bit hash (no displacement can separate them) or
+// when the slack rounds run out.
+std::optional<PerfectHash> buildPerfectHash(const std::vector<std::uint64_t>& hashes) {
+    std::vector<std::uint64_t> sorted = hashes;
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+        return std::nullopt;
+    }
+
+    const auto keyCount = static_cast<std::uint32_t>(hashes.size());
+    const std::uint32_t bucketCount = std::max<std::uint32_t>(1u, (keyCount + 3u) / 4u);
+
+    std::vector<std::vector<std::uint32_t>> buckets(bucketCount);
+    for (std::uint32_t key = 0; key < keyCount; ++key) {
+        buckets[bucketOf(hashes[key], bucketCount)].push_back(key);
+    }
+    std::vector<std::uint32_t> order(bucketCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&buckets](std::uint32_t a, std::uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::uint32_t slotCount = std::max<std::uint32_t>(1u, keyCount);
+    const std::uint32_t maxDisplacement = keyCount * 16u + 1024u;
+    std::vector<std::uint32_t> candidate;
+    for (std::uint32_t round = 0; round < kMaxHashRounds; ++round) {
+        PerfectHash result;
+        result.displacements.assign(bucketCount, 0u);
+        result.slots.assign(slotCount, kEmptySlot);
+        bool placedAll = true;
+        for (std::uint32_t bucket : order) {
+            const auto& keys = buckets[bucket];
+            if (keys.empty()) {
+                break;
+            }
+            bool placed = false;
+            for (std::uint32_t displacement = 0; displacement < maxDisplacement && !placed; ++displacement) {
+                candidate.clear();
+                placed = true;
+                for (std::uint32_t key : keys) {
+                    const auto slot = slotOf(hashes[key], displacement, slotCount);
+                    if (result.slots[slot] != kEmptySlot ||
+                        std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                        placed = false;
+                        break;
+                    }
+                    candidate.push_back(slot);
+                }
+                if (placed) {
+                    for (std::size_t i = 0; i < keys.size(); ++i) {
+                        result.slots[candidate[i]] = keys[i];
+                    }
+                    result.displacements[bucket] = displacement;
+                }
+            }
+            if (!placed) {
+                placedAll = false;
+                break;
+            }
+        }
+        if (placedAll) {
+            return result;
+        }
+        slotCount += slotCount / 8u + 1u;
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+T readPod(const std::byte* source) {
+    T value;
+    std::memcpy(&value, source, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+std::optional<AtlasSourceStamp> atlasSourceStamp(const std::filesystem::path& jsonPath) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(jsonPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto modified = std::filesystem::last_write_time(jsonPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    AtlasSourceStamp stamp;
+    stamp.size = static_cast<std::uint64_t>(size);
+    stamp.modified = static_cast<std::int64_t>(modified.time_since_epoch().count());
+    return stamp;
+}
+
+std::shared_ptr<const BakedAtlas> BakedAtlas::open(const std::filesystem::path& path) {
+    auto mapped = filesystem::MappedFile::open(path);
+    if (!mapped || mapped->size() < sizeof(FileHeader)) {
+        return nullptr;
+    }
+
+    const auto header = readPod<FileHeader>(mapped->data());
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+        return nullptr;
+    }
+    const std::uint64_t fileSize = mapped->size();
+    const auto fits = [fileSize](std::uint64_t offset, std::uint64_t count, std::uint64_t stride) {
+        return offset <= fileSize && count * stride <= fileSize - offset;
+    };
+    if (header.bucketCount == 0 || header.slotCount < header.frameCount ||
+        !fits(header.framesOffset, header.frameCount, sizeof(FrameRecord)) ||
+        !fits(header.displacementsOffset, header.bucketCount, sizeof(std::uint32_t)) ||
+        !fits(header.slotsOffset, header.slotCount, sizeof(std::uint32_t)) ||
+        !fits(header.namesOffset, header.namesSize, 1) ||
+        static_cast<std::uint64_t>(header.imagePathOffset) + header.imagePathLength > header.namesSize) {
+        return nullptr;
+    }
+
+    std::shared_ptr<BakedAtlas> atlas(new BakedAtlas());
+    const std::byte* base = mapped->data();
+    atlas->frames_ = base + header.framesOffset;
+    atlas->displacements_ = base + header.displacementsOffset;
+    atlas->slots_ = base + header.slotsOffset;
+    atlas->names_ = reinterpret_cast<const char*>(base + header.namesOffset);
+    atlas->file_ = std::move(*mapped);
+    atlas->path_ = path;
+    atlas->stamp_ = AtlasSourceStamp{header.sourceSize, header.sourceModified};
+    atlas->frameCount_ = header.frameCount;
+    atlas->bucketCount_ = header.bucketCount;
+    atlas->slotCount_ = header.slotCount;
+    atlas->namesSize_ = header.namesSize;
+    atlas->imagePathOffset_ = header.imagePathOffset;
+    atlas->imagePathLength_ = header.imagePathLength;
+    return atlas;
+}
+
+bool BakedAtlas::write(const std::filesystem::path& path,
+                       std::span<const AtlasFrame> frames,
+                       std::span<const std::string> canonicalNames,
+                       const std::filesystem::path& imagePath,
+                       const AtlasSourceStamp& stamp) {
+    if (frames.size() != canonicalNames.size() || frames.size() >= kEmptySlot) {
+        return false;
+    }
+
+    std::string names;
+    std::vector<FrameRecord> records(frames.size());
+    std::vector<std::uint64_t> hashes(frames.size());
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        const AtlasFrame& frame = frames[i];
+        FrameRecord& record = records[i];
+        record = FrameRecord{};
+        record.frame[0] = frame.frame.x;
+        record.frame[1] = frame.frame.y;
+        record.frame[2] = frame.frame.width;
+        record.frame[3] = frame.frame.height;
+        record.source[0] = frame.source.x;
+        record.source[1] = frame.source.y;
+        record.source[2] = frame.source.width;
+        record.source[3] = frame.source.height;
+        record.pivot[0] = frame.pivot.x;
+        record.pivot[1] = frame.pivot.y;
+        record.flags = (frame.rotated ? kRotatedFlag : 0u) | (frame.trimmed ? kTrimmedFlag : 0u);
+        record.originalOffset = static_cast<std::uint32_t>(names.size());
+        record.originalLength = static_cast<std::uint32_t>(frame.originalName.size());
+        names += frame.originalName;
+        if (canonicalNames[i] == frame.originalName) {
+            record.canonicalOffset = record.originalOffset;
+        } else {
+            record.canonicalOffset = static_cast<std::uint32_t>(names.size());
+            names += canonicalNames[i];
+        }
+        record.canonicalLength = static_cast<std::uint32_t>(canonicalNames[i].size());
+        hashes[i] = hashName(canonicalNames[i]);
+    }
+
+    auto relativeImage = imagePath.lexically_relative(path.parent_path());
+    if (relativeImage.empty()) {
+        relativeImage = imagePath.filename();
+    }
+    const std::string image = relativeImage.generic_string();
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.frameCount = static_cast<std::uint32_t>(frames.size());
+    header.imagePathOffset = static_cast<std::uint32_t>(names.size());
+    header.imagePathLength = static_cast<std::uint32_t>(image.size());
+    names += image;
+
+    const auto built = buildPerfectHash(hashes);
+    if (!built) {
+        return false;
+    }
+    const PerfectHash& index = *built;
+    header.bucketCount = static_cast<std::uint32_t>(index.displacements.size());
+    header.slotCount = static_cast<std::uint32_t>(index.slots.size());
+    header.sourceSize = stamp.size;
+    header.sourceModified = stamp.modified;
+    header.framesOffset = alignTo8(sizeof(FileHeader));
+    header.displacementsOffset = alignTo8(header.framesOffset + records.size() * sizeof(FrameRecord));
+    header.slotsOffset = alignTo8(header.displacementsOffset + index.displacements.size() * sizeof(std::uint32_t));
+    header.namesOffset = alignTo8(header.slotsOffset + index.slots.size() * sizeof(std::uint32_t));
+    header.namesSize = static_cast<std::uint32_t>(names.size());
+
+    std::vector<std::byte> buffer(static_cast<std::size_t>(header.namesOffset) + names.size());
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + header.framesOffset, records.data(), records.size() * sizeof(FrameRecord));
+    std::memcpy(buffer.data() + header.displacementsOffset, index.displacements.data(),
+                index.displacements.size() * sizeof(std::uint32_t));
+    std::memcpy(buffer.data() + header.slotsOffset, index.slots.data(), index.slots.size() * sizeof(std::uint32_t));
+    std::memcpy(buffer.data() + header.namesOffset, names.data(), names.size());
+
+    // Write beside the target and rename so a concurrent reader never maps a half-written file.
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::size_t> BakedAtlas::find(std::string_view canonicalName) const {
+    if (frameCount_ == 0) {
+        return std::nullopt;
+    }
+    const std::uint64_t hash = hashName(canonicalName);
+    const auto displacement = readPod<std::uint32_t>(displacements_ + bucketOf(hash, bucketCount_) * sizeof(std::uint32_t));
+    const auto index = readPod<std::uint32_t>(slots_ + slotOf(hash, displacement, slotCount_) * sizeof(std::uint32_t));
+    if (index >= frameCount_) {
+        return std::nullopt;
+    }
+    // The perfect hash only covers baked names; anything else lands on an arbitrary slot.
+    const auto record = readPod<FrameRecord>(frames_ + index * sizeof(FrameRecord));
+    if (name(record.canonicalOffset, record.canonicalLength) != canonicalName) {
+        return std::nullopt;
+    }
+    return index;
+}
+
+AtlasFrame BakedAtlas::frame(std::size_t index) const {
+    AtlasFrame frame{};
+    if (index >= frameCount_) {
+        return frame;
+    }
+    const auto record = readPod<FrameRecord>(frames_ + index * sizeof(FrameRecord));
+    frame.frame = Rectangle{record.frame[0], record.frame[1], record.frame[2], record.frame[3]};
+    frame.source = Rectangle{record.source[0], record.source[1], record.source[2], record.source[3]};
+    frame.pivot = Vector2{record.pivot[0], record.pivot[1]};
+    frame.rotated = (record.flags & kRotatedFlag) != 0;
+    frame.trimmed = (record.flags & kTrimmedFlag) != 0;
+    frame.originalName = std::string(name(record.originalOffset, record.originalLength));
+    return frame;
+}
+
+std::string_view BakedAtlas::originalName(std::size_t index) const {
+    if (index >= frameCount_) {
+        return {};
+    }
+    const auto record = readPod<FrameRecord>(frames_ + index * sizeof(FrameRecord));
+    return name(record.originalOffset, record.originalLength);
+}
+
+std::filesystem::path BakedAtlas::imagePath() const {
+    std::filesystem::path relative(std::string(name(imagePathOffset_, imagePathLength_)));
+    return (path_.parent_path() / relative).lexically_normal();
+}
+
+std::string_view BakedAtlas::name(std::uint32_t offset, std::uint32_t length) const {
+    if (static_cast<std::uint64_t>(offset) + length > namesSize_) {
+        return {};
+    }
+    return std::string_view(names_ + offset, length);
+}
+
+} // namespace gb2d::textures
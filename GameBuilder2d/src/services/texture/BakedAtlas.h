@@ -0,0 +1,73 @@
+#pragma once
+
+#include "TextureManager.h"
+#include "services/filesystem/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace gb2d::textures {
+
+// Size and modification time of the JSON a baked atlas was produced from. A baked file whose
+// stamp no longer matches its JSON is stale and ignored.
+struct AtlasSourceStamp {
+    std::uint64_t size{0};
+    std::int64_t modified{0};
+
+    bool operator==(const AtlasSourceStamp&) const = default;
+};
+
+std::optional<AtlasSourceStamp> atlasSourceStamp(const std::filesystem::path& jsonPath);
+
+// Memory-mapped ".gb2datlas" file: a flat frame table, an interned name blob and a precomputed
+// perfect-hash index over the canonical frame names. Lookups read straight from the mapping;
+// nothing is parsed or allocated when the file is opened beyond header validation.
+class BakedAtlas {
+public:
+    static constexpr std::string_view kExtension = ".gb2datlas";
+
+    static std::shared_ptr<const BakedAtlas> open(const std::filesystem::path& path);
+
+    // canonicalNames[i] is the lookup key for frames[i]; names must be unique, and the bake fails
+    // if two of them hash alike. imagePath is stored relative to the output file's directory.
+    static bool write(const std::filesystem::path& path,
+                      std::span<const AtlasFrame> frames,
+                      std::span<const std::string> canonicalNames,
+                      const std::filesystem::path& imagePath,
+                      const AtlasSourceStamp& stamp);
+
+    std::size_t frameCount() const { return frameCount_; }
+    std::optional<std::size_t> find(std::string_view canonicalName) const;
+    AtlasFrame frame(std::size_t index) const;
+    std::string_view originalName(std::size_t index) const;
+    std::filesystem::path imagePath() const;
+    const AtlasSourceStamp& sourceStamp() const { return stamp_; }
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    BakedAtlas() = default;
+
+    std::string_view name(std::uint32_t offset, std::uint32_t length) const;
+
+    filesystem::MappedFile file_{};
+    std::filesystem::path path_{};
+    AtlasSourceStamp stamp_{};
+    std::size_t frameCount_{0};
+    std::uint32_t bucketCount_{0};
+    std::uint32_t slotCount_{0};
+    const std::byte* frames_{nullptr};
+    const std::byte* displacements_{nullptr};
+    const std::byte* slots_{nullptr};
+    const char* names_{nullptr};
+    std::uint32_t namesSize_{0};
+    std::uint32_t imagePathOffset_{0};
+    std::uint32_t imagePathLength_{0};
+};
+
+} // namespace gb2d::textures
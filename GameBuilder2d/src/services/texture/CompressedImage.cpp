@@ -0,0 +1,822 @@
+#include "CompressedImage.h"
+
+#include "services/filesystem/MappedFile.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <utility>
+
+namespace gb2d::textures {
+namespace {
+
+constexpr int kMaxDimension = 16384;
+
+void fail(std::string* error, const char* reason) {
+    if (error) {
+        *error = reason;
+    }
+}
+
+// Containers store little-endian fields; every supported target is little-endian.
+template <typename T>
+T readValue(std::span<const std::byte> bytes, std::size_t offset) {
+    T value{};
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+}
+
+constexpr std::uint32_t fourCC(char a, char b, char c, char d) {
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(a)) |
+           (static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8) |
+           (static_cast<std::uint32_t>(static_cast<unsigned char>(c)) << 16) |
+           (static_cast<std::uint32_t>(static_cast<unsigned char>(d)) << 24);
+}
+
+int maxMipLevels(int width, int height) {
+    int levels = 1;
+    for (int size = std::max(width, height); size > 1; size /= 2) {
+        levels++;
+    }
+    return levels;
+}
+
+bool validDimensions(int width, int height, int mipmaps, std::string* error) {
+    if (width <= 0 || height <= 0 || width > kMaxDimension || height > kMaxDimension) {
+        fail(error, "invalid dimensions");
+        return false;
+    }
+    if (mipmaps < 1 || mipmaps > maxMipLevels(width, height)) {
+        fail(error, "invalid mip level count");
+        return false;
+    }
+    return true;
+}
+
+std::size_t chainBytes(BlockFormat format, int width, int height, int mipmaps) {
+    std::size_t total = 0;
+    for (int level = 0; level < mipmaps; ++level) {
+        total += levelBytes(format, width, height);
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return total;
+}
+
+// ---------------------------------------------------------------------------------------------
+// DDS
+// ---------------------------------------------------------------------------------------------
+
+constexpr std::size_t kDdsHeaderEnd = 128;      // magic + DDS_HEADER
+constexpr std::size_t kDdsDx10HeaderEnd = 148;  // + DDS_HEADER_DXT10
+constexpr std::uint32_t kDdsMipMapCountFlag = 0x20000;
+constexpr std::uint32_t kDdsDepthFlag = 0x800000;
+constexpr std::uint32_t kDdsFourCCFlag = 0x4;
+constexpr std::uint32_t kDdsCubemapCaps = 0x200;
+constexpr std::uint32_t kDdsVolumeCaps = 0x200000;
+constexpr std::uint32_t kDx10CubeFlag = 0x4;
+
+std::optional<BlockFormat> formatFromDxgi(std::uint32_t dxgi) {
+    switch (dxgi) {
+    case 71: // DXGI_FORMAT_BC1_UNORM
+    case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+        return BlockFormat::BC1;
+    case 77: // DXGI_FORMAT_BC3_UNORM
+    case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+        return BlockFormat::BC3;
+    case 98: // DXGI_FORMAT_BC7_UNORM
+    case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+        return BlockFormat::BC7;
+    default:
+        return std::nullopt;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// KTX2
+// ---------------------------------------------------------------------------------------------
+
+constexpr std::array<std::uint8_t, 12> kKtx2Identifier = {
+    0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr std::size_t kKtx2HeaderEnd = 80;
+constexpr std::size_t kKtx2LevelEntryBytes = 24;
+
+std::optional<BlockFormat> formatFromVk(std::uint32_t vkFormat) {
+    switch (vkFormat) {
+    case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        return BlockFormat::BC1;
+    case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+    case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+        return BlockFormat::BC3;
+    case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+    case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+        return BlockFormat::BC7;
+    case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+        return BlockFormat::ETC2_RGB;
+    case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+        return BlockFormat::ETC2_RGBA;
+    default:
+        return std::nullopt;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC1 / BC3
+// ---------------------------------------------------------------------------------------------
+
+void expand565(std::uint16_t color, std::uint8_t* out) {
+    const int r = (color >> 11) & 31;
+    const int g = (color >> 5) & 63;
+    const int b = color & 31;
+    out[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    out[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    out[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    out[3] = 255;
+}
+
+// BC3 colour blocks always use the four-colour palette; BC1 switches to three colours plus
+// transparent black when c0 <= c1.
+void decodeBc1Color(const std::uint8_t* block, std::uint8_t* rgba, bool fourColorOnly) {
+    const std::uint16_t c0 = static_cast<std::uint16_t>(block[0] | (block[1] << 8));
+    const std::uint16_t c1 = static_cast<std::uint16_t>(block[2] | (block[3] << 8));
+    std::uint8_t palette[4][4];
+    expand565(c0, palette[0]);
+    expand565(c1, palette[1]);
+    if (c0 > c1 || fourColorOnly) {
+        for (int ch = 0; ch < 3; ++ch) {
+            palette[2][ch] = static_cast<std::uint8_t>((2 * palette[0][ch] + palette[1][ch]) / 3);
+            palette[3][ch] = static_cast<std::uint8_t>((palette[0][ch] + 2 * palette[1][ch]) / 3);
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    } else {
+        for (int ch = 0; ch < 3; ++ch) {
+            palette[2][ch] = static_cast<std::uint8_t>((palette[0][ch] + palette[1][ch]) / 2);
+            palette[3][ch] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 0;
+    }
+    std::uint32_t indices = 0;
+    std::memcpy(&indices, block + 4, sizeof(indices));
+    for (int i = 0; i < 16; ++i) {
+        std::memcpy(rgba + i * 4, palette[(indices >> (2 * i)) & 3], 4);
+    }
+}
+
+void decodeBc3Alpha(const std::uint8_t* block, std::uint8_t* rgba) {
+    const int a0 = block[0];
+    const int a1 = block[1];
+    std::uint8_t table[8];
+    table[0] = static_cast<std::uint8_t>(a0);
+    table[1] = static_cast<std::uint8_t>(a1);
+    if (a0 > a1) {
+        for (int i = 1; i <= 6; ++i) {
+            table[i + 1] = static_cast<std::uint8_t>(((7 - i) * a0 + i * a1) / 7);
+        }
+    } else {
+        for (int i = 1; i <= 4; ++i) {
+            table[i + 1] = static_cast<std::uint8_t>(((5 - i) * a0 + i * a1) / 5);
+        }
+        table[6] = 0;
+        table[7] = 255;
+    }
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i) {
+        bits |= static_cast<std::uint64_t>(block[2 + i]) << (8 * i);
+    }
+    for (int i = 0; i < 16; ++i) {
+        rgba[i * 4 + 3] = table[(bits >> (3 * i)) & 7];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// BC7
+// ---------------------------------------------------------------------------------------------
+
+struct Bc7Mode {
+    std::uint8_t subsets;
+    std::uint8_t partitionBits;
+    std::uint8_t rotationBits;
+    std::uint8_t indexSelectionBits;
+    std::uint8_t colorBits;
+    std::uint8_t alphaBits;
+    std::uint8_t endpointPBits;
+    std::uint8_t sharedPBits;
+    std::uint8_t indexBits;
+    std::uint8_t index2Bits;
+};
+
+constexpr Bc7Mode kBc7Modes[8] = {
+    {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+    {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+    {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+    {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+    {2, 6, 0, 0, 5, 5, 1, 0, 2, 0},
+};
+
+// Bit i selects the subset of texel i.
+constexpr std::uint16_t kBc7Partitions2[64] = {
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+    0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+    0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+    0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+
+// Bits 2i..2i+1 select the subset of texel i.
+constexpr std::uint32_t kBc7Partitions3[64] = {
+    0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+    0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+    0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+    0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+    0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+    0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+    0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+    0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+};
+
+// Anchor texels (whose index MSB is implied zero) of subset 1 in two-subset partitions and of
+// subsets 1 and 2 in three-subset partitions. Subset 0 always anchors at texel 0.
+constexpr std::uint8_t kBc7Anchor2[64] = {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2,  8,  2,  2,  8,  8,  15, 2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15, 6,  8,  2,  8,  15, 15, 2,  8,  2,  2,  2,  15, 15, 6,
+    6,  2,  6,  8,  15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15,
+};
+
+constexpr std::uint8_t kBc7Anchor3a[64] = {
+    3,  3,  15, 15, 8,  3,  15, 15, 8,  8,  6,  6,  6,  5,  3,  3,
+    3,  3,  8,  15, 3,  3,  6,  10, 5,  8,  8,  6,  8,  5,  15, 15,
+    8,  15, 3,  5,  6,  10, 8,  15, 15, 3,  15, 5,  15, 15, 15, 15,
+    3,  15, 5,  5,  5,  8,  5,  10, 5,  10, 8,  13, 15, 12, 3,  3,
+};
+
+constexpr std::uint8_t kBc7Anchor3b[64] = {
+    15, 8,  8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15, 15, 15, 8,
+    15, 8,  15, 3,  15, 8,  15, 8,  3,  15, 6,  10, 15, 15, 10, 8,
+    15, 3,  15, 10, 10, 8,  9,  10, 6,  15, 8,  15, 3,  6,  6,  8,
+    15, 3,  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3,  15, 15, 8,
+};
+
+constexpr std::uint8_t kBc7Weights2[4] = {0, 21, 43, 64};
+constexpr std::uint8_t kBc7Weights3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr std::uint8_t kBc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+class BitReader {
+public:
+    explicit BitReader(const std::uint8_t* data) : data_(data) {}
+
+    std::uint32_t read(unsigned count) {
+        std::uint32_t value = 0;
+        for (unsigned i = 0; i < count; ++i, ++position_) {
+            value |= static_cast<std::uint32_t>((data_[position_ >> 3] >> (position_ & 7)) & 1) << i;
+        }
+        return value;
+    }
+
+private:
+    const std::uint8_t* data_;
+    unsigned position_{0};
+};
+
+int bc7Subset(int subsets, int partition, int texel) {
+    if (subsets == 2) {
+        return (kBc7Partitions2[partition] >> texel) & 1;
+    }
+    if (subsets == 3) {
+        return static_cast<int>((kBc7Partitions3[partition] >> (2 * texel)) & 3);
+    }
+    return 0;
+}
+
+std::uint8_t bc7Interpolate(int e0, int e1, unsigned indexBits, std::uint32_t index) {
+    const std::uint8_t* weights = indexBits == 2 ? kBc7Weights2 : indexBits == 3 ? kBc7Weights3 : kBc7Weights4;
+    const int w = weights[index];
+    return static_cast<std::uint8_t>(((64 - w) * e0 + w * e1 + 32) >> 6);
+}
+
+void decodeBc7(const std::uint8_t* block, std::uint8_t* rgba) {
+    int modeIndex = 0;
+    while (modeIndex < 8 && (block[0] & (1 << modeIndex)) == 0) {
+        modeIndex++;
+    }
+    if (modeIndex == 8) {
+        // Reserved mode: the format defines the result as transparent black.
+        std::memset(rgba, 0, 64);
+        return;
+    }
+    const Bc7Mode& mode = kBc7Modes[modeIndex];
+    BitReader bits(block);
+    bits.read(static_cast<unsigned>(modeIndex + 1));
+    const int partition = static_cast<int>(bits.read(mode.partitionBits));
+    const std::uint32_t rotation = bits.read(mode.rotationBits);
+    const std::uint32_t indexSelection = bits.read(mode.indexSelectionBits);
+
+    int endpoints[3][2][4] = {};
+    for (int ch = 0; ch < 3; ++ch) {
+        for (int s = 0; s < mode.subsets; ++s) {
+            for (int e = 0; e < 2; ++e) {
+                endpoints[s][e][ch] = static_cast<int>(bits.read(mode.colorBits));
+            }
+        }
+    }
+    if (mode.alphaBits > 0) {
+        for (int s = 0; s < mode.subsets; ++s) {
+            for (int e = 0; e < 2; ++e) {
+                endpoints[s][e][3] = static_cast<int>(bits.read(mode.alphaBits));
+            }
+        }
+    }
+
+    int colorPrecision = mode.colorBits;
+    int alphaPrecision = mode.alphaBits;
+    const int channels = mode.alphaBits > 0 ? 4 : 3;
+    if (mode.endpointPBits || mode.sharedPBits) {
+        for (int s = 0; s < mode.subsets; ++s) {
+            const std::uint32_t shared = mode.sharedPBits ? bits.read(1) : 0;
+            for (int e = 0; e < 2; ++e) {
+                const std::uint32_t p = mode.endpointPBits ? bits.read(1) : shared;
+                for (int ch = 0; ch < channels; ++ch) {
+                    endpoints[s][e][ch] = (endpoints[s][e][ch] << 1) | static_cast<int>(p);
+                }
+            }
+        }
+        colorPrecision++;
+        if (mode.alphaBits > 0) {
+            alphaPrecision++;
+        }
+    }
+    for (int s = 0; s < mode.subsets; ++s) {
+        for (int e = 0; e < 2; ++e) {
+            for (int ch = 0; ch < 4; ++ch) {
+                const int precision = ch < 3 ? colorPrecision : alphaPrecision;
+                int& value = endpoints[s][e][ch];
+                if (precision == 0) {
+                    value = 255;
+                } else {
+                    value <<= 8 - precision;
+                    value |= value >> precision;
+                }
+            }
+        }
+    }
+
+    int anchors[3] = {0, 0, 0};
+    if (mode.subsets == 2) {
+        anchors[1] = kBc7Anchor2[partition];
+    } else if (mode.subsets == 3) {
+        anchors[1] = kBc7Anchor3a[partition];
+        anchors[2] = kBc7Anchor3b[partition];
+    }
+
+    std::uint32_t primary[16];
+    std::uint32_t secondary[16] = {};
+    int subsetOf[16];
+    for (int i = 0; i < 16; ++i) {
+        subsetOf[i] = bc7Subset(mode.subsets, partition, i);
+        const bool anchor = i == anchors[subsetOf[i]];
+        primary[i] = bits.read(mode.indexBits - (anchor ? 1u : 0u));
+    }
+    if (mode.index2Bits > 0) {
+        for (int i = 0; i < 16; ++i) {
+            secondary[i] = bits.read(mode.index2Bits - (i == 0 ? 1u : 0u));
+        }
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        const auto& e0 = endpoints[subsetOf[i]][0];
+        const auto& e1 = endpoints[subsetOf[i]][1];
+        unsigned colorBits = mode.indexBits;
+        unsigned alphaBits = mode.indexBits;
+        std::uint32_t colorIndex = primary[i];
+        std::uint32_t alphaIndex = primary[i];
+        if (mode.index2Bits > 0) {
+            if (indexSelection == 0) {
+                alphaBits = mode.index2Bits;
+                alphaIndex = secondary[i];
+            } else {
+                colorBits = mode.index2Bits;
+                colorIndex = secondary[i];
+            }
+        }
+        std::uint8_t* texel = rgba + i * 4;
+        for (int ch = 0; ch < 3; ++ch) {
+            texel[ch] = bc7Interpolate(e0[ch], e1[ch], colorBits, colorIndex);
+        }
+        texel[3] = bc7Interpolate(e0[3], e1[3], alphaBits, alphaIndex);
+        if (rotation > 0) {
+            std::swap(texel[3], texel[rotation - 1]);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// ETC2 / EAC
+// ---------------------------------------------------------------------------------------------
+
+constexpr int kEtc1Modifiers[8][4] = {
+    {2, 8, -2, -8},     {5, 17, -5, -17},   {9, 29, -9, -29},     {13, 42, -13, -42},
+    {18, 60, -18, -60}, {24, 80, -24, -80}, {33, 106, -33, -106}, {47, 183, -47, -183},
+};
+
+constexpr int kEtc2Distances[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+constexpr int kEacModifiers[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},   {-3, -7, -10, -13, 2, 6, 9, 12}, {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},   {-3, -6, -8, -12, 2, 5, 7, 11},  {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},   {-3, -5, -8, -11, 2, 4, 7, 10},  {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},    {-2, -4, -8, -10, 1, 3, 7, 9},   {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},    {-1, -2, -3, -10, 0, 1, 2, 9},   {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8},
+};
+
+std::uint8_t clamp255(int value) {
+    return static_cast<std::uint8_t>(std::clamp(value, 0, 255));
+}
+
+int extend4(int value) { return (value << 4) | value; }
+int extend5(int value) { return (value << 3) | (value >> 2); }
+int extend6(int value) { return (value << 2) | (value >> 4); }
+int extend7(int value) { return (value << 1) | (value >> 6); }
+int signed3(int value) { return value >= 4 ? value - 8 : value; }
+
+// ETC texel indices are stored column-major: texel (x, y) is bit x * 4 + y of each plane.
+int etcIndex(const std::uint8_t* block, int x, int y) {
+    const int bit = x * 4 + y;
+    const int msb = (((block[4] << 8) | block[5]) >> bit) & 1;
+    const int lsb = (((block[6] << 8) | block[7]) >> bit) & 1;
+    return (msb << 1) | lsb;
+}
+
+void writeRgb(std::uint8_t* rgba, int x, int y, const int* color) {
+    std::uint8_t* texel = rgba + (y * 4 + x) * 4;
+    texel[0] = clamp255(color[0]);
+    texel[1] = clamp255(color[1]);
+    texel[2] = clamp255(color[2]);
+    texel[3] = 255;
+}
+
+void decodeEtcSubblocks(const std::uint8_t* block, std::uint8_t* rgba, const int base[2][3]) {
+    const int tables[2] = {(block[3] >> 5) & 7, (block[3] >> 2) & 7};
+    const bool flip = (block[3] & 1) != 0;
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            const int sub = flip ? (y >= 2 ? 1 : 0) : (x >= 2 ? 1 : 0);
+            const int modifier = kEtc1Modifiers[tables[sub]][etcIndex(block, x, y)];
+            const int color[3] = {base[sub][0] + modifier, base[sub][1] + modifier, base[sub][2] + modifier};
+            writeRgb(rgba, x, y, color);
+        }
+    }
+}
+
+void decodePaintColors(const std::uint8_t* block, std::uint8_t* rgba, const int paint[4][3]) {
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            writeRgb(rgba, x, y, paint[etcIndex(block, x, y)]);
+        }
+    }
+}
+
+void decodeEtc2T(const std::uint8_t* b, std::uint8_t* rgba) {
+    const int c1[3] = {extend4(((b[0] >> 1) & 0xC) | (b[0] & 3)), extend4(b[1] >> 4), extend4(b[1] & 15)};
+    const int c2[3] = {extend4(b[2] >> 4), extend4(b[2] & 15), extend4(b[3] >> 4)};
+    const int d = kEtc2Distances[((b[3] >> 1) & 6) | (b[3] & 1)];
+    const int paint[4][3] = {
+        {c1[0], c1[1], c1[2]},
+        {c2[0] + d, c2[1] + d, c2[2] + d},
+        {c2[0], c2[1], c2[2]},
+        {c2[0] - d, c2[1] - d, c2[2] - d},
+    };
+    decodePaintColors(b, rgba, paint);
+}
+
+void decodeEtc2H(const std::uint8_t* b, std::uint8_t* rgba) {
+    const int c1[3] = {extend4((b[0] >> 3) & 15), extend4(((b[0] & 7) << 1) | ((b[1] >> 4) & 1)),
+                       extend4((b[1] & 8) | ((b[1] & 3) << 1) | (b[2] >> 7))};
+    const int c2[3] = {extend4((b[2] >> 3) & 15), extend4(((b[2] & 7) << 1) | (b[3] >> 7)), extend4((b[3] >> 3) & 15)};
+    int distance = (b[3] & 4) | ((b[3] & 1) << 1);
+    if (((c1[0] << 16) | (c1[1] << 8) | c1[2]) >= ((c2[0] << 16) | (c2[1] << 8) | c2[2])) {
+        distance |= 1;
+    }
+    const int d = kEtc2Distances[distance];
+    const int paint[4][3] = {
+        {c1[0] + d, c1[1] + d, c1[2] + d},
+        {c1[0] - d, c1[1] - d, c1[2] - d},
+        {c2[0] + d, c2[1] + d, c2[2] + d},
+        {c2[0] - d, c2[1] - d, c2[2] - d},
+    };
+    decodePaintColors(b, rgba, paint);
+}
+
+void decodeEtc2Planar(const std::uint8_t* b, std::uint8_t* rgba) {
+    const int origin[3] = {extend6((b[0] >> 1) & 0x3F), extend7(((b[0] & 1) << 6) | ((b[1] >> 1) & 0x3F)),
+                           extend6(((b[1] & 1) << 5) | (b[2] & 0x18) | ((b[2] & 3) << 1) | (b[3] >> 7))};
+    const int horizontal[3] = {extend6(((b[3] >> 1) & 0x3E) | (b[3] & 1)), extend7((b[4] >> 1) & 0x7F),
+                               extend6(((b[4] & 1) << 5) | (b[5] >> 3))};
+    const int vertical[3] = {extend6(((b[5] & 7) << 3) | (b[6] >> 5)), extend7(((b[6] & 0x1F) << 2) | (b[7] >> 6)),
+                             extend6(b[7] & 0x3F)};
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            int color[3];
+            for (int ch = 0; ch < 3; ++ch) {
+                color[ch] = (x * (horizontal[ch] - origin[ch]) + y * (vertical[ch] - origin[ch]) + 4 * origin[ch] + 2) >> 2;
+            }
+            writeRgb(rgba, x, y, color);
+        }
+    }
+}
+
+void decodeEtc2Color(const std::uint8_t* b, std::uint8_t* rgba) {
+    int base[2][3];
+    if ((b[3] & 2) == 0) {
+        for (int ch = 0; ch < 3; ++ch) {
+            base[0][ch] = extend4(b[ch] >> 4);
+            base[1][ch] = extend4(b[ch] & 15);
+        }
+        decodeEtcSubblocks(b, rgba, base);
+        return;
+    }
+    // Differential mode; an out-of-range second base colour selects one of the ETC2 modes.
+    int second[3];
+    for (int ch = 0; ch < 3; ++ch) {
+        second[ch] = (b[ch] >> 3) + signed3(b[ch] & 7);
+    }
+    if (second[0] < 0 || second[0] > 31) {
+        decodeEtc2T(b, rgba);
+    } else if (second[1] < 0 || second[1] > 31) {
+        decodeEtc2H(b, rgba);
+    } else if (second[2] < 0 || second[2] > 31) {
+        decodeEtc2Planar(b, rgba);
+    } else {
+        for (int ch = 0; ch < 3; ++ch) {
+            base[0][ch] = extend5(b[ch] >> 3);
+            base[1][ch] = extend5(second[ch]);
+        }
+        decodeEtcSubblocks(b, rgba, base);
+    }
+}
+
+void decodeEacAlpha(const std::uint8_t* b, std::uint8_t* rgba) {
+    const int base = b[0];
+    const int multiplier = b[1] >> 4;
+    const int* modifiers = kEacModifiers[b[1] & 15];
+    std::uint64_t bits = 0;
+    for (int i = 2; i < 8; ++i) {
+        bits = (bits << 8) | b[i];
+    }
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            const int index = static_cast<int>((bits >> (45 - 3 * (x * 4 + y))) & 7);
+            rgba[(y * 4 + x) * 4 + 3] = clamp255(base + modifiers[index] * multiplier);
+        }
+    }
+}
+
+} // namespace
+
+const char* blockFormatName(BlockFormat format) {
+    switch (format) {
+    case BlockFormat::BC1: return "BC1";
+    case BlockFormat::BC3: return "BC3";
+    case BlockFormat::BC7: return "BC7";
+    case BlockFormat::ETC2_RGB: return "ETC2 RGB";
+    case BlockFormat::ETC2_RGBA: return "ETC2 RGBA";
+    }
+    return "unknown";
+}
+
+std::size_t blockBytes(BlockFormat format) {
+    return format == BlockFormat::BC1 || format == BlockFormat::ETC2_RGB ? 8 : 16;
+}
+
+std::size_t levelBytes(BlockFormat format, int width, int height) {
+    const auto blocksX = static_cast<std::size_t>((std::max(width, 1) + 3) / 4);
+    const auto blocksY = static_cast<std::size_t>((std::max(height, 1) + 3) / 4);
+    return blocksX * blocksY * blockBytes(format);
+}
+
+bool isCompressedContainer(const std::filesystem::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char ch) {
+        return static_cast<char>(std::tolower(ch));
+    });
+    return ext == ".dds" || ext == ".ktx2";
+}
+
+std::optional<CompressedImage> parseDds(std::span<const std::byte> bytes, std::string* error) {
+    if (bytes.size() < kDdsHeaderEnd || readValue<std::uint32_t>(bytes, 0) != fourCC('D', 'D', 'S', ' ') ||
+        readValue<std::uint32_t>(bytes, 4) != 124) {
+        fail(error, "not a DDS file");
+        return std::nullopt;
+    }
+    const auto flags = readValue<std::uint32_t>(bytes, 8);
+    const auto height = readValue<std::uint32_t>(bytes, 12);
+    const auto width = readValue<std::uint32_t>(bytes, 16);
+    const auto depth = readValue<std::uint32_t>(bytes, 24);
+    const auto mipCount = readValue<std::uint32_t>(bytes, 28);
+    const auto pixelFlags = readValue<std::uint32_t>(bytes, 80);
+    const auto code = readValue<std::uint32_t>(bytes, 84);
+    const auto caps2 = readValue<std::uint32_t>(bytes, 112);
+    if ((caps2 & (kDdsCubemapCaps | kDdsVolumeCaps)) != 0 || ((flags & kDdsDepthFlag) != 0 && depth > 1)) {
+        fail(error, "cube maps and volume textures are not supported");
+        return std::nullopt;
+    }
+    if ((pixelFlags & kDdsFourCCFlag) == 0) {
+        fail(error, "uncompressed DDS pixel formats are not supported");
+        return std::nullopt;
+    }
+
+    std::optional<BlockFormat> format;
+    std::size_t dataOffset = kDdsHeaderEnd;
+    if (code == fourCC('D', 'X', 'T', '1')) {
+        format = BlockFormat::BC1;
+    } else if (code == fourCC('D', 'X', 'T', '5')) {
+        format = BlockFormat::BC3;
+    } else if (code == fourCC('D', 'X', '1', '0')) {
+        if (bytes.size() < kDdsDx10HeaderEnd) {
+            fail(error, "truncated DX10 header");
+            return std::nullopt;
+        }
+        const auto miscFlags = readValue<std::uint32_t>(bytes, 136);
+        const auto arraySize = readValue<std::uint32_t>(bytes, 140);
+        if ((miscFlags & kDx10CubeFlag) != 0 || arraySize > 1) {
+            fail(error, "texture arrays and cube maps are not supported");
+            return std::nullopt;
+        }
+        format = formatFromDxgi(readValue<std::uint32_t>(bytes, 128));
+        dataOffset = kDdsDx10HeaderEnd;
+    }
+    if (!format) {
+        fail(error, "unsupported DDS format (expected BC1, BC3 or BC7)");
+        return std::nullopt;
+    }
+
+    CompressedImage image;
+    image.format = *format;
+    image.width = static_cast<int>(std::min<std::uint32_t>(width, kMaxDimension + 1));
+    image.height = static_cast<int>(std::min<std::uint32_t>(height, kMaxDimension + 1));
+    image.mipmaps = (flags & kDdsMipMapCountFlag) != 0 && mipCount > 0
+                        ? static_cast<int>(std::min<std::uint32_t>(mipCount, 32))
+                        : 1;
+    if (!validDimensions(image.width, image.height, image.mipmaps, error)) {
+        return std::nullopt;
+    }
+    const std::size_t total = chainBytes(image.format, image.width, image.height, image.mipmaps);
+    if (bytes.size() - dataOffset < total) {
+        fail(error, "truncated image data");
+        return std::nullopt;
+    }
+    const auto* first = reinterpret_cast<const std::uint8_t*>(bytes.data() + dataOffset);
+    image.data.assign(first, first + total);
+    return image;
+}
+
+std::optional<CompressedImage> parseKtx2(std::span<const std::byte> bytes, std::string* error) {
+    if (bytes.size() < kKtx2HeaderEnd ||
+        std::memcmp(bytes.data(), kKtx2Identifier.data(), kKtx2Identifier.size()) != 0) {
+        fail(error, "not a KTX2 file");
+        return std::nullopt;
+    }
+    const auto vkFormat = readValue<std::uint32_t>(bytes, 12);
+    const auto width = readValue<std::uint32_t>(bytes, 20);
+    const auto height = readValue<std::uint32_t>(bytes, 24);
+    const auto depth = readValue<std::uint32_t>(bytes, 28);
+    const auto layers = readValue<std::uint32_t>(bytes, 32);
+    const auto faces = readValue<std::uint32_t>(bytes, 36);
+    const auto levels = readValue<std::uint32_t>(bytes, 40);
+    const auto supercompression = readValue<std::uint32_t>(bytes, 44);
+    if (supercompression != 0) {
+        fail(error, "supercompressed KTX2 (BasisLZ/Zstandard) is not supported");
+        return std::nullopt;
+    }
+    if (depth > 0 || layers > 1 || faces != 1) {
+        fail(error, "cube maps, arrays and volume textures are not supported");
+        return std::nullopt;
+    }
+    const auto format = formatFromVk(vkFormat);
+    if (!format) {
+        fail(error, "unsupported KTX2 format (expected BC1, BC3, BC7, ETC2 RGB or ETC2 RGBA)");
+        return std::nullopt;
+    }
+
+    CompressedImage image;
+    image.format = *format;
+    image.width = static_cast<int>(std::min<std::uint32_t>(width, kMaxDimension + 1));
+    image.height = static_cast<int>(std::min<std::uint32_t>(height, kMaxDimension + 1));
+    image.mipmaps = static_cast<int>(std::clamp<std::uint32_t>(levels, 1, 32));
+    if (!validDimensions(image.width, image.height, image.mipmaps, error)) {
+        return std::nullopt;
+    }
+    const std::size_t indexEnd = kKtx2HeaderEnd + kKtx2LevelEntryBytes * static_cast<std::size_t>(image.mipmaps);
+    if (bytes.size() < indexEnd) {
+        fail(error, "truncated level index");
+        return std::nullopt;
+    }
+
+    image.data.reserve(chainBytes(image.format, image.width, image.height, image.mipmaps));
+    int levelWidth = image.width;
+    int levelHeight = image.height;
+    for (int level = 0; level < image.mipmaps; ++level) {
+        const std::size_t entry = kKtx2HeaderEnd + kKtx2LevelEntryBytes * static_cast<std::size_t>(level);
+        const auto offset = readValue<std::uint64_t>(bytes, entry);
+        const auto length = readValue<std::uint64_t>(bytes, entry + 8);
+        const std::size_t expected = levelBytes(image.format, levelWidth, levelHeight);
+        if (length < expected || offset > bytes.size() || bytes.size() - offset < expected) {
+            fail(error, "truncated image data");
+            return std::nullopt;
+        }
+        const auto* first = reinterpret_cast<const std::uint8_t*>(bytes.data() + offset);
+        image.data.insert(image.data.end(), first, first + expected);
+        levelWidth = std::max(levelWidth / 2, 1);
+        levelHeight = std::max(levelHeight / 2, 1);
+    }
+    return image;
+}
+
+std::optional<CompressedImage> loadCompressedImage(const std::filesystem::path& path, std::string* error) {
+    auto mapped = filesystem::MappedFile::open(path);
+    if (!mapped) {
+        fail(error, "cannot open file");
+        return std::nullopt;
+    }
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char ch) {
+        return static_cast<char>(std::tolower(ch));
+    });
+    return ext == ".ktx2" ? parseKtx2(mapped->bytes(), error) : parseDds(mapped->bytes(), error);
+}
+
+void decodeBlock(BlockFormat format, const std::uint8_t* block, std::uint8_t* rgba) {
+    switch (format) {
+    case BlockFormat::BC1:
+        decodeBc1Color(block, rgba, false);
+        break;
+    case BlockFormat::BC3:
+        decodeBc1Color(block + 8, rgba, true);
+        decodeBc3Alpha(block, rgba);
+        break;
+    case BlockFormat::BC7:
+        decodeBc7(block, rgba);
+        break;
+    case BlockFormat::ETC2_RGB:
+        decodeEtc2Color(block, rgba);
+        break;
+    case BlockFormat::ETC2_RGBA:
+        decodeEtc2Color(block + 8, rgba);
+        decodeEacAlpha(block, rgba);
+        break;
+    }
+}
+
+std::vector<std::uint8_t> transcodeToRgba8(BlockFormat format, int width, int height, int mipmaps,
+                                           std::span<const std::uint8_t> data) {
+    std::vector<std::uint8_t> out;
+    if (width <= 0 || height <= 0 || mipmaps < 1 || data.size() < chainBytes(format, width, height, mipmaps)) {
+        return out;
+    }
+    std::size_t outBytes = 0;
+    for (int level = 0, w = width, h = height; level < mipmaps; ++level, w = std::max(w / 2, 1), h = std::max(h / 2, 1)) {
+        outBytes += static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4;
+    }
+    out.resize(outBytes);
+
+    const std::size_t stride = blockBytes(format);
+    const std::uint8_t* source = data.data();
+    std::uint8_t* level = out.data();
+    std::uint8_t texels[64];
+    for (int index = 0, w = width, h = height; index < mipmaps; ++index, w = std::max(w / 2, 1), h = std::max(h / 2, 1)) {
+        for (int by = 0; by < h; by += 4) {
+            for (int bx = 0; bx < w; bx += 4) {
+                decodeBlock(format, source, texels);
+                source += stride;
+                const int rows = std::min(4, h - by);
+                const int columns = std::min(4, w - bx);
+                for (int y = 0; y < rows; ++y) {
+                    std::memcpy(level + (static_cast<std::size_t>(by + y) * w + bx) * 4, texels + y * 16,
+                                static_cast<std::size_t>(columns) * 4);
+                }
+            }
+        }
+        level += static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4;
+    }
+    return out;
+}
+
+std::vector<std::uint8_t> transcodeToRgba8(const CompressedImage& image) {
+    return transcodeToRgba8(image.format, image.width, image.height, image.mipmaps, image.data);
+}
+
+} // namespace gb2d::textures
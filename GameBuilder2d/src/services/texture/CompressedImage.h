@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace gb2d::textures {
+
+// Block-compressed layouts TextureManager accepts from .dds and .ktx2 files. Every format encodes
+// 4x4 texel blocks: BC1 and ETC2_RGB in 8 bytes, the others in 16.
+enum class BlockFormat {
+    BC1,       // DXT1, 1-bit alpha
+    BC3,       // DXT5, interpolated alpha
+    BC7,
+    ETC2_RGB,  // includes ETC1
+    ETC2_RGBA, // EAC alpha block followed by an ETC2 colour block
+};
+
+const char* blockFormatName(BlockFormat format);
+std::size_t blockBytes(BlockFormat format);
+// Bytes of one mip level; partial blocks at the edges are stored whole.
+std::size_t levelBytes(BlockFormat format, int width, int height);
+
+// A parsed container: every mip level, largest first, packed back to back in `data`.
+struct CompressedImage {
+    BlockFormat format{BlockFormat::BC1};
+    int width{0};
+    int height{0};
+    int mipmaps{1};
+    std::vector<std::uint8_t> data{};
+};
+
+// True for the extensions handled by loadCompressedImage (.dds, .ktx2).
+bool isCompressedContainer(const std::filesystem::path& path);
+
+// Parsers reject cube maps, arrays, volume textures, KTX2 supercompression and any format not in
+// BlockFormat. On failure `error` (when given) receives a short reason.
+std::optional<CompressedImage> parseDds(std::span<const std::byte> bytes, std::string* error = nullptr);
+std::optional<CompressedImage> parseKtx2(std::span<const std::byte> bytes, std::string* error = nullptr);
+std::optional<CompressedImage> loadCompressedImage(const std::filesystem::path& path, std::string* error = nullptr);
+
+// CPU decoders, used when the GPU (or raylib) cannot sample a format. They need no graphics
+// context. decodeBlock writes 16 RGBA8 texels in row-major order.
+void decodeBlock(BlockFormat format, const std::uint8_t* block, std::uint8_t* rgba);
+// Decodes a mip chain stored as `data` (same layout as CompressedImage::data) into tightly packed
+// RGBA8 levels. Returns an empty vector when `data` is too short.
+std::vector<std::uint8_t> transcodeToRgba8(BlockFormat format, int width, int height, int mipmaps,
+                                           std::span<const std::uint8_t> data);
+std::vector<std::uint8_t> transcodeToRgba8(const CompressedImage& image);
+
+} // namespace gb2d::textures
@@ -0,0 +1,205 @@
+#include "DecodedImageCache.h"
+
+#include "services/filesystem/FileWatcher.h"
+#include "services/filesystem/MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gb2d::textures {
+namespace {
+
+// On-disk layout (host byte order): EntryHeader | pixel data, mip levels largest first.
+constexpr char kMagic[8] = {'G', 'B', '2', 'D', 'I', 'M', 'G', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+struct EntryHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t mipmaps;
+    std::int32_t format;
+    std::uint32_t reserved;
+    std::uint64_t contentHash;
+    std::uint64_t dataSize;
+};
+
+bool isBlockCompressed(int format) {
+    return format >= PIXELFORMAT_COMPRESSED_DXT1_RGB;
+}
+
+std::size_t imageDataBytes(int width, int height, int mipmaps, int format) {
+    std::size_t bytes = 0;
+    for (int level = 0; level < std::max(mipmaps, 1); ++level) {
+        bytes += static_cast<std::size_t>(std::max(GetPixelDataSize(width, height, format), 0));
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return bytes;
+}
+
+} // namespace
+
+DecodedImageCache::DecodedImageCache(std::filesystem::path directory)
+    : directory_(std::move(directory)) {}
+
+std::filesystem::path DecodedImageCache::entryPath(std::uint64_t contentHash) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.gb2dimg", static_cast<unsigned long long>(contentHash));
+    return directory_ / name;
+}
+
+std::optional<Image> DecodedImageCache::loadOrDecode(const std::filesystem::path& source, const DecodeFn& decode) {
+    const auto hash = filesystem::hashFile(source);
+    if (hash) {
+        if (auto cached = find(*hash)) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return cached;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    auto image = decode(source);
+    if (image && hash) {
+        store(*hash, *image);
+    }
+    return image;
+}
+
+std::optional<Image> DecodedImageCache::find(std::uint64_t contentHash) const {
+    auto mapped = filesystem::MappedFile::open(entryPath(contentHash));
+    if (!mapped || mapped->size() < sizeof(EntryHeader)) {
+        return std::nullopt;
+    }
+    EntryHeader header{};
+    std::memcpy(&header, mapped->data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        header.contentHash != contentHash || header.width <= 0 || header.height <= 0 || header.mipmaps <= 0 ||
+        isBlockCompressed(header.format) ||
+        header.dataSize != imageDataBytes(header.width, header.height, header.mipmaps, header.format) ||
+        header.dataSize == 0 || header.dataSize > mapped->size() - sizeof(EntryHeader)) {
+        return std::nullopt;
+    }
+
+    Image image{};
+    image.data = MemAlloc(static_cast<unsigned int>(header.dataSize));
+    if (image.data == nullptr) {
+        return std::nullopt;
+    }
+    std::memcpy(image.data, mapped->data() + sizeof(EntryHeader), static_cast<std::size_t>(header.dataSize));
+    image.width = header.width;
+    image.height = header.height;
+    image.mipmaps = header.mipmaps;
+    image.format = header.format;
+    return image;
+}
+
+bool DecodedImageCache::store(std::uint64_t contentHash, const Image& image) const {
+    if (image.data == nullptr || image.width <= 0 || image.height <= 0 || isBlockCompressed(image.format)) {
+        return false;
+    }
+    const int mipmaps = std::max(image.mipmaps, 1);
+    EntryHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.width = image.width;
+    header.height = image.height;
+    header.mipmaps = mipmaps;
+    header.format = image.format;
+    header.contentHash = contentHash;
+    header.dataSize = imageDataBytes(image.width, image.height, mipmaps, image.format);
+    if (header.dataSize == 0) {
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    const auto path = entryPath(contentHash);
+    // Workers may store the same entry at once; each writes its own temporary and the rename wins.
+    auto temporary = path;
+    temporary += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(static_cast<const char*>(image.data), static_cast<std::streamsize>(header.dataSize));
+        if (!out) {
+            out.close();
+            std::filesystem::remove(temporary, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
+
+std::size_t DecodedImageCache::prune(std::uintmax_t maxBytes) const {
+    struct Entry {
+        std::filesystem::path path;
+        std::uintmax_t size{0};
+        std::filesystem::file_time_type modified{};
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t total = 0;
+    std::size_t removed = 0;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(directory_, ec), end; !ec && it != end; it.increment(ec)) {
+        const auto& path = it->path();
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        const std::string name = path.filename().string();
+        if (name.find(".gb2dimg.tmp") != std::string::npos) {
+            std::error_code removeEc;
+            if (std::filesystem::remove(path, removeEc)) {
+                removed++;
+            }
+            continue;
+        }
+        if (path.extension() != ".gb2dimg") {
+            continue;
+        }
+        Entry entry;
+        entry.path = path;
+        entry.size = it->file_size(ec);
+        entry.modified = it->last_write_time(ec);
+        if (ec) {
+            ec.clear();
+            continue;
+        }
+        total += entry.size;
+        entries.push_back(std::move(entry));
+    }
+    if (total <= maxBytes) {
+        return removed;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.modified < b.modified; });
+    for (const auto& entry : entries) {
+        if (total <= maxBytes) {
+            break;
+        }
+        std::error_code removeEc;
+        if (std::filesystem::remove(entry.path, removeEc)) {
+            total -= entry.size;
+            removed++;
+        }
+    }
+    return removed;
+}
+
+} // namespace gb2d::textures
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+
+namespace gb2d::textures {
+
+// On-disk store of decoded images, one raw-pixel file per entry, keyed by the content hash of the
+// file the pixels came from. A warm entry replaces a PNG/JPG decode with a file copy; an edited
+// source hashes differently and simply misses, so stale entries pile up until prune() removes
+// them. Deleting the directory is always safe.
+// Thread-safe: decode workers share one instance, and concurrent stores of the same entry race on
+// an atomic rename.
+class DecodedImageCache {
+public:
+    using DecodeFn = std::function<std::optional<Image>(const std::filesystem::path&)>;
+
+    explicit DecodedImageCache(std::filesystem::path directory);
+
+    const std::filesystem::path& directory() const { return directory_; }
+    std::filesystem::path entryPath(std::uint64_t contentHash) const;
+
+    // Hashes `source` and returns the cached pixels, or runs `decode` and stores what it returns.
+    // Block-compressed results are returned but not stored; their files are already GPU-ready.
+    std::optional<Image> loadOrDecode(const std::filesystem::path& source, const DecodeFn& decode);
+
+    // The Image owns a MemAlloc'd copy of the pixels; release it with UnloadImage.
+    std::optional<Image> find(std::uint64_t contentHash) const;
+    bool store(std::uint64_t contentHash, const Image& image) const;
+
+    // Deletes entries oldest-written first until at most `maxBytes` remain, along with temporaries
+    // left by interrupted stores. Returns the number of files removed. Not safe to run alongside
+    // store(); TextureManager prunes once at init, before any decode is queued.
+    std::size_t prune(std::uintmax_t maxBytes) const;
+
+    std::size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    std::size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    std::filesystem::path directory_;
+    std::atomic<std::size_t> hits_{0};
+    std::atomic<std::size_t> misses_{0};
+};
+
+} // namespace gb2d::textures
@@ -1,16 +1,31 @@
 #include "TextureManager.h"
+#include "AtlasPacker.h"
+#include "BakedAtlas.h"
+#include "CompressedImage.h"
+#include "DecodedImageCache.h"
 
 #include "services/configuration/ConfigurationManager.h"
+#include "services/filesystem/FileWatcher.h"
+#include "services/filesystem/PathResolver.h"
 #include "services/logger/LogManager.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <fstream>
 #include <filesystem>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <span>
 #include <utility>
@@ -30,6 +45,72 @@ struct Settings {
     std::size_t maxBytes{0};
     std::optional<std::filesystem::path> placeholderPath{};
     bool logAtlasContents{false};
+    bool bakeAtlases{false};
+    std::size_t asyncWorkers{2};
+    std::size_t asyncUploadsPerFrame{4};
+    double asyncUploadBudgetMs{2.0};
+    bool packSmallTextures{false};
+    int packMaxDimension{64};
+    int packPageSize{1024};
+    int packPadding{1};
+    bool hotReload{false};
+    bool hotReloadPolling{false};
+    int hotReloadDebounceMs{200};
+    int hotReloadPollMs{500};
+    bool compressedUpload{true};
+    std::optional<std::filesystem::path> decodedCacheDir{};
+    std::size_t decodedCacheMaxBytes{0}; // 0 = unbounded
+    std::unordered_map<std::string, std::vector<std::string>> preloadGroups{}; // group -> identifiers
+};
+
+// What tryGet/tryGetAtlas hand out for one record. Immutable once published; replaced (and
+// retired) whenever the record's texture or frame table changes.
+struct PublishedAtlas {
+    TextureAtlasHandle handle{};
+    std::shared_ptr<const std::vector<AtlasFrame>> frames{}; // keeps handle.frames alive
+};
+
+// One record's share of the per-record counters in TextureMetrics. ManagerState::recordCounts
+// holds the sum over all published records, adjusted as each record is republished.
+struct RecordCounts {
+    std::size_t totalTextures{0};
+    std::size_t placeholderTextures{0};
+    std::size_t compressedTextures{0};
+    std::size_t compressedBytes{0};
+    std::size_t unreferencedTextures{0};
+    std::size_t unreferencedBytes{0};
+    std::size_t totalAtlases{0};
+    std::size_t placeholderAtlases{0};
+    std::size_t totalAtlasFrames{0};
+    std::size_t bakedAtlases{0};
+
+    RecordCounts& operator+=(const RecordCounts& other) {
+        totalTextures += other.totalTextures;
+        placeholderTextures += other.placeholderTextures;
+        compressedTextures += other.compressedTextures;
+        compressedBytes += other.compressedBytes;
+        unreferencedTextures += other.unreferencedTextures;
+        unreferencedBytes += other.unreferencedBytes;
+        totalAtlases += other.totalAtlases;
+        placeholderAtlases += other.placeholderAtlases;
+        totalAtlasFrames += other.totalAtlasFrames;
+        bakedAtlases += other.bakedAtlases;
+        return *this;
+    }
+
+    RecordCounts& operator-=(const RecordCounts& other) {
+        totalTextures -= other.totalTextures;
+        placeholderTextures -= other.placeholderTextures;
+        compressedTextures -= other.compressedTextures;
+        compressedBytes -= other.compressedBytes;
+        unreferencedTextures -= other.unreferencedTextures;
+        unreferencedBytes -= other.unreferencedBytes;
+        totalAtlases -= other.totalAtlases;
+        placeholderAtlases -= other.placeholderAtlases;
+        totalAtlasFrames -= other.totalAtlasFrames;
+        bakedAtlases -= other.bakedAtlases;
+        return *this;
+    }
 };
 
 struct TextureRecord {
@@ -38,19 +119,571 @@ struct TextureRecord {
     std::string originalIdentifier{};
     std::string resolvedPath{};
     bool placeholder{false};
+    bool pending{false};
+    std::uint64_t pendingTicket{0};
+    std::optional<std::list<std::string>::iterator> lruEntry{};
     bool ownsTexture{false};
     std::size_t byteSize{0};
     std::optional<std::filesystem::path> atlasJsonPath{};
-    std::unique_ptr<std::vector<AtlasFrame>> atlasFrames{};
+    std::shared_ptr<const std::vector<AtlasFrame>> atlasFrames{};
+    std::optional<std::uint32_t> atlasSlot{}; // AtlasFrameDirectory slot once an id was resolved
     std::unordered_map<std::string, std::size_t> atlasLookup{};
+    std::shared_ptr<const BakedAtlas> bakedAtlas{}; // replaces atlasLookup when loaded from a baked file
     bool atlasPlaceholder{false};
-    mutable std::optional<TextureAtlasHandle> cachedAtlasHandle{};
+    std::shared_ptr<const PublishedAtlas> publishedAtlas{}; // last state published to the read view
+    std::size_t publishedShard{0};
+    RecordCounts publishedCounts{};
+    bool viewDirty{false}; // queued in ReadView::dirtyKeys
+    std::vector<std::string> watchedPaths{}; // registered with ManagerState::watcher
 };
 
 struct AtlasDefinition {
     std::filesystem::path imagePath{};
     std::vector<AtlasFrame> frames{};
     std::unordered_map<std::string, std::size_t> lookup{};
+    std::shared_ptr<const BakedAtlas> baked{};
+};
+
+struct DecodeJob {
+    std::string key{};
+    std::filesystem::path path{};
+    std::uint64_t ticket{0};
+    TextureManager::DecoderFn decoder{};
+    bool keepCompressed{true};
+    std::shared_ptr<DecodedImageCache> decodedCache{};
+};
+
+struct DecodedImage {
+    std::string key{};
+    std::filesystem::path path{};
+    std::uint64_t ticket{0};
+    std::optional<Image> image{};
+};
+
+std::optional<int> pixelFormatFor(BlockFormat format) {
+    switch (format) {
+    case BlockFormat::BC1: return PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+    case BlockFormat::BC3: return PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+    case BlockFormat::ETC2_RGB: return PIXELFORMAT_COMPRESSED_ETC2_RGB;
+    case BlockFormat::ETC2_RGBA: return PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+    case BlockFormat::BC7: return std::nullopt; // raylib has no BC7 pixel format
+    }
+    return std::nullopt;
+}
+
+std::optional<BlockFormat> blockFormatFor(int pixelFormat) {
+    switch (pixelFormat) {
+    case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+    case PIXELFORMAT_COMPRESSED_DXT1_RGBA: return BlockFormat::BC1;
+    case PIXELFORMAT_COMPRESSED_DXT5_RGBA: return BlockFormat::BC3;
+    case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+    case PIXELFORMAT_COMPRESSED_ETC2_RGB: return BlockFormat::ETC2_RGB;
+    case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return BlockFormat::ETC2_RGBA;
+    default: return std::nullopt;
+    }
+}
+
+bool isCompressedPixelFormat(int pixelFormat) {
+    return pixelFormat >= PIXELFORMAT_COMPRESSED_DXT1_RGB;
+}
+
+// Sums the whole mip chain. Block formats are counted in whole 4x4 blocks, which
+// GetPixelDataSize does not do for small or odd-sized levels.
+std::size_t pixelDataBytes(int width, int height, int mipmaps, int pixelFormat) {
+    const auto block = blockFormatFor(pixelFormat);
+    std::size_t bytes = 0;
+    for (int level = 0; level < std::max(mipmaps, 1); ++level) {
+        if (block) {
+            bytes += levelBytes(*block, width, height);
+        } else {
+            bytes += static_cast<std::size_t>(std::max(GetPixelDataSize(width, height, pixelFormat), 0));
+        }
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return bytes;
+}
+
+Image rgba8Image(std::vector<std::uint8_t> pixels, int width, int height, int mipmaps) {
+    Image image{};
+    image.data = MemAlloc(static_cast<unsigned int>(pixels.size()));
+    std::memcpy(image.data, pixels.data(), pixels.size());
+    image.width = width;
+    image.height = height;
+    image.mipmaps = mipmaps;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return image;
+}
+
+// Keeps the blocks as they are when raylib can upload the format, otherwise (or when
+// keepCompressed is false) decodes the chain to RGBA8 on the calling thread.
+std::optional<Image> imageFromCompressed(const CompressedImage& compressed, bool keepCompressed) {
+    const auto pixelFormat = pixelFormatFor(compressed.format);
+    if (keepCompressed && pixelFormat) {
+        Image image{};
+        image.data = MemAlloc(static_cast<unsigned int>(compressed.data.size()));
+        std::memcpy(image.data, compressed.data.data(), compressed.data.size());
+        image.width = compressed.width;
+        image.height = compressed.height;
+        image.mipmaps = compressed.mipmaps;
+        image.format = *pixelFormat;
+        return image;
+    }
+    auto pixels = transcodeToRgba8(compressed);
+    if (pixels.empty()) {
+        return std::nullopt;
+    }
+    return rgba8Image(std::move(pixels), compressed.width, compressed.height, compressed.mipmaps);
+}
+
+// CPU fallback for a block-compressed Image the GPU refused. The caller owns (and unloads) both.
+std::optional<Image> transcodeImage(const Image& image) {
+    const auto block = blockFormatFor(image.format);
+    if (!block || image.data == nullptr) {
+        return std::nullopt;
+    }
+    const int mipmaps = std::max(image.mipmaps, 1);
+    const std::size_t size = pixelDataBytes(image.width, image.height, mipmaps, image.format);
+    auto pixels = transcodeToRgba8(*block, image.width, image.height, mipmaps,
+                                   std::span<const std::uint8_t>(static_cast<const std::uint8_t*>(image.data), size));
+    if (pixels.empty()) {
+        return std::nullopt;
+    }
+    return rgba8Image(std::move(pixels), image.width, image.height, mipmaps);
+}
+
+// `cache` (textures::decoded_cache_dir) short-circuits PNG/JPG decodes; compressed containers
+// bypass it since their blocks are uploaded as stored.
+std::optional<Image> decodeImageFile(const TextureManager::DecoderFn& decoder, const std::filesystem::path& path,
+                                     bool keepCompressed, DecodedImageCache* cache = nullptr) {
+    if (cache && (decoder || !isCompressedContainer(path))) {
+        return cache->loadOrDecode(path, [&decoder, keepCompressed](const std::filesystem::path& source) {
+            return decodeImageFile(decoder, source, keepCompressed);
+        });
+    }
+    if (decoder) {
+        return decoder(path);
+    }
+    if (isCompressedContainer(path)) {
+        std::string error;
+        auto compressed = loadCompressedImage(path, &error);
+        if (!compressed) {
+            LogManager::warn("Cannot read compressed texture '{}': {}", path.string(), error);
+            return std::nullopt;
+        }
+        return imageFromCompressed(*compressed, keepCompressed);
+    }
+    Image image = LoadImage(path.string().c_str());
+    if (image.data == nullptr) {
+        return std::nullopt;
+    }
+    return image;
+}
+
+void releaseDecodedImage(DecodedImage& decoded) {
+    if (decoded.image && decoded.image->data != nullptr) {
+        UnloadImage(*decoded.image);
+    }
+    decoded.image.reset();
+}
+
+// Worker pool that turns files into CPU-side Images. It never touches ManagerState or the GPU;
+// the main thread drains `completed` and performs the uploads.
+struct DecodePipeline {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::deque<DecodeJob> jobs{};
+    std::deque<DecodedImage> completed{};
+    std::vector<std::thread> workers{};
+    std::size_t busy{0};
+    bool stopping{false};
+    // Workers asked to exit by resize(); an idle worker takes one request and returns.
+    std::size_t retireRequests{0};
+    // Statistics are written under `mutex` but read without it by TextureManager::metrics().
+    std::atomic<std::size_t> workerCount{0};    // running workers, after pending retirements
+    std::atomic<std::size_t> pendingCount{0};   // queued + decoding
+    std::atomic<std::size_t> completedCount{0}; // decoded, waiting for upload
+    std::atomic<std::size_t> decodedCount{0};
+    std::atomic<double> lastDecodeMs{0.0};
+    std::atomic<double> totalDecodeMs{0.0};
+    std::atomic<double> maxDecodeMs{0.0};
+
+    ~DecodePipeline() { stop(); }
+
+    void start(std::size_t count) {
+        if (!workers.empty()) {
+            return;
+        }
+        {
+            std::scoped_lock lock(mutex);
+            stopping = false;
+            retireRequests = 0;
+        }
+        count = std::max<std::size_t>(count, 1);
+        workers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            workers.emplace_back([this]() { run(); });
+        }
+        workerCount = count;
+    }
+
+    // Grows or shrinks a running pool. Surplus workers exit once idle, so queued jobs and
+    // finished images are kept; their threads are joined by stop().
+    void resize(std::size_t count) {
+        count = std::max<std::size_t>(count, 1);
+        if (workers.empty() || count == workerCount.load()) {
+            return;
+        }
+        {
+            std::scoped_lock lock(mutex);
+            const std::size_t current = workerCount.load();
+            if (count > current) {
+                for (std::size_t i = current; i < count; ++i) {
+                    workers.emplace_back([this]() { run(); });
+                }
+            } else {
+                retireRequests += current - count;
+            }
+            workerCount = count;
+        }
+        wake.notify_all();
+    }
+
+    void stop() {
+        {
+            std::scoped_lock lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        workers.clear();
+        workerCount = 0;
+
+        std::scoped_lock lock(mutex);
+        retireRequests = 0;
+        jobs.clear();
+        for (auto& decoded : completed) {
+            releaseDecodedImage(decoded);
+        }
+        completed.clear();
+        busy = 0;
+        pendingCount = 0;
+        completedCount = 0;
+        decodedCount = 0;
+        lastDecodeMs = 0.0;
+        totalDecodeMs = 0.0;
+        maxDecodeMs = 0.0;
+        idle.notify_all();
+    }
+
+    void enqueue(DecodeJob job) {
+        {
+            std::scoped_lock lock(mutex);
+            jobs.push_back(std::move(job));
+            pendingCount++;
+        }
+        wake.notify_one();
+    }
+
+    std::optional<DecodedImage> popCompleted() {
+        std::scoped_lock lock(mutex);
+        if (completed.empty()) {
+            return std::nullopt;
+        }
+        DecodedImage decoded = std::move(completed.front());
+        completed.pop_front();
+        completedCount--;
+        return decoded;
+    }
+
+    void run() {
+        for (;;) {
+            DecodeJob job;
+            {
+                std::unique_lock lock(mutex);
+                wake.wait(lock, [this]() { return stopping || retireRequests > 0 || !jobs.empty(); });
+                if (stopping) {
+                    return;
+                }
+                if (retireRequests > 0) {
+                    retireRequests--;
+                    return;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+                busy++;
+            }
+
+            const auto started = std::chrono::steady_clock::now();
+            DecodedImage decoded;
+            decoded.key = std::move(job.key);
+            decoded.path = std::move(job.path);
+            decoded.ticket = job.ticket;
+            decoded.image = decodeImageFile(job.decoder, decoded.path, job.keepCompressed, job.decodedCache.get());
+            const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+            {
+                std::scoped_lock lock(mutex);
+                busy--;
+                pendingCount--;
+                decodedCount++;
+                lastDecodeMs = elapsedMs;
+                totalDecodeMs = totalDecodeMs.load() + elapsedMs;
+                maxDecodeMs = std::max(maxDecodeMs.load(), elapsedMs);
+                if (stopping) {
+                    releaseDecodedImage(decoded);
+                } else {
+                    completed.push_back(std::move(decoded));
+                    completedCount++;
+                }
+            }
+            idle.notify_all();
+        }
+    }
+};
+
+// Fixed table of published atlas frame tables addressed by AtlasFrameId::slot. Readers only touch
+// the atomics; writers hold ManagerState::mutex. A slot's generation is bumped before its table
+// pointer changes, so a reader that observes the id's generation both before and after loading the
+// pointer holds a table that is current or retired-but-alive. Retired tables are freed after
+// kRetireGraceTicks calls to tick().
+struct AtlasFrameDirectory {
+    using FrameTable = std::vector<AtlasFrame>;
+    static constexpr std::uint32_t kMaxSlots = 1024;
+    static constexpr std::uint64_t kRetireGraceTicks = 2;
+
+    struct Slot {
+        std::atomic<const FrameTable*> table{nullptr};
+        std::atomic<std::uint32_t> generation{0};
+        std::shared_ptr<const FrameTable> owner{};
+    };
+
+    std::array<Slot, kMaxSlots> slots{};
+    std::vector<std::uint32_t> freeSlots{};
+    std::uint32_t nextSlot{0};
+    std::uint64_t ticks{0};
+    std::vector<std::pair<std::uint64_t, std::shared_ptr<const FrameTable>>> retired{};
+    bool exhaustedNotified{false};
+
+    std::optional<std::uint32_t> acquireSlot() {
+        if (!freeSlots.empty()) {
+            const auto slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+        if (nextSlot < kMaxSlots) {
+            return nextSlot++;
+        }
+        return std::nullopt;
+    }
+
+    void publish(std::uint32_t slot, std::shared_ptr<const FrameTable> table) {
+        auto& entry = slots[slot];
+        std::uint32_t generation = entry.generation.load(std::memory_order_relaxed) + 1;
+        if (generation == 0) {
+            generation = 1; // 0 marks an invalid AtlasFrameId
+        }
+        entry.generation.store(generation, std::memory_order_release);
+        entry.table.store(table.get(), std::memory_order_release);
+        retire(std::move(entry.owner));
+        entry.owner = std::move(table);
+    }
+
+    void releaseSlot(std::uint32_t slot) {
+        publish(slot, nullptr);
+        freeSlots.push_back(slot);
+    }
+
+    std::uint32_t generation(std::uint32_t slot) const {
+        return slots[slot].generation.load(std::memory_order_relaxed);
+    }
+
+    const AtlasFrame* find(const AtlasFrameId& id) const {
+        if (id.generation == 0 || id.slot >= kMaxSlots) {
+            return nullptr;
+        }
+        const auto& entry = slots[id.slot];
+        if (entry.generation.load(std::memory_order_acquire) != id.generation) {
+            return nullptr;
+        }
+        const FrameTable* table = entry.table.load(std::memory_order_acquire);
+        if (!table || entry.generation.load(std::memory_order_acquire) != id.generation || id.index >= table->size()) {
+            return nullptr;
+        }
+        return &(*table)[id.index];
+    }
+
+    void retire(std::shared_ptr<const FrameTable> table) {
+        if (table) {
+            retired.emplace_back(ticks, std::move(table));
+        }
+    }
+
+    void advanceTick() {
+        ticks++;
+        std::erase_if(retired, [this](const auto& entry) { return ticks - entry.first >= kRetireGraceTicks; });
+    }
+
+    // Shutdown only: every outstanding id and frame pointer becomes invalid at once.
+    void clear() {
+        for (std::uint32_t slot = 0; slot < nextSlot; ++slot) {
+            slots[slot].generation.fetch_add(1, std::memory_order_release);
+            slots[slot].table.store(nullptr, std::memory_order_release);
+            slots[slot].owner.reset();
+        }
+        freeSlots.clear();
+        for (std::uint32_t slot = nextSlot; slot-- > 0;) {
+            freeSlots.push_back(slot);
+        }
+        retired.clear();
+        exhaustedNotified = false;
+    }
+};
+
+// Epoch-based reclamation for the read view. A reader announces the global epoch in a free slot
+// for the duration of one lookup; a retired object is freed once no slot holds an epoch at or
+// below the one it was retired in.
+struct ReaderEpochs {
+    static constexpr std::size_t kSlots = 64;
+
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> epoch{0};
+    };
+
+    std::array<Slot, kSlots> slots{};
+    std::atomic<std::uint64_t> global{1};
+
+    Slot& enter() {
+        thread_local std::size_t hint = std::hash<std::thread::id>{}(std::this_thread::get_id()) % kSlots;
+        const std::uint64_t epoch = global.load();
+        for (std::size_t probe = 0;; ++probe) {
+            if (probe > 0 && probe % kSlots == 0) {
+                // Every slot is held by another reader; let one of them finish before another pass.
+                std::this_thread::yield();
+            }
+            Slot& slot = slots[(hint + probe) % kSlots];
+            std::uint64_t expected = 0;
+            if (slot.epoch.load(std::memory_order_relaxed) == 0 && slot.epoch.compare_exchange_strong(expected, epoch)) {
+                hint = (hint + probe) % kSlots;
+                return slot;
+            }
+        }
+    }
+
+    std::uint64_t oldestActive() const {
+        std::uint64_t oldest = UINT64_MAX;
+        for (const auto& slot : slots) {
+            const std::uint64_t epoch = slot.epoch.load();
+            if (epoch != 0) {
+                oldest = std::min(oldest, epoch);
+            }
+        }
+        return oldest;
+    }
+};
+
+struct ReadGuard {
+    explicit ReadGuard(ReaderEpochs& epochs) : slot(epochs.enter()) {}
+    ~ReadGuard() { slot.epoch.store(0, std::memory_order_release); }
+    ReadGuard(const ReadGuard&) = delete;
+    ReadGuard& operator=(const ReadGuard&) = delete;
+
+    ReaderEpochs::Slot& slot;
+};
+
+struct ViewKeyHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view key) const noexcept { return std::hash<std::string_view>{}(key); }
+};
+
+struct ReadEntry {
+    const Texture2D* texture{nullptr};
+    std::shared_ptr<const PublishedAtlas> atlas{};
+};
+
+// Immutable, sharded copy of the record and alias tables plus the last metrics, published through
+// atomic pointers so tryGet/tryGetAtlas/metrics never take ManagerState::mutex. Writers queue the
+// keys they touch and rebuild only the shards whose records or aliases changed. Replaced shards are freed once no reader can
+// still be inside them; replaced PublishedAtlas objects additionally survive kGraceTicks calls
+// to tick() because tryGetAtlas hands out pointers into them.
+struct ReadView {
+    static constexpr std::size_t kShards = 128;
+    static constexpr std::uint64_t kGraceTicks = 2;
+    using RecordShard = std::unordered_map<std::string, ReadEntry, ViewKeyHash, std::equal_to<>>;
+    using AliasShard = std::unordered_map<std::string, std::string, ViewKeyHash, std::equal_to<>>;
+
+    struct Retired {
+        std::uint64_t epoch{0};
+        std::optional<std::uint64_t> tick{};
+        std::shared_ptr<const void> object{};
+    };
+
+    std::array<std::atomic<const RecordShard*>, kShards> records{};
+    std::array<std::atomic<const AliasShard*>, kShards> aliases{};
+    std::atomic<const TextureMetrics*> metrics{nullptr};
+    ReaderEpochs readers{};
+
+    // Writer side, guarded by ManagerState::mutex.
+    std::array<std::shared_ptr<const RecordShard>, kShards> ownedRecords{};
+    std::array<std::shared_ptr<const AliasShard>, kShards> ownedAliases{};
+    std::shared_ptr<const TextureMetrics> ownedMetrics{};
+    std::vector<std::string> dirtyKeys{};
+    std::vector<std::string> removedKeys{};
+    std::vector<std::string> changedAliases{};
+    std::vector<Retired> retired{};
+    std::uint64_t ticks{0};
+
+    static std::size_t shardOf(std::string_view key) { return ViewKeyHash{}(key) % kShards; }
+
+    // Call after the replacement has been stored, so readers entering a later epoch cannot see it.
+    void retire(std::shared_ptr<const void> object, bool handedOut) {
+        if (!object) {
+            return;
+        }
+        Retired entry;
+        entry.epoch = readers.global.fetch_add(1);
+        if (handedOut) {
+            entry.tick = ticks;
+        }
+        entry.object = std::move(object);
+        retired.push_back(std::move(entry));
+    }
+
+    void reclaim(bool ignoreGrace) {
+        if (retired.empty()) {
+            return;
+        }
+        const std::uint64_t oldest = readers.oldestActive();
+        std::erase_if(retired, [&](const Retired& entry) {
+            if (entry.epoch >= oldest) {
+                return false;
+            }
+            return ignoreGrace || !entry.tick || ticks - *entry.tick >= kGraceTicks;
+        });
+    }
+};
+
+struct SpritePage {
+    explicit SpritePage(int size, int padding) : packer(size, size, padding) {}
+
+    std::unique_ptr<Texture2D> texture{};
+    bool ownsTexture{false};
+    std::size_t bytes{0};
+    SkylinePacker packer;
+    std::size_t liveSprites{0};
+};
+
+struct SpriteEntry {
+    std::size_t refCount{0};
+    std::optional<std::size_t> page{};    // index into ManagerState::spritePages when packed
+    std::string textureKey{};             // standalone record backing an unpacked sprite
+    std::unique_ptr<AtlasFrame> frame{};  // stable storage behind TextureAtlasHandle::frames
+    bool placeholder{false};
 };
 
 struct ManagerState {
@@ -62,37 +695,142 @@ struct ManagerState {
     bool placeholderOwns{false};
     std::unordered_map<std::string, TextureRecord> records{};
     std::unordered_map<std::string, std::string> aliasToKey{};
+    RecordCounts recordCounts{}; // sum of TextureRecord::publishedCounts
     std::size_t totalBytes{0};
     bool overBudgetNotified{false};
+    // Unreferenced records kept resident while a byte budget is configured; front is evicted first.
+    std::list<std::string> lru{};
+    std::size_t evictions{0};
+    std::size_t evictedBytes{0};
+    std::size_t cacheHits{0};
+    std::size_t cacheMisses{0};
     TextureManager::LoaderFn testLoader{};
     TextureManager::PlaceholderFn testPlaceholder{};
+    TextureManager::DecoderFn testDecoder{};
+    TextureManager::UploaderFn testUploader{};
+    std::uint64_t nextDecodeTicket{0};
+    DecodePipeline decoder{};
+    std::vector<std::unique_ptr<SpritePage>> spritePages{};
+    std::unordered_map<std::string, SpriteEntry> sprites{};
+    std::unordered_map<std::string, std::string> spriteAliases{};
+    AtlasFrameDirectory frameDirectory{};
+    ReadView readView{};
+    // Present while textures::hot_reload is on; tracks resolvedPath and atlasJsonPath of records.
+    std::unique_ptr<gb2d::filesystem::FileWatcher> watcher{};
+    std::size_t hotReloads{0};
+    ReloadResult lastHotReload{};
+    std::size_t transcodedTextures{0};
+    std::shared_ptr<DecodedImageCache> decodedCache{}; // present while textures::decoded_cache_dir is set
+    std::unordered_map<std::string, std::vector<std::string>> preloads{}; // active group -> record keys held
+    gb2d::filesystem::PathResolver resolver{};
 };
 
+std::optional<std::filesystem::path> resolvePath(ManagerState& st, const std::string& identifier) {
+    return st.resolver.resolve(identifier);
+}
+
 ManagerState& state() {
     static ManagerState s;
     return s;
 }
 
-TextureMetrics computeMetricsSnapshot(const ManagerState& st) {
+void fillDecodeMetrics(TextureMetrics& metrics, const DecodePipeline& decoder) {
+    metrics.asyncWorkers = decoder.workerCount.load();
+    metrics.pendingDecodes = decoder.pendingCount.load();
+    metrics.pendingUploads = decoder.completedCount.load();
+    metrics.asyncDecodesCompleted = decoder.decodedCount.load();
+    metrics.lastDecodeMs = decoder.lastDecodeMs.load();
+    metrics.maxDecodeMs = decoder.maxDecodeMs.load();
+    if (metrics.asyncDecodesCompleted > 0) {
+        metrics.averageDecodeMs = decoder.totalDecodeMs.load() / static_cast<double>(metrics.asyncDecodesCompleted);
+    }
+}
+
+RecordCounts countRecord(const TextureRecord& rec) {
+    RecordCounts counts;
+    if (rec.placeholder) {
+        counts.placeholderTextures++;
+    } else {
+        counts.totalTextures++;
+        if (rec.texture && isCompressedPixelFormat(rec.texture->format)) {
+            counts.compressedTextures++;
+            counts.compressedBytes += rec.byteSize;
+        }
+    }
+    if (rec.lruEntry) {
+        counts.unreferencedTextures++;
+        counts.unreferencedBytes += rec.byteSize;
+    }
+    if (rec.atlasPlaceholder) {
+        counts.placeholderAtlases++;
+    } else if (rec.atlasFrames && !rec.atlasFrames->empty()) {
+        counts.totalAtlases++;
+        counts.totalAtlasFrames += rec.atlasFrames->size();
+        if (rec.bakedAtlas) {
+            counts.bakedAtlases++;
+        }
+    }
+    return counts;
+}
+
+// Everything but the decode statistics, which move on worker threads and are read live by
+// TextureManager::metrics(). Record counters come from the running totals, not a record walk.
+TextureMetrics computeMetricsSnapshot(ManagerState& st) {
     TextureMetrics metrics;
     if (!st.initialized) {
         return metrics;
     }
     metrics.totalBytes = st.totalBytes;
-    for (const auto& [key, rec] : st.records) {
-        (void)key;
-        if (rec.placeholder) {
-            metrics.placeholderTextures++;
-        } else {
-            metrics.totalTextures++;
-        }
-        if (rec.atlasPlaceholder) {
-            metrics.placeholderAtlases++;
-        } else if (rec.atlasFrames && !rec.atlasFrames->empty()) {
-            metrics.totalAtlases++;
-            metrics.totalAtlasFrames += rec.atlasFrames->size();
+    metrics.budgetBytes = st.settings.maxBytes;
+    metrics.evictions = st.evictions;
+    metrics.evictedBytes = st.evictedBytes;
+    metrics.cacheHits = st.cacheHits;
+    metrics.cacheMisses = st.cacheMisses;
+    if (st.cacheHits + st.cacheMisses > 0) {
+        metrics.cacheHitRatio = static_cast<double>(st.cacheHits) / static_cast<double>(st.cacheHits + st.cacheMisses);
+    }
+    double occupancySum = 0.0;
+    for (const auto& page : st.spritePages) {
+        if (!page) {
+            continue;
         }
-    }
+        metrics.spritePages++;
+        metrics.packedSprites += page->liveSprites;
+        metrics.spritePageBytes += page->bytes;
+        occupancySum += page->packer.occupancy();
+    }
+    if (metrics.spritePages > 0) {
+        metrics.spritePageOccupancy = occupancySum / static_cast<double>(metrics.spritePages);
+    }
+    metrics.watchedFiles = st.watcher ? st.watcher->watchedCount() : 0;
+    metrics.hotReloads = st.hotReloads;
+    metrics.lastHotReloadMs = st.lastHotReload.totalMs;
+    metrics.transcodedTextures = st.transcodedTextures;
+    if (st.decodedCache) {
+        metrics.decodedCacheHits = st.decodedCache->hits();
+        metrics.decodedCacheMisses = st.decodedCache->misses();
+    }
+    const auto paths = st.resolver.stats();
+    metrics.pathLookups = paths.lookups;
+    metrics.pathCacheHits = paths.hits;
+    metrics.pathProbes = paths.probes;
+    metrics.pathProbesAvoided = paths.probesAvoided;
+    metrics.preloadGroups = st.preloads.size();
+    for (const auto& [group, keys] : st.preloads) {
+        (void)group;
+        metrics.preloadedTextures += keys.size();
+    }
+    const RecordCounts& counts = st.recordCounts;
+    metrics.totalTextures = counts.totalTextures;
+    metrics.placeholderTextures = counts.placeholderTextures;
+    metrics.compressedTextures = counts.compressedTextures;
+    metrics.compressedBytes = counts.compressedBytes;
+    metrics.unreferencedTextures = counts.unreferencedTextures;
+    metrics.unreferencedBytes = counts.unreferencedBytes;
+    metrics.totalAtlases = counts.totalAtlases;
+    metrics.placeholderAtlases = counts.placeholderAtlases;
+    metrics.totalAtlasFrames = counts.totalAtlasFrames;
+    metrics.bakedAtlases = counts.bakedAtlases;
     return metrics;
 }
 
@@ -120,13 +858,7 @@ std::string canonicalizeFrameName(const std::string& raw) {
 }
 
 std::size_t estimateTextureBytes(const Texture2D& texture) {
-    int base = GetPixelDataSize(texture.width, texture.height, texture.format);
-    if (base < 0) base = 0;
-    std::size_t bytes = static_cast<std::size_t>(base);
-    if (texture.mipmaps > 1) {
-        bytes *= static_cast<std::size_t>(texture.mipmaps);
-    }
-    return bytes;
+    return pixelDataBytes(texture.width, texture.height, texture.mipmaps, texture.format);
 }
 
 std::optional<std::filesystem::path> checkCandidate(const std::filesystem::path& candidate) {
@@ -141,47 +873,6 @@ std::optional<std::filesystem::path> checkCandidate(const std::filesystem::path&
     return canonical;
 }
 
-std::optional<std::filesystem::path> resolvePath(const std::string& identifier, const Settings& settings) {
-    if (identifier.empty()) {
-        return std::nullopt;
-    }
-
-    std::filesystem::path input(identifier);
-
-    if (input.is_absolute()) {
-        if (auto absolute = checkCandidate(input)) {
-            return absolute;
-        }
-        return std::nullopt;
-    }
-
-    std::error_code ec;
-    auto currentDir = std::filesystem::current_path(ec);
-    if (!ec) {
-        auto direct = currentDir / input;
-        if (auto found = checkCandidate(direct)) {
-            return found;
-        }
-    }
-
-    for (const auto& search : settings.searchPaths) {
-        std::filesystem::path root = search;
-        if (!root.is_absolute()) {
-            std::error_code ec2;
-            auto base = std::filesystem::current_path(ec2);
-            if (!ec2) {
-                root = base / root;
-            }
-        }
-        auto candidate = root / input;
-        if (auto found = checkCandidate(candidate)) {
-            return found;
-        }
-    }
-
-    return std::nullopt;
-}
-
 int parseFilter(const std::string& value) {
     std::string lower = value;
     std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char ch) {
@@ -195,13 +886,44 @@ int parseFilter(const std::string& value) {
     return TEXTURE_FILTER_BILINEAR;
 }
 
+// textures.preload maps a group name (a game id, or "startup") to the identifiers it loads.
+std::unordered_map<std::string, std::vector<std::string>> loadPreloadManifest() {
+    std::unordered_map<std::string, std::vector<std::string>> groups;
+    const auto& root = ConfigurationManager::raw();
+    if (!root.is_object()) {
+        return groups;
+    }
+    const auto texturesIt = root.find("textures");
+    if (texturesIt == root.end() || !texturesIt->is_object()) {
+        return groups;
+    }
+    const auto preloadIt = texturesIt->find("preload");
+    if (preloadIt == texturesIt->end() || !preloadIt->is_object()) {
+        return groups;
+    }
+    for (const auto& [group, entries] : preloadIt->items()) {
+        if (!entries.is_array()) {
+            LogManager::warn("textures.preload group '{}' is not an array; ignoring it", group);
+            continue;
+        }
+        auto& identifiers = groups[group];
+        for (const auto& entry : entries) {
+            if (entry.is_string()) {
+                identifiers.push_back(entry.get<std::string>());
+            }
+        }
+    }
+    return groups;
+}
+
+std::vector<std::filesystem::path> loadSearchPaths() {
+    auto paths = ConfigurationManager::getStringList("textures::search_paths", { "assets/textures" });
+    return std::vector<std::filesystem::path>(paths.begin(), paths.end());
+}
+
 Settings loadSettings() {
     Settings s;
-    auto paths = ConfigurationManager::getStringList("textures::search_paths", { "assets/textures" });
-    s.searchPaths.reserve(paths.size());
-    for (const auto& p : paths) {
-        s.searchPaths.emplace_back(p);
-    }
+    s.searchPaths = loadSearchPaths();
     s.generateMipmaps = ConfigurationManager::getBool("textures::generate_mipmaps", false);
     s.filterMode = parseFilter(ConfigurationManager::getString("textures::default_filter", "bilinear"));
     auto maxBytes = ConfigurationManager::getInt("textures::max_bytes", 0);
@@ -213,13 +935,103 @@ Settings loadSettings() {
         s.placeholderPath = std::filesystem::path(placeholderPath);
     }
     s.logAtlasContents = ConfigurationManager::getBool("textures::log_atlas_contents", false);
+    s.bakeAtlases = ConfigurationManager::getBool("textures::bake_atlases", false);
+    auto workers = ConfigurationManager::getInt("textures::async_workers", 2);
+    s.asyncWorkers = static_cast<std::size_t>(std::max<std::int64_t>(workers, 1));
+    auto uploads = ConfigurationManager::getInt("textures::async_uploads_per_frame", 4);
+    s.asyncUploadsPerFrame = static_cast<std::size_t>(std::max<std::int64_t>(uploads, 0));
+    s.asyncUploadBudgetMs = std::max(ConfigurationManager::getDouble("textures::async_upload_budget_ms", 2.0), 0.0);
+    s.packSmallTextures = ConfigurationManager::getBool("textures::pack_small_textures", false);
+    s.packMaxDimension = static_cast<int>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::pack_max_dimension", 64), 8));
+    s.packPageSize = static_cast<int>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::pack_page_size", 1024), 256));
+    s.packPadding = static_cast<int>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::pack_padding", 1), 0));
+    // A sprite must fit a page with its gutters, or every acquire would open and drop a page.
+    s.packMaxDimension = std::max(1, std::min(s.packMaxDimension, s.packPageSize - 2 * s.packPadding));
+    s.hotReload = ConfigurationManager::getBool("textures::hot_reload", false);
+    s.hotReloadPolling = ConfigurationManager::getBool("textures::hot_reload_polling", false);
+    s.hotReloadDebounceMs = static_cast<int>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::hot_reload_debounce_ms", 200), 0));
+    s.hotReloadPollMs = static_cast<int>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::hot_reload_poll_ms", 500), 0));
+    s.compressedUpload = ConfigurationManager::getBool("textures::compressed_upload", true);
+    std::string decodedCacheDir = ConfigurationManager::getString("textures::decoded_cache_dir", "");
+    if (!decodedCacheDir.empty()) {
+        s.decodedCacheDir = std::filesystem::path(decodedCacheDir);
+    }
+    s.decodedCacheMaxBytes = static_cast<std::size_t>(
+        std::max<std::int64_t>(ConfigurationManager::getInt("textures::decoded_cache_max_bytes", 268435456), 0));
+    s.preloadGroups = loadPreloadManifest();
     return s;
 }
 
+bool isAsyncDecodable(const std::filesystem::path& path) {
+    auto ext = canonicalizeKey(path.extension().string());
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || isCompressedContainer(path);
+}
+
+std::optional<TextureManager::LoadedTexture> uploadImage(ManagerState& st, const Image& image) {
+    if (st.testUploader) {
+        auto loaded = st.testUploader(image, st.settings.generateMipmaps, st.settings.filterMode);
+        if (loaded && loaded->bytes == 0) {
+            loaded->bytes = pixelDataBytes(image.width, image.height, image.mipmaps, image.format);
+        }
+        return loaded;
+    }
+    Texture2D handle = LoadTextureFromImage(image);
+    if (handle.id == 0) {
+        return std::nullopt;
+    }
+    // Block-compressed images bring their own mip chain; the GPU cannot generate one for them.
+    if (st.settings.generateMipmaps && !isCompressedPixelFormat(handle.format) && handle.mipmaps <= 1) {
+        GenTextureMipmaps(&handle);
+    }
+    SetTextureFilter(handle, st.settings.filterMode);
+    TextureManager::LoadedTexture loaded;
+    loaded.texture = handle;
+    loaded.ownsTexture = true;
+    loaded.bytes = estimateTextureBytes(handle);
+    return loaded;
+}
+
+// `source` is the file the image was decoded from; it only feeds the transcode counter and logs.
+std::optional<TextureManager::LoadedTexture> uploadDecodedImage(ManagerState& st, const Image& image,
+                                                                const std::filesystem::path& source) {
+    if (!isCompressedPixelFormat(image.format)) {
+        if (isCompressedContainer(source)) {
+            st.transcodedTextures++; // transcoded while decoding (BC7, or compressed_upload off)
+        }
+        return uploadImage(st, image);
+    }
+    if (st.settings.compressedUpload) {
+        if (auto loaded = uploadImage(st, image)) {
+            return loaded;
+        }
+    }
+    auto rgba = transcodeImage(image);
+    if (!rgba) {
+        return std::nullopt;
+    }
+    LogManager::info("Transcoded compressed texture '{}' to RGBA8 ({}x{}, {} mip levels)",
+                     source.string(), rgba->width, rgba->height, rgba->mipmaps);
+    st.transcodedTextures++;
+    auto loaded = uploadImage(st, *rgba);
+    UnloadImage(*rgba);
+    return loaded;
+}
+
 std::optional<TextureManager::LoadedTexture> loadTextureFromDisk(ManagerState& st, const std::filesystem::path& path) {
     if (st.testLoader) {
         return st.testLoader(path, st.settings.generateMipmaps, st.settings.filterMode);
     }
+    if (isCompressedContainer(path) || st.decodedCache) {
+        auto image = isCompressedContainer(path)
+                         ? decodeImageFile({}, path, st.settings.compressedUpload)
+                         : decodeImageFile(st.testDecoder, path, st.settings.compressedUpload, st.decodedCache.get());
+        if (!image) {
+            return std::nullopt;
+        }
+        auto loaded = uploadDecodedImage(st, *image, path);
+        UnloadImage(*image);
+        return loaded;
+    }
     Texture2D handle = LoadTexture(path.string().c_str());
     if (handle.id == 0) {
         return std::nullopt;
@@ -290,13 +1102,10 @@ void applyLoadedTexture(TextureRecord& rec, ManagerState& st, const TextureManag
     rec.ownsTexture = loaded.ownsTexture;
     rec.byteSize = loaded.bytes;
     rec.placeholder = false;
+    rec.pending = false;
+    rec.pendingTicket = 0;
     rec.resolvedPath = path.string();
     st.totalBytes += rec.byteSize;
-    if (st.settings.maxBytes > 0 && st.totalBytes > st.settings.maxBytes && !st.overBudgetNotified) {
-        LogManager::warn("Texture budget exceeded: {} bytes > configured cap {} bytes", st.totalBytes, st.settings.maxBytes);
-        st.overBudgetNotified = true;
-    }
-    rec.cachedAtlasHandle.reset();
 }
 
 float jsonNumberToFloat(const nlohmann::json& node, const char* key, float fallback = 0.0f) {
@@ -479,41 +1288,125 @@ std::optional<AtlasDefinition> loadAtlasDefinition(const std::filesystem::path&
     return definition;
 }
 
-void setAtlasPlaceholder(TextureRecord& rec) {
-    rec.atlasPlaceholder = true;
-    if (!rec.atlasFrames) {
-        rec.atlasFrames = std::make_unique<std::vector<AtlasFrame>>();
-    } else {
-        rec.atlasFrames->clear();
-    }
-    rec.atlasLookup.clear();
-    rec.cachedAtlasHandle.reset();
+bool isBakedAtlasPath(const std::filesystem::path& path) {
+    return canonicalizeKey(path.extension().string()) == BakedAtlas::kExtension;
 }
 
-void assignAtlasFrames(TextureRecord& rec, AtlasDefinition&& definition) {
-    rec.atlasPlaceholder = false;
-    rec.atlasFrames = std::make_unique<std::vector<AtlasFrame>>(std::move(definition.frames));
-    rec.atlasLookup = std::move(definition.lookup);
-    rec.cachedAtlasHandle.reset();
+std::filesystem::path bakedAtlasPathFor(const std::filesystem::path& jsonPath) {
+    auto baked = jsonPath;
+    baked.replace_extension(BakedAtlas::kExtension);
+    return baked;
 }
 
-void maybeDumpAtlasContents(const ManagerState& st,
-                           const std::string& atlasKey,
-                           const std::string& identifier,
-                           const std::optional<std::filesystem::path>& jsonPath,
-                           const AtlasDefinition& definition) {
-    if (!st.settings.logAtlasContents) {
-        return;
+AtlasDefinition definitionFromBaked(std::shared_ptr<const BakedAtlas> baked) {
+    AtlasDefinition definition;
+    definition.imagePath = baked->imagePath();
+    definition.frames.reserve(baked->frameCount());
+    for (std::size_t i = 0; i < baked->frameCount(); ++i) {
+        definition.frames.push_back(baked->frame(i));
     }
+    definition.baked = std::move(baked);
+    return definition;
+}
 
-    std::string sourcePath;
-    if (jsonPath) {
-        sourcePath = jsonPath->string();
-    } else if (!identifier.empty()) {
-        sourcePath = identifier;
+bool writeBakedAtlas(const AtlasDefinition& definition,
+                     const std::filesystem::path& jsonPath,
+                     const std::filesystem::path& outputPath) {
+    auto stamp = atlasSourceStamp(jsonPath);
+    if (!stamp) {
+        return false;
     }
+    std::vector<std::string> canonicalNames(definition.frames.size());
+    for (const auto& [name, index] : definition.lookup) {
+        if (index < canonicalNames.size()) {
+            canonicalNames[index] = name;
+        }
+    }
+    return BakedAtlas::write(outputPath, definition.frames, canonicalNames, definition.imagePath, *stamp);
+}
 
-    LogManager::debug("Texture atlas dump: key='{}', identifier='{}', json='{}', frames={}",
+// Prefers a baked sibling ("<name>.gb2datlas") whose source stamp still matches the JSON, falls
+// back to parsing the JSON, and optionally bakes the result for the next load.
+std::optional<AtlasDefinition> loadAtlas(const Settings& settings, const std::filesystem::path& atlasPath) {
+    if (isBakedAtlasPath(atlasPath)) {
+        auto baked = BakedAtlas::open(atlasPath);
+        if (!baked || baked->frameCount() == 0) {
+            LogManager::error("Baked texture atlas '{}' is invalid or empty", atlasPath.string());
+            return std::nullopt;
+        }
+        return definitionFromBaked(std::move(baked));
+    }
+
+    const auto bakedPath = bakedAtlasPathFor(atlasPath);
+    std::error_code existsEc;
+    if (std::filesystem::exists(bakedPath, existsEc) && !existsEc) {
+        auto stamp = atlasSourceStamp(atlasPath);
+        auto baked = BakedAtlas::open(bakedPath);
+        if (baked && stamp && baked->sourceStamp() == *stamp && baked->frameCount() > 0) {
+            return definitionFromBaked(std::move(baked));
+        }
+        LogManager::debug("Texture atlas '{}': baked file '{}' is stale or invalid; parsing JSON",
+                          atlasPath.string(), bakedPath.string());
+    }
+
+    auto definition = loadAtlasDefinition(atlasPath);
+    if (definition && settings.bakeAtlases) {
+        if (writeBakedAtlas(*definition, atlasPath, bakedPath)) {
+            LogManager::info("Texture atlas '{}' baked to '{}'", atlasPath.string(), bakedPath.string());
+        } else {
+            LogManager::warn("Texture atlas '{}' could not be baked to '{}'", atlasPath.string(), bakedPath.string());
+        }
+    }
+    return definition;
+}
+
+// Called whenever rec.atlasFrames is replaced so resolved AtlasFrameIds go stale.
+void republishAtlasFrames(TextureRecord& rec) {
+    if (rec.atlasSlot) {
+        state().frameDirectory.publish(*rec.atlasSlot, rec.atlasFrames);
+    }
+}
+
+void releaseAtlasSlot(TextureRecord& rec) {
+    if (rec.atlasSlot) {
+        state().frameDirectory.releaseSlot(*rec.atlasSlot);
+        rec.atlasSlot.reset();
+    }
+}
+
+void setAtlasPlaceholder(TextureRecord& rec) {
+    rec.atlasPlaceholder = true;
+    rec.atlasFrames = std::make_shared<const std::vector<AtlasFrame>>();
+    rec.atlasLookup.clear();
+    rec.bakedAtlas.reset();
+    republishAtlasFrames(rec);
+}
+
+void assignAtlasFrames(TextureRecord& rec, AtlasDefinition&& definition) {
+    rec.atlasPlaceholder = false;
+    rec.atlasFrames = std::make_shared<const std::vector<AtlasFrame>>(std::move(definition.frames));
+    rec.atlasLookup = std::move(definition.lookup);
+    rec.bakedAtlas = std::move(definition.baked);
+    republishAtlasFrames(rec);
+}
+
+void maybeDumpAtlasContents(const ManagerState& st,
+                           const std::string& atlasKey,
+                           const std::string& identifier,
+                           const std::optional<std::filesystem::path>& jsonPath,
+                           const AtlasDefinition& definition) {
+    if (!st.settings.logAtlasContents) {
+        return;
+    }
+
+    std::string sourcePath;
+    if (jsonPath) {
+        sourcePath = jsonPath->string();
+    } else if (!identifier.empty()) {
+        sourcePath = identifier;
+    }
+
+    LogManager::debug("Texture atlas dump: key='{}', identifier='{}', json='{}', frames={}",
                       atlasKey,
                       identifier,
                       sourcePath.empty() ? "<unknown>" : sourcePath,
@@ -537,6 +1430,23 @@ void maybeDumpAtlasContents(const ManagerState& st,
     }
 }
 
+std::optional<std::size_t> findAtlasFrameIndex(const TextureRecord& rec, const std::string& frameName) {
+    if (!rec.atlasFrames || rec.atlasFrames->empty()) {
+        return std::nullopt;
+    }
+    auto nameKey = canonicalizeFrameName(frameName);
+    std::optional<std::size_t> index;
+    if (rec.bakedAtlas) {
+        index = rec.bakedAtlas->find(nameKey);
+    } else if (auto it = rec.atlasLookup.find(nameKey); it != rec.atlasLookup.end()) {
+        index = it->second;
+    }
+    if (!index || *index >= rec.atlasFrames->size()) {
+        return std::nullopt;
+    }
+    return index;
+}
+
 TextureAtlasHandle makeAtlasHandle(const std::string& key,
                                   const TextureRecord& rec,
                                   const ManagerState& st,
@@ -552,25 +1462,6 @@ TextureAtlasHandle makeAtlasHandle(const std::string& key,
     return handle;
 }
 
-const TextureAtlasHandle* ensureAtlasHandle(const std::string& key,
-                                            TextureRecord& rec,
-                                            const ManagerState& st) {
-    if (!rec.cachedAtlasHandle) {
-        rec.cachedAtlasHandle.emplace();
-    }
-    TextureAtlasHandle& handle = *rec.cachedAtlasHandle;
-    handle.key = key;
-    handle.texture = texturePtr(rec, st);
-    handle.placeholder = rec.placeholder || rec.atlasPlaceholder;
-    handle.newlyLoaded = false;
-    if (rec.atlasFrames) {
-        handle.frames = std::span<const AtlasFrame>(*rec.atlasFrames);
-    } else {
-        handle.frames = {};
-    }
-    return &handle;
-}
-
 std::string resolveRecordKey(const ManagerState& st, const std::string& suppliedKey) {
     auto canonical = canonicalizeKey(suppliedKey);
     auto aliasIt = st.aliasToKey.find(canonical);
@@ -580,23 +1471,49 @@ std::string resolveRecordKey(const ManagerState& st, const std::string& supplied
     return canonical;
 }
 
+void markAliasDirty(ManagerState& st, const std::string& alias) {
+    st.readView.changedAliases.push_back(alias);
+}
+
+// Queues a record for the next publishReadView. Call wherever its texture, frame table,
+// placeholder state or LRU membership may have changed, and after inserting or rekeying it.
+void markRecordDirty(ManagerState& st, const std::string& key, TextureRecord& rec) {
+    if (!rec.viewDirty) {
+        rec.viewDirty = true;
+        st.readView.dirtyKeys.push_back(key);
+    }
+}
+
+void markAllRecordsDirty(ManagerState& st) {
+    for (auto& [key, rec] : st.records) {
+        markRecordDirty(st, key, rec);
+    }
+}
+
 void bindAlias(ManagerState& st, const std::string& alias, const std::string& key) {
     if (alias.empty()) {
         return;
     }
-    st.aliasToKey[alias] = key;
+    auto& mapped = st.aliasToKey[alias];
+    if (mapped != key) {
+        mapped = key;
+        markAliasDirty(st, alias);
+    }
 }
 
 void unbindAlias(ManagerState& st, const std::string& alias) {
     if (alias.empty()) {
         return;
     }
-    st.aliasToKey.erase(alias);
+    if (st.aliasToKey.erase(alias) > 0) {
+        markAliasDirty(st, alias);
+    }
 }
 
 void unbindAliasesForKey(ManagerState& st, const std::string& key) {
     for (auto it = st.aliasToKey.begin(); it != st.aliasToKey.end();) {
         if (it->second == key) {
+            markAliasDirty(st, it->first);
             it = st.aliasToKey.erase(it);
         } else {
             ++it;
@@ -604,6 +1521,284 @@ void unbindAliasesForKey(ManagerState& st, const std::string& key) {
     }
 }
 
+void untrackUnreferenced(ManagerState& st, TextureRecord& rec) {
+    if (rec.lruEntry) {
+        st.lru.erase(*rec.lruEntry);
+        rec.lruEntry.reset();
+    }
+}
+
+// Points the watcher at the paths `rec` currently loads from. Runs for each dirty record in
+// publishReadView, which covers every change to resolvedPath or atlasJsonPath.
+void syncRecordWatches(ManagerState& st, TextureRecord& rec) {
+    if (!st.watcher) {
+        return;
+    }
+    const bool hasAtlas = rec.atlasJsonPath.has_value();
+    const std::size_t wanted = (rec.resolvedPath.empty() ? 0u : 1u) + (hasAtlas ? 1u : 0u);
+    if (rec.watchedPaths.size() == wanted &&
+        (rec.resolvedPath.empty() || rec.watchedPaths.front() == rec.resolvedPath) &&
+        (!hasAtlas || rec.watchedPaths.back() == rec.atlasJsonPath->string())) {
+        return;
+    }
+    std::vector<std::string> desired;
+    if (!rec.resolvedPath.empty()) {
+        desired.push_back(rec.resolvedPath);
+    }
+    if (hasAtlas) {
+        desired.push_back(rec.atlasJsonPath->string());
+    }
+    for (const auto& path : desired) {
+        st.watcher->watch(path);
+    }
+    for (const auto& path : rec.watchedPaths) {
+        st.watcher->unwatch(path);
+    }
+    rec.watchedPaths = std::move(desired);
+}
+
+// Publishes the records marked dirty since the last call, copies the affected shards with the
+// changes applied and swaps them in, and replaces the metrics snapshot if any value moved. Dirty
+// records also get their file watches updated. Runs at
+// the end of each mutating entry point (see ReadViewPublisher); cost is proportional to the dirty
+// records plus a copy of each touched shard.
+void publishReadView(ManagerState& st) {
+    auto& view = st.readView;
+    if (!st.initialized) {
+        for (std::size_t shard = 0; shard < ReadView::kShards; ++shard) {
+            view.records[shard].store(nullptr);
+            view.aliases[shard].store(nullptr);
+            view.retire(std::move(view.ownedRecords[shard]), false);
+            view.retire(std::move(view.ownedAliases[shard]), false);
+        }
+        view.metrics.store(nullptr);
+        view.retire(std::move(view.ownedMetrics), false);
+        view.dirtyKeys.clear();
+        view.removedKeys.clear();
+        view.changedAliases.clear();
+        view.reclaim(true);
+        return;
+    }
+
+    std::vector<std::pair<const std::string*, const TextureRecord*>> changed;
+    for (const auto& dirtyKey : view.dirtyKeys) {
+        auto it = st.records.find(dirtyKey);
+        if (it == st.records.end() || !it->second.viewDirty) {
+            continue; // erased since, or queued twice
+        }
+        const std::string& key = it->first;
+        auto& rec = it->second;
+        rec.viewDirty = false;
+        st.recordCounts -= rec.publishedCounts;
+        rec.publishedCounts = countRecord(rec);
+        st.recordCounts += rec.publishedCounts;
+        syncRecordWatches(st, rec);
+        const Texture2D* texture = texturePtr(rec, st);
+        const bool placeholder = rec.placeholder || rec.atlasPlaceholder;
+        const auto& current = rec.publishedAtlas;
+        if (current && current->handle.texture == texture && current->frames == rec.atlasFrames &&
+            current->handle.placeholder == placeholder) {
+            continue;
+        }
+        auto published = std::make_shared<PublishedAtlas>();
+        published->frames = rec.atlasFrames;
+        published->handle.key = key;
+        published->handle.texture = texture;
+        published->handle.placeholder = placeholder;
+        if (rec.atlasFrames) {
+            published->handle.frames = std::span<const AtlasFrame>(*rec.atlasFrames);
+        }
+        view.retire(std::move(rec.publishedAtlas), true);
+        rec.publishedAtlas = std::move(published);
+        rec.publishedShard = ReadView::shardOf(key);
+        changed.emplace_back(&key, &rec);
+    }
+    view.dirtyKeys.clear();
+
+    if (!changed.empty() || !view.removedKeys.empty()) {
+        // Copy-on-write per shard: start from the published shard, then apply removals and updates.
+        std::array<std::shared_ptr<ReadView::RecordShard>, ReadView::kShards> fresh{};
+        auto shardFor = [&](std::size_t shard) -> ReadView::RecordShard& {
+            if (!fresh[shard]) {
+                fresh[shard] = view.ownedRecords[shard] ? std::make_shared<ReadView::RecordShard>(*view.ownedRecords[shard])
+                                                        : std::make_shared<ReadView::RecordShard>();
+            }
+            return *fresh[shard];
+        };
+        for (const auto& key : view.removedKeys) {
+            shardFor(ReadView::shardOf(key)).erase(key);
+        }
+        view.removedKeys.clear();
+        for (const auto& [key, rec] : changed) {
+            shardFor(rec->publishedShard).insert_or_assign(*key, ReadEntry{rec->publishedAtlas->handle.texture, rec->publishedAtlas});
+        }
+        for (std::size_t shard = 0; shard < ReadView::kShards; ++shard) {
+            if (!fresh[shard]) {
+                continue;
+            }
+            view.records[shard].store(fresh[shard].get());
+            view.retire(std::move(view.ownedRecords[shard]), false);
+            view.ownedRecords[shard] = std::move(fresh[shard]);
+        }
+    }
+
+    if (!view.changedAliases.empty()) {
+        std::array<std::shared_ptr<ReadView::AliasShard>, ReadView::kShards> fresh{};
+        for (const auto& alias : view.changedAliases) {
+            auto& shard = fresh[ReadView::shardOf(alias)];
+            if (!shard) {
+                const auto& owned = view.ownedAliases[ReadView::shardOf(alias)];
+                shard = owned ? std::make_shared<ReadView::AliasShard>(*owned) : std::make_shared<ReadView::AliasShard>();
+            }
+            if (auto it = st.aliasToKey.find(alias); it != st.aliasToKey.end()) {
+                shard->insert_or_assign(alias, it->second);
+            } else {
+                shard->erase(alias);
+            }
+        }
+        view.changedAliases.clear();
+        for (std::size_t shard = 0; shard < ReadView::kShards; ++shard) {
+            if (!fresh[shard]) {
+                continue;
+            }
+            view.aliases[shard].store(fresh[shard].get());
+            view.retire(std::move(view.ownedAliases[shard]), false);
+            view.ownedAliases[shard] = std::move(fresh[shard]);
+        }
+    }
+
+    TextureMetrics metrics = computeMetricsSnapshot(st);
+    if (!view.ownedMetrics || !(*view.ownedMetrics == metrics)) {
+        auto published = std::make_shared<const TextureMetrics>(std::move(metrics));
+        view.metrics.store(published.get());
+        view.retire(std::move(view.ownedMetrics), false);
+        view.ownedMetrics = std::move(published);
+    }
+    view.reclaim(false);
+}
+
+// Declared right after taking ManagerState::mutex in every mutating entry point so the read view
+// is republished before the lock is released, including on early returns.
+struct ReadViewPublisher {
+    explicit ReadViewPublisher(ManagerState& state) : st(state) {}
+    ~ReadViewPublisher() { publishReadView(st); }
+    ReadViewPublisher(const ReadViewPublisher&) = delete;
+    ReadViewPublisher& operator=(const ReadViewPublisher&) = delete;
+
+    ManagerState& st;
+};
+
+// Drops a record from the read view and the metric totals; the caller is about to erase or rekey
+// it (a rekeyed record is marked dirty again under its new key).
+void unpublishRecord(ManagerState& st, const std::string& key, TextureRecord& rec) {
+    st.recordCounts -= rec.publishedCounts;
+    rec.publishedCounts = RecordCounts{};
+    rec.viewDirty = false;
+    if (rec.publishedAtlas) {
+        st.readView.removedKeys.push_back(key);
+        st.readView.retire(std::move(rec.publishedAtlas), true);
+    }
+}
+
+const ReadEntry* findReadEntry(const ReadView& view, std::string_view canonicalKey) {
+    std::string_view target = canonicalKey;
+    if (const auto* aliases = view.aliases[ReadView::shardOf(canonicalKey)].load()) {
+        if (auto it = aliases->find(canonicalKey); it != aliases->end()) {
+            target = it->second;
+        }
+    }
+    if (const auto* records = view.records[ReadView::shardOf(target)].load()) {
+        if (auto it = records->find(target); it != records->end()) {
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+// Lock-free counterpart of resolveRecordKey() + records.find(). Keys that are already canonical
+// (the common case: keys returned by acquire*) are looked up without allocating.
+const ReadEntry* findReadEntry(const ReadView& view, const std::string& key) {
+    const bool canonical = std::none_of(key.begin(), key.end(), [](unsigned char ch) {
+        return ch == '\\' || std::tolower(ch) != ch;
+    });
+    if (canonical) {
+        return findReadEntry(view, std::string_view(key));
+    }
+    const std::string canonicalKey = canonicalizeKey(key);
+    return findReadEntry(view, std::string_view(canonicalKey));
+}
+
+void unwatchRecord(ManagerState& st, TextureRecord& rec) {
+    if (st.watcher) {
+        for (const auto& path : rec.watchedPaths) {
+            st.watcher->unwatch(path);
+        }
+    }
+    rec.watchedPaths.clear();
+}
+
+void eraseRecord(ManagerState& st, std::unordered_map<std::string, TextureRecord>::iterator it) {
+    const std::string key = it->first;
+    auto& rec = it->second;
+    untrackUnreferenced(st, rec);
+    unpublishRecord(st, key, rec);
+    unwatchRecord(st, rec);
+    if (rec.texture && rec.ownsTexture) {
+        UnloadTexture(*rec.texture);
+    }
+    subtractBytes(st, rec.byteSize);
+    releaseAtlasSlot(rec);
+    st.records.erase(it);
+    unbindAliasesForKey(st, key);
+}
+
+// Evicts unreferenced textures oldest-first until the budget is met. Referenced textures are
+// never evicted, so the budget can still be exceeded; that case is reported once.
+void enforceBudget(ManagerState& st) {
+    if (st.settings.maxBytes == 0) {
+        return;
+    }
+    while (st.totalBytes > st.settings.maxBytes && !st.lru.empty()) {
+        auto it = st.records.find(st.lru.front());
+        if (it == st.records.end()) {
+            st.lru.pop_front();
+            continue;
+        }
+        const std::size_t bytes = it->second.byteSize;
+        LogManager::debug("Evicting unreferenced texture '{}' ({} bytes)", it->first, bytes);
+        eraseRecord(st, it);
+        st.evictions++;
+        st.evictedBytes += bytes;
+    }
+    if (st.totalBytes > st.settings.maxBytes && !st.overBudgetNotified) {
+        LogManager::warn("Texture budget exceeded: {} bytes > configured cap {} bytes (all resident textures are referenced)",
+                         st.totalBytes,
+                         st.settings.maxBytes);
+        st.overBudgetNotified = true;
+    }
+}
+
+// Called when a record's refCount reaches zero. With a budget configured the texture stays
+// resident (most recently released at the back of the LRU); otherwise it is unloaded right away.
+void handleUnreferenced(ManagerState& st, std::unordered_map<std::string, TextureRecord>::iterator it) {
+    auto& rec = it->second;
+    if (rec.placeholder && !rec.pending) {
+        return;
+    }
+    if (st.settings.maxBytes > 0 && !rec.pending) {
+        untrackUnreferenced(st, rec);
+        st.lru.push_back(it->first);
+        rec.lruEntry = std::prev(st.lru.end());
+        markRecordDirty(st, it->first, rec);
+        enforceBudget(st);
+        return;
+    }
+    if (rec.texture && rec.ownsTexture) {
+        LogManager::info("Unloaded texture '{}' (key '{}')", rec.resolvedPath, it->first);
+    }
+    eraseRecord(st, it);
+}
+
 TextureRecord* rekeyRecord(ManagerState& st, const std::string& oldKey, const std::string& newKey) {
     if (oldKey == newKey) {
         auto it = st.records.find(newKey);
@@ -620,6 +1815,7 @@ TextureRecord* rekeyRecord(ManagerState& st, const std::string& oldKey, const st
     if (newIt != st.records.end()) {
         auto& dst = newIt->second;
         auto& src = oldIt->second;
+        untrackUnreferenced(st, src);
         dst.refCount += src.refCount;
         if (!dst.texture && src.texture) {
             dst.texture = std::move(src.texture);
@@ -638,19 +1834,23 @@ TextureRecord* rekeyRecord(ManagerState& st, const std::string& oldKey, const st
             if (!dst.atlasFrames || dst.atlasFrames->empty()) {
                 dst.atlasFrames = std::move(src.atlasFrames);
                 dst.atlasLookup = std::move(src.atlasLookup);
+                dst.bakedAtlas = std::move(src.bakedAtlas);
                 dst.atlasPlaceholder = src.atlasPlaceholder;
             }
         }
-        if (src.cachedAtlasHandle) {
-            dst.cachedAtlasHandle = std::move(src.cachedAtlasHandle);
-        }
         if (src.atlasJsonPath) {
             dst.atlasJsonPath = src.atlasJsonPath;
         }
+        releaseAtlasSlot(src);
+        republishAtlasFrames(dst);
+        markRecordDirty(st, newKey, dst);
+        unpublishRecord(st, oldKey, src);
+        unwatchRecord(st, src);
         st.records.erase(oldIt);
         for (auto& [aliasKey, mapped] : st.aliasToKey) {
             if (mapped == oldKey) {
                 mapped = newKey;
+                markAliasDirty(st, aliasKey);
             }
         }
         return &dst;
@@ -661,10 +1861,16 @@ TextureRecord* rekeyRecord(ManagerState& st, const std::string& oldKey, const st
         return nullptr;
     }
     node.key() = newKey;
+    if (node.mapped().lruEntry) {
+        **node.mapped().lruEntry = newKey;
+    }
+    unpublishRecord(st, oldKey, node.mapped());
     auto insertResult = st.records.insert(std::move(node));
+    markRecordDirty(st, newKey, insertResult.position->second);
     for (auto& [aliasKey, mapped] : st.aliasToKey) {
         if (mapped == oldKey) {
             mapped = newKey;
+            markAliasDirty(st, aliasKey);
         }
     }
     return &insertResult.position->second;
@@ -688,7 +1894,7 @@ bool reloadAtlasMetadata(const std::string& key, TextureRecord& rec, ManagerStat
         return false;
     }
 
-    auto definition = loadAtlasDefinition(jsonPath);
+    auto definition = loadAtlas(st.settings, jsonPath);
     if (!definition) {
         LogManager::error("Texture atlas '{}' failed to reload for '{}'", jsonPath.string(), key);
         setAtlasPlaceholder(rec);
@@ -704,14 +1910,473 @@ bool reloadAtlasMetadata(const std::string& key, TextureRecord& rec, ManagerStat
 }
 
 void purgeAtlasMetadata(TextureRecord& rec) {
-    if (rec.atlasFrames) {
-        rec.atlasFrames->clear();
-        rec.atlasFrames.reset();
-    }
+    releaseAtlasSlot(rec);
+    rec.atlasFrames.reset();
     rec.atlasLookup.clear();
+    rec.bakedAtlas.reset();
     rec.atlasPlaceholder = false;
     rec.atlasJsonPath.reset();
-    rec.cachedAtlasHandle.reset();
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reloads one record and appends its timing to `result`. With reloadTexture the image is decoded
+// again and the atlas metadata follows when `reloadAtlas` is set or the atlas fell back to a
+// placeholder; without it only the atlas JSON is re-parsed.
+void reloadRecord(ManagerState& st, const std::string& key, TextureRecord& rec, bool reloadTexture, bool reloadAtlas,
+                  ReloadResult& result) {
+    const auto start = std::chrono::steady_clock::now();
+    markRecordDirty(st, key, rec);
+    ReloadTiming timing;
+    timing.key = key;
+    timing.texture = reloadTexture;
+    result.attempted++;
+
+    if (!reloadTexture) {
+        timing.atlas = true;
+        timing.succeeded = reloadAtlasMetadata(key, rec, st);
+        if (timing.succeeded) {
+            result.succeeded++;
+        } else {
+            result.placeholders++;
+        }
+        timing.milliseconds = millisecondsSince(start);
+        result.timings.push_back(std::move(timing));
+        return;
+    }
+
+    std::optional<std::filesystem::path> path;
+    if (!rec.resolvedPath.empty()) {
+        path = std::filesystem::path(rec.resolvedPath);
+    } else {
+        path = resolvePath(st, rec.originalIdentifier);
+    }
+
+    if (!path) {
+        result.placeholders++;
+        rec.placeholder = true;
+        rec.texture.reset();
+        rec.ownsTexture = false;
+        rec.byteSize = 0;
+        LogManager::warn("Reload skipped for '{}' — no resolved path", key);
+        setAtlasPlaceholder(rec);
+    } else if (auto loaded = loadTextureFromDisk(st, *path)) {
+        applyLoadedTexture(rec, st, *loaded, *path);
+        result.succeeded++;
+        timing.succeeded = true;
+        LogManager::info("Reloaded texture '{}' from '{}'", key, path->string());
+        if (rec.atlasJsonPath) {
+            if (reloadAtlas || rec.atlasPlaceholder) {
+                timing.atlas = true;
+                reloadAtlasMetadata(key, rec, st);
+            }
+        } else if (rec.atlasFrames && rec.atlasFrames->size() > 0) {
+            setAtlasPlaceholder(rec);
+        }
+    } else {
+        result.placeholders++;
+        rec.placeholder = true;
+        if (rec.texture && rec.ownsTexture) {
+            UnloadTexture(*rec.texture);
+        }
+        subtractBytes(st, rec.byteSize);
+        rec.texture.reset();
+        rec.ownsTexture = false;
+        rec.byteSize = 0;
+        rec.resolvedPath = path->string();
+        LogManager::error("Reload failed for '{}' ({}); placeholder in use", key, path->string());
+        setAtlasPlaceholder(rec);
+    }
+
+    timing.milliseconds = millisecondsSince(start);
+    result.timings.push_back(std::move(timing));
+}
+
+// Reloads the records whose texture or atlas JSON is among `changed` (paths as reported by the
+// watcher). Records still waiting on an async decode are skipped; the decode reads the new file.
+ReloadResult reloadChangedPaths(ManagerState& st, const std::vector<std::filesystem::path>& changed) {
+    const auto start = std::chrono::steady_clock::now();
+    ReloadResult result;
+    std::unordered_map<std::string, bool> changedPaths;
+    for (const auto& path : changed) {
+        changedPaths.emplace(path.string(), true);
+        st.resolver.invalidatePath(path);
+    }
+    auto isChanged = [&](const std::string& path) {
+        return !path.empty() && changedPaths.count(gb2d::filesystem::normalizeWatchPath(path)) > 0;
+    };
+
+    for (auto& [key, rec] : st.records) {
+        const bool textureChanged = !rec.pending && isChanged(rec.resolvedPath);
+        const bool atlasChanged = rec.atlasJsonPath && isChanged(rec.atlasJsonPath->string());
+        if (!textureChanged && !atlasChanged) {
+            result.unchanged++;
+            continue;
+        }
+        reloadRecord(st, key, rec, textureChanged, atlasChanged, result);
+    }
+    enforceBudget(st);
+    result.totalMs = millisecondsSince(start);
+    return result;
+}
+
+void finishPendingSynchronously(const std::string& key, TextureRecord& rec, ManagerState& st) {
+    markRecordDirty(st, key, rec);
+    rec.pending = false;
+    rec.pendingTicket = 0;
+    if (rec.resolvedPath.empty()) {
+        return;
+    }
+    std::filesystem::path path(rec.resolvedPath);
+    if (auto loaded = loadTextureFromDisk(st, path)) {
+        applyLoadedTexture(rec, st, *loaded, path);
+        LogManager::info("Loaded texture '{}' as '{}'", path.string(), key);
+    } else {
+        LogManager::error("Failed to load texture '{}' (key '{}'), using placeholder", path.string(), key);
+    }
+}
+
+std::size_t processUploadsLocked(ManagerState& st, std::size_t maxUploads, double budgetMs) {
+    const auto started = std::chrono::steady_clock::now();
+    std::size_t uploaded = 0;
+    while (maxUploads == 0 || uploaded < maxUploads) {
+        if (budgetMs > 0.0 && uploaded > 0) {
+            const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+            if (elapsedMs >= budgetMs) {
+                break;
+            }
+        }
+        auto decoded = st.decoder.popCompleted();
+        if (!decoded) {
+            break;
+        }
+        auto it = st.records.find(decoded->key);
+        if (it == st.records.end() || !it->second.pending || it->second.pendingTicket != decoded->ticket) {
+            releaseDecodedImage(*decoded);
+            continue;
+        }
+        auto& rec = it->second;
+        markRecordDirty(st, it->first, rec);
+        std::optional<TextureManager::LoadedTexture> loaded;
+        if (decoded->image) {
+            loaded = uploadDecodedImage(st, *decoded->image, decoded->path);
+        }
+        releaseDecodedImage(*decoded);
+        if (loaded) {
+            applyLoadedTexture(rec, st, *loaded, decoded->path);
+            LogManager::info("Loaded texture '{}' as '{}' (async)", decoded->path.string(), decoded->key);
+        } else {
+            rec.pending = false;
+            rec.pendingTicket = 0;
+            LogManager::error("Failed to load texture '{}' (key '{}'), using placeholder", decoded->path.string(), decoded->key);
+        }
+        uploaded++;
+    }
+    if (uploaded > 0) {
+        enforceBudget(st);
+    }
+    return uploaded;
+}
+
+AcquireResult acquireLocked(ManagerState& st,
+                            const std::string& identifier,
+                            const std::optional<std::string>& alias,
+                            bool async) {
+    auto resolved = resolvePath(st, identifier);
+    std::string aliasKey;
+    if (alias && !alias->empty()) {
+        aliasKey = canonicalizeKey(*alias);
+    }
+
+    std::string canonicalKey;
+    bool canonicalFromAlias = false;
+    bool canonicalFromIdentifierAlias = false;
+
+    if (!aliasKey.empty()) {
+        auto aliasIt = st.aliasToKey.find(aliasKey);
+        if (aliasIt != st.aliasToKey.end()) {
+            canonicalKey = aliasIt->second;
+            canonicalFromAlias = true;
+        }
+    }
+
+    if (canonicalKey.empty()) {
+        std::string identifierKey = resolveRecordKey(st, identifier);
+        if (identifierKey != canonicalizeKey(identifier)) {
+            canonicalKey = identifierKey;
+            canonicalFromIdentifierAlias = true;
+        }
+    }
+
+    if (canonicalKey.empty()) {
+        if (resolved) {
+            canonicalKey = canonicalizePath(*resolved);
+        } else {
+            canonicalKey = canonicalizeKey(identifier);
+        }
+    }
+
+    auto found = st.records.find(canonicalKey);
+    if (found == st.records.end() && canonicalFromAlias) {
+        unbindAlias(st, aliasKey);
+        canonicalKey.clear();
+        if (resolved) {
+            canonicalKey = canonicalizePath(*resolved);
+        } else {
+            canonicalKey = canonicalizeKey(identifier);
+        }
+        found = st.records.find(canonicalKey);
+    }
+    auto identifierKeyCanon = canonicalizeKey(identifier);
+    if (identifierKeyCanon != canonicalKey) {
+        bindAlias(st, identifierKeyCanon, canonicalKey);
+    }
+    if (found == st.records.end() && canonicalFromIdentifierAlias) {
+        unbindAlias(st, canonicalizeKey(identifier));
+        canonicalKey.clear();
+        if (resolved) {
+            canonicalKey = canonicalizePath(*resolved);
+        } else {
+            canonicalKey = canonicalizeKey(identifier);
+        }
+        found = st.records.find(canonicalKey);
+    }
+
+    if (!aliasKey.empty()) {
+        bindAlias(st, aliasKey, canonicalKey);
+    }
+    if (found != st.records.end()) {
+        auto& rec = found->second;
+        untrackUnreferenced(st, rec);
+        markRecordDirty(st, found->first, rec);
+        rec.refCount++;
+        st.cacheHits++;
+        if (rec.pending && !async) {
+            // A synchronous caller needs the real texture now; the queued decode becomes stale.
+            finishPendingSynchronously(canonicalKey, rec, st);
+            enforceBudget(st);
+        }
+        return AcquireResult{canonicalKey, texturePtr(rec, st), rec.placeholder, false, rec.pending};
+    }
+
+    st.cacheMisses++;
+    TextureRecord rec;
+    rec.refCount = 1;
+    rec.originalIdentifier = identifier;
+    rec.resolvedPath = resolved ? resolved->string() : std::string{};
+
+    if (async && resolved && (st.testDecoder || (!st.testLoader && isAsyncDecodable(*resolved)))) {
+        rec.placeholder = true;
+        rec.pending = true;
+        rec.pendingTicket = ++st.nextDecodeTicket;
+        st.decoder.start(st.settings.asyncWorkers);
+        st.decoder.enqueue(DecodeJob{canonicalKey, *resolved, rec.pendingTicket, st.testDecoder,
+                                     st.settings.compressedUpload, st.decodedCache});
+        LogManager::debug("Queued async decode for texture '{}' (key '{}')", resolved->string(), canonicalKey);
+        auto [it, inserted] = st.records.emplace(canonicalKey, std::move(rec));
+        (void)inserted;
+        markRecordDirty(st, it->first, it->second);
+        return AcquireResult{canonicalKey, texturePtr(it->second, st), true, true, true};
+    }
+
+    if (resolved) {
+        if (auto loaded = loadTextureFromDisk(st, *resolved)) {
+            applyLoadedTexture(rec, st, *loaded, *resolved);
+            LogManager::info("Loaded texture '{}' as '{}'", resolved->string(), canonicalKey);
+        } else {
+            LogManager::error("Failed to load texture '{}' (key '{}'), using placeholder", resolved->string(), canonicalKey);
+            rec.placeholder = true;
+        }
+    } else {
+        LogManager::warn("Texture '{}' not found in configured search paths; using placeholder", identifier);
+        rec.placeholder = true;
+    }
+
+    auto [it, inserted] = st.records.emplace(canonicalKey, std::move(rec));
+    (void)inserted;
+    markRecordDirty(st, it->first, it->second);
+    enforceBudget(st);
+    const Texture2D* ptr = texturePtr(it->second, st);
+    return AcquireResult{canonicalKey, ptr, it->second.placeholder, true, false};
+}
+
+
+std::optional<std::size_t> createSpritePage(ManagerState& st) {
+    const int size = st.settings.packPageSize;
+    auto page = std::make_unique<SpritePage>(size, st.settings.packPadding);
+
+    Image blank{};
+    blank.data = MemAlloc(static_cast<unsigned int>(size) * static_cast<unsigned int>(size) * 4u);
+    blank.width = size;
+    blank.height = size;
+    blank.mipmaps = 1;
+    blank.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    std::optional<TextureManager::LoadedTexture> loaded;
+    if (st.testUploader) {
+        loaded = st.testUploader(blank, false, st.settings.filterMode);
+    } else {
+        Texture2D handle = LoadTextureFromImage(blank);
+        if (handle.id != 0) {
+            SetTextureFilter(handle, st.settings.filterMode);
+            loaded = TextureManager::LoadedTexture{handle, estimateTextureBytes(handle), true};
+        }
+    }
+    UnloadImage(blank);
+    if (!loaded) {
+        LogManager::error("Failed to create {}x{} sprite page texture", size, size);
+        return std::nullopt;
+    }
+
+    page->texture = std::make_unique<Texture2D>(loaded->texture);
+    page->ownsTexture = loaded->ownsTexture;
+    page->bytes = loaded->bytes;
+    st.totalBytes += page->bytes;
+
+    for (std::size_t i = 0; i < st.spritePages.size(); ++i) {
+        if (!st.spritePages[i]) {
+            st.spritePages[i] = std::move(page);
+            return i;
+        }
+    }
+    st.spritePages.push_back(std::move(page));
+    return st.spritePages.size() - 1;
+}
+
+void destroySpritePage(ManagerState& st, std::size_t index) {
+    auto& page = st.spritePages[index];
+    if (!page) {
+        return;
+    }
+    if (page->texture && page->ownsTexture) {
+        UnloadTexture(*page->texture);
+    }
+    subtractBytes(st, page->bytes);
+    page.reset();
+}
+
+std::optional<std::pair<std::size_t, PackedRect>> packSprite(ManagerState& st, Image& image) {
+    std::optional<std::pair<std::size_t, PackedRect>> placement;
+    for (std::size_t i = 0; i < st.spritePages.size() && !placement; ++i) {
+        if (!st.spritePages[i]) {
+            continue;
+        }
+        if (auto rect = st.spritePages[i]->packer.insert(image.width, image.height)) {
+            placement.emplace(i, *rect);
+        }
+    }
+    if (!placement) {
+        auto index = createSpritePage(st);
+        if (!index) {
+            return std::nullopt;
+        }
+        auto rect = st.spritePages[*index]->packer.insert(image.width, image.height);
+        if (!rect) {
+            destroySpritePage(st, *index);
+            return std::nullopt;
+        }
+        placement.emplace(*index, *rect);
+    }
+
+    auto& page = *st.spritePages[placement->first];
+    if (image.data != nullptr && !st.testUploader) {
+        if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+        const auto& rect = placement->second;
+        UpdateTextureRec(*page.texture,
+                         Rectangle{static_cast<float>(rect.x), static_cast<float>(rect.y),
+                                   static_cast<float>(rect.width), static_cast<float>(rect.height)},
+                         image.data);
+    }
+    page.liveSprites++;
+    return placement;
+}
+
+// Creates a standalone record from an image that was decoded for packing but turned out too large,
+// so the file is not decoded a second time.
+std::string adoptDecodedImage(ManagerState& st, const std::string& key, const std::string& identifier,
+                              const std::filesystem::path& path, const Image& image) {
+    st.cacheMisses++;
+    TextureRecord rec;
+    rec.refCount = 1;
+    rec.originalIdentifier = identifier;
+    rec.resolvedPath = path.string();
+    if (auto loaded = uploadDecodedImage(st, image, path)) {
+        applyLoadedTexture(rec, st, *loaded, path);
+        LogManager::info("Loaded texture '{}' as '{}'", path.string(), key);
+    } else {
+        LogManager::error("Failed to load texture '{}' (key '{}'), using placeholder", path.string(), key);
+        rec.placeholder = true;
+    }
+    auto [it, inserted] = st.records.emplace(key, std::move(rec));
+    (void)inserted;
+    markRecordDirty(st, it->first, it->second);
+    enforceBudget(st);
+    return key;
+}
+
+TextureAtlasHandle makeSpriteHandle(const std::string& key, const SpriteEntry& entry, const ManagerState& st, bool newlyLoaded) {
+    TextureAtlasHandle handle;
+    handle.key = key;
+    handle.newlyLoaded = newlyLoaded;
+    handle.placeholder = entry.placeholder;
+    if (entry.page && *entry.page < st.spritePages.size() && st.spritePages[*entry.page]) {
+        handle.texture = st.spritePages[*entry.page]->texture.get();
+    } else if (auto it = st.records.find(entry.textureKey); it != st.records.end()) {
+        handle.texture = texturePtr(it->second, st);
+        handle.placeholder = handle.placeholder || it->second.placeholder;
+    } else {
+        handle.texture = st.placeholderReady ? &st.placeholder : nullptr;
+    }
+    if (entry.frame) {
+        handle.frames = std::span<const AtlasFrame>(entry.frame.get(), 1);
+    }
+    return handle;
+}
+
+void releasePreloadKeys(ManagerState& st, const std::vector<std::string>& keys) {
+    for (const auto& key : keys) {
+        auto it = st.records.find(key);
+        if (it == st.records.end() || it->second.refCount == 0) {
+            continue;
+        }
+        if (--it->second.refCount == 0) {
+            handleUnreferenced(st, it);
+        }
+    }
+}
+
+// Reload hook: picks up textures::search_paths edits without a restart. Resolved identifiers are
+// dropped only when the roots actually changed.
+void applySearchPathsFromConfig() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    if (!st.initialized) {
+        return;
+    }
+    auto paths = loadSearchPaths();
+    if (st.resolver.setSearchPaths(paths)) {
+        st.settings.searchPaths = std::move(paths);
+        LogManager::info("Texture search paths changed ({} roots); path cache cleared", st.settings.searchPaths.size());
+    }
+}
+
+void applyAsyncWorkersFromConfig() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return;
+    }
+    const auto workers = static_cast<std::size_t>(std::max<std::int64_t>(ConfigurationManager::getInt("textures::async_workers", 2), 1));
+    if (workers != st.settings.asyncWorkers) {
+        st.settings.asyncWorkers = workers;
+        st.decoder.resize(workers);
+        LogManager::info("Texture decode workers set to {}", workers);
+    }
 }
 
 } // namespace
@@ -719,11 +2384,21 @@ void purgeAtlasMetadata(TextureRecord& rec) {
 bool TextureManager::init() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (st.initialized) {
         return true;
     }
 
     st.settings = loadSettings();
+    st.resolver.setSearchPaths(st.settings.searchPaths);
+    ConfigurationManager::pushReloadHook({
+        .name = "TextureManager::search_paths",
+        .callback = []() { applySearchPathsFromConfig(); }
+    });
+    ConfigurationManager::pushReloadHook({
+        .name = "TextureManager::async_workers",
+        .callback = []() { applyAsyncWorkersFromConfig(); }
+    });
     if (!st.placeholderReady) {
         if (auto placeholder = generatePlaceholderTexture(st)) {
             st.placeholder = placeholder->texture;
@@ -737,6 +2412,27 @@ bool TextureManager::init() {
         }
     }
 
+    if (st.settings.hotReload) {
+        gb2d::filesystem::FileWatcher::Options options;
+        options.backend = st.settings.hotReloadPolling ? gb2d::filesystem::FileWatcher::Backend::Polling
+                                                       : gb2d::filesystem::FileWatcher::Backend::Auto;
+        options.debounce = std::chrono::milliseconds(st.settings.hotReloadDebounceMs);
+        options.pollInterval = std::chrono::milliseconds(st.settings.hotReloadPollMs);
+        st.watcher = std::make_unique<gb2d::filesystem::FileWatcher>(options);
+        LogManager::info("Texture hot reload enabled ({})", st.watcher->nativeEvents() ? "inotify" : "polling");
+    }
+
+    if (st.settings.decodedCacheDir) {
+        st.decodedCache = std::make_shared<DecodedImageCache>(*st.settings.decodedCacheDir);
+        LogManager::info("Decoded image cache at '{}'", st.settings.decodedCacheDir->string());
+        if (st.settings.decodedCacheMaxBytes > 0) {
+            if (const auto pruned = st.decodedCache->prune(st.settings.decodedCacheMaxBytes); pruned > 0) {
+                LogManager::info("Pruned {} decoded image cache file(s) to stay under {} bytes", pruned,
+                                 st.settings.decodedCacheMaxBytes);
+            }
+        }
+    }
+
     st.initialized = true;
     LogManager::info("TextureManager initialized (search paths={}, mipmaps={}, filter={}, atlasDumpLogging={})",
                      st.settings.searchPaths.size(),
@@ -749,10 +2445,18 @@ bool TextureManager::init() {
 void TextureManager::shutdown() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return;
     }
 
+    st.decoder.stop();
+    for (std::size_t i = 0; i < st.spritePages.size(); ++i) {
+        destroySpritePage(st, i);
+    }
+    st.spritePages.clear();
+    st.sprites.clear();
+    st.spriteAliases.clear();
     for (auto& entry : st.records) {
         auto& rec = entry.second;
         if (rec.texture && rec.ownsTexture) {
@@ -761,9 +2465,24 @@ void TextureManager::shutdown() {
         purgeAtlasMetadata(rec);
     }
     st.records.clear();
+    st.recordCounts = RecordCounts{};
+    st.frameDirectory.clear();
     st.aliasToKey.clear();
+    st.lru.clear();
+    st.watcher.reset();
+    st.hotReloads = 0;
+    st.lastHotReload = ReloadResult{};
+    st.transcodedTextures = 0;
+    st.decodedCache.reset();
+    st.preloads.clear();
+    st.resolver.clear();
+    st.resolver.resetStats();
     st.totalBytes = 0;
     st.overBudgetNotified = false;
+    st.evictions = 0;
+    st.evictedBytes = 0;
+    st.cacheHits = 0;
+    st.cacheMisses = 0;
 
     if (st.placeholderReady && st.placeholderOwns && st.placeholder.id != 0) {
         UnloadTexture(st.placeholder);
@@ -787,101 +2506,147 @@ AcquireResult TextureManager::acquire(const std::string& identifier, std::option
 
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return {};
     }
+    return acquireLocked(st, identifier, alias, false);
+}
 
-    auto resolved = resolvePath(identifier, st.settings);
-    std::string aliasKey;
-    if (alias && !alias->empty()) {
-        aliasKey = canonicalizeKey(*alias);
+AcquireResult TextureManager::acquireAsync(const std::string& identifier, std::optional<std::string> alias) {
+    if (!isInitialized()) {
+        init();
     }
 
-    std::string canonicalKey;
-    bool canonicalFromAlias = false;
-    bool canonicalFromIdentifierAlias = false;
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return {};
+    }
+    return acquireLocked(st, identifier, alias, true);
+}
 
-    if (!aliasKey.empty()) {
-        auto aliasIt = st.aliasToKey.find(aliasKey);
-        if (aliasIt != st.aliasToKey.end()) {
-            canonicalKey = aliasIt->second;
-            canonicalFromAlias = true;
-        }
+std::size_t TextureManager::processPendingUploads(std::size_t maxUploads, double budgetMs) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return 0;
     }
+    return processUploadsLocked(st, maxUploads, budgetMs);
+}
 
-    if (canonicalKey.empty()) {
-        std::string identifierKey = resolveRecordKey(st, identifier);
-        if (identifierKey != canonicalizeKey(identifier)) {
-            canonicalKey = identifierKey;
-            canonicalFromIdentifierAlias = true;
+bool TextureManager::waitForPendingDecodes(std::chrono::milliseconds timeout) {
+    auto& st = state();
+    std::unique_lock lock(st.decoder.mutex);
+    return st.decoder.idle.wait_for(lock, timeout, [&st]() {
+        return st.decoder.jobs.empty() && st.decoder.busy == 0;
+    });
+}
+
+void TextureManager::tick() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return;
+    }
+    processUploadsLocked(st, st.settings.asyncUploadsPerFrame, st.settings.asyncUploadBudgetMs);
+    if (st.watcher) {
+        auto changed = st.watcher->poll();
+        if (!changed.empty()) {
+            st.lastHotReload = reloadChangedPaths(st, changed);
+            st.hotReloads++;
+            LogManager::info("Hot reload: {} file(s) changed, {} record(s) reloaded in {:.2f} ms",
+                             changed.size(),
+                             st.lastHotReload.attempted,
+                             st.lastHotReload.totalMs);
         }
     }
+    st.frameDirectory.advanceTick();
+    st.readView.ticks++;
+}
 
-    if (canonicalKey.empty()) {
-        if (resolved) {
-            canonicalKey = canonicalizePath(*resolved);
-        } else {
-            canonicalKey = canonicalizeKey(identifier);
-        }
+PreloadResult TextureManager::preloadGroup(const std::string& group, std::chrono::milliseconds timeout) {
+    if (!isInitialized()) {
+        init();
     }
 
-    auto found = st.records.find(canonicalKey);
-    if (found == st.records.end() && canonicalFromAlias) {
-        unbindAlias(st, aliasKey);
-        canonicalKey.clear();
-        if (resolved) {
-            canonicalKey = canonicalizePath(*resolved);
-        } else {
-            canonicalKey = canonicalizeKey(identifier);
+    const auto started = std::chrono::steady_clock::now();
+    PreloadResult result;
+    result.group = group;
+    auto& st = state();
+    std::size_t hitsBefore = 0;
+    {
+        std::scoped_lock lock(st.mutex);
+        ReadViewPublisher publisher(st);
+        if (!st.initialized || st.preloads.contains(group)) {
+            return result;
         }
-        found = st.records.find(canonicalKey);
-    }
-        auto identifierKeyCanon = canonicalizeKey(identifier);
-        if (identifierKeyCanon != canonicalKey) {
-            bindAlias(st, identifierKeyCanon, canonicalKey);
+        auto manifest = st.settings.preloadGroups.find(group);
+        if (manifest == st.settings.preloadGroups.end()) {
+            return result;
         }
-    if (found == st.records.end() && canonicalFromIdentifierAlias) {
-        unbindAlias(st, canonicalizeKey(identifier));
-        canonicalKey.clear();
-        if (resolved) {
-            canonicalKey = canonicalizePath(*resolved);
-        } else {
-            canonicalKey = canonicalizeKey(identifier);
+        hitsBefore = st.decodedCache ? st.decodedCache->hits() : 0;
+        // Everything is queued before waiting so the decode workers run in parallel.
+        auto& held = st.preloads[group];
+        for (const auto& identifier : manifest->second) {
+            auto acquired = acquireLocked(st, identifier, std::nullopt, true);
+            if (!acquired.key.empty()) {
+                held.push_back(acquired.key);
+            }
         }
-        found = st.records.find(canonicalKey);
+        result.requested = manifest->second.size();
     }
 
-    if (!aliasKey.empty()) {
-        bindAlias(st, aliasKey, canonicalKey);
+    waitForPendingDecodes(timeout);
+
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return result;
     }
-    if (found != st.records.end()) {
-        auto& rec = found->second;
-        rec.refCount++;
-        return AcquireResult{canonicalKey, texturePtr(rec, st), rec.placeholder, false};
+    processUploadsLocked(st, 0, 0.0);
+    if (auto held = st.preloads.find(group); held != st.preloads.end()) {
+        for (const auto& key : held->second) {
+            auto it = st.records.find(key);
+            if (it != st.records.end() && !it->second.placeholder) {
+                result.loaded++;
+            } else {
+                result.placeholders++;
+            }
+        }
     }
+    if (st.decodedCache) {
+        result.decodedCacheHits = st.decodedCache->hits() - hitsBefore;
+    }
+    result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    LogManager::info("Preloaded texture group '{}': {} of {} loaded, {} decoded-cache hits, {:.2f} ms",
+                     group, result.loaded, result.requested, result.decodedCacheHits, result.milliseconds);
+    return result;
+}
 
-    TextureRecord rec;
-    rec.refCount = 1;
-    rec.originalIdentifier = identifier;
-    rec.resolvedPath = resolved ? resolved->string() : std::string{};
-
-    if (resolved) {
-        if (auto loaded = loadTextureFromDisk(st, *resolved)) {
-            applyLoadedTexture(rec, st, *loaded, *resolved);
-            LogManager::info("Loaded texture '{}' as '{}'", resolved->string(), canonicalKey);
-        } else {
-            LogManager::error("Failed to load texture '{}' (key '{}'), using placeholder", resolved->string(), canonicalKey);
-            rec.placeholder = true;
-        }
-    } else {
-        LogManager::warn("Texture '{}' not found in configured search paths; using placeholder", identifier);
-        rec.placeholder = true;
+bool TextureManager::releasePreloadGroup(const std::string& group) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return false;
+    }
+    auto it = st.preloads.find(group);
+    if (it == st.preloads.end()) {
+        return false;
     }
+    releasePreloadKeys(st, it->second);
+    st.preloads.erase(it);
+    return true;
+}
 
-    auto [it, inserted] = st.records.emplace(canonicalKey, std::move(rec));
-    (void)inserted;
-    const Texture2D* ptr = texturePtr(it->second, st);
-    return AcquireResult{canonicalKey, ptr, it->second.placeholder, true};
+bool TextureManager::hasPreloadGroup(const std::string& group) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return st.initialized && st.settings.preloadGroups.contains(group);
 }
 
 TextureAtlasHandle TextureManager::acquireAtlas(const std::string& jsonIdentifier,
@@ -892,14 +2657,15 @@ TextureAtlasHandle TextureManager::acquireAtlas(const std::string& jsonIdentifie
 
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return {};
     }
 
-    auto resolvedJson = resolvePath(jsonIdentifier, st.settings);
+    auto resolvedJson = resolvePath(st, jsonIdentifier);
     std::optional<AtlasDefinition> definition;
     if (resolvedJson) {
-        definition = loadAtlasDefinition(*resolvedJson);
+        definition = loadAtlas(st.settings, *resolvedJson);
         if (!definition) {
             LogManager::error("Texture atlas '{}' failed to load; placeholder will be used", resolvedJson->string());
         }
@@ -974,6 +2740,7 @@ TextureAtlasHandle TextureManager::acquireAtlas(const std::string& jsonIdentifie
         recordWasNew = inserted;
         record = &itRecord->second;
     }
+    markRecordDirty(st, canonicalKey, *record);
 
     if (!aliasKey.empty()) {
         bindAlias(st, aliasKey, canonicalKey);
@@ -1029,7 +2796,14 @@ TextureAtlasHandle TextureManager::acquireAtlas(const std::string& jsonIdentifie
         LogManager::warn("Texture atlas '{}' using placeholder metadata", jsonIdentifier);
     }
 
+    untrackUnreferenced(st, *record);
     record->refCount++;
+    if (recordWasNew || textureLoadedNow) {
+        st.cacheMisses++;
+    } else {
+        st.cacheHits++;
+    }
+    enforceBudget(st);
     bool newlyLoaded = recordWasNew || textureLoadedNow || metadataNewlyLoaded;
     return makeAtlasHandle(canonicalKey, *record, st, newlyLoaded);
 }
@@ -1042,6 +2816,7 @@ TextureAtlasHandle TextureManager::acquireAtlasFromTexture(const std::string& te
 
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return {};
     }
@@ -1059,21 +2834,24 @@ TextureAtlasHandle TextureManager::acquireAtlasFromTexture(const std::string& te
     }
 
     TextureRecord& record = it->second;
+    markRecordDirty(st, canonicalKey, record);
 
-    auto resolvedJson = resolvePath(jsonIdentifier, st.settings);
+    auto resolvedJson = resolvePath(st, jsonIdentifier);
     if (!resolvedJson) {
         LogManager::error("Texture atlas JSON '{}' not found; placeholder will be used", jsonIdentifier);
         setAtlasPlaceholder(record);
         record.atlasJsonPath.reset();
+        untrackUnreferenced(st, record);
         record.refCount++;
         return makeAtlasHandle(canonicalKey, record, st, false);
     }
 
-    auto definition = loadAtlasDefinition(*resolvedJson);
+    auto definition = loadAtlas(st.settings, *resolvedJson);
     if (!definition) {
         LogManager::error("Texture atlas '{}' failed to load; placeholder will be used", resolvedJson->string());
         setAtlasPlaceholder(record);
         record.atlasJsonPath = resolvedJson;
+        untrackUnreferenced(st, record);
         record.refCount++;
         bindAlias(st, canonicalizePath(*resolvedJson), canonicalKey);
         return makeAtlasHandle(canonicalKey, record, st, false);
@@ -1086,6 +2864,7 @@ TextureAtlasHandle TextureManager::acquireAtlasFromTexture(const std::string& te
     assignAtlasFrames(record, std::move(loadedDef));
     LogManager::info("Texture atlas '{}' loaded (frames={})", jsonIdentifier, frameCount);
     record.atlasJsonPath = resolvedJson;
+    untrackUnreferenced(st, record);
     record.refCount++;
     std::string jsonKey = canonicalizePath(*resolvedJson);
     if (jsonKey != canonicalKey) {
@@ -1100,21 +2879,15 @@ TextureAtlasHandle TextureManager::acquireAtlasFromTexture(const std::string& te
 
 const TextureAtlasHandle* TextureManager::tryGetAtlas(const std::string& key) {
     auto& st = state();
-    std::scoped_lock lock(st.mutex);
-    if (!st.initialized) {
-        return nullptr;
-    }
-    auto canonical = resolveRecordKey(st, key);
-    auto it = st.records.find(canonical);
-    if (it == st.records.end()) {
-        return nullptr;
-    }
-    return ensureAtlasHandle(canonical, it->second, st);
+    ReadGuard guard(st.readView.readers);
+    const ReadEntry* entry = findReadEntry(st.readView, key);
+    return entry ? &entry->atlas->handle : nullptr;
 }
 
 bool TextureManager::releaseAtlas(const std::string& key) {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return false;
     }
@@ -1130,13 +2903,8 @@ bool TextureManager::releaseAtlas(const std::string& key) {
         return false;
     }
     rec.refCount--;
-    if (rec.refCount == 0 && !rec.placeholder) {
-        if (rec.texture && rec.ownsTexture) {
-            UnloadTexture(*rec.texture);
-        }
-        subtractBytes(st, rec.byteSize);
-        st.records.erase(it);
-        unbindAliasesForKey(st, canonical);
+    if (rec.refCount == 0) {
+        handleUnreferenced(st, it);
     }
     return true;
 }
@@ -1155,38 +2923,208 @@ std::optional<AtlasFrame> TextureManager::getAtlasFrame(const std::string& atlas
         return std::nullopt;
     }
     const TextureRecord& rec = it->second;
-    if (!rec.atlasFrames || rec.atlasFrames->empty()) {
-        return std::nullopt;
-    }
-    auto nameKey = canonicalizeFrameName(frameName);
-    auto frameIt = rec.atlasLookup.find(nameKey);
-    if (frameIt == rec.atlasLookup.end()) {
+    auto index = findAtlasFrameIndex(rec, frameName);
+    if (!index) {
         return std::nullopt;
     }
-    std::size_t index = frameIt->second;
-    if (index >= rec.atlasFrames->size()) {
-        return std::nullopt;
-    }
-    return (*rec.atlasFrames)[index];
+    return (*rec.atlasFrames)[*index];
 }
 
-const Texture2D* TextureManager::tryGet(const std::string& key) {
+AtlasFrameId TextureManager::resolveAtlasFrame(const std::string& atlasKey, const std::string& frameName) {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
     if (!st.initialized) {
-        return nullptr;
+        return {};
     }
-    auto canonical = resolveRecordKey(st, key);
+
+    auto canonical = resolveRecordKey(st, atlasKey);
     auto it = st.records.find(canonical);
     if (it == st.records.end()) {
-        return nullptr;
+        return {};
+    }
+    TextureRecord& rec = it->second;
+    auto index = findAtlasFrameIndex(rec, frameName);
+    if (!index) {
+        return {};
+    }
+    if (!rec.atlasSlot) {
+        auto slot = st.frameDirectory.acquireSlot();
+        if (!slot) {
+            if (!st.frameDirectory.exhaustedNotified) {
+                st.frameDirectory.exhaustedNotified = true;
+                LogManager::warn("TextureManager: atlas frame id slots exhausted ({}); resolveAtlasFrame returns invalid ids",
+                                 AtlasFrameDirectory::kMaxSlots);
+            }
+            return {};
+        }
+        rec.atlasSlot = *slot;
+        st.frameDirectory.publish(*slot, rec.atlasFrames);
+    }
+
+    AtlasFrameId id;
+    id.slot = *rec.atlasSlot;
+    id.index = static_cast<std::uint32_t>(*index);
+    id.generation = st.frameDirectory.generation(*rec.atlasSlot);
+    return id;
+}
+
+const AtlasFrame* TextureManager::frameById(AtlasFrameId id) {
+    return state().frameDirectory.find(id);
+}
+
+bool TextureManager::bakeAtlas(const std::filesystem::path& jsonPath,
+                               std::optional<std::filesystem::path> outputPath) {
+    auto definition = loadAtlasDefinition(jsonPath);
+    if (!definition) {
+        return false;
+    }
+    const auto target = outputPath ? *outputPath : bakedAtlasPathFor(jsonPath);
+    if (!writeBakedAtlas(*definition, jsonPath, target)) {
+        LogManager::error("Texture atlas '{}' could not be baked to '{}'", jsonPath.string(), target.string());
+        return false;
+    }
+    LogManager::info("Texture atlas '{}' baked to '{}' (frames={})", jsonPath.string(), target.string(), definition->frames.size());
+    return true;
+}
+
+TextureAtlasHandle TextureManager::acquireSprite(const std::string& identifier, std::optional<std::string> alias) {
+    if (!isInitialized()) {
+        init();
+    }
+
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return {};
+    }
+
+    auto resolved = resolvePath(st, identifier);
+    std::string key = resolved ? canonicalizePath(*resolved) : canonicalizeKey(identifier);
+    if (auto aliasIt = st.spriteAliases.find(canonicalizeKey(identifier)); aliasIt != st.spriteAliases.end()) {
+        key = aliasIt->second;
+    }
+    if (alias && !alias->empty()) {
+        st.spriteAliases[canonicalizeKey(*alias)] = key;
+    }
+
+    if (auto found = st.sprites.find(key); found != st.sprites.end()) {
+        found->second.refCount++;
+        return makeSpriteHandle(key, found->second, st, false);
+    }
+
+    SpriteEntry entry;
+    entry.refCount = 1;
+    entry.frame = std::make_unique<AtlasFrame>();
+    entry.frame->originalName = identifier;
+
+    std::optional<Image> image;
+    if (resolved && st.settings.packSmallTextures && !st.records.contains(key)) {
+        image = decodeImageFile(st.testDecoder, *resolved, st.settings.compressedUpload, st.decodedCache.get());
+        if (!image) {
+            LogManager::error("Failed to decode sprite '{}' (key '{}'), using placeholder", resolved->string(), key);
+            entry.placeholder = true;
+        }
+    }
+
+    // Block-compressed sprites stay standalone; packing would expand them into an RGBA8 page.
+    if (image && !isCompressedPixelFormat(image->format) &&
+        image->width <= st.settings.packMaxDimension && image->height <= st.settings.packMaxDimension) {
+        if (auto placement = packSprite(st, *image)) {
+            const auto& rect = placement->second;
+            entry.page = placement->first;
+            entry.frame->frame = Rectangle{static_cast<float>(rect.x), static_cast<float>(rect.y),
+                                           static_cast<float>(rect.width), static_cast<float>(rect.height)};
+            LogManager::debug("Packed sprite '{}' into page {} at [{}, {}, {}, {}]",
+                              key, placement->first, rect.x, rect.y, rect.width, rect.height);
+        }
+    }
+
+    if (!entry.page && !entry.placeholder) {
+        if (image && resolved) {
+            entry.textureKey = adoptDecodedImage(st, key, identifier, *resolved, *image);
+        } else {
+            entry.textureKey = acquireLocked(st, identifier, std::nullopt, false).key;
+        }
+        if (auto it = st.records.find(entry.textureKey); it != st.records.end()) {
+            entry.placeholder = it->second.placeholder;
+            if (const Texture2D* texture = texturePtr(it->second, st)) {
+                entry.frame->frame = Rectangle{0.0f, 0.0f, static_cast<float>(texture->width), static_cast<float>(texture->height)};
+            }
+        }
+    }
+
+    if (image && image->data != nullptr) {
+        UnloadImage(*image);
+    }
+
+    entry.frame->source = Rectangle{0.0f, 0.0f, entry.frame->frame.width, entry.frame->frame.height};
+    auto [it, inserted] = st.sprites.emplace(key, std::move(entry));
+    (void)inserted;
+    return makeSpriteHandle(key, it->second, st, true);
+}
+
+bool TextureManager::releaseSprite(const std::string& key) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return false;
+    }
+    std::string canonical = canonicalizeKey(key);
+    if (auto aliasIt = st.spriteAliases.find(canonical); aliasIt != st.spriteAliases.end()) {
+        canonical = aliasIt->second;
+    }
+    auto it = st.sprites.find(canonical);
+    if (it == st.sprites.end()) {
+        LogManager::warn("TextureManager::releaseSprite called for unknown key '{}'", key);
+        return false;
+    }
+    auto& entry = it->second;
+    if (entry.refCount == 0) {
+        LogManager::warn("TextureManager::releaseSprite over-release detected for key '{}'", key);
+        return false;
+    }
+    entry.refCount--;
+    if (entry.refCount > 0) {
+        return true;
+    }
+
+    if (entry.page) {
+        auto& page = st.spritePages[*entry.page];
+        if (page && page->liveSprites > 0 && --page->liveSprites == 0) {
+            destroySpritePage(st, *entry.page);
+        }
+    } else if (!entry.textureKey.empty()) {
+        auto recordIt = st.records.find(entry.textureKey);
+        if (recordIt != st.records.end() && recordIt->second.refCount > 0) {
+            if (--recordIt->second.refCount == 0) {
+                handleUnreferenced(st, recordIt);
+            }
+        }
+    }
+    st.sprites.erase(it);
+    for (auto aliasIt = st.spriteAliases.begin(); aliasIt != st.spriteAliases.end();) {
+        if (aliasIt->second == canonical) {
+            aliasIt = st.spriteAliases.erase(aliasIt);
+        } else {
+            ++aliasIt;
+        }
     }
-    return texturePtr(it->second, st);
+    return true;
+}
+
+const Texture2D* TextureManager::tryGet(const std::string& key) {
+    auto& st = state();
+    ReadGuard guard(st.readView.readers);
+    const ReadEntry* entry = findReadEntry(st.readView, key);
+    return entry ? entry->texture : nullptr;
 }
 
 bool TextureManager::release(const std::string& key) {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return false;
     }
@@ -1202,15 +3140,8 @@ bool TextureManager::release(const std::string& key) {
         return false;
     }
     rec.refCount--;
-    if (rec.refCount == 0 && !rec.placeholder) {
-        if (rec.texture && rec.ownsTexture) 
-        {
-            LogManager::info("Unloaded texture '{}' (key '{}')", rec.resolvedPath, canonical);
-            UnloadTexture(*rec.texture);
-        }
-        subtractBytes(st, rec.byteSize);
-        st.records.erase(it);
-        unbindAliasesForKey(st, canonical);
+    if (rec.refCount == 0) {
+        handleUnreferenced(st, it);
     }
     return true;
 }
@@ -1218,6 +3149,7 @@ bool TextureManager::release(const std::string& key) {
 bool TextureManager::forceUnload(const std::string& key) {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     if (!st.initialized) {
         return false;
     }
@@ -1226,14 +3158,8 @@ bool TextureManager::forceUnload(const std::string& key) {
     if (it == st.records.end()) {
         return false;
     }
-    auto& rec = it->second;
-    if (rec.texture && rec.ownsTexture) {
-        UnloadTexture(*rec.texture);
-    }
-    purgeAtlasMetadata(rec);
-    subtractBytes(st, rec.byteSize);
-    st.records.erase(it);
-    unbindAliasesForKey(st, canonical);
+    purgeAtlasMetadata(it->second);
+    eraseRecord(st, it);
     LogManager::info("Force-unloaded texture '{}'; future acquire will reload", canonical);
     return true;
 }
@@ -1241,68 +3167,61 @@ bool TextureManager::forceUnload(const std::string& key) {
 ReloadResult TextureManager::reloadAll() {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     ReloadResult result;
     if (!st.initialized) {
         return result;
     }
 
+    const auto start = std::chrono::steady_clock::now();
+    st.resolver.clear();
     for (auto& [key, rec] : st.records) {
-        result.attempted++;
-        std::optional<std::filesystem::path> path;
-        if (!rec.resolvedPath.empty()) {
-            path = std::filesystem::path(rec.resolvedPath);
-        } else {
-            path = resolvePath(rec.originalIdentifier, st.settings);
-        }
-
-        bool textureLoaded = false;
-        if (!path) {
-            result.placeholders++;
-            rec.placeholder = true;
-            rec.texture.reset();
-            rec.ownsTexture = false;
-            rec.byteSize = 0;
-            LogManager::warn("Reload skipped for '{}' — no resolved path", key);
-            setAtlasPlaceholder(rec);
-            continue;
-        }
+        reloadRecord(st, key, rec, true, true, result);
+    }
+    if (st.watcher) {
+        // Everything was just read from disk; take fresh stamps so tick() does not reload again.
+        st.watcher->scan();
+    }
 
-        if (auto loaded = loadTextureFromDisk(st, *path)) {
-            applyLoadedTexture(rec, st, *loaded, *path);
-            result.succeeded++;
-            LogManager::info("Reloaded texture '{}' from '{}'", key, path->string());
-            textureLoaded = true;
-        } else {
-            result.placeholders++;
-            rec.placeholder = true;
-            if (rec.texture && rec.ownsTexture) {
-                UnloadTexture(*rec.texture);
-            }
-            subtractBytes(st, rec.byteSize);
-            rec.texture.reset();
-            rec.ownsTexture = false;
-            rec.byteSize = 0;
-            rec.resolvedPath = path->string();
-            LogManager::error("Reload failed for '{}' ({}); placeholder in use", key, path->string());
-            setAtlasPlaceholder(rec);
-        }
+    enforceBudget(st);
+    result.totalMs = millisecondsSince(start);
+    return result;
+}
 
-        if (textureLoaded) {
-            if (rec.atlasJsonPath) {
-                reloadAtlasMetadata(key, rec, st);
-            } else if (rec.atlasFrames && rec.atlasFrames->size() > 0) {
-                setAtlasPlaceholder(rec);
-            }
-        }
+ReloadResult TextureManager::reloadChanged() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
+    if (!st.initialized) {
+        return {};
+    }
+    if (!st.watcher) {
+        LogManager::warn("TextureManager::reloadChanged requires textures::hot_reload; nothing reloaded");
+        return {};
     }
+    return reloadChangedPaths(st, st.watcher->scan());
+}
 
-    return result;
+ReloadResult TextureManager::lastHotReload() {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    return st.lastHotReload;
 }
 
 TextureMetrics TextureManager::metrics() {
     auto& st = state();
-    std::scoped_lock lock(st.mutex);
-    return computeMetricsSnapshot(st);
+    TextureMetrics metrics;
+    {
+        ReadGuard guard(st.readView.readers);
+        const TextureMetrics* published = st.readView.metrics.load();
+        if (!published) {
+            return metrics;
+        }
+        metrics = *published;
+    }
+    // Decode queue statistics move on worker threads between publishes; read them live.
+    fillDecodeMetrics(metrics, st.decoder);
+    return metrics;
 }
 
 TextureDiagnosticsSnapshot TextureManager::diagnosticsSnapshot() {
@@ -1313,6 +3232,7 @@ TextureDiagnosticsSnapshot TextureManager::diagnosticsSnapshot() {
     if (!st.initialized) {
         return snapshot;
     }
+    fillDecodeMetrics(snapshot.metrics, st.decoder);
 
     snapshot.totalAliases = st.aliasToKey.size();
 
@@ -1322,6 +3242,12 @@ TextureDiagnosticsSnapshot TextureManager::diagnosticsSnapshot() {
         reverseAliases[target].push_back(alias);
     }
 
+    std::unordered_map<std::string, std::size_t> evictionRanks;
+    evictionRanks.reserve(st.lru.size());
+    for (const auto& key : st.lru) {
+        evictionRanks.emplace(key, evictionRanks.size());
+    }
+
     snapshot.records.reserve(st.records.size());
     for (const auto& [key, rec] : st.records) {
         TextureDiagnosticsRecord record;
@@ -1330,8 +3256,12 @@ TextureDiagnosticsSnapshot TextureManager::diagnosticsSnapshot() {
         record.resolvedPath = rec.resolvedPath;
         record.refCount = rec.refCount;
         record.placeholder = rec.placeholder;
+        record.pending = rec.pending;
         record.ownsTexture = rec.ownsTexture;
         record.byteSize = rec.byteSize;
+        if (auto rankIt = evictionRanks.find(key); rankIt != evictionRanks.end()) {
+            record.evictionRank = rankIt->second;
+        }
         record.atlasPlaceholder = rec.atlasPlaceholder;
         record.atlasFrameCount = rec.atlasFrames ? rec.atlasFrames->size() : 0;
         record.atlasAvailable = record.atlasFrameCount > 0;
@@ -1358,20 +3288,37 @@ void TextureManager::setLoaderForTesting(LoaderFn loader) {
     st.testLoader = std::move(loader);
 }
 
+void TextureManager::setDecoderForTesting(DecoderFn decoder) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    st.testDecoder = std::move(decoder);
+}
+
+void TextureManager::setUploaderForTesting(UploaderFn uploader) {
+    auto& st = state();
+    std::scoped_lock lock(st.mutex);
+    st.testUploader = std::move(uploader);
+}
+
 void TextureManager::setPlaceholderGeneratorForTesting(PlaceholderFn generator) {
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     st.testPlaceholder = std::move(generator);
     st.placeholderReady = false;
+    markAllRecordsDirty(st);
 }
 
 void TextureManager::resetForTesting() {
     shutdown();
     auto& st = state();
     std::scoped_lock lock(st.mutex);
+    ReadViewPublisher publisher(st);
     st.settings = Settings{};
     st.testLoader = nullptr;
     st.testPlaceholder = nullptr;
+    st.testDecoder = nullptr;
+    st.testUploader = nullptr;
     st.aliasToKey.clear();
 }
 
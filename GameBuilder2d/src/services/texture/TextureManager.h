@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <optional>
 #include <functional>
@@ -19,6 +21,7 @@ struct AcquireResult {
     const Texture2D* texture{nullptr};
     bool placeholder{false};
     bool newlyLoaded{false};
+    bool pending{false};
 };
 
 struct TextureMetrics {
@@ -28,6 +31,55 @@ struct TextureMetrics {
     std::size_t totalAtlases{0};
     std::size_t placeholderAtlases{0};
     std::size_t totalAtlasFrames{0};
+    std::size_t bakedAtlases{0};
+    std::size_t budgetBytes{0};
+    std::size_t unreferencedTextures{0};
+    std::size_t unreferencedBytes{0};
+    std::size_t evictions{0};
+    std::size_t evictedBytes{0};
+    std::size_t cacheHits{0};
+    std::size_t cacheMisses{0};
+    double cacheHitRatio{0.0};
+    std::size_t spritePages{0};
+    std::size_t packedSprites{0};
+    std::size_t spritePageBytes{0};
+    double spritePageOccupancy{0.0};
+    std::size_t asyncWorkers{0}; // decode threads running; 0 until the first async acquire
+    std::size_t pendingDecodes{0};
+    std::size_t pendingUploads{0};
+    std::size_t asyncDecodesCompleted{0};
+    double lastDecodeMs{0.0};
+    double averageDecodeMs{0.0};
+    double maxDecodeMs{0.0};
+    std::size_t watchedFiles{0};
+    std::size_t hotReloads{0};
+    double lastHotReloadMs{0.0};
+    // Textures resident in a GPU block format (DXT/ETC2); their bytes are included in totalBytes.
+    std::size_t compressedTextures{0};
+    std::size_t compressedBytes{0};
+    // .dds/.ktx2 loads decoded to RGBA8 on the CPU because the format could not be uploaded as is.
+    std::size_t transcodedTextures{0};
+    // textures::decoded_cache_dir lookups; a hit skips the PNG/JPG decode entirely.
+    std::size_t decodedCacheHits{0};
+    std::size_t decodedCacheMisses{0};
+    // Identifier -> file resolution; cached answers (including misses) skip the search-path walk.
+    std::size_t pathLookups{0};
+    std::size_t pathCacheHits{0};
+    std::size_t pathProbes{0};
+    std::size_t pathProbesAvoided{0};
+    std::size_t preloadGroups{0};
+    std::size_t preloadedTextures{0};
+
+    bool operator==(const TextureMetrics&) const = default;
+};
+
+struct PreloadResult {
+    std::string group{};
+    std::size_t requested{0};
+    std::size_t loaded{0};
+    std::size_t placeholders{0}; // missing files, failed decodes and decodes still running at the timeout
+    std::size_t decodedCacheHits{0};
+    double milliseconds{0.0};
 };
 
 struct TextureDiagnosticsRecord {
@@ -36,8 +88,11 @@ struct TextureDiagnosticsRecord {
     std::string resolvedPath;
     std::size_t refCount{0};
     bool placeholder{false};
+    bool pending{false};
     bool ownsTexture{false};
     std::size_t byteSize{0};
+    // Position in the eviction queue (0 = evicted first); empty while the texture is referenced.
+    std::optional<std::size_t> evictionRank{};
     bool atlasAvailable{false};
     bool atlasPlaceholder{false};
     std::size_t atlasFrameCount{0};
@@ -51,10 +106,21 @@ struct TextureDiagnosticsSnapshot {
     std::vector<TextureDiagnosticsRecord> records{};
 };
 
+struct ReloadTiming {
+    std::string key{};
+    double milliseconds{0.0};
+    bool texture{false}; // image re-decoded
+    bool atlas{false};   // atlas metadata re-parsed
+    bool succeeded{false};
+};
+
 struct ReloadResult {
     std::size_t attempted{0};
     std::size_t succeeded{0};
     std::size_t placeholders{0};
+    std::size_t unchanged{0}; // records skipped by reloadChanged because nothing on disk changed
+    double totalMs{0.0};
+    std::vector<ReloadTiming> timings{};
 };
 
 struct AtlasFrame {
@@ -66,6 +132,17 @@ struct AtlasFrame {
     std::string originalName{};
 };
 
+// Resolved once through TextureManager::resolveAtlasFrame; frameById() then reads the frame
+// without locking. An id goes stale (frameById returns nullptr) once its atlas is released,
+// evicted or reloaded; resolve it again in that case.
+struct AtlasFrameId {
+    std::uint32_t slot{0};
+    std::uint32_t index{0};
+    std::uint32_t generation{0};
+
+    bool valid() const { return generation != 0; }
+};
+
 struct TextureAtlasHandle {
     std::string key;
     const Texture2D* texture{nullptr};
@@ -82,11 +159,31 @@ public:
 
     static AcquireResult acquire(const std::string& identifier,
                                  std::optional<std::string> alias = std::nullopt);
+    // Decodes on a worker thread and returns a placeholder-backed result right away; the real
+    // texture becomes visible through tryGet() once processPendingUploads()/tick() uploads it.
+    static AcquireResult acquireAsync(const std::string& identifier,
+                                      std::optional<std::string> alias = std::nullopt);
+    static std::size_t processPendingUploads(std::size_t maxUploads, double budgetMs = 0.0);
+    static bool waitForPendingDecodes(std::chrono::milliseconds timeout);
+    static void tick();
+    // tryGet, tryGetAtlas and metrics read a published snapshot and never take the manager lock.
     static const Texture2D* tryGet(const std::string& key);
     static bool release(const std::string& key);
     static bool forceUnload(const std::string& key);
     static ReloadResult reloadAll();
+    // Reloads only textures and atlas JSON files whose contents changed since they were loaded.
+    // Requires textures::hot_reload; tick() does the same from debounced file-watch events.
+    static ReloadResult reloadChanged();
+    static ReloadResult lastHotReload();
     static TextureMetrics metrics();
+    // Acquires every identifier of a textures::preload group through the async decoders and blocks
+    // until they are uploaded (or `timeout` passes). The group holds one reference per texture
+    // until releasePreloadGroup(); preloading an active group again does nothing.
+    static PreloadResult preloadGroup(const std::string& group,
+                                      std::chrono::milliseconds timeout = std::chrono::seconds(30));
+    static bool releasePreloadGroup(const std::string& group);
+    // True when textures::preload defines `group`.
+    static bool hasPreloadGroup(const std::string& group);
     static TextureDiagnosticsSnapshot diagnosticsSnapshot();
 
     static TextureAtlasHandle acquireAtlas(const std::string& jsonIdentifier,
@@ -97,6 +194,22 @@ public:
     static bool releaseAtlas(const std::string& key);
     static std::optional<AtlasFrame> getAtlasFrame(const std::string& atlasKey,
                                                    const std::string& frameName);
+    static AtlasFrameId resolveAtlasFrame(const std::string& atlasKey, const std::string& frameName);
+    // Lock-free. The frame stays readable until at least the next tick() after the atlas is
+    // released or reloaded, and until shutdown() otherwise.
+    static const AtlasFrame* frameById(AtlasFrameId id);
+    // Writes the binary form of an atlas JSON (default: "<json stem>.gb2datlas" next to it).
+    // acquireAtlas() prefers that file while its recorded source stamp matches the JSON.
+    static bool bakeAtlas(const std::filesystem::path& jsonPath,
+                          std::optional<std::filesystem::path> outputPath = std::nullopt);
+
+    // Small images (textures::pack_max_dimension) are packed into shared sprite pages when
+    // textures::pack_small_textures is enabled; the handle carries a single frame describing the
+    // sub-rectangle. Larger images, or packing disabled, yield a standalone texture with one
+    // full-size frame. Pair every call with releaseSprite().
+    static TextureAtlasHandle acquireSprite(const std::string& identifier,
+                                            std::optional<std::string> alias = std::nullopt);
+    static bool releaseSprite(const std::string& key);
 
     struct LoadedTexture {
         Texture2D texture{};
@@ -107,8 +220,15 @@ public:
                                                                 bool generateMipmaps,
                                                                 int filterMode)>;
     using PlaceholderFn = std::function<std::optional<LoadedTexture>()>;
+    using DecoderFn = std::function<std::optional<Image>(const std::filesystem::path& path)>;
+    // A LoadedTexture returned with bytes == 0 is accounted from the image's size and mip chain.
+    using UploaderFn = std::function<std::optional<LoadedTexture>(const Image& image,
+                                                                  bool generateMipmaps,
+                                                                  int filterMode)>;
 
     static void setLoaderForTesting(LoaderFn loader);
+    static void setDecoderForTesting(DecoderFn decoder);
+    static void setUploaderForTesting(UploaderFn uploader);
     static void setPlaceholderGeneratorForTesting(PlaceholderFn generator);
     static void resetForTesting();
 };
@@ -0,0 +1,48 @@
+#include "services/logger/LogManager.h"
+#include "services/texture/TextureManager.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+// Usage: gb2d_atlas_baker <atlas.json> [output.gb2datlas]
+//        gb2d_atlas_baker <directory>   (bakes every *.json below it)
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "usage: %s <atlas.json | directory> [output.gb2datlas]\n", argv[0]);
+        return 2;
+    }
+
+    gb2d::logging::LogManager::init({"AtlasBaker", gb2d::logging::Level::info, "[%l] %v"});
+    using gb2d::textures::TextureManager;
+
+    const std::filesystem::path input = argv[1];
+    std::error_code ec;
+    if (std::filesystem::is_directory(input, ec)) {
+        if (argc == 3) {
+            std::fprintf(stderr, "an explicit output path is only valid for a single atlas\n");
+            return 2;
+        }
+        int failures = 0;
+        int baked = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input, ec)) {
+            if (!entry.is_regular_file() || entry.path().extension() != ".json") {
+                continue;
+            }
+            if (TextureManager::bakeAtlas(entry.path())) {
+                baked++;
+            } else {
+                failures++;
+            }
+        }
+        std::printf("baked %d atlas(es), %d failed\n", baked, failures);
+        return failures == 0 ? 0 : 1;
+    }
+
+    std::optional<std::filesystem::path> output;
+    if (argc == 3) {
+        output = std::filesystem::path(argv[2]);
+    }
+    return TextureManager::bakeAtlas(input, output) ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+#include "services/filesystem/MappedFile.h"
+#include "services/logger/BinaryLogReader.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace binlog = gb2d::logging::binlog;
+
+namespace {
+
+void printUsage(const char* program) {
+    std::fprintf(stderr,
+                 "usage: %s [--json] [--level <level>] [--since <time>] [--until <time>] <segment|directory>...\n"
+                 "  --json           one JSON object per message instead of text\n"
+                 "  --level <level>  minimum level: trace, debug, info, warn, error, critical\n"
+                 "  --since/--until  unix seconds (1760600000.25) or UTC 2026-10-16T12:00:00[.fff]\n"
+                 "Directories are decoded in segment order. Times are printed in UTC.\n",
+                 program);
+}
+
+std::optional<uint8_t> parseLevel(std::string_view name) {
+    static const std::pair<std::string_view, uint8_t> names[] = {
+        {"trace", 0}, {"debug", 1}, {"info", 2}, {"warn", 3}, {"warning", 3}, {"error", 4}, {"err", 4}, {"critical", 5}, {"crit", 5},
+    };
+    for (const auto& [n, level] : names) {
+        if (n == name) return level;
+    }
+    return std::nullopt;
+}
+
+// Days since 1970-01-01 for a proleptic Gregorian date (Howard Hinnant's days_from_civil).
+int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned)(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+std::optional<int64_t> parseTime(const char* text) {
+    int y = 0, mo = 0, d = 0, h = 0, mi = 0, consumed = 0;
+    double s = 0.0;
+    if (std::sscanf(text, "%d-%d-%dT%d:%d:%lf%n", &y, &mo, &d, &h, &mi, &s, &consumed) == 6 && text[consumed] == '\0') {
+        const int64_t days = daysFromCivil(y, (unsigned)mo, (unsigned)d);
+        return (days * 86400 + h * 3600 + mi * 60) * 1000000000LL + (int64_t)(s * 1e9);
+    }
+    char* end = nullptr;
+    const double seconds = std::strtod(text, &end);
+    if (end != text && *end == '\0') return (int64_t)(seconds * 1e9);
+    return std::nullopt;
+}
+
+std::string formatTime(int64_t ns, char dateTimeSeparator, bool zulu) {
+    const int64_t seconds = ns >= 0 ? ns / 1000000000 : (ns - 999999999) / 1000000000;
+    const int64_t nanos = ns - seconds * 1000000000;
+    const std::time_t t = (std::time_t)seconds;
+    std::tm tm{};
+#if defined(_WIN32)
+    gmtime_s(&tm, &t);
+#else
+    gmtime_r(&t, &tm);
+#endif
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%04d-%02d-%02d%c%02d:%02d:%02d.%06lld%s", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                  dateTimeSeparator, tm.tm_hour, tm.tm_min, tm.tm_sec, (long long)(nanos / 1000), zulu ? "Z" : "");
+    return buf;
+}
+
+nlohmann::json argToJson(const binlog::DecodedArg& arg) {
+    switch (arg.type) {
+        case binlog::ArgType::int64: return arg.i;
+        case binlog::ArgType::uint64: return arg.u;
+        case binlog::ArgType::float32:
+        case binlog::ArgType::float64: return arg.f;
+        case binlog::ArgType::boolean: return arg.b;
+        case binlog::ArgType::character: return std::string(1, arg.c);
+        case binlog::ArgType::string: return std::string(arg.s);
+        case binlog::ArgType::pointer: {
+            char buf[24];
+            std::snprintf(buf, sizeof(buf), "0x%llx", (unsigned long long)arg.u);
+            return buf;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// Usage: gb2d_log_decoder [--json] [--level <level>] [--since <time>] [--until <time>] <segment|directory>...
+// Decodes binary log segments written by LogManager's binary log (".gb2dlog") to text or JSON lines.
+int main(int argc, char** argv) {
+    bool json = false;
+    binlog::RecordFilter filter;
+    std::vector<std::filesystem::path> inputs;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--json") {
+            json = true;
+        } else if (arg == "--level" && hasValue) {
+            const auto level = parseLevel(argv[++i]);
+            if (!level) { std::fprintf(stderr, "unknown level '%s'\n", argv[i]); return 2; }
+            filter.min_level = *level;
+        } else if ((arg == "--since" || arg == "--until") && hasValue) {
+            const auto time = parseTime(argv[++i]);
+            if (!time) { std::fprintf(stderr, "cannot parse time '%s'\n", argv[i]); return 2; }
+            (arg == "--since" ? filter.since_ns : filter.until_ns) = *time;
+        } else if (arg == "-h" || arg == "--help" || arg.rfind("--", 0) == 0) {
+            printUsage(argv[0]);
+            return 2;
+        } else {
+            inputs.emplace_back(argv[i]);
+        }
+    }
+    if (inputs.empty()) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<std::filesystem::path> segments;
+    for (const auto& input : inputs) {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(input, ec)) {
+            segments.push_back(input);
+            continue;
+        }
+        std::vector<std::filesystem::path> found;
+        for (const auto& entry : std::filesystem::directory_iterator(input, ec)) {
+            if (entry.is_regular_file() && entry.path().extension() == binlog::kExtension) found.push_back(entry.path());
+        }
+        // Segment numbers are zero-padded, so name order is write order.
+        std::sort(found.begin(), found.end());
+        segments.insert(segments.end(), found.begin(), found.end());
+    }
+
+    int result = 0;
+    std::string line;
+    for (const auto& path : segments) {
+        auto file = gb2d::filesystem::MappedFile::open(path);
+        if (!file) {
+            std::fprintf(stderr, "%s: cannot open\n", path.string().c_str());
+            result = 1;
+            continue;
+        }
+        const std::string_view bytes(reinterpret_cast<const char*>(file->data()), file->size());
+        const auto status = binlog::decode_segment(bytes, [&](const binlog::DecodedRecord& record) {
+            if (!filter.accepts(record)) return;
+            const std::string message = binlog::render_message(record);
+            if (json) {
+                nlohmann::json out{
+                    {"time", formatTime(record.time_ns, 'T', true)},
+                    {"ts_ns", record.time_ns},
+                    {"level", binlog::level_name(record.level)},
+                    {"message", message},
+                };
+                if (!record.is_text) {
+                    out["format"] = std::string(record.format);
+                    auto& args = out["args"] = nlohmann::json::array();
+                    for (const auto& a : record.args) args.push_back(argToJson(a));
+                }
+                line = out.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+            } else {
+                line = formatTime(record.time_ns, ' ', false) + " [" + binlog::level_name(record.level) + "] " + message;
+            }
+            line.push_back('\n');
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        });
+        if (status == binlog::DecodeStatus::not_a_segment) {
+            std::fprintf(stderr, "%s: not a binary log segment\n", path.string().c_str());
+            result = 1;
+        } else if (status == binlog::DecodeStatus::truncated) {
+            // A segment cut short by a crash; everything before the damaged record was printed.
+            std::fprintf(stderr, "%s: ends in a damaged record\n", path.string().c_str());
+        }
+    }
+    return result;
+}
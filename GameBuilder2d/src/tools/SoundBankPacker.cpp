@@ -0,0 +1,60 @@
+#include "services/audio/SoundBank.h"
+#include "services/logger/LogManager.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool isSoundFile(const std::filesystem::path& path) {
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char ch) {
+        return static_cast<char>(std::tolower(ch));
+    });
+    return extension == ".wav" || extension == ".ogg" || extension == ".mp3" || extension == ".flac" ||
+           extension == ".qoa";
+}
+
+} // namespace
+
+// Usage: gb2d_sound_bank_packer <output.gb2dbank> <sound>...
+//        gb2d_sound_bank_packer <output.gb2dbank>            (packs every sound below its directory)
+// Sounds are named by their path relative to the bank's directory, which is how games acquire them.
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <output.gb2dbank> [sound...]\n", argv[0]);
+        return 2;
+    }
+
+    gb2d::logging::LogManager::init({"SoundBankPacker", gb2d::logging::Level::info, "[%l] %v"});
+
+    const std::filesystem::path output = std::filesystem::absolute(argv[1]);
+    const std::filesystem::path root = output.parent_path();
+    std::vector<std::string> identifiers;
+    std::error_code ec;
+    if (argc == 2) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root, ec)) {
+            if (entry.is_regular_file() && isSoundFile(entry.path())) {
+                identifiers.push_back(entry.path().lexically_relative(root).generic_string());
+            }
+        }
+    } else {
+        for (int i = 2; i < argc; ++i) {
+            const auto relative = std::filesystem::absolute(argv[i]).lexically_relative(root);
+            if (relative.empty() || *relative.begin() == "..") {
+                std::fprintf(stderr, "'%s' is not below the bank's directory\n", argv[i]);
+                return 2;
+            }
+            identifiers.push_back(relative.generic_string());
+        }
+    }
+    if (identifiers.empty()) {
+        std::fprintf(stderr, "no sounds to pack\n");
+        return 1;
+    }
+    return gb2d::audio::SoundBank::pack(output, root, identifiers) ? 0 : 1;
+}
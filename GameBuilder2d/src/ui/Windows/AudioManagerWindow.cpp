@@ -116,6 +116,11 @@ void AudioManagerWindow::render(WindowContext& ctx) {
         renderDiagnosticsPanel();
         ImGui::EndTabItem();
     }
+
+    if (ImGui::BeginTabItem("Mixer")) {
+        renderMixerPanel();
+        ImGui::EndTabItem();
+    }
     
     ImGui::EndTabBar();
     ImGui::EndChild();
@@ -173,17 +178,19 @@ void AudioManagerWindow::renderAssetList() {
             ImGui::PushID(sound.key.c_str());
             
             bool isPlaceholder = sound.placeholder;
+            // Released but kept resident for the memory budget; it cannot be played until acquired.
+            bool isRetained = sound.evictionRank.has_value();
             bool isSelected = (selectedAssetKey_ == sound.key);
             bool isPreviewingThis = (previewType_ == PreviewType::Sound && previewKey_ == sound.key && isPlayingPreview_);
             
-            if (isPlaceholder) {
+            if (isPlaceholder || isRetained) {
                 ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
             } else if (isPreviewingThis) {
                 ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.3f, 1.0f, 0.3f, 1.0f));
             }
             
             // Play/Stop button
-            if (!isPlaceholder) {
+            if (!isPlaceholder && !isRetained) {
                 if (isPreviewingThis) {
                     if (ImGui::Button("■")) {
                         stopPreview();
@@ -211,17 +218,25 @@ void AudioManagerWindow::renderAssetList() {
                 ImGui::BeginTooltip();
                 ImGui::Text("Key: %s", sound.key.c_str());
                 ImGui::Text("Path: %s", sound.path.c_str());
+                if (!sound.bank.empty()) {
+                    ImGui::Text("Bank: %s", sound.bank.c_str());
+                }
                 ImGui::Text("Duration: %.2fs", sound.durationSeconds);
                 ImGui::Text("Ref Count: %zu", sound.refCount);
                 ImGui::Text("Sample Rate: %u Hz", sound.sampleRate);
                 ImGui::Text("Channels: %u", sound.channels);
+                ImGui::Text("Memory: %.1f KiB", static_cast<double>(sound.bytes) / 1024.0);
                 if (isPlaceholder) {
                     ImGui::Text("Status: Placeholder (not loaded)");
+                } else if (isRetained) {
+                    ImGui::Text("Status: Released, evicted #%zu under memory pressure", *sound.evictionRank + 1);
+                } else if (sound.decodeOnDemand) {
+                    ImGui::Text("Status: %s", sound.decoded ? "Decoded on demand" : "Encoded until played");
                 }
                 ImGui::EndTooltip();
             }
             
-            if (isPlaceholder || isPreviewingThis) {
+            if (isPlaceholder || isRetained || isPreviewingThis) {
                 ImGui::PopStyleColor();
             }
             
@@ -284,6 +299,7 @@ void AudioManagerWindow::renderAssetList() {
                 ImGui::Text("Ref Count: %zu", music.refCount);
                 ImGui::Text("Sample Rate: %u Hz", music.sampleRate);
                 ImGui::Text("Channels: %u", music.channels);
+                ImGui::Text("Memory: %.1f KiB", static_cast<double>(music.bytes) / 1024.0);
                 if (isPlaceholder) {
                     ImGui::Text("Status: Placeholder (not loaded)");
                 }
@@ -566,6 +582,9 @@ void AudioManagerWindow::renderPreviewPanel() {
         ImGui::Text("Sample Rate: %u Hz", soundInfo.sampleRate);
         ImGui::Text("Channels: %u", soundInfo.channels);
         ImGui::Text("Path: %s", soundInfo.path.c_str());
+        if (!soundInfo.bank.empty()) {
+            ImGui::Text("Bank: %s", soundInfo.bank.c_str());
+        }
         
         if (soundInfo.placeholder) {
             ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "Warning: Placeholder (not loaded)");
@@ -1142,6 +1161,10 @@ void AudioManagerWindow::renderDiagnosticsPanel() {
             ImGui::SameLine();
             ImGui::Text("(%s)", entry.event.details.c_str());
         }
+        if (entry.event.count > 1) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("x%u", static_cast<unsigned>(entry.event.count));
+        }
     }
     
     if (eventLog_.empty()) {
@@ -1154,10 +1177,88 @@ void AudioManagerWindow::renderDiagnosticsPanel() {
     }
 }
 
-void AudioManagerWindow::onAudioEvent(const audio::AudioEvent& event) {
-    gb2d::logging::LogManager::info("AudioManagerWindow received audio event: type={}, key='{}', details='{}'", 
-                 static_cast<int>(event.type), event.key, event.details);
-    handleEvent(event);
+void AudioManagerWindow::renderMixerPanel() {
+    ImGui::Text("Software Mixer");
+    ImGui::Separator();
+
+    if (!audio::AudioManager::isMixerActive()) {
+        meterPeakHold_.clear();
+        ImGui::TextDisabled("The software mixer is off. Enable audio.mixer.enabled and restart audio to use buses and meters.");
+        return;
+    }
+
+    const auto metrics = audio::AudioManager::metrics();
+    ImGui::Text("Voices: %zu", metrics.mixerVoices);
+    ImGui::SameLine();
+    ImGui::Text("Frames rendered: %llu", static_cast<unsigned long long>(metrics.mixerFramesRendered));
+
+    constexpr float kPeakHoldDecayPerSecond = 0.5f;
+    const float decay = kPeakHoldDecayPerSecond * ImGui::GetIO().DeltaTime;
+    const auto meters = audio::AudioManager::mixerMeters();
+
+    const auto depthOf = [&meters](const audio::MixerBusMeter& meter) {
+        int depth = 0;
+        for (std::string parent = meter.parent; !parent.empty() && depth < 16; ++depth) {
+            auto it = std::find_if(meters.begin(), meters.end(), [&parent](const auto& other) { return other.name == parent; });
+            parent = it != meters.end() ? it->parent : std::string{};
+        }
+        return depth;
+    };
+
+    ImGui::BeginChild("mixer-buses", ImVec2(0, 0), true);
+    for (const auto& meter : meters) {
+        ImGui::PushID(meter.name.c_str());
+        const float indent = static_cast<float>(depthOf(meter)) * 16.0f;
+        if (indent > 0.0f) {
+            ImGui::Indent(indent);
+        }
+
+        if (!meter.audible) {
+            ImGui::TextDisabled("%s", meter.name.c_str());
+        } else {
+            ImGui::TextUnformatted(meter.name.c_str());
+        }
+
+        auto settings = meter.settings;
+        bool changed = false;
+        ImGui::SetNextItemWidth(160.0f);
+        changed |= ImGui::SliderFloat("Gain", &settings.gain, 0.0f, 2.0f, "%.2f");
+        ImGui::SameLine();
+        changed |= ImGui::Checkbox("Mute", &settings.muted);
+        ImGui::SameLine();
+        changed |= ImGui::Checkbox("Solo", &settings.solo);
+        if (changed) {
+            audio::AudioManager::setMixerBusSettings(meter.name, settings);
+        }
+
+        auto& hold = meterPeakHold_[meter.name];
+        static const char* kChannelLabels[2] = {"L", "R"};
+        for (std::size_t channel = 0; channel < 2; ++channel) {
+            hold[channel] = std::max(meter.peak[channel], hold[channel] - decay);
+            char overlay[48];
+            std::snprintf(overlay, sizeof(overlay), "%s  rms %.2f  peak %.2f",
+                          kChannelLabels[channel], meter.rms[channel], hold[channel]);
+            ImGui::ProgressBar(std::clamp(meter.rms[channel], 0.0f, 1.0f), ImVec2(220.0f, 0.0f), overlay);
+            ImGui::SameLine();
+            ImGui::ProgressBar(std::clamp(hold[channel], 0.0f, 1.0f), ImVec2(60.0f, 0.0f), "");
+        }
+
+        if (indent > 0.0f) {
+            ImGui::Unindent(indent);
+        }
+        ImGui::Separator();
+        ImGui::PopID();
+    }
+    ImGui::EndChild();
+}
+
+void AudioManagerWindow::onAudioEvents(std::span<const audio::AudioEvent> events) {
+    if (configBaseline_.diagnosticsLoggingEnabled) {
+        gb2d::logging::LogManager::info("AudioManagerWindow received {} audio event(s)", events.size());
+    }
+    for (const auto& event : events) {
+        handleEvent(event);
+    }
 }
 
 void AudioManagerWindow::refreshInventorySnapshots() {
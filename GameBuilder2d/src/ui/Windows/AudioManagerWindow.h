@@ -4,8 +4,10 @@
 #include "services/audio/AudioManager.h"
 
 #include <nlohmann/json.hpp>
+#include <array>
 #include <functional>
 #include <optional>
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -32,7 +34,7 @@ public:
     void deserialize(const nlohmann::json& in) override;
 
     // AudioEventSink implementation
-    void onAudioEvent(const audio::AudioEvent& event) override;
+    void onAudioEvents(std::span<const audio::AudioEvent> events) override;
 
 private:
     void renderAssetList();
@@ -40,6 +42,7 @@ private:
     void renderPreviewPanel();
     void renderConfigPanel();
     void renderDiagnosticsPanel();
+    void renderMixerPanel();
     void renderClosePromptModal();
     void processPendingCloseAction();
     
@@ -93,6 +96,9 @@ private:
     };
     std::vector<EventLogEntry> eventLog_;
     std::size_t maxEventLogSize_{100};
+
+    // Mixer meters: decaying peak-hold per bus, indexed by bus name, left and right.
+    std::unordered_map<std::string, std::array<float, 2>> meterPeakHold_{};
     
     // Preview state
     enum class PreviewType { None, Sound, Music };
@@ -2,31 +2,24 @@
 #include "ui/WindowContext.h"
 // logging snapshot API
 #include "services/logger/LogManager.h"
-// imgui & editor
+// imgui
 #include <nlohmann/json.hpp>
 #include <imgui.h>
-#include <imgui_internal.h>
-// ImGuiColorTextEdit
-//#include <TextEditor.h> // already included by header
 // std helpers
 #include <cctype>
+#include <cstring>
 #include <algorithm>
+#include <string_view>
 
 namespace {
     constexpr float kConsoleFontScaleMin = 0.7f;
     constexpr float kConsoleFontScaleMax = 2.5f;
     constexpr float kConsoleTextBrightnessMin = 0.6f;
     constexpr float kConsoleTextBrightnessMax = 1.8f;
-    // Simple 64-bit FNV-1a hash utility for rebuild change detection
-    uint64_t fnv1a64(const void* data, size_t len, uint64_t seed = 1469598103934665603ull) {
-        uint64_t h = seed;
-        const unsigned char* p = (const unsigned char*)data;
-        for (size_t i = 0; i < len; ++i) {
-            h ^= (uint64_t)p[i];
-            h *= 1099511628211ull;
-        }
-        return h;
-    }
+    constexpr ImU32 kConsoleBackground = IM_COL32(26, 26, 28, 255);
+    constexpr ImU32 kSelectedRowColor = IM_COL32(80, 120, 180, 90);
+    constexpr ImU32 kSearchMatchColor = IM_COL32(200, 170, 60, 90);
+    constexpr ImU32 kCurrentMatchColor = IM_COL32(255, 200, 60, 170);
 
     ImU32 scaleColor(ImU32 color, float factor) {
         ImVec4 c = ImGui::ColorConvertU32ToFloat4(color);
@@ -37,288 +30,146 @@ namespace {
         return ImGui::ColorConvertFloat4ToU32(c);
     }
 
-    // Custom tokenizer to color only the log level word (inside brackets) with a unique color per level.
-    bool LogTokenize(const char* in_begin, const char* in_end,
-                     const char*& out_begin, const char*& out_end,
-                     TextEditor::PaletteIndex& paletteIndex) {
-        // Skip whitespace first
-        const char* p = in_begin;
-        while (p < in_end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) {
-            out_begin = p;
-            out_end = p + 1;
-            paletteIndex = TextEditor::PaletteIndex::Default;
-            return true;
-        }
-        if (p >= in_end) return false;
-
-        if (*p == '[') {
-            const char* token_start = p;
-            ++p;
-            const char* word_start = p;
-            while (p < in_end && *p != ']' && *p != '\n' && *p != '\r') ++p;
-            const char* word_end = p;
-            if (p < in_end && *p == ']') {
-                std::string inner(word_start, word_end);
-                std::string lower;
-                lower.reserve(inner.size());
-                for (char c : inner) lower.push_back((char)std::tolower((unsigned char)c));
-
-                if (lower == "trace")      paletteIndex = TextEditor::PaletteIndex::Comment;
-                else if (lower == "debug") paletteIndex = TextEditor::PaletteIndex::Identifier;
-                else if (lower == "info")  paletteIndex = TextEditor::PaletteIndex::KnownIdentifier;
-                else if (lower == "warn" || lower == "warning")  paletteIndex = TextEditor::PaletteIndex::PreprocIdentifier;
-                else if (lower == "error" || lower == "err") paletteIndex = TextEditor::PaletteIndex::Keyword;
-                else if (lower == "crit" || lower == "critical") paletteIndex = TextEditor::PaletteIndex::Preprocessor;
-                else paletteIndex = TextEditor::PaletteIndex::Punctuation;
-
-                ++p; // consume closing bracket
-                out_begin = token_start;
-                out_end = p;
-                return true;
-            }
-            // unmatched '[', revert pointer to treat as punctuation below
-            p = token_start;
-        }
-
-        if (std::ispunct((unsigned char)*p) && *p != '_' && *p != '-') {
-            out_begin = p;
-            out_end = p + 1;
-            paletteIndex = TextEditor::PaletteIndex::Punctuation;
-            return true;
-        }
-
-        if (std::isalnum((unsigned char)*p)) {
-            const char* start = p;
-            ++p;
-            while (p < in_end && (std::isalnum((unsigned char)*p) || *p == '_' || *p=='-')) ++p;
-            std::string word(start, p);
-            std::string lower;
-            lower.reserve(word.size());
-            for (char c : word) lower.push_back((char)std::tolower((unsigned char)c));
-            paletteIndex = TextEditor::PaletteIndex::Default;
-            out_begin = start;
-            out_end = p;
-            return true;
-        }
-
-        out_begin = p;
-        out_end = p + 1;
-        paletteIndex = TextEditor::PaletteIndex::Default;
-        return true;
-    }
-
-    TextEditor::LanguageDefinition CreateLogLanguageDefinition() {
-        static bool initialized = false;
-        static TextEditor::LanguageDefinition lang;
-        if (!initialized) {
-            lang.mName = "GB2DLog";
-            lang.mKeywords.clear();
-            lang.mTokenRegexStrings.clear();
-            lang.mCommentStart = "";
-            lang.mCommentEnd = "";
-            lang.mSingleLineComment = "";
-            lang.mCaseSensitive = true;
-            lang.mIdentifiers.clear();
-            lang.mPreprocIdentifiers.clear();
-            lang.mAutoIndentation = false;
-            lang.mTokenize = &LogTokenize;
-            initialized = true;
+    // The first bracketed level word of a line ("[info]", "[warning]", ...), colored per level.
+    struct LevelToken { size_t begin = 0; size_t end = 0; ImU32 color = 0; };
+
+    bool findLevelToken(std::string_view line, float tone, LevelToken& out) {
+        size_t open = line.find('[');
+        while (open != std::string_view::npos) {
+            const size_t close = line.find(']', open + 1);
+            if (close == std::string_view::npos) return false;
+            std::string lower(line.substr(open + 1, close - open - 1));
+            for (char& c : lower) c = (char)std::tolower((unsigned char)c);
+
+            out.begin = open;
+            out.end = close + 1;
+            if (lower == "trace")      { out.color = scaleColor(IM_COL32(160, 160, 160, 255), tone * 0.85f); return true; }
+            if (lower == "debug")      { out.color = IM_COL32(110, 190, 255, 255); return true; } // sky blue
+            if (lower == "info")       { out.color = IM_COL32(120, 230, 150, 255); return true; } // bright green
+            if (lower == "warn" || lower == "warning") { out.color = IM_COL32(255, 200, 80, 255); return true; }  // amber
+            if (lower == "error" || lower == "err")    { out.color = IM_COL32(255, 110, 110, 255); return true; } // red
+            if (lower == "crit" || lower == "critical") { out.color = IM_COL32(230, 120, 255, 255); return true; } // magenta
+            open = line.find('[', close + 1);
         }
-        return lang;
+        return false;
     }
 }
 
 namespace gb2d {
 
-void ConsoleLogWindow::initEditorIfNeeded() {
-    if (editor_initialized_) return;
-    editor_initialized_ = true;
+void ConsoleLogWindow::initIfNeeded() {
+    if (initialized_) return;
+    initialized_ = true;
     // Apply default buffer capacity on first use
     gb2d::logging::set_log_buffer_capacity(buffer_cap_);
-    editor_.SetReadOnly(true);
-    editor_.SetShowWhitespaces(false);
-    editor_.SetImGuiChildIgnored(true);
-    applyPalette();
-    editor_.SetLanguageDefinition(CreateLogLanguageDefinition());
 }
 
-void ConsoleLogWindow::applyPalette() {
-    float tone = std::clamp(text_brightness_, kConsoleTextBrightnessMin, kConsoleTextBrightnessMax);
-    text_brightness_ = tone;
-
-    auto palette = TextEditor::GetDarkPalette();
-    auto toneColor = [&](ImU32 base, float multiplier = 1.0f) {
-        return scaleColor(base, tone * multiplier);
-    };
-
-    palette[(int)TextEditor::PaletteIndex::Default] = toneColor(IM_COL32(220, 220, 220, 255));
-    palette[(int)TextEditor::PaletteIndex::Number] = palette[(int)TextEditor::PaletteIndex::Default];
-    palette[(int)TextEditor::PaletteIndex::String] = palette[(int)TextEditor::PaletteIndex::Default];
-    palette[(int)TextEditor::PaletteIndex::CharLiteral] = palette[(int)TextEditor::PaletteIndex::Default];
-
-    palette[(int)TextEditor::PaletteIndex::Identifier] = IM_COL32(110, 190, 255, 255);       // DEBUG (sky blue)
-    palette[(int)TextEditor::PaletteIndex::KnownIdentifier] = IM_COL32(120, 230, 150, 255);  // INFO (bright green)
-    palette[(int)TextEditor::PaletteIndex::PreprocIdentifier] = IM_COL32(255, 200, 80, 255); // WARN (amber)
-    palette[(int)TextEditor::PaletteIndex::Keyword] = IM_COL32(255, 110, 110, 255);          // ERROR (red)
-    palette[(int)TextEditor::PaletteIndex::Preprocessor] = IM_COL32(230, 120, 255, 255);     // CRIT (magenta)
-
-    palette[(int)TextEditor::PaletteIndex::Comment] = toneColor(IM_COL32(160, 160, 160, 255), 0.85f);
-    palette[(int)TextEditor::PaletteIndex::MultiLineComment] = palette[(int)TextEditor::PaletteIndex::Comment];
-    palette[(int)TextEditor::PaletteIndex::Punctuation] = toneColor(IM_COL32(190, 190, 190, 255));
+void ConsoleLogWindow::pullNewLines() {
+    if (max_lines_ > lines_max_) {
+        // Older lines may still be in the log buffer; read it again from the start
+        next_seq_ = 0;
+        view_.clear();
+    }
+    lines_max_ = max_lines_;
+    view_.setMaxLines((size_t)max_lines_);
 
-    palette[(int)TextEditor::PaletteIndex::Background] = IM_COL32(26, 26, 28, 255);
-    palette[(int)TextEditor::PaletteIndex::LineNumber] = toneColor(IM_COL32(130, 130, 130, 255), 0.9f);
-    palette[(int)TextEditor::PaletteIndex::Cursor] = toneColor(IM_COL32(255, 255, 255, 255), 1.1f);
-    palette[(int)TextEditor::PaletteIndex::Selection] = toneColor(IM_COL32(80, 120, 180, 160), 0.95f);
-    palette[(int)TextEditor::PaletteIndex::CurrentLineFill] = IM_COL32(50, 50, 50, 60);
-    palette[(int)TextEditor::PaletteIndex::CurrentLineFillInactive] = IM_COL32(40, 40, 40, 40);
-    palette[(int)TextEditor::PaletteIndex::CurrentLineEdge] = IM_COL32(60, 60, 60, 120);
+    // Pull only the lines logged since the last frame; the view filters them as they arrive
+    fresh_.clear();
+    next_seq_ = gb2d::logging::read_log_lines_since(next_seq_, fresh_);
+    for (const auto& ln : fresh_) view_.append(ln.level, ln.text);
 
-    editor_.SetPalette(palette);
+    view_.setFilter(level_mask_, text_filter_);
+    view_.setSearch(search_query_, search_case_sensitive_);
 }
 
-void ConsoleLogWindow::rebuildEditorIfNeeded() {
-    last_autoscroll_triggered_ = false;
-    // Snapshot current log lines (bounded by max_lines_)
-    auto lines = gb2d::logging::read_log_lines_snapshot((size_t)max_lines_);
-    size_t snapshotSize = lines.size();
-
-    // Compute hash of inputs
-    uint64_t h = 1469598103934665603ull;
-    h = fnv1a64(&snapshotSize, sizeof(snapshotSize), h);
-    h = fnv1a64(&level_mask_, sizeof(level_mask_), h);
-    h = fnv1a64(text_filter_.data(), text_filter_.size(), h);
-
-    if (snapshotSize == last_snapshot_size_ && h == last_hash_) {
-        return; // nothing changed that affects filtered view
-    }
-
-    // Determine if user is at bottom
-    bool should_autoscroll = false;
-    if (autoscroll_) {
-        auto totalBefore = editor_.GetTotalLines();
-        auto cursor = editor_.GetCursorPosition();
-        if (totalBefore == 0) {
-            user_was_at_bottom_ = true;
-        } else {
-            user_was_at_bottom_ = (cursor.mLine >= totalBefore - 2);
-        }
-        should_autoscroll = user_was_at_bottom_;
-    }
-
-    bool filters_simple = text_filter_.empty();
-    bool size_non_decreasing = snapshotSize >= prev_raw_.size();
-    bool can_incremental = size_non_decreasing && filters_simple && (level_mask_ == 0x3F);
+void ConsoleLogWindow::renderRows() {
+    const float lineHeight = ImGui::GetTextLineHeightWithSpacing();
+    const bool stickToBottom = autoscroll_ && ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+
+    const size_t matchCount = view_.searchMatchCount();
+    const uint64_t currentMatch = matchCount ? view_.searchMatchLine((size_t)search_current_index_) : UINT64_MAX;
+    if (scroll_to_match_ && matchCount) {
+        const size_t row = view_.rowOf(currentMatch);
+        ImGui::SetScrollY(std::max(0.0f, (float)row * lineHeight - ImGui::GetWindowHeight() * 0.5f));
+    }
+    scroll_to_match_ = false;
+
+    const float tone = std::clamp(text_brightness_, kConsoleTextBrightnessMin, kConsoleTextBrightnessMax);
+    const ImU32 textColor = scaleColor(IM_COL32(220, 220, 220, 255), tone);
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float rowWidth = ImGui::GetWindowWidth() + ImGui::GetScrollX();
+    ImDrawList* draw = ImGui::GetWindowDrawList();
+
+    auto segment = [](const char* begin, const char* end, ImU32 color, bool last) {
+        ImGui::PushStyleColor(ImGuiCol_Text, color);
+        ImGui::TextUnformatted(begin, end);
+        ImGui::PopStyleColor();
+        if (!last) ImGui::SameLine(0.0f, 0.0f);
+    };
 
-    if (can_incremental && !prev_raw_.empty()) {
-        size_t prevCount = prev_raw_.size();
-        bool prefix_ok = true;
-        if (prevCount <= lines.size()) {
-            for (size_t i = 0; i < prevCount; ++i) {
-                const auto& a = prev_raw_[i];
-                const auto& b = lines[i];
-                if (a.level != b.level || a.text != b.text) { prefix_ok = false; break; }
+    // Only the rows inside the scroll window are laid out; the clipper skips the rest
+    ImGuiListClipper clipper;
+    clipper.Begin((int)view_.rowCount(), lineHeight);
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            const std::string_view text = view_.rowText((size_t)row);
+            const uint64_t line = view_.rowLine((size_t)row);
+            const ImVec2 pos = ImGui::GetCursorScreenPos();
+            if (line == selected_line_) {
+                draw->AddRectFilled(pos, ImVec2(origin.x + rowWidth, pos.y + lineHeight), kSelectedRowColor);
+            }
+            view_.searchSpans((size_t)row, spans_);
+            for (const auto& [b, e] : spans_) {
+                const float x0 = pos.x + ImGui::CalcTextSize(text.data(), text.data() + b).x;
+                const float x1 = x0 + ImGui::CalcTextSize(text.data() + b, text.data() + e).x;
+                draw->AddRectFilled(ImVec2(x0, pos.y), ImVec2(x1, pos.y + ImGui::GetTextLineHeight()),
+                                    line == currentMatch ? kCurrentMatchColor : kSearchMatchColor);
             }
-        } else prefix_ok = false;
-        if (!prefix_ok) {
-            can_incremental = false;
-        }
-    }
-
-    bool did_incremental = false;
-    bool text_changed = false;
-    std::string out;
-    if (!can_incremental) out.reserve(snapshotSize * 64);
-
-    size_t start_index = 0;
-    if (can_incremental) start_index = prev_raw_.size();
-    std::string appendBuf;
-    if (can_incremental) appendBuf.reserve((snapshotSize - start_index) * 64);
-
-    auto processLine = [&](const gb2d::logging::LogLine& ln, std::string& dest){
-        uint32_t bit = 0;
-        switch (ln.level) {
-            case gb2d::logging::Level::trace: bit = 1u<<0; break;
-            case gb2d::logging::Level::debug: bit = 1u<<1; break;
-            case gb2d::logging::Level::info:  bit = 1u<<2; break;
-            case gb2d::logging::Level::warn:  bit = 1u<<3; break;
-            case gb2d::logging::Level::err:   bit = 1u<<4; break;
-            case gb2d::logging::Level::critical: bit = 1u<<5; break;
-            case gb2d::logging::Level::off: default: break;
-        }
-        if ((level_mask_ & bit) == 0) return false;
-        if (!text_filter_.empty()) {
-            std::string hay = ln.text;
-            std::string needle = text_filter_;
-            std::transform(hay.begin(), hay.end(), hay.begin(), [](unsigned char c){ return (char)tolower(c); });
-            std::transform(needle.begin(), needle.end(), needle.begin(), [](unsigned char c){ return (char)tolower(c); });
-            if (hay.find(needle) == std::string::npos) return false;
-        }
-        dest.append(ln.text);
-        if (!dest.empty() && dest.back() != '\n') dest.push_back('\n');
-        return true;
-    };
 
-    size_t emitted_count = 0;
-    if (can_incremental && start_index < snapshotSize) {
-        for (size_t i = start_index; i < snapshotSize; ++i) {
-            if (processLine(lines[i], appendBuf)) ++emitted_count;
-        }
-        if (!appendBuf.empty()) {
-            editor_text_cache_.append(appendBuf);
-            editor_.SetText(editor_text_cache_);
-            did_incremental = true;
-            text_changed = true;
-        } else {
-            did_incremental = true;
+            const char* begin = text.data();
+            const char* end = begin + text.size();
+            LevelToken token;
+            if (findLevelToken(text, tone, token)) {
+                if (token.begin > 0) segment(begin, begin + token.begin, textColor, false);
+                segment(begin + token.begin, begin + token.end, token.color, token.end == text.size());
+                if (token.end < text.size()) segment(begin + token.end, end, textColor, true);
+            } else {
+                segment(begin, end, textColor, true);
+            }
         }
     }
+    clipper.End();
 
-    if (!did_incremental) {
-        for (const auto& ln : lines) {
-            if (processLine(ln, out)) ++emitted_count;
-        }
-        if (out.size() != prev_char_count_ || out != editor_text_cache_) {
-            editor_text_cache_.assign(out.begin(), out.end());
-            editor_.SetText(editor_text_cache_);
-            text_changed = true;
-        }
+    // Click selects a row; Ctrl+C or the context menu copies it
+    if (ImGui::IsWindowHovered() && (ImGui::IsMouseClicked(ImGuiMouseButton_Left) || ImGui::IsMouseClicked(ImGuiMouseButton_Right))) {
+        const float y = ImGui::GetMousePos().y - origin.y;
+        const size_t row = y >= 0.0f ? (size_t)(y / lineHeight) : view_.rowCount();
+        selected_line_ = row < view_.rowCount() ? view_.rowLine(row) : UINT64_MAX;
     }
-    if (text_changed) {
-        ++text_version_;
+    const size_t selectedRow = view_.rowOf(selected_line_);
+    const bool hasSelection = selectedRow < view_.rowCount();
+    if (hasSelection && ImGui::IsWindowFocused() && ImGui::GetIO().KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_C)) {
+        ImGui::SetClipboardText(std::string(view_.rowText(selectedRow)).c_str());
     }
-    if (should_autoscroll && text_changed) {
-        auto totalLines = editor_.GetTotalLines();
-        if (totalLines > 0) {
-            TextEditor::Coordinates c{ (int)totalLines - 1, 0 };
-            editor_.SetCursorPosition(c);
+    if (ImGui::BeginPopupContextWindow("##console_row_menu")) {
+        if (ImGui::MenuItem("Copy line", "Ctrl+C", false, hasSelection)) {
+            ImGui::SetClipboardText(std::string(view_.rowText(selectedRow)).c_str());
         }
-        last_autoscroll_triggered_ = true;
-    }
-    last_snapshot_size_ = snapshotSize;
-    last_hash_ = h;
-    if (!did_incremental) {
-        prev_raw_ = lines;
-    } else {
-        if (!appendBuf.empty()) {
-            prev_raw_.insert(prev_raw_.end(), lines.begin() + (long long)start_index, lines.end());
-        } else {
-            prev_raw_ = lines;
+        if (ImGui::MenuItem("Copy visible")) {
+            ImGui::SetClipboardText(view_.visibleText().c_str());
         }
+        ImGui::EndPopup();
     }
-    if (text_changed) {
-        prev_char_count_ = editor_text_cache_.size();
+
+    if (stickToBottom) {
+        ImGui::SetScrollHereY(1.0f);
     }
 }
 
 void ConsoleLogWindow::render(WindowContext& /*ctx*/) {
-    initEditorIfNeeded();
+    initIfNeeded();
     font_scale_ = std::clamp(font_scale_, kConsoleFontScaleMin, kConsoleFontScaleMax);
 
-    ImGuiContext* imguiCtx = ImGui::GetCurrentContext();
-    ImGuiWindow* previousFocusWindow = imguiCtx ? imguiCtx->NavWindow : nullptr;
-    const bool windowWasFocused = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows);
-
     // Settings / controls row
     ImGui::SetNextItemWidth(120);
     ImGui::InputInt("Max lines", &max_lines_);
@@ -336,18 +187,12 @@ void ConsoleLogWindow::render(WindowContext& /*ctx*/) {
     ImGui::SameLine();
     if (ImGui::Button("Clear")) {
         gb2d::logging::clear_log_buffer();
-        editor_.SetText("");
-        last_snapshot_size_ = 0;
-        last_hash_ = 0;
-        prev_raw_.clear();
-        editor_text_cache_.clear();
-        prev_char_count_ = 0;
-        ++text_version_;
+        view_.clear();
+        selected_line_ = UINT64_MAX;
     }
     ImGui::SameLine();
     if (ImGui::Button("Copy")) {
-        auto txt = editor_.GetText();
-        ImGui::SetClipboardText(txt.c_str());
+        ImGui::SetClipboardText(view_.visibleText().c_str());
     }
     ImGui::SameLine();
     ImGui::TextUnformatted("Font");
@@ -374,13 +219,10 @@ void ConsoleLogWindow::render(WindowContext& /*ctx*/) {
     ImGui::TextUnformatted("Tone");
     ImGui::SameLine();
     ImGui::SetNextItemWidth(120.0f);
-    if (ImGui::SliderFloat("##console_text_brightness", &text_brightness_, kConsoleTextBrightnessMin, kConsoleTextBrightnessMax, "%.2f")) {
-        applyPalette();
-    }
+    ImGui::SliderFloat("##console_text_brightness", &text_brightness_, kConsoleTextBrightnessMin, kConsoleTextBrightnessMax, "%.2f");
     ImGui::SameLine();
     if (ImGui::Button("Reset##console_text_tone")) {
         text_brightness_ = 1.0f;
-        applyPalette();
     }
     ImGui::NewLine();
 
@@ -424,90 +266,52 @@ void ConsoleLogWindow::render(WindowContext& /*ctx*/) {
     }
     
     ImGui::SameLine();
-    ImGui::Checkbox("Aa", &search_case_sensitive_); ImGui::SameLine();
+    if (ImGui::Checkbox("Aa", &search_case_sensitive_)) searchEdited = true;
+    ImGui::SameLine();
     bool goPrev = ImGui::ArrowButton("##search_prev", ImGuiDir_Left); ImGui::SameLine();
     bool goNext = ImGui::ArrowButton("##search_next", ImGuiDir_Right); ImGui::SameLine();
     
     if (ImGui::Button("Clear Search")) {
         search_query_.clear();
-        search_matches_.clear();
         search_current_index_ = 0;
     }
     if (ImGui::IsItemFocused() && ImGui::IsKeyPressed(ImGuiKey_Enter)) {
         goNext = true;
     }
 
-    if (searchEdited || search_last_query_ != search_query_ || search_last_version_ != text_version_ || search_last_case_sensitive_ != search_case_sensitive_) {
-        search_matches_.clear();
+    pullNewLines();
+
+    const int matchCount = (int)view_.searchMatchCount();
+    if (searchEdited) {
         search_current_index_ = 0;
-        search_last_query_ = search_query_;
-        search_last_version_ = text_version_;
-        search_last_case_sensitive_ = search_case_sensitive_;
-        if (!search_query_.empty()) {
-            auto lines = editor_.GetTextLines();
-            std::string needle = search_query_;
-            if (!search_case_sensitive_) {
-                std::transform(needle.begin(), needle.end(), needle.begin(), [](unsigned char c){ return (char)tolower(c); });
-            }
-            for (int li = 0; li < (int)lines.size(); ++li) {
-                const std::string& L = lines[li];
-                std::string hay = L;
-                if (!search_case_sensitive_) {
-                    std::transform(hay.begin(), hay.end(), hay.begin(), [](unsigned char c){ return (char)tolower(c); });
-                }
-                size_t pos = hay.find(needle);
-                while (!needle.empty() && pos != std::string::npos) {
-                    search_matches_.push_back({ li, (int)pos, (int)(pos + needle.size()) });
-                    pos = hay.find(needle, pos + (needle.size() ? needle.size() : 1));
-                }
-            }
-        }
-        search_selection_dirty_ = true;
+        scroll_to_match_ = true;
     }
-
-    if (!search_matches_.empty()) {
-        if (goNext) { search_current_index_ = (search_current_index_ + 1) % (int)search_matches_.size(); search_selection_dirty_ = true; }
-        if (goPrev) { search_current_index_ = (search_current_index_ - 1 + (int)search_matches_.size()) % (int)search_matches_.size(); search_selection_dirty_ = true; }
+    if (search_current_index_ >= matchCount) search_current_index_ = 0;
+    if (matchCount > 0) {
+        if (goNext) { search_current_index_ = (search_current_index_ + 1) % matchCount; scroll_to_match_ = true; }
+        if (goPrev) { search_current_index_ = (search_current_index_ - 1 + matchCount) % matchCount; scroll_to_match_ = true; }
         ImGui::SameLine();
-        ImGui::TextDisabled("%d/%d", search_current_index_ + 1, (int)search_matches_.size());
+        ImGui::TextDisabled("%d/%d", search_current_index_ + 1, matchCount);
     } else if (!search_query_.empty()) {
         ImGui::SameLine();
         ImGui::TextDisabled("0/0");
     }
 
-    if (search_selection_dirty_ && !search_matches_.empty()) {
-        search_selection_dirty_ = false;
-        const auto& m = search_matches_[search_current_index_];
-        TextEditor::Coordinates start{ m.line, m.start_col };
-        TextEditor::Coordinates end{ m.line, m.end_col };
-        editor_.SetSelection(start, end, TextEditor::SelectionMode::Normal);
-        editor_.SetCursorPosition(end);
-    }
-
-    rebuildEditorIfNeeded();
-    constexpr ImGuiWindowFlags editorFlags = ImGuiWindowFlags_HorizontalScrollbar |
-                                            ImGuiWindowFlags_AlwaysHorizontalScrollbar |
-                                            ImGuiWindowFlags_NoMove;
-    ImGuiWindow* consoleChildWindow = nullptr;
-    if (ImGui::BeginChild("##console_log_editor", ImVec2(0, 0), false, editorFlags)) {
-        consoleChildWindow = ImGui::GetCurrentWindow();
+    constexpr ImGuiWindowFlags logFlags = ImGuiWindowFlags_HorizontalScrollbar |
+                                          ImGuiWindowFlags_AlwaysHorizontalScrollbar |
+                                          ImGuiWindowFlags_NoMove;
+    ImGui::PushStyleColor(ImGuiCol_ChildBg, kConsoleBackground);
+    if (ImGui::BeginChild("##console_log_rows", ImVec2(0, 0), false, logFlags)) {
         if (font_scale_ != 1.0f) {
             ImGui::SetWindowFontScale(font_scale_);
         }
-        editor_.Render("##log_editor");
+        renderRows();
         if (font_scale_ != 1.0f) {
             ImGui::SetWindowFontScale(1.0f);
         }
     }
     ImGui::EndChild();
-
-    if (last_autoscroll_triggered_ && !windowWasFocused && imguiCtx && consoleChildWindow) {
-        ImGuiWindow* currentNav = imguiCtx->NavWindow;
-        if (currentNav == consoleChildWindow && previousFocusWindow && previousFocusWindow != consoleChildWindow) {
-            ImGui::FocusWindow(previousFocusWindow);
-        }
-    }
-    last_autoscroll_triggered_ = false;
+    ImGui::PopStyleColor();
 }
 
 void ConsoleLogWindow::serialize(nlohmann::json& out) const {
@@ -535,7 +339,6 @@ void ConsoleLogWindow::deserialize(const nlohmann::json& in) {
     }
     if (auto it = in.find("text_brightness"); it != in.end() && (it->is_number_float() || it->is_number_integer())) {
         text_brightness_ = std::clamp((float)it->get<double>(), kConsoleTextBrightnessMin, kConsoleTextBrightnessMax);
-        if (editor_initialized_) applyPalette();
     }
 }
 
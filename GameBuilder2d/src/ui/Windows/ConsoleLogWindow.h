@@ -1,13 +1,14 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <optional>
 #include <cstdint>
 #include "ui/Window.h"
-#include <TextEditor.h>
 // For logging::LogLine
 #include "services/logger/LogManager.h"
+#include "services/logger/LogViewIndex.h"
 
 namespace gb2d {
 
@@ -37,34 +38,25 @@ private:
     float font_scale_{1.0f};
     float text_brightness_{1.0f};
 
-    // TextEditor-backed console state
-    TextEditor editor_{};
-    bool editor_initialized_{false};
-    size_t last_snapshot_size_{0};
-    uint64_t last_hash_{0};
-    bool user_was_at_bottom_{true};
-    std::vector<::gb2d::logging::LogLine> prev_raw_{};
-    std::string editor_text_cache_{};
-    size_t prev_emitted_count_{0};
-    size_t prev_char_count_{0};
-    size_t text_version_{0};
+    // Retained lines and the filtered rows; only the rows on screen are drawn each frame
+    logging::LogViewIndex view_{};
+    bool initialized_{false};
+    uint64_t next_seq_{0};       // log buffer sequence to read from next frame
+    int lines_max_{0};           // max_lines_ the view was filled with
+    std::vector<logging::LogLine> fresh_{};
+    uint64_t selected_line_{UINT64_MAX}; // line id of the clicked row
+    std::vector<std::pair<size_t, size_t>> spans_{};
 
     // Search state
     std::string search_query_{};
-    std::string search_last_query_{};
-    size_t search_last_version_{(size_t)-1};
-    struct SearchMatch { int line; int start_col; int end_col; };
-    std::vector<SearchMatch> search_matches_{};
     int search_current_index_{0};
     bool search_case_sensitive_{false};
-    bool search_selection_dirty_{false};
-    bool search_last_case_sensitive_{false};
-    bool last_autoscroll_triggered_{false};
+    bool scroll_to_match_{false};
 
     // Helpers
-    void initEditorIfNeeded();
-    void rebuildEditorIfNeeded();
-    void applyPalette();
+    void initIfNeeded();
+    void pullNewLines();
+    void renderRows();
 };
 
 } // namespace gb2d
@@ -99,6 +99,9 @@ GameWindow::~GameWindow() {
         current_game_->unload();
         current_game_.reset();
     }
+    if (current_game_index_ >= 0 && current_game_index_ < (int)games_.size()) {
+        gb2d::textures::TextureManager::releasePreloadGroup(games_[current_game_index_].id);
+    }
     releaseGameIcons();
     unloadRenderTarget();
 }
@@ -145,9 +148,14 @@ void GameWindow::ensureGameSelected() {
 
 void GameWindow::switchGame(int index) {
     if (index < 0 || index >= (int)games_.size()) return;
+    // Preload the incoming game's textures before dropping the outgoing group so shared ones stay resident.
+    gb2d::textures::TextureManager::preloadGroup(games_[index].id);
     if (current_game_) {
         current_game_->unload();
     }
+    if (current_game_index_ >= 0 && current_game_index_ < (int)games_.size() && current_game_index_ != index) {
+        gb2d::textures::TextureManager::releasePreloadGroup(games_[current_game_index_].id);
+    }
     current_game_ = games_[index].factory();
     current_game_index_ = index;
     game_needs_init_ = true;
@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+struct rAudioBuffer;
+
+using gb2d::audio::AudioManager;
+using gb2d::audio::PlaybackHandle;
+
+namespace {
+
+constexpr int kIterations = 200000;
+constexpr int kRuns = 5;
+
+// Raylib's LoadSoundAlias allocates and registers an audio buffer and UnloadSoundAlias frees it;
+// the stub does the same amount of heap work so the alias cost is not optimized away.
+struct AllocatingHooks {
+    static constexpr std::size_t kBufferBytes = 512;
+    static inline std::size_t live = 0;
+
+    static Sound make() {
+        auto* buffer = new unsigned char[kBufferBytes];
+        std::memset(buffer, 0, kBufferBytes);
+        ++live;
+        Sound sound{};
+        sound.frameCount = 1;
+        sound.stream.buffer = reinterpret_cast<rAudioBuffer*>(buffer);
+        return sound;
+    }
+    static void destroy(Sound sound) {
+        delete[] reinterpret_cast<unsigned char*>(sound.stream.buffer);
+        --live;
+    }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            auto table = gb2d::audio::testing::stubRaylibHooks();
+            table.loadSound = [](const char*) { return make(); };
+            table.unloadSound = destroy;
+            table.loadSoundAlias = [](Sound) { return make(); };
+            table.unloadSoundAlias = destroy;
+            return table;
+        }();
+        return api;
+    }
+};
+
+double nsPerIteration(std::chrono::steady_clock::time_point started) {
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+    return elapsed.count() / kIterations;
+}
+
+} // namespace
+
+TEST_CASE("Sound play latency with pooled aliases", "[audio][aliases][!benchmark]") {
+    const gb2d::audio::testing::ScopedTempDir dir("gb2d_alias_pool_bench");
+    dir.touch("blip.wav");
+
+    gb2d::audio::testing::resetAudioForTesting(dir.path(), AllocatingHooks::hooks());
+    AudioManager::init();
+    const auto key = AudioManager::acquireSound("blip.wav").key;
+    const Sound source = *AudioManager::tryGetSound(key);
+    const auto& api = AllocatingHooks::hooks();
+
+    // What playSound used to add per trigger: one alias created and freed.
+    double aliasPairNs = 1e300;
+    double pooledNs = 1e300;
+    double perPlayAliasNs = 1e300;
+    for (int run = 0; run < kRuns; ++run) {
+        auto started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            api.unloadSoundAlias(api.loadSoundAlias(source));
+        }
+        aliasPairNs = std::min(aliasPairNs, nsPerIteration(started));
+
+        started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            const PlaybackHandle handle = AudioManager::playSound(key);
+            AudioManager::stopSound(handle);
+        }
+        pooledNs = std::min(pooledNs, nsPerIteration(started));
+
+        // The same loop paying the old alias cost inline, as the pre-pool playSound did.
+        started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            Sound alias = api.loadSoundAlias(source);
+            const PlaybackHandle handle = AudioManager::playSound(key);
+            AudioManager::stopSound(handle);
+            api.unloadSoundAlias(alias);
+        }
+        perPlayAliasNs = std::min(perPlayAliasNs, nsPerIteration(started));
+    }
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.aliasPoolMisses == 0);
+    std::printf("%d play+stop pairs per run, best of %d, %zu-byte alias buffers\n",
+                kIterations, kRuns, AllocatingHooks::kBufferBytes);
+    std::printf("%-26s %9s\n", "mode", "ns/play");
+    std::printf("%-26s %9.1f\n", "alias create+free only", aliasPairNs);
+    std::printf("%-26s %9.1f\n", "per-play alias", perPlayAliasNs);
+    std::printf("%-26s %9.1f\n", "pooled alias", pooledNs);
+    std::printf("pool hits %zu, misses %zu, idle aliases %zu\n",
+                metrics.aliasPoolHits, metrics.aliasPoolMisses, metrics.pooledAliases);
+
+    AudioManager::resetForTesting();
+    REQUIRE(AllocatingHooks::live == 0);
+}
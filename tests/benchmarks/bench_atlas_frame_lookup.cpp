@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::AtlasFrameId;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+constexpr int kAtlasFrames = 1000;
+constexpr int kAnimationFrames = 16;
+constexpr int kLookupsPerSample = 100000;
+
+struct LookupFixture {
+    LookupFixture() {
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        dir = std::filesystem::temp_directory_path() / ("gb2d_frame_lookup_bench_" + std::to_string(stamp));
+        std::filesystem::create_directories(dir);
+        {
+            std::ofstream out(dir / "hero.json");
+            out << "{\"frames\": [\n";
+            for (int i = 0; i < kAtlasFrames; ++i) {
+                out << "{\"filename\": \"Hero/Run_" << i << ".png\", \"frame\": {\"x\": " << (i % 32) * 32
+                    << ", \"y\": " << (i / 32) * 32 << ", \"w\": 32, \"h\": 32}}" << (i + 1 < kAtlasFrames ? ",\n" : "\n");
+            }
+            out << "], \"meta\": {\"image\": \"hero.png\"}}\n";
+            std::ofstream png(dir / "hero.png", std::ios::binary);
+            png << "stub";
+        }
+
+        TextureManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+        ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.string() });
+        TextureManager::setLoaderForTesting([](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+            TextureManager::LoadedTexture stub;
+            stub.texture.id = 1;
+            stub.texture.width = 1024;
+            stub.texture.height = 1024;
+            stub.texture.mipmaps = 1;
+            stub.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            return stub;
+        });
+        TextureManager::init();
+        atlasKey = TextureManager::acquireAtlas("hero.json").key;
+
+        for (int i = 0; i < kAnimationFrames; ++i) {
+            names.push_back("Hero/Run_" + std::to_string(i * 7) + ".png");
+            ids.push_back(TextureManager::resolveAtlasFrame(atlasKey, names.back()));
+        }
+    }
+
+    ~LookupFixture() {
+        TextureManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    std::filesystem::path dir;
+    std::string atlasKey;
+    std::vector<std::string> names;
+    std::vector<AtlasFrameId> ids;
+};
+
+// Sums frame x so the lookups cannot be optimized away.
+float lookupByName(const LookupFixture& fixture, int count) {
+    float sum = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        if (auto frame = TextureManager::getAtlasFrame(fixture.atlasKey, fixture.names[i % kAnimationFrames])) {
+            sum += frame->frame.x;
+        }
+    }
+    return sum;
+}
+
+float lookupById(const LookupFixture& fixture, int count) {
+    float sum = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        if (const auto* frame = TextureManager::frameById(fixture.ids[i % kAnimationFrames])) {
+            sum += frame->frame.x;
+        }
+    }
+    return sum;
+}
+
+template <typename Fn>
+double nanosecondsPerCall(Fn&& fn, int count) {
+    const auto start = std::chrono::steady_clock::now();
+    volatile float sink = fn(count);
+    (void)sink;
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / count;
+}
+
+} // namespace
+
+TEST_CASE("Atlas frame lookup cost", "[texture][atlas][frame-id][!benchmark]") {
+    LookupFixture fixture;
+    REQUIRE(fixture.ids.front().valid());
+
+    const double byName = nanosecondsPerCall([&](int n) { return lookupByName(fixture, n); }, kLookupsPerSample);
+    const double byId = nanosecondsPerCall([&](int n) { return lookupById(fixture, n); }, kLookupsPerSample * 10);
+    std::printf("getAtlasFrame(name): %8.1f ns/call (%7.2f M/s)\n", byName, 1000.0 / byName);
+    std::printf("frameById(id):       %8.1f ns/call (%7.2f M/s)  speedup=%.0fx\n", byId, 1000.0 / byId, byName / byId);
+
+    BENCHMARK("getAtlasFrame by name x100k") {
+        return lookupByName(fixture, kLookupsPerSample);
+    };
+
+    BENCHMARK("frameById x100k") {
+        return lookupById(fixture, kLookupsPerSample);
+    };
+}
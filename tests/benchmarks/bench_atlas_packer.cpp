@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "services/texture/AtlasPacker.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using gb2d::textures::PackResult;
+using gb2d::textures::PackSize;
+using gb2d::textures::SkylinePacker;
+using gb2d::textures::packRects;
+
+namespace {
+
+constexpr int kPageSize = 1024;
+constexpr int kPadding = 1;
+
+std::vector<PackSize> randomSprites(std::size_t count, int minSide, int maxSide, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(minSide, maxSide);
+    std::vector<PackSize> sizes;
+    sizes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        sizes.push_back(PackSize{dist(rng), dist(rng)});
+    }
+    return sizes;
+}
+
+// Mirrors TextureManager::acquireSprite: sprites arrive one at a time and open pages on demand.
+PackResult packOnline(const std::vector<PackSize>& sizes) {
+    PackResult result;
+    std::vector<std::unique_ptr<SkylinePacker>> pages;
+    std::size_t area = 0;
+    for (const auto& size : sizes) {
+        bool placed = false;
+        for (auto& page : pages) {
+            if (page->insert(size.width, size.height)) {
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            pages.push_back(std::make_unique<SkylinePacker>(kPageSize, kPageSize, kPadding));
+            placed = pages.back()->insert(size.width, size.height).has_value();
+        }
+        if (placed) {
+            area += static_cast<std::size_t>(size.width) * static_cast<std::size_t>(size.height);
+        }
+    }
+    result.pageCount = static_cast<int>(pages.size());
+    result.occupancy = static_cast<double>(area) / (static_cast<double>(pages.size()) * kPageSize * kPageSize);
+    return result;
+}
+
+void reportEfficiency(const std::string& label, const std::vector<PackSize>& sizes) {
+    const auto online = packOnline(sizes);
+    const auto offline = packRects(sizes, kPageSize, kPageSize, kPadding);
+    std::printf("%-28s sprites=%6zu  online: pages=%3d occupancy=%5.1f%%  sorted: pages=%3d occupancy=%5.1f%%\n",
+                label.c_str(),
+                sizes.size(),
+                online.pageCount,
+                online.occupancy * 100.0,
+                offline.pageCount,
+                offline.occupancy * 100.0);
+}
+
+} // namespace
+
+TEST_CASE("Atlas packer efficiency", "[texture][packer][!benchmark]") {
+    reportEfficiency("uniform 16x16", std::vector<PackSize>(4000, PackSize{16, 16}));
+    reportEfficiency("uniform 32x32", std::vector<PackSize>(2000, PackSize{32, 32}));
+    reportEfficiency("random 8..64", randomSprites(4000, 8, 64, 7));
+    reportEfficiency("random 4..128", randomSprites(2000, 4, 128, 11));
+    reportEfficiency("random 8..64 (10k)", randomSprites(10000, 8, 64, 13));
+}
+
+TEST_CASE("Atlas packer throughput", "[texture][packer][!benchmark]") {
+    const auto sprites = randomSprites(4000, 8, 64, 7);
+
+    BENCHMARK("online skyline insert, 4000 sprites") {
+        return packOnline(sprites).pageCount;
+    };
+
+    BENCHMARK("sorted packRects, 4000 sprites") {
+        return packRects(sprites, kPageSize, kPageSize, kPadding).pageCount;
+    };
+
+    BENCHMARK("single page fill, 16x16") {
+        SkylinePacker packer(kPageSize, kPageSize, kPadding);
+        std::size_t placed = 0;
+        while (packer.insert(16, 16)) {
+            placed++;
+        }
+        return placed;
+    };
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using gb2d::audio::AudioManager;
+
+namespace {
+
+constexpr int kCallsPerProducer = 20000;
+constexpr std::array<int, 4> kProducerCounts{1, 2, 4, 8};
+
+// Voices finish as soon as the manager looks at them, so slots never run out and the numbers
+// measure the call path rather than throttling.
+const AudioManager::RaylibHooks& instantHooks() {
+    static const AudioManager::RaylibHooks api = [] {
+        auto table = gb2d::audio::testing::stubRaylibHooks();
+        table.isSoundPlaying = [](Sound) { return false; };
+        return table;
+    }();
+    return api;
+}
+
+struct RunResult {
+    double nsPerCall{0.0};   // mean producer-side cost of one call
+    double worstCallUs{0.0}; // slowest single call seen by any producer
+    std::size_t rejected{0};
+};
+
+// Producers hammer one entry point while a game-loop thread keeps ticking, as in a game whose
+// gameplay and physics threads trigger sounds.
+template <typename Call>
+RunResult runProducers(int producers, Call call) {
+    std::atomic<bool> stop{false};
+    std::thread frameLoop([&stop]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            AudioManager::tick();
+            std::this_thread::yield();
+        }
+    });
+
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<double> totals(static_cast<std::size_t>(producers), 0.0);
+    std::vector<double> worst(static_cast<std::size_t>(producers), 0.0);
+    std::vector<std::size_t> rejected(static_cast<std::size_t>(producers), 0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            const auto index = static_cast<std::size_t>(p);
+            const auto started = std::chrono::steady_clock::now();
+            for (int i = 0; i < kCallsPerProducer; ++i) {
+                const auto before = std::chrono::steady_clock::now();
+                rejected[index] += call() ? 0 : 1;
+                const std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - before;
+                worst[index] = std::max(worst[index], took.count());
+            }
+            const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+            totals[index] = elapsed.count();
+        });
+    }
+    while (ready.load() < producers) {
+        std::this_thread::yield();
+    }
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stop.store(true);
+    frameLoop.join();
+    AudioManager::tick();
+
+    RunResult result;
+    for (std::size_t i = 0; i < totals.size(); ++i) {
+        result.nsPerCall += totals[i] / kCallsPerProducer / producers;
+        result.worstCallUs = std::max(result.worstCallUs, worst[i]);
+        result.rejected += rejected[i];
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Audio command queue vs. locked calls with several producers", "[audio][commands][!benchmark]") {
+    const gb2d::audio::testing::ScopedTempDir dir("gb2d_audio_commands_bench");
+    dir.touch("blip.wav");
+
+    gb2d::audio::testing::resetAudioForTesting(dir.path(), instantHooks());
+    AudioManager::init();
+    const auto key = AudioManager::acquireSound("blip.wav").key;
+
+    std::printf("%d calls per producer, %u hardware threads, one thread ticking\n",
+                kCallsPerProducer, std::thread::hardware_concurrency());
+    std::printf("%-10s %-14s %10s %12s %9s\n", "producers", "mode", "ns/call", "worst (us)", "rejected");
+    for (int producers : kProducerCounts) {
+        const auto locked = runProducers(producers, [&key]() { return AudioManager::playSound(key).valid(); });
+        const auto posted = runProducers(producers, [&key]() { return AudioManager::postPlaySound(key); });
+        std::printf("%-10d %-14s %10.0f %12.1f %9s\n", producers, "playSound", locked.nsPerCall, locked.worstCallUs, "-");
+        std::printf("%-10d %-14s %10.0f %12.1f %9zu\n", producers, "postPlaySound", posted.nsPerCall, posted.worstCallUs, posted.rejected);
+    }
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.commandsApplied + metrics.commandsPending == metrics.commandsPosted);
+    std::printf("posted %zu, applied %zu, rejected %zu\n",
+                metrics.commandsPosted, metrics.commandsApplied, metrics.commandsRejected);
+
+    AudioManager::resetForTesting();
+}
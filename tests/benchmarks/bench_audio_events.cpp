@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioEvent;
+using gb2d::audio::AudioEventSink;
+using gb2d::audio::AudioManager;
+
+namespace {
+
+constexpr int kPlaysPerFrame = 1000;
+constexpr int kFrames = 200;
+constexpr int kSounds = 8;
+constexpr std::int64_t kVoices = 16;
+
+// Overrides only onAudioEvent, so the default onAudioEvents calls it once per event.
+struct PerEventSink final : AudioEventSink {
+    std::size_t seen{0};
+    void onAudioEvent(const AudioEvent& event) override { seen += event.count; }
+};
+
+struct BatchSink final : AudioEventSink {
+    std::size_t seen{0};
+    void onAudioEvents(std::span<const AudioEvent> events) override {
+        for (const auto& event : events) {
+            seen += event.count;
+        }
+    }
+};
+
+struct FrameResult {
+    double nsPerPlay{0.0};
+    double usPerTick{0.0};
+    double eventsPerFrame{0.0};
+    std::size_t published{0};
+};
+
+FrameResult runFrames(const std::vector<std::string>& keys, AudioEventSink* sink) {
+    AudioManager::tick();
+    const auto before = AudioManager::metrics();
+    gb2d::audio::AudioEventSubscription subscription{};
+    if (sink) {
+        subscription = AudioManager::subscribeToAudioEvents(sink);
+    }
+    double playNs = 0.0;
+    double tickUs = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        const auto started = std::chrono::steady_clock::now();
+        for (int play = 0; play < kPlaysPerFrame; ++play) {
+            (void)AudioManager::playSound(keys[static_cast<std::size_t>(play % kSounds)]);
+        }
+        const auto played = std::chrono::steady_clock::now();
+        AudioManager::tick(1.0f / 60.0f);
+        const std::chrono::duration<double, std::nano> plays = played - started;
+        const std::chrono::duration<double, std::micro> tick = std::chrono::steady_clock::now() - played;
+        playNs += plays.count();
+        tickUs += tick.count();
+    }
+    if (sink) {
+        AudioManager::unsubscribeFromAudioEvents(subscription);
+    }
+    const auto after = AudioManager::metrics();
+    FrameResult result;
+    result.nsPerPlay = playNs / (static_cast<double>(kFrames) * kPlaysPerFrame);
+    result.usPerTick = tickUs / kFrames;
+    result.published = after.eventsPublished - before.eventsPublished;
+    result.eventsPerFrame =
+        static_cast<double>(result.published - (after.eventsCoalesced - before.eventsCoalesced)) / kFrames;
+    return result;
+}
+
+// Voices never finish, so once the 16 slots fill every play steals one and publishes a
+// SoundPlaybackStopped event.
+void setUp(const std::filesystem::path& dir, bool coalesce, std::vector<std::string>& keys) {
+    static const auto hooks = gb2d::audio::testing::stubRaylibHooks();
+    gb2d::audio::testing::resetAudioForTesting(dir, hooks);
+    ConfigurationManager::set("audio.core.coalesce_events", coalesce);
+    ConfigurationManager::set("audio.engine.max_concurrent_sounds", kVoices);
+    ConfigurationManager::set("audio.engine.steal_policy", std::string("oldest"));
+    AudioManager::init();
+    keys.clear();
+    for (int i = 0; i < kSounds; ++i) {
+        keys.push_back(AudioManager::acquireSound("sfx/explosion_variant_" + std::to_string(i) + ".wav").key);
+    }
+}
+
+} // namespace
+
+// A frame that triggers 1000 sounds, e.g. a bullet-hell burst. "closed" is the Audio Manager
+// window closed (no subscribers); the others have one sink open and differ in how it consumes
+// the frame's batch.
+TEST_CASE("Audio events: 1000 plays per frame", "[audio][events][!benchmark]") {
+    const gb2d::audio::testing::ScopedTempDir dir("gb2d_audio_events_bench");
+    for (int i = 0; i < kSounds; ++i) {
+        dir.touch(std::filesystem::path("sfx") / ("explosion_variant_" + std::to_string(i) + ".wav"));
+    }
+
+    std::vector<std::string> keys;
+    std::printf("%d plays per frame, %d frames, %d sounds, %lld voices\n", kPlaysPerFrame, kFrames, kSounds,
+                static_cast<long long>(kVoices));
+    std::printf("%-24s %10s %12s %14s\n", "mode", "ns/play", "tick (us)", "events/frame");
+    const auto report = [](const char* mode, const FrameResult& result) {
+        std::printf("%-24s %10.0f %12.1f %14.1f\n", mode, result.nsPerPlay, result.usPerTick, result.eventsPerFrame);
+    };
+
+    setUp(dir.path(), false, keys);
+    const auto closed = runFrames(keys, nullptr);
+    REQUIRE(closed.published == 0);
+    report("closed (no sinks)", closed);
+
+    PerEventSink perEvent;
+    const auto perEventResult = runFrames(keys, &perEvent);
+    REQUIRE(perEvent.seen == perEventResult.published);
+    report("sink, onAudioEvent", perEventResult);
+
+    BatchSink batch;
+    const auto batchResult = runFrames(keys, &batch);
+    REQUIRE(batch.seen == batchResult.published);
+    report("sink, onAudioEvents", batchResult);
+
+    setUp(dir.path(), true, keys);
+    BatchSink coalesced;
+    const auto coalescedResult = runFrames(keys, &coalesced);
+    REQUIRE(coalesced.seen == coalescedResult.published);
+    report("sink, coalesced", coalescedResult);
+
+    AudioManager::resetForTesting();
+}
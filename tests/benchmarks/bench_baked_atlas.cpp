@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "services/texture/BakedAtlas.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::BakedAtlas;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+struct BenchDir {
+    BenchDir() {
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path = std::filesystem::temp_directory_path() / ("gb2d_baked_atlas_bench_" + std::to_string(stamp));
+        std::filesystem::create_directories(path / "json");
+        std::filesystem::create_directories(path / "baked");
+    }
+    ~BenchDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+    std::filesystem::path path;
+};
+
+// TexturePacker-style JSON array export with the fields real exports carry for every frame.
+void writeAtlasJson(const std::filesystem::path& jsonPath, int frameCount) {
+    std::ofstream out(jsonPath);
+    out << "{\"frames\": [\n";
+    for (int i = 0; i < frameCount; ++i) {
+        const int x = (i % 64) * 32;
+        const int y = (i / 64) * 32;
+        out << "{\"filename\": \"characters/hero/walk_" << i << ".png\", "
+            << "\"frame\": {\"x\": " << x << ", \"y\": " << y << ", \"w\": 32, \"h\": 32}, "
+            << "\"rotated\": false, \"trimmed\": false, "
+            << "\"spriteSourceSize\": {\"x\": 0, \"y\": 0, \"w\": 32, \"h\": 32}, "
+            << "\"sourceSize\": {\"w\": 32, \"h\": 32}, \"pivot\": {\"x\": 0.5, \"y\": 0.5}}"
+            << (i + 1 < frameCount ? ",\n" : "\n");
+    }
+    out << "], \"meta\": {\"image\": \"sheet.png\", \"format\": \"RGBA8888\"}}\n";
+    std::ofstream png(jsonPath.parent_path() / "sheet.png", std::ios::binary);
+    png << "stub";
+}
+
+void initManager(const std::filesystem::path& searchPath) {
+    TextureManager::resetForTesting();
+    ConfigurationManager::loadOrDefault();
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ searchPath.string() });
+    TextureManager::setLoaderForTesting([](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture stub;
+        stub.texture.id = 1;
+        stub.texture.width = 2048;
+        stub.texture.height = 2048;
+        stub.texture.mipmaps = 1;
+        stub.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        stub.ownsTexture = false;
+        return stub;
+    });
+    TextureManager::init();
+}
+
+// acquire + release; with textures::max_bytes = 0 the release drops the record, so every
+// iteration reloads the metadata from disk.
+std::size_t acquireOnce(const std::string& identifier) {
+    auto handle = TextureManager::acquireAtlas(identifier);
+    const auto frames = handle.frames.size();
+    TextureManager::releaseAtlas(handle.key);
+    return frames;
+}
+
+double averageMs(const std::string& identifier, int iterations) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        acquireOnce(identifier);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+} // namespace
+
+TEST_CASE("Baked atlas load time vs JSON", "[texture][atlas][!benchmark]") {
+    BenchDir dir;
+    for (int frames : {1000, 10000, 50000}) {
+        const auto jsonPath = dir.path / "json" / ("atlas_" + std::to_string(frames) + ".json");
+        const auto bakedJsonPath = dir.path / "baked" / jsonPath.filename();
+        writeAtlasJson(jsonPath, frames);
+        writeAtlasJson(bakedJsonPath, frames);
+        REQUIRE(TextureManager::bakeAtlas(bakedJsonPath));
+
+        const int iterations = frames >= 50000 ? 3 : 10;
+        initManager(dir.path / "json");
+        const double jsonMs = averageMs(jsonPath.filename().string(), iterations);
+        initManager(dir.path / "baked");
+        const double bakedMs = averageMs(bakedJsonPath.filename().string(), iterations);
+
+        std::printf("frames=%6d  json: %8.3f ms (%7zu bytes)  baked: %8.3f ms (%7zu bytes)  speedup=%5.1fx\n",
+                    frames,
+                    jsonMs,
+                    static_cast<std::size_t>(std::filesystem::file_size(jsonPath)),
+                    bakedMs,
+                    static_cast<std::size_t>(std::filesystem::file_size(dir.path / "baked" /
+                                                                        ("atlas_" + std::to_string(frames) + ".gb2datlas"))),
+                    bakedMs > 0.0 ? jsonMs / bakedMs : 0.0);
+    }
+    TextureManager::resetForTesting();
+}
+
+TEST_CASE("Baked atlas throughput", "[texture][atlas][!benchmark]") {
+    BenchDir dir;
+    constexpr int kFrames = 10000;
+    const auto jsonPath = dir.path / "json" / "atlas.json";
+    const auto bakedJsonPath = dir.path / "baked" / "atlas.json";
+    writeAtlasJson(jsonPath, kFrames);
+    writeAtlasJson(bakedJsonPath, kFrames);
+    REQUIRE(TextureManager::bakeAtlas(bakedJsonPath));
+    const auto bakedPath = dir.path / "baked" / "atlas.gb2datlas";
+
+    std::vector<std::string> names;
+    names.reserve(kFrames);
+    for (int i = 0; i < kFrames; ++i) {
+        names.push_back("characters/hero/walk_" + std::to_string(i) + ".png");
+    }
+
+    initManager(dir.path / "json");
+    BENCHMARK("acquireAtlas JSON, 10k frames") {
+        return acquireOnce("atlas.json");
+    };
+
+    initManager(dir.path / "baked");
+    BENCHMARK("acquireAtlas baked, 10k frames") {
+        return acquireOnce("atlas.json");
+    };
+
+    BENCHMARK("BakedAtlas::open, 10k frames") {
+        return BakedAtlas::open(bakedPath)->frameCount();
+    };
+
+    auto baked = BakedAtlas::open(bakedPath);
+    REQUIRE(baked != nullptr);
+    BENCHMARK("BakedAtlas::find x10k") {
+        std::size_t hits = 0;
+        for (const auto& name : names) {
+            hits += baked->find(name).has_value() ? 1 : 0;
+        }
+        return hits;
+    };
+
+    TextureManager::resetForTesting();
+}
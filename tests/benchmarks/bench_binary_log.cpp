@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/BinaryLogSink.h"
+#include "services/logger/LogManager.h"
+
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using gb2d::logging::BinaryLogOptions;
+using gb2d::logging::BinaryLogSink;
+using gb2d::logging::Config;
+using gb2d::logging::LogManager;
+
+namespace {
+
+constexpr int kMessages = 1000000;
+constexpr std::array<int, 2> kProducerCounts{1, 4};
+
+struct RunResult {
+    double nsPerMessage{0.0}; // wall time per message, including the final flush/close
+    std::uint64_t bytes{0};   // bytes on disk afterwards
+};
+
+uint64_t directoryBytes(const fs::path& dir) {
+    uint64_t total = 0;
+    std::error_code ec;
+    for (const auto& e : fs::directory_iterator(dir, ec)) {
+        if (e.is_regular_file()) total += e.file_size();
+    }
+    return total;
+}
+
+// Runs `body(producer, i)` kMessages times split across `producers` threads, then `finish`.
+double timeRun(int producers, const std::function<void(int, int)>& body, const std::function<void()>& finish) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    const int perProducer = kMessages / producers;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < perProducer; ++i) body(p, i);
+        });
+    }
+    while (ready.load() < producers) {
+        std::this_thread::yield();
+    }
+    const auto started = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    finish();
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+    return elapsed.count() / (perProducer * producers);
+}
+
+BinaryLogOptions binaryOptions(const fs::path& dir) {
+    BinaryLogOptions o;
+    o.enabled = true;
+    o.directory = dir;
+    o.segment_bytes = 64u << 20;
+    o.max_segments = 1000;
+    o.text_sinks = false;
+    return o;
+}
+
+} // namespace
+
+TEST_CASE("Binary log vs. spdlog basic_file_sink throughput", "[logger][binary][!benchmark]") {
+    auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    const auto root = fs::temp_directory_path() / ("gb2d_binary_log_bench_" + std::to_string(stamp));
+
+    struct Mode {
+        const char* name;
+        std::function<RunResult(const fs::path&, int)> run;
+    };
+    const std::array<Mode, 4> modes{{
+        {"spdlog basic_file_sink", [](const fs::path& dir, int producers) {
+            auto logger = std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::basic_file_sink_mt>((dir / "bench.log").string()));
+            logger->set_pattern("[%H:%M:%S.%e] [%l] %v");
+            RunResult r;
+            r.nsPerMessage = timeRun(producers, [&](int p, int i) {
+                logger->info("producer {} frame {} spawned entity {} at ({:.1f}, {:.1f})", p, i, i * 7, i * 0.5, i * 0.25);
+            }, [&] { logger->flush(); });
+            logger.reset();
+            r.bytes = directoryBytes(dir);
+            return r;
+        }},
+        {"LogManager + file sink", [](const fs::path& dir, int producers) {
+            (void)LogManager::shutdown();
+            LogManager::setSinksForTesting({ std::make_shared<spdlog::sinks::basic_file_sink_mt>((dir / "bench.log").string()) });
+            Config cfg;
+            cfg.pattern = "[%H:%M:%S.%e] [%l] %v";
+            LogManager::init(cfg);
+            RunResult r;
+            r.nsPerMessage = timeRun(producers, [](int p, int i) {
+                LogManager::info("producer {} frame {} spawned entity {} at ({:.1f}, {:.1f})", p, i, i * 7, i * 0.5, i * 0.25);
+            }, [] { LogManager::flush(); });
+            (void)LogManager::shutdown();
+            LogManager::setSinksForTesting({});
+            r.bytes = directoryBytes(dir);
+            return r;
+        }},
+        {"BinaryLogSink::write", [](const fs::path& dir, int producers) {
+            BinaryLogSink sink(binaryOptions(dir));
+            REQUIRE(sink.open());
+            RunResult r;
+            r.nsPerMessage = timeRun(producers, [&](int p, int i) {
+                sink.write(2, "producer {} frame {} spawned entity {} at ({:.1f}, {:.1f})", p, i, i * 7, i * 0.5, i * 0.25);
+            }, [&] { sink.close(); });
+            REQUIRE(sink.stats().dropped == 0);
+            r.bytes = directoryBytes(dir);
+            return r;
+        }},
+        {"LogManager binary only", [](const fs::path& dir, int producers) {
+            (void)LogManager::shutdown();
+            Config cfg;
+            cfg.binary = binaryOptions(dir);
+            LogManager::init(cfg);
+            RunResult r;
+            r.nsPerMessage = timeRun(producers, [](int p, int i) {
+                LogManager::info("producer {} frame {} spawned entity {} at ({:.1f}, {:.1f})", p, i, i * 7, i * 0.5, i * 0.25);
+            }, [] { (void)LogManager::shutdown(); });
+            r.bytes = directoryBytes(dir);
+            return r;
+        }},
+    }};
+
+    std::printf("%d messages, %u hardware threads; times include the final flush or close\n", kMessages,
+                std::thread::hardware_concurrency());
+    std::printf("%-10s %-24s %10s %10s %10s\n", "producers", "mode", "ns/msg", "MB/s", "bytes/msg");
+    for (int producers : kProducerCounts) {
+        int run = 0;
+        for (const auto& mode : modes) {
+            const auto dir = root / (std::to_string(producers) + "_" + std::to_string(run++));
+            fs::create_directories(dir);
+            const auto r = mode.run(dir, producers);
+            const double seconds = r.nsPerMessage * kMessages / 1e9;
+            std::printf("%-10d %-24s %10.0f %10.1f %10.1f\n", producers, mode.name, r.nsPerMessage,
+                        r.bytes / seconds / (1024.0 * 1024.0), (double)r.bytes / kMessages);
+            std::error_code ec;
+            fs::remove_all(dir, ec);
+        }
+    }
+
+    std::error_code ec;
+    fs::remove_all(root, ec);
+}
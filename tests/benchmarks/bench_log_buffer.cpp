@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/ImGuiLogSink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using gb2d::logging::ImGuiLogBuffer;
+using gb2d::logging::LogEntry;
+
+namespace {
+
+constexpr std::size_t kCapacity = 100000;
+constexpr int kLinesPerFrame = 100;
+constexpr int kFrames = 200;
+
+// The console buffer as it was before the ring: a vector trimmed from the front on every push
+// once full, read by copying all of it.
+class VectorLogBuffer {
+public:
+    void push(LogEntry e) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (entries_.size() >= kCapacity) {
+            entries_.erase(entries_.begin(), entries_.begin() + (std::ptrdiff_t)(entries_.size() - kCapacity + 1));
+        }
+        entries_.emplace_back(std::move(e));
+    }
+    void snapshot(std::vector<LogEntry>& out) const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        out = entries_;
+    }
+
+private:
+    mutable std::mutex mtx_;
+    std::vector<LogEntry> entries_;
+};
+
+std::string lineText(int i) {
+    return "[12:00:00] [info] frame " + std::to_string(i) + " updated 42 entities in 0.31 ms\n";
+}
+
+double msSince(std::chrono::steady_clock::time_point started) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+}
+
+} // namespace
+
+TEST_CASE("Console log buffer: vector vs. ring with a 100k-line capacity", "[logger][buffer][!benchmark]") {
+    const auto now = std::chrono::system_clock::now();
+
+    VectorLogBuffer vectorBuffer;
+    ImGuiLogBuffer ring;
+    ring.setCapacity(kCapacity);
+    for (int i = 0; i < (int)kCapacity; ++i) {
+        vectorBuffer.push(LogEntry{ spdlog::level::info, now, lineText(i) });
+        ring.push(spdlog::level::info, now, lineText(i));
+    }
+
+    // Each frame: kLinesPerFrame lines arrive into a full buffer, then the console catches up. The
+    // old console copied the whole buffer and compared it against its previous copy; the new one
+    // reads only what it has not seen.
+    std::vector<LogEntry> previous;
+    vectorBuffer.snapshot(previous);
+    double vectorPushMs = 0.0, vectorReadMs = 0.0;
+    std::size_t vectorRead = 0;
+    for (int f = 0; f < kFrames; ++f) {
+        auto started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kLinesPerFrame; ++i) {
+            vectorBuffer.push(LogEntry{ spdlog::level::info, now, lineText(f * kLinesPerFrame + i) });
+        }
+        vectorPushMs += msSince(started);
+        started = std::chrono::steady_clock::now();
+        std::vector<LogEntry> current;
+        vectorBuffer.snapshot(current);
+        std::size_t same = 0;
+        while (same < previous.size() && same < current.size() && previous[same].message == current[same].message) ++same;
+        vectorRead += current.size();
+        previous = std::move(current);
+        vectorReadMs += msSince(started);
+    }
+
+    uint64_t next = ring.nextSeq();
+    double ringPushMs = 0.0, ringReadMs = 0.0;
+    std::size_t ringRead = 0;
+    std::vector<LogEntry> fresh;
+    for (int f = 0; f < kFrames; ++f) {
+        auto started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kLinesPerFrame; ++i) {
+            ring.push(spdlog::level::info, now, lineText(f * kLinesPerFrame + i));
+        }
+        ringPushMs += msSince(started);
+        started = std::chrono::steady_clock::now();
+        fresh.clear();
+        next = ring.readSince(next, fresh);
+        ringRead += fresh.size();
+        ringReadMs += msSince(started);
+    }
+    REQUIRE(ringRead == (std::size_t)(kFrames * kLinesPerFrame));
+
+    const double pushes = (double)kFrames * kLinesPerFrame;
+    std::printf("capacity %zu, %d frames of %d new lines into a full buffer\n", kCapacity, kFrames, kLinesPerFrame);
+    std::printf("%-8s %12s %16s %14s\n", "buffer", "ns/push", "read ms/frame", "lines copied");
+    std::printf("%-8s %12.0f %16.3f %14zu\n", "vector", vectorPushMs * 1e6 / pushes, vectorReadMs / kFrames, vectorRead);
+    std::printf("%-8s %12.0f %16.3f %14zu\n", "ring", ringPushMs * 1e6 / pushes, ringReadMs / kFrames, ringRead);
+}
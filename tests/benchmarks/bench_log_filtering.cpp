@@ -0,0 +1,68 @@
+// Trace calls in this file are compiled out; debug calls stay and are filtered at run time. Built
+// as its own executable so no other translation unit sees a different active level.
+#undef GB2D_LOG_ACTIVE_LEVEL
+#define GB2D_LOG_ACTIVE_LEVEL 1
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/LogManager.h"
+
+#include <spdlog/sinks/null_sink.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using gb2d::logging::Config;
+using gb2d::logging::Level;
+using gb2d::logging::LogManager;
+
+namespace {
+
+constexpr int kCalls = 5000000;
+
+// Mean ns per call over kCalls; `sink` keeps the loop itself from being optimized away.
+template <typename Call>
+double nsPerCall(Call call) {
+    volatile int sink = 0;
+    const auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < kCalls; ++i) {
+        call(i);
+        sink = i;
+    }
+    (void)sink;
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+    return elapsed.count() / kCalls;
+}
+
+} // namespace
+
+TEST_CASE("Cost of log calls below the active level", "[logger][filtering][!benchmark]") {
+    (void)LogManager::shutdown();
+    LogManager::setSinksForTesting({ std::make_shared<spdlog::sinks::null_sink_mt>() });
+    Config cfg;
+    cfg.level = Level::info;
+    REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+    REQUIRE_FALSE(LogManager::isEnabled(Level::debug));
+
+    const std::string name = "goblin";
+    const float x = 12.5f;
+    const double compiledOut = nsPerCall([&](int i) { LogManager::trace("spawned {} #{} at x={:.1f}", name, i, x); });
+    const double filtered = nsPerCall([&](int i) { LogManager::debug("spawned {} #{} at x={:.1f}", name, i, x); });
+    // What every filtered call used to cost: the message was formatted before the level check.
+    const double formatFirst = nsPerCall([&](int i) {
+        const std::string message = fmt::format("spawned {} #{} at x={:.1f}", name, i, x);
+        LogManager::debug("{}", message);
+    });
+    const double written = nsPerCall([&](int i) { LogManager::info("spawned {} #{} at x={:.1f}", name, i, x); });
+
+    std::printf("%d calls each, GB2D_LOG_ACTIVE_LEVEL=%d, runtime level info, null sink\n", kCalls, GB2D_LOG_ACTIVE_LEVEL);
+    std::printf("%-32s %8s\n", "call", "ns/call");
+    std::printf("%-32s %8.2f\n", "trace (compiled out)", compiledOut);
+    std::printf("%-32s %8.2f\n", "debug (filtered at run time)", filtered);
+    std::printf("%-32s %8.2f\n", "debug, formatted before check", formatFirst);
+    std::printf("%-32s %8.2f\n", "info (written)", written);
+
+    (void)LogManager::shutdown();
+    LogManager::setSinksForTesting({});
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/LogViewIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using gb2d::logging::Level;
+using gb2d::logging::LogViewIndex;
+
+namespace {
+
+constexpr std::size_t kLines = 1000000;
+
+const char* const kSubsystems[] = { "Texture", "Audio", "Physics", "Input", "Scene", "Script" };
+
+std::string lineText(std::size_t i, Level level) {
+    static const char* const labels[] = { "trace", "debug", "info", "warning", "error", "critical" };
+    return "[12:00:00.123] [" + std::string(labels[(int)level]) + "] " + kSubsystems[i % 6] + ": frame " + std::to_string(i) +
+           " processed " + std::to_string(i % 97) + " entities in 0." + std::to_string(i % 10) + " ms";
+}
+
+Level levelFor(std::size_t i) {
+    // Mostly debug/info, with the occasional warning and error.
+    if (i % 1000 == 0) return Level::err;
+    if (i % 100 == 0) return Level::warn;
+    return (i % 3 == 0) ? Level::debug : Level::info;
+}
+
+double msSince(std::chrono::steady_clock::time_point started) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+}
+
+template <typename Fn>
+double timeMs(Fn fn) {
+    const auto started = std::chrono::steady_clock::now();
+    fn();
+    return msSince(started);
+}
+
+// What the console did before on every filter change: lowercase a copy of each line, test it,
+// and join the survivors into one string for the text editor.
+std::size_t rebuildJoined(const std::vector<std::string>& lines, const std::vector<Level>& levels, uint32_t mask, const std::string& needle, std::string& out) {
+    out.clear();
+    std::size_t rows = 0;
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        if (!(mask & LogViewIndex::levelBit(levels[i]))) continue;
+        std::string lower = lines[i];
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        if (!needle.empty() && lower.find(needle) == std::string::npos) continue;
+        out += lines[i];
+        out += '\n';
+        ++rows;
+    }
+    return rows;
+}
+
+} // namespace
+
+TEST_CASE("Console log view: filter updates over 1M retained lines", "[logger][view][!benchmark]") {
+    std::vector<std::string> lines;
+    std::vector<Level> levels;
+    lines.reserve(kLines);
+    levels.reserve(kLines);
+    for (std::size_t i = 0; i < kLines; ++i) {
+        levels.push_back(levelFor(i));
+        lines.push_back(lineText(i, levels.back()));
+    }
+
+    LogViewIndex index;
+    index.setMaxLines(kLines);
+    const double appendMs = timeMs([&] {
+        for (std::size_t i = 0; i < kLines; ++i) index.append(levels[i], lines[i]);
+    });
+    REQUIRE(index.rowCount() == kLines);
+
+    const uint32_t all = LogViewIndex::kAllLevels;
+    const uint32_t noDebug = all & ~LogViewIndex::levelBit(Level::debug);
+    const uint32_t warnUp = LogViewIndex::levelBit(Level::warn) | LogViewIndex::levelBit(Level::err) | LogViewIndex::levelBit(Level::critical);
+
+    struct Step { const char* name; uint32_t mask; const char* needle; };
+    // Typing "physics: frame 12" one word at a time, then level toggles and clearing the filter.
+    const Step steps[] = {
+        { "level: hide debug", noDebug, "" },
+        { "level: warn and up", warnUp, "" },
+        { "level: all", all, "" },
+        { "text: \"ph\"", all, "ph" },
+        { "text: \"physics\"", all, "physics" },
+        { "text: \"physics: frame 12\"", all, "physics: frame 12" },
+        { "level toggle under text", noDebug, "physics: frame 12" },
+        { "text: \"error\"", all, "error" },
+        { "text: cleared", all, "" },
+    };
+
+    std::printf("%zu retained lines, %.1f MB of text\n", kLines, [&] {
+        std::size_t bytes = 0;
+        for (const auto& l : lines) bytes += l.size() + 1;
+        return bytes / (1024.0 * 1024.0);
+    }());
+    std::printf("append: %.0f ns/line\n", appendMs * 1e6 / (double)kLines);
+    std::printf("%-30s %10s %12s %14s\n", "filter change", "rows", "index ms", "rebuild ms");
+    std::string joined;
+    for (const auto& step : steps) {
+        const double indexMs = timeMs([&] { index.setFilter(step.mask, step.needle); });
+        std::size_t oldRows = 0;
+        const double oldMs = timeMs([&] { oldRows = rebuildJoined(lines, levels, step.mask, step.needle, joined); });
+        REQUIRE(oldRows == index.rowCount());
+        std::printf("%-30s %10zu %12.2f %14.2f\n", step.name, index.rowCount(), indexMs, oldMs);
+    }
+
+    const double searchMs = timeMs([&] { index.setSearch("entities in 0.7", false); });
+    std::printf("search \"entities in 0.7\": %zu matches in %.2f ms\n", index.searchMatchCount(), searchMs);
+
+    // Per frame the clipper only touches the rows on screen, wherever the scroll position is.
+    constexpr int kFrames = 1000;
+    constexpr std::size_t kRowsOnScreen = 60;
+    std::size_t touched = 0;
+    const double frameMs = timeMs([&] {
+        for (int f = 0; f < kFrames; ++f) {
+            const std::size_t first = ((std::size_t)f * 7919u) % (index.rowCount() - kRowsOnScreen);
+            for (std::size_t r = first; r < first + kRowsOnScreen; ++r) touched += index.rowText(r).size() + (std::size_t)index.rowLevel(r);
+        }
+    });
+    REQUIRE(touched > 0);
+    std::printf("visible rows per frame (%zu rows, random scroll): %.4f ms\n", kRowsOnScreen, frameMs / kFrames);
+}
@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/ImGuiLogSink.h"
+#include "services/logger/LogManager.h"
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gb2d::logging::AsyncOptions;
+using gb2d::logging::Config;
+using gb2d::logging::LogManager;
+using gb2d::logging::OverflowPolicy;
+
+namespace {
+
+constexpr int kMessagesPerProducer = 20000;
+constexpr std::array<int, 3> kProducerCounts{1, 4, 16};
+
+struct RunResult {
+    double nsPerCall{0.0};   // mean producer-side cost of one call
+    double worstCallUs{0.0}; // slowest single call seen by any producer
+    double drainedMs{0.0};   // until flush() returned, i.e. everything reached the sinks
+    std::uint64_t dropped{0};
+};
+
+// The editor's own sinks minus the terminal: a log file and the ImGui console buffer.
+RunResult run(const std::filesystem::path& file, int producers, const AsyncOptions& async) {
+    (void)LogManager::shutdown();
+    std::filesystem::remove(file);
+    LogManager::setSinksForTesting({
+        std::make_shared<spdlog::sinks::basic_file_sink_mt>(file.string()),
+        gb2d::logging::create_imgui_sink() });
+    Config cfg;
+    cfg.async = async;
+    LogManager::init(cfg);
+
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<double> totals(static_cast<std::size_t>(producers), 0.0);
+    std::vector<double> worst(static_cast<std::size_t>(producers), 0.0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            const auto index = static_cast<std::size_t>(p);
+            const auto started = std::chrono::steady_clock::now();
+            for (int i = 0; i < kMessagesPerProducer; ++i) {
+                const auto before = std::chrono::steady_clock::now();
+                LogManager::info("producer {} frame {} spawned entity {} at ({:.1f}, {:.1f})", p, i, i * 7, i * 0.5, i * 0.25);
+                const std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - before;
+                worst[index] = std::max(worst[index], took.count());
+            }
+            const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+            totals[index] = elapsed.count();
+        });
+    }
+    while (ready.load() < producers) {
+        std::this_thread::yield();
+    }
+    const auto started = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    LogManager::flush();
+    const std::chrono::duration<double, std::milli> drained = std::chrono::steady_clock::now() - started;
+
+    RunResult result;
+    for (std::size_t i = 0; i < totals.size(); ++i) {
+        result.nsPerCall += totals[i] / kMessagesPerProducer / producers;
+        result.worstCallUs = std::max(result.worstCallUs, worst[i]);
+    }
+    result.drainedMs = drained.count();
+    const auto stats = LogManager::asyncStats();
+    result.dropped = stats.dropped_newest + stats.dropped_oldest;
+    (void)LogManager::shutdown();
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Synchronous vs. asynchronous logging with several producers", "[logger][async][!benchmark]") {
+    auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    const auto dir = std::filesystem::temp_directory_path() / ("gb2d_logging_bench_" + std::to_string(stamp));
+    std::filesystem::create_directories(dir);
+    const auto file = dir / "bench.log";
+
+    struct Mode {
+        const char* name;
+        AsyncOptions async;
+    };
+    const std::array<Mode, 3> modes{{
+        {"sync", AsyncOptions{}},
+        {"async block", AsyncOptions{true, 8192, OverflowPolicy::block, 256}},
+        {"async drop_new", AsyncOptions{true, 8192, OverflowPolicy::drop_newest, 256}},
+    }};
+
+    std::printf("%d messages per producer, %u hardware threads, file + ImGui sinks\n",
+                kMessagesPerProducer, std::thread::hardware_concurrency());
+    std::printf("%-10s %-15s %10s %12s %12s %9s\n", "producers", "mode", "ns/call", "worst (us)", "drained (ms)", "dropped");
+    for (int producers : kProducerCounts) {
+        for (const auto& mode : modes) {
+            const auto r = run(file, producers, mode.async);
+            if (mode.async.overflow != OverflowPolicy::drop_newest) {
+                REQUIRE(r.dropped == 0);
+            }
+            std::printf("%-10d %-15s %10.0f %12.1f %12.1f %9llu\n", producers, mode.name, r.nsPerCall, r.worstCallUs,
+                        r.drainedMs, static_cast<unsigned long long>(r.dropped));
+        }
+    }
+
+    LogManager::setSinksForTesting({});
+    gb2d::logging::clear_log_buffer();
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/audio/OfflineAudioBackend.h"
+#include "services/configuration/ConfigurationManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::OfflineAudioBackend;
+using gb2d::audio::PlaybackParams;
+using gb2d::audio::testing::ScopedTempDir;
+using gb2d::audio::testing::toneSamples;
+using gb2d::audio::testing::writePcm16Wav;
+
+namespace {
+
+constexpr std::uint32_t kSampleRate = 48000;
+constexpr int kSessionFrames = 600; // 10 s at 60 ticks per second
+constexpr float kFrameSeconds = 1.0f / 60.0f;
+constexpr int kRuns = 3;
+
+} // namespace
+
+// How much faster than realtime a scripted session renders offline: looping music plus a sound
+// effect every few frames, mixed at 48 kHz. CI render jobs scale with this ratio.
+TEST_CASE("Offline render speed vs. realtime", "[audio][offline][!benchmark]") {
+    const ScopedTempDir dir("gb2d_offline_render_bench");
+    writePcm16Wav(dir / "laser.wav", kSampleRate, 1, toneSamples(880.0, 0.1, kSampleRate, 1, 0.3));
+    writePcm16Wav(dir / "engine.wav", kSampleRate, 2, toneSamples(110.0, 0.5, kSampleRate, 2, 0.3));
+    writePcm16Wav(dir / "theme.wav", kSampleRate, 2, toneSamples(220.0, 2.0, kSampleRate, 2, 0.3));
+
+    double renderedSeconds = 0.0;
+    double wallSeconds = 0.0;
+    for (int run = 0; run < kRuns; ++run) {
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+        ConfigurationManager::set("audio.core.diagnostics_logging", false);
+        ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{dir.string()});
+        ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        OfflineAudioBackend backend(kSampleRate);
+        backend.install();
+        REQUIRE(AudioManager::init());
+        const auto laser = AudioManager::acquireSound("laser.wav").key;
+        const auto engine = AudioManager::acquireSound("engine.wav").key;
+        const auto theme = AudioManager::acquireMusic("theme.wav").key;
+        REQUIRE(AudioManager::playMusic(theme));
+
+        const auto started = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < kSessionFrames; ++frame) {
+            if (frame % 6 == 0) {
+                AudioManager::playSound(laser, PlaybackParams{0.8f, 1.0f, 0.25f + 0.5f * static_cast<float>(frame % 12) / 12.0f});
+            }
+            if (frame % 30 == 0) {
+                AudioManager::playSound(engine, PlaybackParams{0.6f, 1.25f, 0.5f});
+            }
+            AudioManager::tick(kFrameSeconds);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+        wallSeconds += elapsed.count();
+        renderedSeconds += backend.durationSeconds();
+        AudioManager::shutdown();
+    }
+    AudioManager::resetForTesting();
+
+    std::printf("%d ticks of %.1f ms at %u Hz, %d runs\n", kSessionFrames, kFrameSeconds * 1000.0f, kSampleRate, kRuns);
+    std::printf("%-12s %12s %12s\n", "rendered s", "wall ms", "x realtime");
+    std::printf("%-12.2f %12.1f %12.1f\n", renderedSeconds / kRuns, wallSeconds * 1000.0 / kRuns,
+                wallSeconds > 0.0 ? renderedSeconds / wallSeconds : 0.0);
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/filesystem/PathResolver.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::filesystem::PathResolver;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+constexpr int kRoots = 48;
+constexpr int kAssets = 4096;
+constexpr int kMissing = 512;
+constexpr int kPasses = 4;
+
+// Asset i lives in root i % kRoots, so an uncached lookup probes the working directory plus, on
+// average, half the roots; a missing identifier probes all of them.
+struct ResolverFixture {
+    ResolverFixture() {
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        dir = std::filesystem::temp_directory_path() / ("gb2d_path_resolver_bench_" + std::to_string(stamp));
+        for (int r = 0; r < kRoots; ++r) {
+            roots.push_back(dir / ("root_" + std::to_string(r)));
+            std::filesystem::create_directories(roots.back());
+        }
+        for (int i = 0; i < kAssets; ++i) {
+            const auto name = "asset_" + std::to_string(i) + ".png";
+            std::ofstream(roots[static_cast<std::size_t>(i % kRoots)] / name) << "stub";
+            identifiers.push_back(name);
+        }
+        for (int i = 0; i < kMissing; ++i) {
+            identifiers.push_back("missing_" + std::to_string(i) + ".png");
+        }
+    }
+
+    ~ResolverFixture() {
+        TextureManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    std::filesystem::path dir;
+    std::vector<std::filesystem::path> roots;
+    std::vector<std::string> identifiers;
+};
+
+struct PassSample {
+    double nsPerLookup{0.0};
+    double probesPerLookup{0.0};
+};
+
+PassSample runPasses(PathResolver& resolver, const std::vector<std::string>& identifiers, bool cached) {
+    const auto probesBefore = resolver.stats().probes;
+    std::size_t found = 0;
+    const auto started = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        if (!cached) {
+            resolver.clear();
+        }
+        for (const auto& identifier : identifiers) {
+            found += resolver.resolve(identifier).has_value();
+        }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+    REQUIRE(found == static_cast<std::size_t>(kAssets) * kPasses);
+    const double lookups = static_cast<double>(identifiers.size()) * kPasses;
+    return PassSample{elapsed.count() / lookups, static_cast<double>(resolver.stats().probes - probesBefore) / lookups};
+}
+
+} // namespace
+
+TEST_CASE("Path resolution with many search roots", "[texture][paths][!benchmark]") {
+    ResolverFixture fixture;
+
+    PathResolver resolver(fixture.roots);
+    const auto uncached = runPasses(resolver, fixture.identifiers, false);
+    resolver.clear();
+    resolver.resetStats();
+    for (const auto& identifier : fixture.identifiers) {
+        resolver.resolve(identifier);
+    }
+    const auto cached = runPasses(resolver, fixture.identifiers, true);
+    const auto stats = resolver.stats();
+
+    std::printf("%d roots, %d assets, %d missing identifiers, %d passes\n", kRoots, kAssets, kMissing, kPasses);
+    std::printf("%-10s %12s %14s\n", "mode", "ns/lookup", "probes/lookup");
+    std::printf("%-10s %12.0f %14.2f\n", "uncached", uncached.nsPerLookup, uncached.probesPerLookup);
+    std::printf("%-10s %12.0f %14.2f\n", "cached", cached.nsPerLookup, cached.probesPerLookup);
+    std::printf("speedup %.1fx, probes avoided %zu, negative hits %zu\n",
+                cached.nsPerLookup > 0.0 ? uncached.nsPerLookup / cached.nsPerLookup : 0.0,
+                stats.probesAvoided, stats.negativeHits);
+
+    // The same workload through TextureManager, whose acquire resolves before it checks residency.
+    TextureManager::resetForTesting();
+    ConfigurationManager::loadOrDefault();
+    std::vector<std::string> roots;
+    for (const auto& root : fixture.roots) {
+        roots.push_back(root.string());
+    }
+    ConfigurationManager::set("textures::search_paths", roots);
+    TextureManager::setLoaderForTesting([](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture stub;
+        stub.texture.id = 1;
+        stub.texture.width = 4;
+        stub.texture.height = 4;
+        stub.ownsTexture = false;
+        stub.bytes = 64;
+        return stub;
+    });
+    TextureManager::init();
+    std::vector<std::string> keys;
+    for (const auto& identifier : fixture.identifiers) {
+        keys.push_back(TextureManager::acquire(identifier).key);
+    }
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (std::size_t i = 0; i < fixture.identifiers.size(); ++i) {
+            TextureManager::acquire(fixture.identifiers[i]);
+            TextureManager::release(keys[i]);
+        }
+    }
+    const auto metrics = TextureManager::metrics();
+    std::printf("TextureManager: %zu lookups, %zu probes performed, %zu avoided\n",
+                metrics.pathLookups, metrics.pathProbes, metrics.pathProbesAvoided);
+}
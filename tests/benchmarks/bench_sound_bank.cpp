@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/audio/OfflineAudioBackend.h"
+#include "services/audio/SoundBank.h"
+#include "services/configuration/ConfigurationManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::OfflineAudioBackend;
+using gb2d::audio::SoundBank;
+
+namespace {
+
+constexpr int kSounds = 500;
+constexpr int kSearchRoots = 4;
+constexpr std::uint32_t kSampleRate = 44100;
+constexpr int kFramesPerSound = 11025; // 0.25 s mono, 22 KB of PCM
+constexpr int kRuns = 3;
+
+void writeSound(const std::filesystem::path& path, int seed) {
+    std::vector<std::int16_t> samples(kFramesPerSound);
+    for (int i = 0; i < kFramesPerSound; ++i) {
+        samples[i] = static_cast<std::int16_t>(8000.0 * std::sin(0.01 * (i + 1) * (seed % 17 + 1)));
+    }
+    gb2d::audio::testing::writePcm16Wav(path, kSampleRate, 1, samples);
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point started) {
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - started;
+    return elapsed.count();
+}
+
+} // namespace
+
+// Startup with 500 preloaded sound effects. The sounds sit in the last of four search roots, as
+// game assets usually do after engine and shared roots. The mixer decodes through raylib's
+// LoadWave, so "files" pays a resolve and a decode per sound and "bank" pays one mapping.
+TEST_CASE("Sound startup: individual files vs one sound bank", "[audio][soundbank][!benchmark]") {
+    auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    const auto dir = std::filesystem::temp_directory_path() / ("gb2d_sound_bank_bench_" + std::to_string(stamp));
+    std::vector<std::string> roots;
+    for (int root = 0; root < kSearchRoots; ++root) {
+        roots.push_back((dir / ("root" + std::to_string(root))).string());
+        std::filesystem::create_directories(roots.back());
+    }
+    const std::filesystem::path assets = roots.back();
+    std::vector<std::string> identifiers;
+    for (int i = 0; i < kSounds; ++i) {
+        identifiers.push_back("sfx/group" + std::to_string(i % 10) + "/sound_" + std::to_string(i) + ".wav");
+        writeSound(assets / identifiers.back(), i);
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    REQUIRE(SoundBank::pack(assets / "sfx.gb2dbank", assets, identifiers));
+    const double packMs = millisecondsSince(started);
+
+    const auto startup = [&](bool useBank, std::size_t& probes) {
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+        ConfigurationManager::set("audio.core.diagnostics_logging", false);
+        ConfigurationManager::set("audio.engine.search_paths", roots);
+        ConfigurationManager::set("audio.engine.max_concurrent_sounds", static_cast<int64_t>(16));
+        ConfigurationManager::set("audio.preload.sounds", identifiers);
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.sound_banks",
+                                  useBank ? std::vector<std::string>{"sfx.gb2dbank"} : std::vector<std::string>{});
+        static OfflineAudioBackend backend(48000);
+        backend.install();
+        const auto begin = std::chrono::steady_clock::now();
+        AudioManager::init();
+        const double ms = millisecondsSince(begin);
+        const auto metrics = AudioManager::metrics();
+        REQUIRE(metrics.loadedSounds == static_cast<std::size_t>(kSounds));
+        probes += metrics.pathProbes;
+        AudioManager::resetForTesting();
+        return ms;
+    };
+
+    double filesMs = 0.0;
+    double bankMs = 0.0;
+    std::size_t fileProbes = 0;
+    std::size_t bankProbes = 0;
+    for (int run = 0; run < kRuns; ++run) {
+        filesMs += startup(false, fileProbes);
+        bankMs += startup(true, bankProbes);
+    }
+
+    std::printf("%d sounds, %d frames each, %d search roots, bank %.1f MB (packed in %.1f ms)\n",
+                kSounds, kFramesPerSound, kSearchRoots,
+                static_cast<double>(std::filesystem::file_size(assets / "sfx.gb2dbank")) / (1024.0 * 1024.0), packMs);
+    std::printf("%-20s %9s %9s   %9s\n", "mode", "ms", "probes", "vs files");
+    std::printf("%-20s %9.1f %9zu   %8.2fx\n", "individual files", filesMs / kRuns, fileProbes / kRuns, 1.0);
+    std::printf("%-20s %9.1f %9zu   %8.2fx\n", "sound bank", bankMs / kRuns, bankProbes / kRuns,
+                bankMs > 0.0 ? filesMs / bankMs : 0.0);
+
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::PreloadResult;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+constexpr int kTextures = 48;
+constexpr int kDimension = 512;
+constexpr int kRuns = 3;
+
+// Real PNGs (noise compresses poorly, so decoding is not trivially cheap); uploads go through the
+// uploader seam so the numbers measure file I/O and decoding only.
+struct PreloadFixture {
+    PreloadFixture() {
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        dir = std::filesystem::temp_directory_path() / ("gb2d_texture_preload_bench_" + std::to_string(stamp));
+        cacheDir = dir / "decoded";
+        std::filesystem::create_directories(dir);
+        for (int i = 0; i < kTextures; ++i) {
+            Image image = GenImagePerlinNoise(kDimension, kDimension, i * 97, i * 31, 4.0f);
+            const auto name = "tex_" + std::to_string(i) + ".png";
+            ExportImage(image, (dir / name).string().c_str());
+            UnloadImage(image);
+            identifiers.push_back(name);
+        }
+    }
+
+    ~PreloadFixture() {
+        TextureManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    void start(bool useCache) const {
+        TextureManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+        ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.string() });
+        ConfigurationManager::set("textures::async_workers",
+                                  static_cast<int64_t>(std::max(2u, std::thread::hardware_concurrency())));
+        ConfigurationManager::set("textures::decoded_cache_dir", useCache ? cacheDir.string() : std::string{});
+        ConfigurationManager::setJson("textures.preload", nlohmann::json{{"startup", identifiers}});
+        TextureManager::setUploaderForTesting([](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+            TextureManager::LoadedTexture stub;
+            stub.texture.id = 1;
+            stub.texture.width = image.width;
+            stub.texture.height = image.height;
+            stub.texture.mipmaps = 1;
+            stub.texture.format = image.format;
+            stub.ownsTexture = false;
+            return stub;
+        });
+        TextureManager::init();
+    }
+
+    std::filesystem::path dir;
+    std::filesystem::path cacheDir;
+    std::vector<std::string> identifiers;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point started) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+}
+
+} // namespace
+
+TEST_CASE("Texture startup: serial loads vs cold and warm preload", "[texture][preload][!benchmark]") {
+    PreloadFixture fixture;
+
+    // Baseline: what the first frame pays today, one synchronous acquire after another.
+    double serialMs = 0.0;
+    for (int run = 0; run < kRuns; ++run) {
+        fixture.start(false);
+        TextureManager::setLoaderForTesting([](const std::filesystem::path& path, bool, int)
+                                                -> std::optional<TextureManager::LoadedTexture> {
+            Image image = LoadImage(path.string().c_str());
+            if (image.data == nullptr) {
+                return std::nullopt;
+            }
+            TextureManager::LoadedTexture stub;
+            stub.texture.id = 1;
+            stub.texture.width = image.width;
+            stub.texture.height = image.height;
+            stub.ownsTexture = false;
+            UnloadImage(image);
+            return stub;
+        });
+        const auto started = std::chrono::steady_clock::now();
+        for (const auto& identifier : fixture.identifiers) {
+            TextureManager::acquire(identifier);
+        }
+        serialMs += millisecondsSince(started);
+    }
+
+    double parallelMs = 0.0;
+    for (int run = 0; run < kRuns; ++run) {
+        fixture.start(false);
+        parallelMs += TextureManager::preloadGroup("startup").milliseconds;
+    }
+
+    // Cold: empty cache directory, every image is decoded and written back.
+    double coldMs = 0.0;
+    double warmMs = 0.0;
+    std::size_t warmHits = 0;
+    for (int run = 0; run < kRuns; ++run) {
+        std::error_code ec;
+        std::filesystem::remove_all(fixture.cacheDir, ec);
+        fixture.start(true);
+        const PreloadResult cold = TextureManager::preloadGroup("startup");
+        REQUIRE(cold.loaded == fixture.identifiers.size());
+        coldMs += cold.milliseconds;
+
+        fixture.start(true);
+        const PreloadResult warm = TextureManager::preloadGroup("startup");
+        REQUIRE(warm.loaded == fixture.identifiers.size());
+        warmMs += warm.milliseconds;
+        warmHits += warm.decodedCacheHits;
+    }
+    TextureManager::resetForTesting();
+
+    std::printf("%d textures, %dx%d PNG, %u hardware threads\n",
+                kTextures, kDimension, kDimension, std::thread::hardware_concurrency());
+    std::printf("%-22s %9s   %9s\n", "mode", "ms", "vs serial");
+    const auto row = [serialMs](const char* label, double totalMs) {
+        const double ms = totalMs / kRuns;
+        std::printf("%-22s %9.1f   %8.2fx\n", label, ms, ms > 0.0 ? serialMs / kRuns / ms : 0.0);
+    };
+    row("serial acquire", serialMs);
+    row("preload, no cache", parallelMs);
+    row("preload, cold cache", coldMs);
+    row("preload, warm cache", warmMs);
+    std::printf("warm decoded-cache hits: %zu / %d\n", warmHits / kRuns, kTextures);
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+constexpr int kResidentTextures = 256;
+constexpr int kChurnTextures = 32;
+constexpr auto kSampleDuration = std::chrono::milliseconds(300);
+
+struct ReadFixture {
+    ReadFixture() {
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        dir = std::filesystem::temp_directory_path() / ("gb2d_texture_reads_bench_" + std::to_string(stamp));
+        std::filesystem::create_directories(dir);
+        for (int i = 0; i < kResidentTextures + kChurnTextures; ++i) {
+            std::ofstream out(dir / ("tex_" + std::to_string(i) + ".png"), std::ios::binary);
+            out << "stub";
+        }
+
+        TextureManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+        ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.string() });
+        TextureManager::setLoaderForTesting([](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+            TextureManager::LoadedTexture stub;
+            stub.texture.id = 1;
+            stub.texture.width = 64;
+            stub.texture.height = 64;
+            stub.texture.mipmaps = 1;
+            stub.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            stub.bytes = 64 * 64 * 4;
+            return stub;
+        });
+        TextureManager::init();
+        for (int i = 0; i < kResidentTextures; ++i) {
+            keys.push_back(TextureManager::acquire("tex_" + std::to_string(i) + ".png").key);
+        }
+    }
+
+    ~ReadFixture() {
+        TextureManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    std::filesystem::path dir;
+    std::vector<std::string> keys;
+};
+
+struct ContentionSample {
+    double readsPerSecond{0.0};
+    double writesPerSecond{0.0};
+};
+
+// Runs `readers` threads doing tryGet (plus a metrics() every 64 lookups, as an HUD would) while
+// one writer acquires/releases textures and ticks, i.e. the loading-screen pattern.
+ContentionSample runContention(const ReadFixture& fixture, int readers) {
+    std::atomic<bool> go{false};
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> reads{0};
+    std::atomic<std::size_t> writes{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < readers; ++t) {
+        threads.emplace_back([&, t] {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            std::size_t local = 0;
+            std::size_t found = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const auto& key = fixture.keys[(local * 7 + static_cast<std::size_t>(t)) % fixture.keys.size()];
+                found += TextureManager::tryGet(key) != nullptr;
+                if ((local & 63) == 0) {
+                    found += TextureManager::metrics().totalTextures > 0;
+                }
+                local++;
+            }
+            reads += local;
+            volatile std::size_t sink = found;
+            (void)sink;
+        });
+    }
+    threads.emplace_back([&] {
+        while (!go.load()) {
+            std::this_thread::yield();
+        }
+        std::size_t local = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            const auto name = "tex_" + std::to_string(kResidentTextures + static_cast<int>(local % kChurnTextures)) + ".png";
+            auto result = TextureManager::acquire(name);
+            TextureManager::release(result.key);
+            TextureManager::tick();
+            local++;
+        }
+        writes += local;
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+    std::this_thread::sleep_for(kSampleDuration);
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    ContentionSample sample;
+    sample.readsPerSecond = static_cast<double>(reads.load()) / elapsed.count();
+    sample.writesPerSecond = static_cast<double>(writes.load()) / elapsed.count();
+    return sample;
+}
+
+} // namespace
+
+TEST_CASE("Texture read path under writer contention", "[texture][contention][!benchmark]") {
+    ReadFixture fixture;
+    REQUIRE(fixture.keys.size() == static_cast<std::size_t>(kResidentTextures));
+
+    // The 0-reader row is the writer's cost on its own; scaling is relative to one reader.
+    double single = 0.0;
+    std::printf("readers  tryGet M/s  per-reader M/s  scaling  writer ops/s\n");
+    for (int readers : {0, 1, 2, 4, 8}) {
+        const auto sample = runContention(fixture, readers);
+        if (readers == 1) {
+            single = sample.readsPerSecond;
+        }
+        std::printf("%7d  %10.2f  %14.2f  %6.2fx  %12.0f\n",
+                    readers,
+                    sample.readsPerSecond / 1e6,
+                    readers > 0 ? sample.readsPerSecond / readers / 1e6 : 0.0,
+                    single > 0.0 ? sample.readsPerSecond / single : 0.0,
+                    sample.writesPerSecond);
+    }
+}
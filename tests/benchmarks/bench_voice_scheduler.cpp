@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+#include "unit/audio/AudioTestHooks.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+struct rAudioBuffer;
+
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::PlaybackParams;
+using gb2d::audio::SoundVoiceSettings;
+
+namespace {
+
+constexpr int kFrames = 600;           // ten seconds at 60 Hz
+constexpr int kRequestsPerFrame = 100; // 6000 play requests per second
+constexpr std::int64_t kSlots = 12; // below the sum of the per-sound caps, so the pool fills too
+
+// A busy shooter scene: lots of short low-priority shots and pickups, fewer long explosions, and
+// the rare sounds that must be heard.
+struct SoundSpec {
+    const char* name;
+    int priority;
+    std::size_t maxInstances;
+    unsigned durationFrames;
+    int weight; // per mille of requests
+};
+
+constexpr std::array<SoundSpec, 6> kSounds{ {
+    {"shot.wav", 0, 4, 8, 500},
+    {"pickup.wav", 0, 2, 12, 300},
+    {"engine.wav", 1, 1, 30, 100},
+    {"explosion.wav", 5, 6, 45, 95},
+    {"player_hit.wav", 10, 2, 60, 4},
+    {"player_death.wav", 20, 1, 90, 1},
+} };
+
+// Voices "play" for a fixed number of simulated frames; the clip length travels in frameCount.
+struct FrameClockHooks {
+    static inline unsigned frame = 0;
+    static inline std::vector<unsigned> endFrame{};
+
+    static std::uintptr_t id(Sound sound) { return gb2d::audio::testing::fakeSoundId(sound); }
+
+    static Sound make(unsigned durationFrames) {
+        endFrame.push_back(0);
+        Sound sound{};
+        sound.frameCount = durationFrames;
+        sound.stream.buffer = reinterpret_cast<rAudioBuffer*>(static_cast<std::uintptr_t>(endFrame.size()));
+        return sound;
+    }
+
+    static Sound loadSound(const char* path) {
+        const auto name = std::filesystem::path(path).filename().string();
+        for (const auto& spec : kSounds) {
+            if (name == spec.name) {
+                return make(spec.durationFrames);
+            }
+        }
+        return make(1);
+    }
+    static Sound loadSoundAlias(Sound source) { return make(source.frameCount); }
+    static void play(Sound sound) { endFrame[id(sound) - 1] = frame + sound.frameCount; }
+    static void stop(Sound sound) { endFrame[id(sound) - 1] = frame; }
+    static bool isPlaying(Sound sound) { return frame < endFrame[id(sound) - 1]; }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            auto table = gb2d::audio::testing::stubRaylibHooks();
+            table.loadSound = loadSound;
+            table.loadSoundAlias = loadSoundAlias;
+            table.playSound = play;
+            table.stopSound = stop;
+            table.isSoundPlaying = isPlaying;
+            return table;
+        }();
+        return api;
+    }
+};
+
+struct PolicyResult {
+    double nsPerRequest{0.0};
+    std::size_t started{0};
+    std::size_t stolen{0};
+    std::size_t dropped{0};
+    std::size_t capHits{0};
+    std::size_t criticalRequested{0};
+    std::size_t criticalStarted{0};
+};
+
+PolicyResult runScene(const std::filesystem::path& dir, const char* policy) {
+    gb2d::audio::testing::resetAudioForTesting(dir, FrameClockHooks::hooks());
+    ConfigurationManager::set("audio.engine.max_concurrent_sounds", kSlots);
+    ConfigurationManager::set("audio.engine.steal_policy", std::string(policy));
+    FrameClockHooks::frame = 0;
+    FrameClockHooks::endFrame.clear();
+    AudioManager::init();
+
+    std::vector<std::string> keys;
+    std::vector<int> weights;
+    for (const auto& spec : kSounds) {
+        keys.push_back(AudioManager::acquireSound(spec.name).key);
+        AudioManager::setSoundVoiceSettings(keys.back(), SoundVoiceSettings{spec.priority, spec.maxInstances});
+        weights.push_back(spec.weight);
+    }
+
+    std::mt19937 rng(1234);
+    std::discrete_distribution<std::size_t> pick(weights.begin(), weights.end());
+    std::uniform_real_distribution<float> volume(0.3f, 1.0f);
+    PolicyResult result;
+    std::chrono::nanoseconds elapsed{0};
+    for (int frame = 0; frame < kFrames; ++frame) {
+        FrameClockHooks::frame = static_cast<unsigned>(frame);
+        AudioManager::tick();
+        const auto started = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRequestsPerFrame; ++i) {
+            const auto sound = pick(rng);
+            PlaybackParams params;
+            params.volume = volume(rng);
+            const bool critical = kSounds[sound].priority >= 10;
+            const bool played = AudioManager::playSound(keys[sound], params).valid();
+            result.started += played;
+            result.criticalRequested += critical;
+            result.criticalStarted += critical && played;
+        }
+        elapsed += std::chrono::steady_clock::now() - started;
+    }
+
+    const auto metrics = AudioManager::metrics();
+    result.nsPerRequest = static_cast<double>(elapsed.count()) / (kFrames * kRequestsPerFrame);
+    result.stolen = metrics.voicesStolen;
+    result.dropped = metrics.voicesDropped;
+    result.capHits = metrics.instanceCapHits;
+    AudioManager::resetForTesting();
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Voice scheduler under thousands of play requests per second", "[audio][voices][!benchmark]") {
+    const gb2d::audio::testing::ScopedTempDir dir("gb2d_voice_bench");
+    for (const auto& spec : kSounds) {
+        dir.touch(spec.name);
+    }
+
+    std::printf("%d frames x %d requests, %lld slots\n", kFrames, kRequestsPerFrame, static_cast<long long>(kSlots));
+    std::printf("%-16s %10s %9s %9s %9s %9s %14s\n",
+                "policy", "ns/request", "started", "stolen", "dropped", "cap hits", "critical heard");
+    for (const char* policy : {"none", "oldest", "quietest", "lowest_priority"}) {
+        const auto r = runScene(dir.path(), policy);
+        REQUIRE(r.started + r.dropped == static_cast<std::size_t>(kFrames) * kRequestsPerFrame);
+        std::printf("%-16s %10.0f %9zu %9zu %9zu %9zu %8zu / %-4zu\n", policy, r.nsPerRequest, r.started,
+                    r.stolen, r.dropped, r.capHits, r.criticalStarted, r.criticalRequested);
+        if (std::string(policy) != "none") {
+            // Critical sounds are capped well below the pool size, so some slot can always be taken.
+            REQUIRE(r.criticalStarted == r.criticalRequested);
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+// Fakes shared by the audio tests and benchmarks: a device-less backend, a raylib hook table
+// whose sounds are counters rather than buffers, scratch directories and a WAV writer.
+
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+struct rAudioBuffer;
+
+namespace gb2d::audio::testing {
+
+struct NullBackend final : AudioManager::Backend {
+    void initDevice() override {}
+    void closeDevice() override {}
+    bool isDeviceReady() override { return true; }
+    void setMasterVolume(float) override {}
+};
+
+// The buffer pointer of a fake sound is a process-wide counter, so every load and alias is
+// distinct and fakeSoundId() can key tables by it.
+inline Sound makeFakeSound(unsigned int frames = 1) {
+    static std::atomic<std::uintptr_t> nextId{1};
+    Sound sound{};
+    sound.frameCount = frames;
+    sound.stream.buffer = reinterpret_cast<rAudioBuffer*>(nextId.fetch_add(1));
+    return sound;
+}
+
+inline std::uintptr_t fakeSoundId(Sound sound) {
+    return reinterpret_cast<std::uintptr_t>(sound.stream.buffer);
+}
+
+// Every sound and music hook as a no-op. Sounds load as one-frame fakes that play forever and
+// aliases copy their source's length. Copy the table and replace the hooks a test cares about.
+inline AudioManager::RaylibHooks stubRaylibHooks() {
+    return AudioManager::RaylibHooks{
+        .loadSound = [](const char*) { return makeFakeSound(); },
+        .unloadSound = [](Sound) {},
+        .loadSoundAlias = [](Sound source) { return makeFakeSound(source.frameCount); },
+        .unloadSoundAlias = [](Sound) {},
+        .playSound = [](Sound) {},
+        .stopSound = [](Sound) {},
+        .isSoundPlaying = [](Sound) { return true; },
+        .setSoundVolume = [](Sound, float) {},
+        .setSoundPitch = [](Sound, float) {},
+        .setSoundPan = [](Sound, float) {},
+        .loadMusicStream = [](const char*) { return Music{}; },
+        .unloadMusicStream = [](Music) {},
+        .playMusicStream = [](Music) {},
+        .pauseMusicStream = [](Music) {},
+        .resumeMusicStream = [](Music) {},
+        .stopMusicStream = [](Music) {},
+        .updateMusicStream = [](Music) {},
+        .isMusicStreamPlaying = [](Music) { return false; },
+        .setMusicVolume = [](Music, float) {},
+        .seekMusicStream = [](Music, float) {},
+        .getMusicTimeLength = [](Music) { return 0.0f; },
+        .getMusicTimePlayed = [](Music) { return 0.0f; }};
+}
+
+// A path under the system temp directory that no other call, in this process or a parallel
+// one, returns: the name carries the clock and a counter.
+inline std::filesystem::path uniqueTempPath(std::string_view prefix) {
+    static std::atomic<int> counter{0};
+    const auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return std::filesystem::temp_directory_path() /
+           (std::string(prefix) + "-" + std::to_string(stamp) + "-" + std::to_string(++counter));
+}
+
+// A fresh uniqueTempPath directory, removed with its contents on destruction.
+class ScopedTempDir {
+public:
+    explicit ScopedTempDir(std::string_view prefix) : path_(uniqueTempPath(prefix)) {
+        std::filesystem::create_directories(path_);
+    }
+    ~ScopedTempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+    ScopedTempDir(const ScopedTempDir&) = delete;
+    ScopedTempDir& operator=(const ScopedTempDir&) = delete;
+
+    const std::filesystem::path& path() const { return path_; }
+    std::string string() const { return path_.string(); }
+    std::filesystem::path operator/(const std::filesystem::path& name) const { return path_ / name; }
+
+    // Creates a one-byte file for hooks that never read what they load.
+    void touch(const std::filesystem::path& name) const {
+        std::filesystem::create_directories((path_ / name).parent_path());
+        std::ofstream(path_ / name).put('\0');
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+// Writes interleaved samples as a little-endian 16-bit PCM WAV, creating parent directories.
+inline void writePcm16Wav(const std::filesystem::path& path,
+                          std::uint32_t sampleRate,
+                          std::uint16_t channels,
+                          const std::vector<std::int16_t>& samples) {
+    const auto dataBytes = static_cast<std::uint32_t>(samples.size() * 2);
+    const auto put32 = [](std::ofstream& out, std::uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            out.put(static_cast<char>((value >> shift) & 0xFF));
+        }
+    };
+    const auto put16 = [](std::ofstream& out, std::uint16_t value) {
+        out.put(static_cast<char>(value & 0xFF));
+        out.put(static_cast<char>(value >> 8));
+    };
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream out(path, std::ios::binary);
+    out.write("RIFF", 4);
+    put32(out, 36 + dataBytes);
+    out.write("WAVEfmt ", 8);
+    put32(out, 16);
+    put16(out, 1);
+    put16(out, channels);
+    put32(out, sampleRate);
+    put32(out, sampleRate * channels * 2);
+    put16(out, static_cast<std::uint16_t>(channels * 2));
+    put16(out, 16);
+    out.write("data", 4);
+    put32(out, dataBytes);
+    for (std::int16_t sample : samples) {
+        put16(out, static_cast<std::uint16_t>(sample));
+    }
+}
+
+// `seconds` of a sine at `hz`, interleaved for writePcm16Wav.
+inline std::vector<std::int16_t> toneSamples(double hz, double seconds, std::uint32_t sampleRate,
+                                             std::uint16_t channels, double amplitude) {
+    constexpr double kPi = 3.14159265358979323846;
+    const auto frames = static_cast<std::size_t>(seconds * sampleRate);
+    std::vector<std::int16_t> samples;
+    samples.reserve(frames * channels);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        const double phase = 2.0 * kPi * hz * static_cast<double>(frame) / sampleRate;
+        for (std::uint16_t channel = 0; channel < channels; ++channel) {
+            // Offset the right channel's phase so stereo material is not just a doubled mono.
+            const double value = amplitude * std::sin(phase + channel * 0.5);
+            samples.push_back(static_cast<std::int16_t>(std::lround(value * 32767.0)));
+        }
+    }
+    return samples;
+}
+
+// Resets the manager and the configuration, then points it at `searchPath` with nothing
+// preloaded, diagnostics quiet and the mixer off, on a NullBackend and `hooks`. Callers set
+// anything else they need before init().
+inline void resetAudioForTesting(const std::filesystem::path& searchPath, const AudioManager::RaylibHooks& hooks) {
+    static NullBackend backend;
+    AudioManager::resetForTesting();
+    ConfigurationManager::loadOrDefault();
+    ConfigurationManager::set("audio.core.enabled", true);
+    ConfigurationManager::set("audio.core.diagnostics_logging", false);
+    ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{searchPath.string()});
+    ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+    ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+    ConfigurationManager::set("audio.mixer.enabled", false);
+    AudioManager::setBackendForTesting(&backend);
+    AudioManager::setRaylibHooksForTesting(&hooks);
+}
+
+// Base for fixtures: a scratch search directory and resetAudioForTesting on construction, a
+// reset manager on destruction.
+struct AudioManagerFixture {
+    AudioManagerFixture(std::string_view name, const AudioManager::RaylibHooks& hooks) : tempDir(name) {
+        resetAudioForTesting(tempDir.path(), hooks);
+    }
+    ~AudioManagerFixture() { AudioManager::resetForTesting(); }
+
+    ScopedTempDir tempDir;
+};
+
+} // namespace gb2d::audio::testing
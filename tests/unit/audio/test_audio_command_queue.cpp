@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioCommandQueue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using gb2d::audio::CommandRing;
+
+TEST_CASE("CommandRing is FIFO, bounded, and wraps around", "[audio][commands]") {
+    CommandRing<int> ring(5);
+    REQUIRE(ring.capacity() == 8);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            int value = round * 100 + i;
+            REQUIRE(ring.tryPush(std::move(value)));
+        }
+        int overflow = -1;
+        REQUIRE_FALSE(ring.tryPush(std::move(overflow)));
+        REQUIRE(ring.sizeApprox() == 8);
+        for (int i = 0; i < 8; ++i) {
+            auto value = ring.tryPop();
+            REQUIRE(value);
+            REQUIRE(*value == round * 100 + i);
+        }
+        REQUIRE_FALSE(ring.tryPop());
+    }
+}
+
+TEST_CASE("CommandRing keeps each producer's order under contention", "[audio][commands]") {
+    constexpr int kProducers = 4;
+    constexpr std::uint32_t kPerProducer = 20000;
+    CommandRing<std::uint64_t> ring(256);
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, &go, p]() {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (std::uint32_t seq = 0; seq < kPerProducer; ++seq) {
+                std::uint64_t item = (static_cast<std::uint64_t>(p) << 32) | seq;
+                while (!ring.tryPush(std::move(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::int64_t> last(kProducers, -1);
+    std::size_t received = 0;
+    bool ordered = true;
+    go.store(true);
+    while (received < kProducers * kPerProducer) {
+        auto item = ring.tryPop();
+        if (!item) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = static_cast<std::size_t>(*item >> 32);
+        const auto seq = static_cast<std::int64_t>(*item & 0xffffffffu);
+        ordered = ordered && seq == last[producer] + 1;
+        last[producer] = seq;
+        ++received;
+    }
+    for (auto& thread : producers) {
+        thread.join();
+    }
+
+    REQUIRE(ordered);
+    REQUIRE_FALSE(ring.tryPop());
+    for (auto value : last) {
+        REQUIRE(value == static_cast<std::int64_t>(kPerProducer) - 1);
+    }
+}
@@ -0,0 +1,228 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AudioTestHooks.h"
+#include "services/audio/AudioEventArena.h"
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioEvent;
+using gb2d::audio::AudioEventArena;
+using gb2d::audio::AudioEventSink;
+using gb2d::audio::AudioEventType;
+using gb2d::audio::AudioManager;
+using gb2d::audio::testing::AudioManagerFixture;
+
+namespace {
+
+// Voices keep playing until a test sets `finished`; after that the next tick() stops all of them.
+struct VoiceHooks {
+    static inline bool finished{false};
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            auto table = gb2d::audio::testing::stubRaylibHooks();
+            table.isSoundPlaying = [](Sound) { return !finished; };
+            return table;
+        }();
+        return api;
+    }
+};
+
+struct RecordingSink final : AudioEventSink {
+    std::vector<std::vector<AudioEvent>> batches;
+
+    void onAudioEvents(std::span<const AudioEvent> events) override {
+        batches.emplace_back(events.begin(), events.end());
+    }
+};
+
+struct AudioEventsFixture : AudioManagerFixture {
+    AudioEventsFixture() : AudioManagerFixture("gb2d-audio-events-tests", VoiceHooks::hooks()) {
+        tempDir.touch("blip.wav");
+        tempDir.touch("boom.wav");
+        ConfigurationManager::set("audio.engine.max_concurrent_sounds", static_cast<int64_t>(4));
+        ConfigurationManager::set("audio.engine.steal_policy", std::string("oldest"));
+        VoiceHooks::finished = false;
+    }
+};
+
+} // namespace
+
+TEST_CASE("AudioEventArena keeps publishing order and reuses its buffers", "[audio][events]") {
+    AudioEventArena arena;
+    std::vector<AudioEvent> scratch;
+
+    REQUIRE(arena.publish(AudioEventType::SoundLoaded, "sfx/a_rather_long_sound_key.wav", "", 10, false));
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "b.wav", "stolen", 11, false));
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "b.wav", "stolen", 12, false));
+    auto events = arena.materialize(scratch);
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[0].key == "sfx/a_rather_long_sound_key.wav");
+    REQUIRE(events[1].details == "stolen");
+    REQUIRE(events[2].timestampMs == 12);
+    REQUIRE(events[2].count == 1);
+
+    // A smaller batch reuses the scratch events, strings included.
+    arena.clear();
+    REQUIRE(arena.empty());
+    const auto* firstKey = scratch[0].key.data();
+    REQUIRE(arena.publish(AudioEventType::SoundUnloaded, "c.wav", "", 13, false));
+    events = arena.materialize(scratch);
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].key == "c.wav");
+    REQUIRE(scratch.size() == 3);
+    REQUIRE(scratch[0].key.data() == firstKey);
+}
+
+TEST_CASE("AudioEventArena coalesces repeats into the key's latest event", "[audio][events]") {
+    AudioEventArena arena;
+    std::vector<AudioEvent> scratch;
+
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "stolen", 1, true));
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "b.wav", "stolen", 2, true));
+    REQUIRE_FALSE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "stolen", 3, true));
+    REQUIRE_FALSE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "stolen", 4, true));
+    // Different details, then a different type, start new events; later repeats fold into those,
+    // so a.wav's own events never change order.
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "", 5, true));
+    REQUIRE(arena.publish(AudioEventType::SoundUnloaded, "a.wav", "", 6, true));
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "stolen", 7, true));
+
+    const auto events = arena.materialize(scratch);
+    REQUIRE(events.size() == 5);
+    REQUIRE(events[0].key == "a.wav");
+    REQUIRE(events[0].count == 3);
+    REQUIRE(events[0].timestampMs == 1);
+    REQUIRE(events[1].key == "b.wav");
+    REQUIRE(events[1].count == 1);
+    REQUIRE(events[2].details.empty());
+    REQUIRE(events[3].type == AudioEventType::SoundUnloaded);
+    REQUIRE(events[4].count == 1);
+
+    // Nothing folds into an event from before clear(), and enough keys to grow the table all
+    // keep folding into their own event.
+    arena.clear();
+    REQUIRE(arena.publish(AudioEventType::SoundPlaybackStopped, "a.wav", "stolen", 8, true));
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            arena.publish(AudioEventType::SoundLoaded, "sfx/" + std::to_string(i) + ".wav", "", 9, true);
+        }
+    }
+    const auto afterClear = arena.materialize(scratch);
+    REQUIRE(afterClear.size() == 101);
+    REQUIRE(afterClear[0].timestampMs == 8);
+    REQUIRE(afterClear[0].count == 1);
+    REQUIRE(afterClear[100].key == "sfx/99.wav");
+    REQUIRE(afterClear[100].count == 2);
+}
+
+TEST_CASE_METHOD(AudioEventsFixture, "AudioManager delivers a frame's events to each sink in one batch", "[audio][events]") {
+    REQUIRE(AudioManager::init());
+    const auto key = AudioManager::acquireSound("blip.wav").key;
+    RecordingSink first;
+    RecordingSink second;
+    auto firstSubscription = AudioManager::subscribeToAudioEvents(&first);
+    auto secondSubscription = AudioManager::subscribeToAudioEvents(&second);
+
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(AudioManager::playSound(key).valid());
+    }
+    // Buffered until the frame ends.
+    REQUIRE(first.batches.empty());
+
+    VoiceHooks::finished = true;
+    AudioManager::tick();
+
+    for (const auto* sink : {&first, &second}) {
+        REQUIRE(sink->batches.size() == 1);
+        const auto& batch = sink->batches.front();
+        // Six plays stole a voice; tick() then saw the remaining four finish.
+        REQUIRE(batch.size() == 10);
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            REQUIRE(batch[i].type == AudioEventType::SoundPlaybackStopped);
+            REQUIRE(batch[i].key == key);
+            REQUIRE(batch[i].details == (i < 6 ? "stolen" : ""));
+        }
+    }
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.eventsPublished == 10);
+    REQUIRE(metrics.eventsCoalesced == 0);
+    REQUIRE(metrics.eventBatchesDelivered == 2);
+
+    // Nothing new, nothing delivered.
+    AudioManager::tick();
+    REQUIRE(first.batches.size() == 1);
+
+    // Tools that do not tick can flush.
+    REQUIRE(AudioManager::releaseSound(key));
+    AudioManager::flushEvents();
+    REQUIRE(first.batches.size() == 2);
+    REQUIRE(first.batches.back().front().type == AudioEventType::SoundUnloaded);
+
+    REQUIRE(AudioManager::unsubscribeFromAudioEvents(firstSubscription));
+    REQUIRE(AudioManager::unsubscribeFromAudioEvents(secondSubscription));
+}
+
+TEST_CASE_METHOD(AudioEventsFixture, "AudioManager buffers nothing while nobody is subscribed", "[audio][events]") {
+    REQUIRE(AudioManager::init());
+    const auto key = AudioManager::acquireSound("blip.wav").key;
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(AudioManager::playSound(key).valid());
+    }
+    AudioManager::tick();
+    REQUIRE(AudioManager::metrics().eventsPublished == 0);
+
+    // A sink that subscribes later only hears what happens from then on.
+    RecordingSink sink;
+    auto subscription = AudioManager::subscribeToAudioEvents(&sink);
+    AudioManager::tick();
+    REQUIRE(sink.batches.empty());
+    REQUIRE(AudioManager::playSound(key).valid());
+    AudioManager::tick();
+    REQUIRE(sink.batches.size() == 1);
+    REQUIRE(sink.batches.front().size() == 1);
+    REQUIRE(AudioManager::unsubscribeFromAudioEvents(subscription));
+}
+
+TEST_CASE_METHOD(AudioEventsFixture, "AudioManager coalesces repeated events when configured", "[audio][events]") {
+    ConfigurationManager::set("audio.core.coalesce_events", true);
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::config().coalesceEvents);
+    const auto blip = AudioManager::acquireSound("blip.wav").key;
+    const auto boom = AudioManager::acquireSound("boom.wav").key;
+    RecordingSink sink;
+    auto subscription = AudioManager::subscribeToAudioEvents(&sink);
+
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(AudioManager::playSound(blip).valid());
+    }
+    REQUIRE(AudioManager::playSound(boom).valid());
+    VoiceHooks::finished = true;
+    AudioManager::tick();
+
+    // Five voices were stolen, all blips (the boom took the oldest blip's slot); the tick then saw
+    // three blips and the boom finish.
+    REQUIRE(sink.batches.size() == 1);
+    const auto& batch = sink.batches.front();
+    REQUIRE(batch.size() == 3);
+    REQUIRE(batch[0].key == blip);
+    REQUIRE(batch[0].details == "stolen");
+    REQUIRE(batch[0].count == 5);
+    // The tick visits voices in slot order, and the boom reused the first slot.
+    REQUIRE(batch[1].key == boom);
+    REQUIRE(batch[1].count == 1);
+    REQUIRE(batch[2].key == blip);
+    REQUIRE(batch[2].details.empty());
+    REQUIRE(batch[2].count == 3);
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.eventsPublished == 9);
+    REQUIRE(metrics.eventsCoalesced == 6);
+    REQUIRE(AudioManager::unsubscribeFromAudioEvents(subscription));
+}
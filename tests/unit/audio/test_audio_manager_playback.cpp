@@ -12,6 +12,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include <nlohmann/json.hpp>
+
 // Forward declaration from raylib internals so test doubles can tag buffers.
 struct rAudioBuffer;
 
@@ -19,6 +21,8 @@ using gb2d::ConfigurationManager;
 using gb2d::audio::AudioManager;
 using gb2d::audio::PlaybackHandle;
 using gb2d::audio::PlaybackParams;
+using gb2d::audio::SoundVoiceSettings;
+using gb2d::audio::VoiceStealPolicy;
 
 namespace {
 
@@ -71,6 +75,12 @@ public:
         return count;
     }
 
+    static std::size_t aliasCount() {
+        std::lock_guard lock(mutex());
+        return static_cast<std::size_t>(std::count_if(sounds().begin(), sounds().end(),
+                                                      [](const auto& entry) { return entry.second.isAlias; }));
+    }
+
     static void setAllSoundsPlaying(bool playing) {
         std::lock_guard lock(mutex());
         for (auto& [id, info] : sounds()) {
@@ -103,28 +113,28 @@ public:
 
     static const AudioManager::RaylibHooks& hooks() {
         static const AudioManager::RaylibHooks api{
-            loadSound,
-            unloadSound,
-            loadSoundAlias,
-            unloadSoundAlias,
-            playSound,
-            stopSound,
-            isSoundPlaying,
-            setSoundVolume,
-            setSoundPitch,
-            setSoundPan,
-            loadMusicStream,
-            unloadMusicStream,
-            playMusicStream,
-            pauseMusicStream,
-            resumeMusicStream,
-            stopMusicStream,
-            updateMusicStream,
-            isMusicStreamPlaying,
-            setMusicVolume,
-            seekMusicStream,
-            getMusicTimeLength,
-            getMusicTimePlayed};
+            .loadSound = loadSound,
+            .unloadSound = unloadSound,
+            .loadSoundAlias = loadSoundAlias,
+            .unloadSoundAlias = unloadSoundAlias,
+            .playSound = playSound,
+            .stopSound = stopSound,
+            .isSoundPlaying = isSoundPlaying,
+            .setSoundVolume = setSoundVolume,
+            .setSoundPitch = setSoundPitch,
+            .setSoundPan = setSoundPan,
+            .loadMusicStream = loadMusicStream,
+            .unloadMusicStream = unloadMusicStream,
+            .playMusicStream = playMusicStream,
+            .pauseMusicStream = pauseMusicStream,
+            .resumeMusicStream = resumeMusicStream,
+            .stopMusicStream = stopMusicStream,
+            .updateMusicStream = updateMusicStream,
+            .isMusicStreamPlaying = isMusicStreamPlaying,
+            .setMusicVolume = setMusicVolume,
+            .seekMusicStream = seekMusicStream,
+            .getMusicTimeLength = getMusicTimeLength,
+            .getMusicTimePlayed = getMusicTimePlayed};
         return api;
     }
 
@@ -335,6 +345,8 @@ struct AudioTestFixture {
             std::vector<std::string>{tempDir.string()});
         ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
         ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        // The stub advances music position on every update; refilling from tick() keeps it deterministic.
+        ConfigurationManager::set("audio.music.stream_thread", false);
 
         backend.ready = true;
         AudioManager::setBackendForTesting(&backend);
@@ -461,3 +473,270 @@ TEST_CASE_METHOD(AudioTestFixture, "AudioManager reports music playback status",
     REQUIRE_FALSE(status.paused);
     REQUIRE(status.positionSeconds == Catch::Approx(0.0f));
 }
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager caches path resolution and drops it when search paths change", "[audio][paths]") {
+    auto first = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(first.placeholder);
+    auto again = AudioManager::acquireSound("blip.wav");
+    REQUIRE(again.key == first.key);
+
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.pathLookups == 2);
+    REQUIRE(metrics.pathCacheHits == 1);
+    REQUIRE(metrics.pathProbesAvoided >= 1);
+
+    // Misses are cached too, until the search paths change.
+    const auto extraDir = tempDir / "extra";
+    std::filesystem::create_directories(extraDir);
+    std::ofstream(extraDir / "zap.wav").put('\0');
+    REQUIRE(AudioManager::acquireSound("zap.wav").placeholder);
+    const auto probesAfterMiss = AudioManager::metrics().pathProbes;
+    REQUIRE(AudioManager::acquireSound("zap.wav").placeholder);
+    REQUIRE(AudioManager::metrics().pathProbes == probesAfterMiss);
+
+    ConfigurationManager::set("audio.engine.search_paths",
+                              std::vector<std::string>{tempDir.string(), extraDir.string()});
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+    REQUIRE(AudioManager::config().searchPaths.size() == 2);
+    REQUIRE_FALSE(AudioManager::acquireSound("zap.wav").placeholder);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager steals the lowest-priority voice when slots are exhausted", "[audio][sound][voices]") {
+    std::ofstream(tempDir / "zap.wav").put('\0');
+    auto blip = AudioManager::acquireSound("blip.wav");
+    auto zap = AudioManager::acquireSound("zap.wav");
+    REQUIRE_FALSE(blip.placeholder);
+    REQUIRE_FALSE(zap.placeholder);
+    REQUIRE(AudioManager::config().stealPolicy == VoiceStealPolicy::LowestPriority);
+
+    PlaybackParams low;
+    low.priority = 0;
+    PlaybackParams mid;
+    mid.priority = 5;
+    PlaybackParams high;
+    high.priority = 10;
+
+    auto lowHandle = AudioManager::playSound(blip.key, low);
+    auto midHandle = AudioManager::playSound(blip.key, mid);
+    auto highHandle = AudioManager::playSound(zap.key, high);
+    REQUIRE(highHandle.valid());
+    REQUIRE(highHandle.slot == lowHandle.slot);
+    REQUIRE(highHandle.generation != lowHandle.generation);
+
+    // The stolen handle is stale even though its slot is busy again.
+    REQUIRE_FALSE(AudioManager::isHandleActive(lowHandle));
+    REQUIRE_FALSE(AudioManager::stopSound(lowHandle));
+    REQUIRE_FALSE(AudioManager::updateSoundPlayback(lowHandle, PlaybackParams{}));
+    REQUIRE(AudioManager::isHandleActive(midHandle));
+    REQUIRE(AudioManager::isHandleActive(highHandle));
+    REQUIRE(StubRaylib::activeSoundCount() == 2);
+
+    // Nothing playing is below priority 5, so an equal-priority request is dropped.
+    REQUIRE_FALSE(AudioManager::playSound(zap.key, mid).valid());
+
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.voicesStolen == 1);
+    REQUIRE(metrics.voicesDropped == 1);
+    REQUIRE(metrics.activeSoundInstances == 2);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager steal policies pick oldest or quietest voices", "[audio][sound][voices]") {
+    auto blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(blip.placeholder);
+
+    ConfigurationManager::set("audio.engine.steal_policy", std::string("oldest"));
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+    REQUIRE(AudioManager::config().stealPolicy == VoiceStealPolicy::Oldest);
+
+    auto first = AudioManager::playSound(blip.key, PlaybackParams{0.2f, 1.0f, 0.5f});
+    auto second = AudioManager::playSound(blip.key, PlaybackParams{0.9f, 1.0f, 0.5f});
+    auto third = AudioManager::playSound(blip.key, PlaybackParams{0.5f, 1.0f, 0.5f});
+    REQUIRE(third.valid());
+    REQUIRE_FALSE(AudioManager::isHandleActive(first));
+    REQUIRE(AudioManager::isHandleActive(second));
+
+    ConfigurationManager::set("audio.engine.steal_policy", std::string("quietest"));
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+
+    // `second` is older, but `third` is quieter.
+    auto fourth = AudioManager::playSound(blip.key, PlaybackParams{1.0f, 1.0f, 0.5f});
+    REQUIRE(fourth.valid());
+    REQUIRE(AudioManager::isHandleActive(second));
+    REQUIRE_FALSE(AudioManager::isHandleActive(third));
+
+    // A higher-priority voice is never stolen, whatever the policy.
+    PlaybackParams important{0.1f, 1.0f, 0.5f};
+    important.priority = 3;
+    auto fifth = AudioManager::playSound(blip.key, important);
+    REQUIRE(fifth.valid());
+    PlaybackParams background;
+    background.priority = -1;
+    REQUIRE_FALSE(AudioManager::playSound(blip.key, background).valid());
+    REQUIRE(AudioManager::isHandleActive(fifth));
+    REQUIRE(AudioManager::metrics().voicesStolen == 3);
+    // Policy steals that happen to hit the same sound are not instance-cap retriggers.
+    REQUIRE(AudioManager::metrics().instanceCapHits == 0);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager caps simultaneous instances per sound", "[audio][sound][voices]") {
+    ConfigurationManager::set("audio.engine.max_concurrent_sounds", static_cast<int64_t>(4));
+    ConfigurationManager::setJson("audio.engine.voices", nlohmann::json{{"blip.wav", {{"priority", 2}, {"max_instances", 1}}}});
+    AudioManager::shutdown();
+    REQUIRE(AudioManager::init());
+
+    auto blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(blip.placeholder);
+    auto voice = AudioManager::soundVoiceSettings(blip.key);
+    REQUIRE(voice);
+    REQUIRE(voice->priority == 2);
+    REQUIRE(voice->maxInstances == 1);
+
+    // At the cap a new play retriggers the sound's own oldest voice instead of taking a free slot.
+    auto first = AudioManager::playSound(blip.key);
+    auto second = AudioManager::playSound(blip.key);
+    REQUIRE(second.valid());
+    REQUIRE_FALSE(AudioManager::isHandleActive(first));
+    REQUIRE(StubRaylib::activeSoundCount() == 1);
+    REQUIRE(AudioManager::metrics().instanceCapHits == 1);
+
+    // With stealing off the request is dropped instead; runtime overrides replace the config entry.
+    ConfigurationManager::set("audio.engine.steal_policy", std::string("none"));
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+    REQUIRE_FALSE(AudioManager::playSound(blip.key).valid());
+    REQUIRE(AudioManager::isHandleActive(second));
+
+    REQUIRE(AudioManager::setSoundVoiceSettings(blip.key, SoundVoiceSettings{2, 2}));
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    REQUIRE(StubRaylib::activeSoundCount() == 2);
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.instanceCapHits == 2);
+    REQUIRE(metrics.voicesDropped == 1);
+    REQUIRE(metrics.voicesStolen == 1);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager recycles pre-created sound aliases", "[audio][sound][aliases]") {
+    auto blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(blip.placeholder);
+    REQUIRE(AudioManager::config().aliasPoolSize == 2);
+    REQUIRE(StubRaylib::aliasCount() == 2);
+
+    for (int i = 0; i < 10; ++i) {
+        auto handle = AudioManager::playSound(blip.key);
+        REQUIRE(handle.valid());
+        if (i % 2 == 0) {
+            REQUIRE(AudioManager::stopSound(handle));
+        } else {
+            StubRaylib::setAllSoundsPlaying(false);
+            AudioManager::tick();
+        }
+    }
+
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.aliasPoolHits == 10);
+    REQUIRE(metrics.aliasPoolMisses == 0);
+    REQUIRE(metrics.pooledAliases == 2);
+    REQUIRE(StubRaylib::aliasCount() == 2);
+
+    // Releasing the sound stops its voices and unloads every alias it owns.
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    REQUIRE(AudioManager::releaseSound(blip.key));
+    REQUIRE(StubRaylib::aliasCount() == 0);
+    REQUIRE(AudioManager::metrics().activeSoundInstances == 0);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager sizes alias pools from observed concurrency", "[audio][sound][aliases]") {
+    ConfigurationManager::set("audio.engine.alias_pool_size", static_cast<int64_t>(0));
+    AudioManager::shutdown();
+    REQUIRE(AudioManager::init());
+
+    auto blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE(StubRaylib::aliasCount() == 0);
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.aliasPoolMisses == 2);
+    REQUIRE(metrics.aliasPoolHits == 0);
+
+    REQUIRE(AudioManager::releaseSound(blip.key));
+    REQUIRE(StubRaylib::aliasCount() == 0);
+
+    // Two voices played at once before, so the next load pre-creates two.
+    blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE(StubRaylib::aliasCount() == 2);
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    metrics = AudioManager::metrics();
+    REQUIRE(metrics.aliasPoolMisses == 2);
+    REQUIRE(metrics.aliasPoolHits == 2);
+    REQUIRE(metrics.pooledAliases == 0);
+}
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager applies posted commands in order on tick", "[audio][sound][commands]") {
+    auto blip = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(blip.placeholder);
+
+    REQUIRE(AudioManager::postPlaySound(blip.key));
+    REQUIRE(AudioManager::postPlaySound(blip.key));
+    REQUIRE(AudioManager::postStopAllSounds());
+    REQUIRE(AudioManager::postPlaySound(blip.key, PlaybackParams{0.5f, 1.0f, 0.5f}));
+    REQUIRE(StubRaylib::activeSoundCount() == 0);
+    REQUIRE(AudioManager::metrics().commandsPending == 4);
+
+    AudioManager::tick();
+    REQUIRE(StubRaylib::activeSoundCount() == 1);
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.commandsPosted == 4);
+    REQUIRE(metrics.commandsApplied == 4);
+    REQUIRE(metrics.commandsPending == 0);
+
+    // Posted commands can target handles from the synchronous API.
+    auto handle = AudioManager::playSound(blip.key);
+    REQUIRE(handle.valid());
+    REQUIRE(AudioManager::postUpdateSoundPlayback(handle, PlaybackParams{0.25f, 1.0f, 0.5f}));
+    REQUIRE(AudioManager::postStopSound(handle));
+    REQUIRE(AudioManager::isHandleActive(handle));
+    AudioManager::tick();
+    REQUIRE_FALSE(AudioManager::isHandleActive(handle));
+    REQUIRE(StubRaylib::activeSoundCount() == 1);
+}
+
+namespace {
+
+// Calls back into the manager from the event, which deadlocks if sinks run under the lock.
+struct ReentrantSink final : gb2d::audio::AudioEventSink {
+    std::string replayKey;
+    std::vector<gb2d::audio::AudioEventType> seen;
+    PlaybackHandle replayed;
+
+    void onAudioEvent(const gb2d::audio::AudioEvent& event) override {
+        seen.push_back(event.type);
+        if (event.type == gb2d::audio::AudioEventType::SoundPlaybackStopped && !replayed.valid()) {
+            (void)AudioManager::metrics();
+            replayed = AudioManager::playSound(replayKey);
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE_METHOD(AudioTestFixture, "AudioManager delivers events after releasing its lock", "[audio][events]") {
+    auto blip = AudioManager::acquireSound("blip.wav");
+    ReentrantSink sink;
+    sink.replayKey = blip.key;
+    auto subscription = AudioManager::subscribeToAudioEvents(&sink);
+
+    REQUIRE(AudioManager::playSound(blip.key).valid());
+    StubRaylib::setAllSoundsPlaying(false);
+    AudioManager::tick();
+
+    REQUIRE(sink.seen.size() == 1);
+    REQUIRE(sink.seen.front() == gb2d::audio::AudioEventType::SoundPlaybackStopped);
+    REQUIRE(AudioManager::isHandleActive(sink.replayed));
+
+    // Once unsubscribed the sink hears nothing more.
+    REQUIRE(AudioManager::unsubscribeFromAudioEvents(subscription));
+    StubRaylib::setAllSoundsPlaying(false);
+    AudioManager::tick();
+    REQUIRE(sink.seen.size() == 1);
+}
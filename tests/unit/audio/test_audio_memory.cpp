@@ -0,0 +1,225 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "AudioTestHooks.h"
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::SoundInventoryRecord;
+using gb2d::audio::testing::AudioManagerFixture;
+
+namespace {
+
+constexpr std::size_t kSoundFrames = 44100;
+constexpr std::size_t kBytesPerFrame = 8; // raylib keeps sounds as 32-bit float stereo
+constexpr std::size_t kWavBytes = kSoundFrames * kBytesPerFrame;
+// Each byte of an encoded test file decodes to a tenth of a second.
+constexpr unsigned int kFramesPerEncodedByte = 4410;
+
+// Files load as one second of device-format audio; encoded files decode to a length set by their
+// size. Voices play until a test sets `finished`.
+struct MemoryHooks {
+    static inline int fileLoads{0};
+    static inline int memoryDecodes{0};
+    static inline bool finished{false};
+    static inline unsigned char waveData[4]{};
+
+    static Sound make(unsigned int frames) {
+        Sound sound = gb2d::audio::testing::makeFakeSound(frames);
+        sound.stream.sampleRate = 44100;
+        sound.stream.sampleSize = 32;
+        sound.stream.channels = 2;
+        return sound;
+    }
+    static Sound loadSound(const char*) {
+        ++fileLoads;
+        return make(kSoundFrames);
+    }
+    static Wave loadWaveFromMemory(const char*, const unsigned char*, int dataSize) {
+        ++memoryDecodes;
+        Wave wave{};
+        wave.frameCount = static_cast<unsigned int>(dataSize) * kFramesPerEncodedByte;
+        wave.sampleRate = 44100;
+        wave.sampleSize = 16;
+        wave.channels = 2;
+        wave.data = waveData;
+        return wave;
+    }
+
+    static void reset() {
+        fileLoads = 0;
+        memoryDecodes = 0;
+        finished = false;
+    }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            auto table = gb2d::audio::testing::stubRaylibHooks();
+            table.loadSound = loadSound;
+            table.loadSoundAlias = [](Sound source) { return make(source.frameCount); };
+            table.isSoundPlaying = [](Sound) { return !finished; };
+            table.unloadWave = [](Wave) {};
+            table.unloadWaveSamples = [](float*) {};
+            table.loadSoundFromWave = [](Wave wave) { return make(wave.frameCount); };
+            table.loadWaveFromMemory = loadWaveFromMemory;
+            return table;
+        }();
+        return api;
+    }
+};
+
+struct AudioMemoryFixture : AudioManagerFixture {
+    AudioMemoryFixture() : AudioManagerFixture("gb2d-audio-memory-tests", MemoryHooks::hooks()) {
+        for (const char* name : {"a.wav", "b.wav", "c.wav"}) {
+            tempDir.touch(name);
+        }
+        writeEncoded("ambience.ogg", 30); // 3 s
+        writeEncoded("click.ogg", 10);    // 1 s
+        ConfigurationManager::set("audio.engine.alias_pool_size", static_cast<int64_t>(0));
+        MemoryHooks::reset();
+    }
+
+    void writeEncoded(const char* name, std::size_t bytes) {
+        std::ofstream file(tempDir / name, std::ios::binary);
+        file << std::string(bytes, 'x');
+    }
+
+    static std::optional<SoundInventoryRecord> inventory(const std::string& key) {
+        for (auto& record : AudioManager::captureSoundInventorySnapshot()) {
+            if (record.key == key) {
+                return record;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+} // namespace
+
+TEST_CASE_METHOD(AudioMemoryFixture, "AudioManager reports the bytes each sound holds", "[audio][memory]") {
+    REQUIRE(AudioManager::init());
+    const auto a = AudioManager::acquireSound("a.wav").key;
+    // Without decode-on-demand an OGG file loads like any other.
+    const auto ambience = AudioManager::acquireSound("ambience.ogg").key;
+    REQUIRE(MemoryHooks::fileLoads == 2);
+    REQUIRE(MemoryHooks::memoryDecodes == 0);
+
+    REQUIRE(inventory(a)->bytes == kWavBytes);
+    REQUIRE_FALSE(inventory(ambience)->decodeOnDemand);
+    REQUIRE(inventory(ambience)->decoded);
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.soundMemoryBytes == 2 * kWavBytes);
+    REQUIRE(metrics.encodedSoundBytes == 0);
+    REQUIRE(metrics.memoryBudgetBytes == 0);
+
+    // No budget: released sounds are unloaded right away.
+    REQUIRE(AudioManager::releaseSound(a));
+    REQUIRE_FALSE(inventory(a).has_value());
+    REQUIRE(AudioManager::metrics().retainedSounds == 0);
+}
+
+TEST_CASE_METHOD(AudioMemoryFixture, "Released sounds stay resident within the budget and are evicted oldest first", "[audio][memory]") {
+    ConfigurationManager::set("audio.memory.max_bytes", static_cast<int64_t>(kWavBytes * 5 / 2));
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::config().memoryBudgetBytes == kWavBytes * 5 / 2);
+    const auto a = AudioManager::acquireSound("a.wav").key;
+    const auto b = AudioManager::acquireSound("b.wav").key;
+
+    REQUIRE(AudioManager::releaseSound(a));
+    REQUIRE(AudioManager::releaseSound(b));
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.loadedSounds == 2);
+    REQUIRE(metrics.retainedSounds == 2);
+    REQUIRE(inventory(a)->evictionRank == std::optional<std::size_t>{0});
+    REQUIRE(inventory(b)->evictionRank == std::optional<std::size_t>{1});
+    // Released means released: a retained sound cannot be played or looked up.
+    REQUIRE_FALSE(AudioManager::playSound(a).valid());
+    REQUIRE(AudioManager::tryGetSound(a) == nullptr);
+
+    // Acquiring again reuses the resident copy.
+    const auto again = AudioManager::acquireSound("a.wav");
+    REQUIRE_FALSE(again.newlyLoaded);
+    REQUIRE(MemoryHooks::fileLoads == 2);
+    REQUIRE_FALSE(inventory(a)->evictionRank.has_value());
+    REQUIRE(AudioManager::playSound(a).valid());
+
+    // A third sound goes over budget; b, the only released sound, makes room.
+    const auto c = AudioManager::acquireSound("c.wav").key;
+    metrics = AudioManager::metrics();
+    REQUIRE(metrics.soundsEvicted == 1);
+    REQUIRE(metrics.evictedSoundBytes == kWavBytes);
+    REQUIRE(metrics.retainedSounds == 0);
+    REQUIRE(metrics.soundMemoryBytes == 2 * kWavBytes);
+    REQUIRE_FALSE(inventory(b).has_value());
+    REQUIRE(inventory(c).has_value());
+}
+
+TEST_CASE_METHOD(AudioMemoryFixture, "Long compressed sounds stay encoded until their first play", "[audio][memory]") {
+    ConfigurationManager::set("audio.memory.decode_on_demand_seconds", 2.0);
+    REQUIRE(AudioManager::init());
+    const auto ambience = AudioManager::acquireSound("ambience.ogg").key;
+    const auto click = AudioManager::acquireSound("click.ogg").key;
+    const auto a = AudioManager::acquireSound("a.wav").key;
+    // Both OGG files were measured once; only the WAV went through LoadSound.
+    REQUIRE(MemoryHooks::memoryDecodes == 2);
+    REQUIRE(MemoryHooks::fileLoads == 1);
+
+    auto record = inventory(ambience);
+    REQUIRE(record->decodeOnDemand);
+    REQUIRE_FALSE(record->decoded);
+    REQUIRE(record->bytes == 30);
+    REQUIRE(record->durationSeconds == Approx(3.0f));
+    REQUIRE(record->sampleRate == 44100);
+    REQUIRE_FALSE(inventory(click)->decodeOnDemand);
+    REQUIRE(inventory(click)->bytes == 10 * kFramesPerEncodedByte * kBytesPerFrame);
+    REQUIRE_FALSE(inventory(a)->decodeOnDemand);
+    REQUIRE(AudioManager::metrics().encodedSoundBytes == 30);
+
+    REQUIRE(AudioManager::playSound(ambience).valid());
+    REQUIRE(MemoryHooks::memoryDecodes == 3);
+    record = inventory(ambience);
+    REQUIRE(record->decoded);
+    REQUIRE(record->bytes == 30 + 30 * kFramesPerEncodedByte * kBytesPerFrame);
+    REQUIRE(AudioManager::playSound(ambience).valid());
+    REQUIRE(MemoryHooks::memoryDecodes == 3);
+    REQUIRE(AudioManager::metrics().soundsDecodedOnDemand == 1);
+}
+
+TEST_CASE_METHOD(AudioMemoryFixture, "Memory pressure drops the decoded copy of idle decode-on-demand sounds", "[audio][memory]") {
+    const std::size_t decodedAmbience = 30 * kFramesPerEncodedByte * kBytesPerFrame;
+    ConfigurationManager::set("audio.memory.decode_on_demand_seconds", 2.0);
+    ConfigurationManager::set("audio.memory.max_bytes", static_cast<int64_t>(decodedAmbience + kWavBytes / 2));
+    REQUIRE(AudioManager::init());
+    const auto ambience = AudioManager::acquireSound("ambience.ogg").key;
+    REQUIRE(AudioManager::playSound(ambience).valid());
+
+    // Still playing: the decoded copy is in use, so going over budget cannot drop it.
+    const auto a = AudioManager::acquireSound("a.wav").key;
+    REQUIRE(inventory(ambience)->decoded);
+    REQUIRE(AudioManager::metrics().decodedSoundsDropped == 0);
+
+    MemoryHooks::finished = true;
+    AudioManager::tick();
+    MemoryHooks::finished = false;
+    const auto b = AudioManager::acquireSound("b.wav").key;
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.decodedSoundsDropped == 1);
+    REQUIRE(metrics.soundMemoryBytes == 30 + 2 * kWavBytes);
+    REQUIRE_FALSE(inventory(ambience)->decoded);
+
+    // The next play decodes it again.
+    REQUIRE(AudioManager::playSound(ambience).valid());
+    REQUIRE(inventory(ambience)->decoded);
+    REQUIRE(AudioManager::metrics().soundsDecodedOnDemand == 2);
+    (void)a;
+    (void)b;
+}
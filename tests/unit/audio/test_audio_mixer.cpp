@@ -0,0 +1,526 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/audio/AudioMixer.h"
+#include "services/audio/MixerKernels.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::AudioMixer;
+using gb2d::audio::MixerBusConfig;
+using gb2d::audio::MixerBusMeter;
+using gb2d::audio::MixerBusSettings;
+using gb2d::audio::MixerEffectSettings;
+using gb2d::audio::MixerEffectType;
+using gb2d::audio::MixerVoiceParams;
+using gb2d::audio::PcmBuffer;
+using gb2d::audio::PlaybackParams;
+
+namespace kernels = gb2d::audio::kernels;
+
+namespace {
+
+constexpr std::uint32_t kRate = 48000;
+
+std::shared_ptr<const PcmBuffer> constantPcm(float value, std::size_t frames, std::uint32_t channels = 2) {
+    auto pcm = std::make_shared<PcmBuffer>();
+    pcm->sampleRate = kRate;
+    pcm->channels = channels;
+    pcm->samples.assign(frames * channels, value);
+    return pcm;
+}
+
+std::vector<float> render(AudioMixer& mixer, std::size_t frames) {
+    std::vector<float> out(frames * 2, -1.0f);
+    mixer.render(out.data(), frames);
+    return out;
+}
+
+MixerBusMeter meterFor(const AudioMixer& mixer, const std::string& bus) {
+    for (const auto& meter : mixer.meters()) {
+        if (meter.name == bus) {
+            return meter;
+        }
+    }
+    return {};
+}
+
+float peakOf(const std::vector<float>& samples, std::size_t fromFrame = 0) {
+    float peak = 0.0f;
+    for (std::size_t i = fromFrame * 2; i < samples.size(); ++i) {
+        peak = std::max(peak, std::fabs(samples[i]));
+    }
+    return peak;
+}
+
+} // namespace
+
+TEST_CASE("Mixer kernels match a scalar reference on odd lengths", "[audio][mixer][kernels]") {
+    constexpr std::size_t frames = 37;
+    std::vector<float> src(frames * 2);
+    std::vector<float> mono(frames);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = std::sin(static_cast<float>(i) * 0.37f);
+    }
+    for (std::size_t i = 0; i < frames; ++i) {
+        mono[i] = std::cos(static_cast<float>(i) * 0.21f);
+    }
+
+    std::vector<float> dst(src.size(), 0.25f);
+    kernels::mixScaled(dst.data(), src.data(), src.size(), 0.5f);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        REQUIRE(dst[i] == Approx(0.25f + src[i] * 0.5f));
+    }
+
+    std::fill(dst.begin(), dst.end(), 0.0f);
+    kernels::mixStereo(dst.data(), src.data(), frames, 0.2f, 0.9f);
+    for (std::size_t f = 0; f < frames; ++f) {
+        REQUIRE(dst[f * 2] == Approx(src[f * 2] * 0.2f));
+        REQUIRE(dst[f * 2 + 1] == Approx(src[f * 2 + 1] * 0.9f));
+    }
+
+    std::fill(dst.begin(), dst.end(), 0.0f);
+    kernels::mixMonoToStereo(dst.data(), mono.data(), frames, 0.3f, 0.7f);
+    for (std::size_t f = 0; f < frames; ++f) {
+        REQUIRE(dst[f * 2] == Approx(mono[f] * 0.3f));
+        REQUIRE(dst[f * 2 + 1] == Approx(mono[f] * 0.7f));
+    }
+
+    dst = src;
+    kernels::applyGainRamp(dst.data(), frames, 0.0f, 1.0f);
+    for (std::size_t f = 0; f < frames; ++f) {
+        const float gain = static_cast<float>(f + 1) / static_cast<float>(frames);
+        REQUIRE(dst[f * 2] == Approx(src[f * 2] * gain).margin(1e-6));
+        REQUIRE(dst[f * 2 + 1] == Approx(src[f * 2 + 1] * gain).margin(1e-6));
+    }
+
+    const auto levels = kernels::measureStereo(src.data(), frames);
+    float peakLeft = 0.0f;
+    double sumRight = 0.0;
+    for (std::size_t f = 0; f < frames; ++f) {
+        peakLeft = std::max(peakLeft, std::fabs(src[f * 2]));
+        sumRight += static_cast<double>(src[f * 2 + 1]) * src[f * 2 + 1];
+    }
+    REQUIRE(levels.peak[0] == Approx(peakLeft));
+    REQUIRE(levels.sumSquares[1] == Approx(sumRight));
+}
+
+TEST_CASE("AudioMixer plays voices with gain, pan and channel spreading", "[audio][mixer]") {
+    AudioMixer mixer(kRate);
+    auto stereo = constantPcm(0.5f, 1000);
+    auto mono = constantPcm(0.25f, 1000, 1);
+
+    const auto centered = mixer.startVoice(stereo, AudioMixer::kSfxBus, MixerVoiceParams{1.0f, 0.5f, 1.0f});
+    REQUIRE(centered != 0);
+    auto out = render(mixer, 100);
+    REQUIRE(out[0] == Approx(0.5f));
+    REQUIRE(out[199] == Approx(0.5f));
+
+    REQUIRE(mixer.stopVoice(centered));
+    mixer.startVoice(mono, AudioMixer::kSfxBus, MixerVoiceParams{0.8f, 1.0f, 1.0f});
+    out = render(mixer, 600); // pan change ramps in the first block only
+    REQUIRE(out[1200 - 2] == Approx(0.0f).margin(1e-6));
+    REQUIRE(out[1200 - 1] == Approx(0.2f));
+
+    REQUIRE(mixer.startVoice(std::make_shared<PcmBuffer>(), AudioMixer::kSfxBus, {}) == 0);
+}
+
+TEST_CASE("AudioMixer finishes, loops and resamples voices", "[audio][mixer]") {
+    AudioMixer mixer(kRate);
+    auto pcm = constantPcm(1.0f, 300);
+
+    const auto oneShot = mixer.startVoice(pcm, AudioMixer::kSfxBus, {});
+    const auto looped = mixer.startVoice(pcm, AudioMixer::kMusicBus, {}, true);
+    auto out = render(mixer, 1000);
+    REQUIRE_FALSE(mixer.isVoicePlaying(oneShot));
+    REQUIRE(mixer.isVoicePlaying(looped));
+    REQUIRE(out[2 * 299] == Approx(2.0f));
+    REQUIRE(out[2 * 999] == Approx(1.0f));
+    REQUIRE(mixer.activeVoices() == 1);
+    mixer.stopAllVoices();
+    REQUIRE(mixer.activeVoices() == 0);
+
+    const auto fast = mixer.startVoice(pcm, AudioMixer::kSfxBus, MixerVoiceParams{1.0f, 0.5f, 2.0f});
+    render(mixer, 149);
+    REQUIRE(mixer.isVoicePlaying(fast));
+    render(mixer, 2);
+    REQUIRE_FALSE(mixer.isVoicePlaying(fast));
+
+    const auto seeking = mixer.startVoice(pcm, AudioMixer::kSfxBus, {});
+    REQUIRE(mixer.seekVoice(seeking, 250.0f / kRate));
+    REQUIRE(mixer.voicePosition(seeking).value() == Approx(250.0f / kRate));
+    REQUIRE(mixer.setVoicePaused(seeking, true));
+    out = render(mixer, 100);
+    REQUIRE(peakOf(out) == 0.0f);
+    REQUIRE(mixer.setVoicePaused(seeking, false));
+    render(mixer, 100);
+    REQUIRE_FALSE(mixer.isVoicePlaying(seeking));
+    REQUIRE(mixer.framesRendered() == 1000 + 151 + 200);
+}
+
+TEST_CASE("AudioMixer applies bus gain, mute and solo", "[audio][mixer][buses]") {
+    AudioMixer mixer(kRate);
+    REQUIRE(mixer.addBus("footsteps", AudioMixer::kSfxBus));
+    REQUIRE_FALSE(mixer.addBus("footsteps"));
+    REQUIRE_FALSE(mixer.addBus("orphan", "missing"));
+
+    mixer.startVoice(constantPcm(0.1f, 4000), "footsteps", {}, true);
+    mixer.startVoice(constantPcm(0.2f, 4000), AudioMixer::kMusicBus, {}, true);
+    mixer.startVoice(constantPcm(0.4f, 4000), AudioMixer::kUiBus, {}, true);
+    auto out = render(mixer, 256);
+    REQUIRE(out[510] == Approx(0.7f));
+
+    // Settle gain ramps with a block, then check the steady state in the next one.
+    const auto settle = [&mixer]() {
+        render(mixer, AudioMixer::kBlockFrames);
+        return render(mixer, AudioMixer::kBlockFrames);
+    };
+
+    REQUIRE(mixer.setBusSettings(AudioMixer::kMusicBus, MixerBusSettings{0.5f, false, false}));
+    out = settle();
+    REQUIRE(out[0] == Approx(0.6f));
+
+    REQUIRE(mixer.setBusSettings(AudioMixer::kSfxBus, MixerBusSettings{1.0f, true, false}));
+    out = settle();
+    REQUIRE(out[0] == Approx(0.5f));
+    REQUIRE_FALSE(meterFor(mixer, "footsteps").audible);
+
+    REQUIRE(mixer.setBusSettings(AudioMixer::kSfxBus, MixerBusSettings{}));
+    REQUIRE(mixer.setBusSettings("footsteps", MixerBusSettings{1.0f, false, true}));
+    out = settle();
+    REQUIRE(out[0] == Approx(0.1f));
+    REQUIRE(meterFor(mixer, AudioMixer::kSfxBus).audible);
+    REQUIRE(meterFor(mixer, AudioMixer::kMasterBus).audible);
+    REQUIRE_FALSE(meterFor(mixer, AudioMixer::kMusicBus).audible);
+
+    REQUIRE(mixer.setBusSettings("footsteps", MixerBusSettings{}));
+    mixer.setOutputGain(0.5f);
+    out = settle();
+    REQUIRE(out[0] == Approx(0.3f));
+    REQUIRE_FALSE(mixer.setBusSettings("missing", MixerBusSettings{}));
+}
+
+TEST_CASE("AudioMixer meters report peak and RMS per bus", "[audio][mixer][meters]") {
+    AudioMixer mixer(kRate);
+    mixer.startVoice(constantPcm(0.5f, 2000), AudioMixer::kSfxBus, MixerVoiceParams{1.0f, 1.0f, 1.0f});
+    render(mixer, 1000);
+
+    const auto sfx = meterFor(mixer, AudioMixer::kSfxBus);
+    REQUIRE(sfx.parent == AudioMixer::kMasterBus);
+    REQUIRE(sfx.peak[0] == Approx(0.0f).margin(1e-6));
+    REQUIRE(sfx.peak[1] == Approx(0.5f));
+    REQUIRE(sfx.rms[1] == Approx(0.5f));
+    const auto music = meterFor(mixer, AudioMixer::kMusicBus);
+    REQUIRE(music.peak[1] == 0.0f);
+    REQUIRE(meterFor(mixer, AudioMixer::kMasterBus).rms[1] == Approx(0.5f));
+}
+
+TEST_CASE("AudioMixer insert effects shape the bus signal", "[audio][mixer][effects]") {
+    SECTION("low-pass keeps DC and removes Nyquist") {
+        AudioMixer mixer(kRate);
+        MixerEffectSettings lowPass;
+        lowPass.type = MixerEffectType::LowPass;
+        lowPass.cutoffHz = 1000.0f;
+        REQUIRE(mixer.setBusEffects(AudioMixer::kSfxBus, {lowPass}));
+
+        auto alternating = std::make_shared<PcmBuffer>();
+        alternating->sampleRate = kRate;
+        alternating->channels = 1;
+        for (int i = 0; i < 8000; ++i) {
+            alternating->samples.push_back(i % 2 == 0 ? 1.0f : -1.0f);
+        }
+        mixer.startVoice(alternating, AudioMixer::kSfxBus, {});
+        auto out = render(mixer, 4000);
+        REQUIRE(peakOf(out, 2000) < 0.01f);
+
+        mixer.stopAllVoices();
+        mixer.startVoice(constantPcm(0.5f, 8000), AudioMixer::kSfxBus, {});
+        out = render(mixer, 4000);
+        REQUIRE(out[2 * 3999] == Approx(0.5f).margin(1e-3));
+
+        lowPass.bypass = true;
+        REQUIRE(mixer.setBusEffects(AudioMixer::kSfxBus, {lowPass}));
+        mixer.stopAllVoices();
+        mixer.startVoice(alternating, AudioMixer::kSfxBus, {});
+        out = render(mixer, 100);
+        REQUIRE(peakOf(out) == Approx(1.0f));
+    }
+
+    SECTION("compressor reduces level above the threshold") {
+        AudioMixer mixer(kRate);
+        MixerEffectSettings compressor;
+        compressor.type = MixerEffectType::Compressor;
+        compressor.thresholdDb = -12.0f;
+        compressor.ratio = 4.0f;
+        REQUIRE(mixer.setBusEffects(AudioMixer::kSfxBus, {compressor}));
+        mixer.startVoice(constantPcm(1.0f, 48000), AudioMixer::kSfxBus, {});
+        const auto out = render(mixer, 24000);
+        // 0 dBFS in, 12 dB over a 4:1 threshold: 3 dB over, i.e. -9 dBFS out.
+        REQUIRE(out[2 * 23999] == Approx(std::pow(10.0f, -9.0f / 20.0f)).margin(0.01));
+    }
+
+    SECTION("reverb leaves a tail after an impulse") {
+        AudioMixer mixer(kRate);
+        MixerEffectSettings reverb;
+        reverb.type = MixerEffectType::Reverb;
+        reverb.wet = 0.5f;
+        REQUIRE(mixer.setBusEffects(AudioMixer::kSfxBus, {reverb}));
+        mixer.startVoice(constantPcm(1.0f, 1), AudioMixer::kSfxBus, {});
+        const auto out = render(mixer, 9600);
+        REQUIRE(out[0] == Approx(0.5f).margin(0.05));
+        REQUIRE(peakOf(out, 1000) > 0.0f);
+    }
+}
+
+TEST_CASE("AudioMixer applies bus configuration in dependency order", "[audio][mixer][buses]") {
+    AudioMixer mixer(kRate);
+    std::vector<MixerBusConfig> config;
+    config.push_back(MixerBusConfig{"dialogue", "voice", MixerBusSettings{0.5f, false, false}, {}});
+    config.push_back(MixerBusConfig{"voice", "", MixerBusSettings{}, {MixerEffectSettings{}}});
+    config.push_back(MixerBusConfig{"a", "b", {}, {}});
+    config.push_back(MixerBusConfig{"b", "a", {}, {}});
+    config.push_back(MixerBusConfig{"music", "", MixerBusSettings{0.25f, false, false}, {}});
+
+    const auto rejected = mixer.applyBusConfig(config);
+    REQUIRE(rejected == std::vector<std::string>{"a", "b"});
+    REQUIRE(mixer.hasBus("dialogue"));
+    REQUIRE(meterFor(mixer, "dialogue").parent == "voice");
+    REQUIRE(mixer.busSettings("dialogue")->gain == Approx(0.5f));
+    REQUIRE(mixer.busSettings(AudioMixer::kMusicBus)->gain == Approx(0.25f));
+    REQUIRE_FALSE(mixer.busSettings("a").has_value());
+}
+
+namespace {
+
+struct MixerBackend final : AudioManager::Backend {
+    float masterVolume{1.0f};
+    void initDevice() override {}
+    void closeDevice() override {}
+    bool isDeviceReady() override { return true; }
+    void setMasterVolume(float volume) override { masterVolume = volume; }
+};
+
+// Decodes every file to a constant signal: 1000 stereo frames of 0.5 at the mixer's rate.
+struct WaveHooks {
+    static inline std::atomic<int> liveWaves{0};
+    static inline std::atomic<bool> musicLoaded{false};
+
+    static Sound loadSound(const char*) { return Sound{}; }
+    static Sound loadSoundAlias(Sound) { return Sound{}; }
+    static void soundOp(Sound) {}
+    static bool soundPlaying(Sound) { return false; }
+    static void setFloat(Sound, float) {}
+    static Music loadMusic(const char*) {
+        musicLoaded = true;
+        return Music{};
+    }
+    static void music(Music) {}
+    static bool musicPlaying(Music) { return false; }
+    static void setMusicFloat(Music, float) {}
+    static float musicTime(Music) { return 0.0f; }
+
+    static Wave loadWave(const char*) {
+        Wave wave{};
+        wave.frameCount = 1000;
+        wave.sampleRate = kRate;
+        wave.sampleSize = 16;
+        wave.channels = 2;
+        wave.data = std::calloc(wave.frameCount * 2, sizeof(short));
+        ++liveWaves;
+        return wave;
+    }
+    static void unloadWave(Wave wave) {
+        std::free(wave.data);
+        --liveWaves;
+    }
+    static float* loadWaveSamples(Wave wave) {
+        auto* samples = static_cast<float*>(std::malloc(wave.frameCount * wave.channels * sizeof(float)));
+        std::fill(samples, samples + wave.frameCount * wave.channels, 0.5f);
+        return samples;
+    }
+    static void unloadWaveSamples(float* samples) { std::free(samples); }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api{
+            .loadSound = loadSound,
+            .unloadSound = soundOp,
+            .loadSoundAlias = loadSoundAlias,
+            .unloadSoundAlias = soundOp,
+            .playSound = soundOp,
+            .stopSound = soundOp,
+            .isSoundPlaying = soundPlaying,
+            .setSoundVolume = setFloat,
+            .setSoundPitch = setFloat,
+            .setSoundPan = setFloat,
+            .loadMusicStream = loadMusic,
+            .unloadMusicStream = music,
+            .playMusicStream = music,
+            .pauseMusicStream = music,
+            .resumeMusicStream = music,
+            .stopMusicStream = music,
+            .updateMusicStream = music,
+            .isMusicStreamPlaying = musicPlaying,
+            .setMusicVolume = setMusicFloat,
+            .seekMusicStream = setMusicFloat,
+            .getMusicTimeLength = musicTime,
+            .getMusicTimePlayed = musicTime,
+            .loadWave = loadWave,
+            .unloadWave = unloadWave,
+            .loadWaveSamples = loadWaveSamples,
+            .unloadWaveSamples = unloadWaveSamples};
+        return api;
+    }
+};
+
+struct MixerFixture {
+    MixerFixture() {
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+
+        tempDir = std::filesystem::temp_directory_path() /
+                  (std::string("gb2d-audio-mixer-tests-") + std::to_string(++suiteCounter));
+        std::filesystem::create_directories(tempDir);
+        std::ofstream(tempDir / "blip.wav").put('\0');
+        std::ofstream(tempDir / "loop.ogg").put('\0');
+
+        ConfigurationManager::set("audio.core.enabled", true);
+        ConfigurationManager::set("audio.volumes.master", 1.0);
+        ConfigurationManager::set("audio.volumes.music", 1.0);
+        ConfigurationManager::set("audio.volumes.sfx", 1.0);
+        ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{tempDir.string()});
+        ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        ConfigurationManager::set("audio.mixer.enabled", true);
+        ConfigurationManager::set("audio.mixer.sample_rate", static_cast<int64_t>(kRate));
+        ConfigurationManager::set("audio.mixer.output", std::string("offline"));
+
+        AudioManager::setBackendForTesting(&backend);
+        AudioManager::setRaylibHooksForTesting(&WaveHooks::hooks());
+    }
+
+    ~MixerFixture() {
+        AudioManager::shutdown();
+        AudioManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(tempDir, ec);
+    }
+
+    std::vector<float> render(std::size_t frames) {
+        std::vector<float> out(frames * 2, -1.0f);
+        REQUIRE(AudioManager::renderMixer(out.data(), frames) == frames);
+        return out;
+    }
+
+    MixerBackend backend;
+    std::filesystem::path tempDir;
+    inline static int suiteCounter = 0;
+};
+
+MixerBusMeter managerMeter(const std::string& bus) {
+    for (const auto& meter : AudioManager::mixerMeters()) {
+        if (meter.name == bus) {
+            return meter;
+        }
+    }
+    return {};
+}
+
+} // namespace
+
+TEST_CASE_METHOD(MixerFixture, "AudioManager plays decoded sounds through the offline mixer", "[audio][mixer][manager]") {
+    ConfigurationManager::set("audio.volumes.master", 0.5);
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::isMixerActive());
+    REQUIRE(backend.masterVolume == Approx(1.0f));
+
+    auto sound = AudioManager::acquireSound("blip.wav");
+    REQUIRE_FALSE(sound.placeholder);
+    auto handle = AudioManager::playSound(sound.key, PlaybackParams{0.5f, 1.0f, 0.5f});
+    REQUIRE(handle.valid());
+
+    auto out = render(600);
+    REQUIRE(out[0] == Approx(0.125f));
+    REQUIRE(managerMeter("sfx").peak[0] == Approx(0.25f));
+    REQUIRE(managerMeter("music").peak[0] == 0.0f);
+    REQUIRE(AudioManager::metrics().mixerVoices == 1);
+
+    REQUIRE(AudioManager::stopSound(handle));
+    out = render(100);
+    REQUIRE(peakOf(out) == 0.0f);
+
+    handle = AudioManager::playSound(sound.key);
+    REQUIRE(handle.valid());
+    render(1200);
+    AudioManager::tick();
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.activeSoundInstances == 0);
+    REQUIRE(metrics.mixerActive);
+    REQUIRE(metrics.mixerFramesRendered == 1900);
+    REQUIRE_FALSE(AudioManager::stopSound(handle));
+}
+
+TEST_CASE_METHOD(MixerFixture, "AudioManager loops music on the mixer's music bus", "[audio][mixer][manager]") {
+    REQUIRE(AudioManager::init());
+    WaveHooks::musicLoaded = false;
+    auto music = AudioManager::acquireMusic("loop.ogg");
+    REQUIRE_FALSE(music.placeholder);
+    REQUIRE_FALSE(WaveHooks::musicLoaded);
+    REQUIRE(AudioManager::playMusic(music.key));
+
+    auto out = render(2500);
+    REQUIRE(out[2 * 2499] == Approx(0.5f));
+    REQUIRE(managerMeter("music").rms[1] == Approx(0.5f));
+    auto status = AudioManager::musicPlaybackStatus(music.key);
+    REQUIRE(status.durationSeconds == Approx(1000.0f / kRate));
+    REQUIRE(status.playing);
+
+    REQUIRE(AudioManager::setMixerBusSettings("music", MixerBusSettings{1.0f, true, false}));
+    render(AudioMixer::kBlockFrames);
+    out = render(100);
+    REQUIRE(peakOf(out) == 0.0f);
+    REQUIRE_FALSE(AudioManager::setMixerBusSettings("missing", MixerBusSettings{}));
+}
+
+TEST_CASE_METHOD(MixerFixture, "AudioManager builds mixer buses from configuration", "[audio][mixer][manager][config]") {
+    auto buses = nlohmann::json::object();
+    buses["voice"] = {{"gain", 0.5}, {"effects", nlohmann::json::array({{{"type", "low_pass"}, {"cutoff_hz", 2000.0}}})}};
+    buses["dialogue"] = {{"parent", "voice"}, {"solo", true}};
+    ConfigurationManager::setJson("audio.mixer.buses", buses);
+    ConfigurationManager::setJson("audio.engine.voices",
+                              nlohmann::json{{"blip.wav", {{"bus", "dialogue"}}}});
+    REQUIRE(AudioManager::init());
+
+    REQUIRE(managerMeter("dialogue").parent == "voice");
+    REQUIRE(managerMeter("voice").settings.gain == Approx(0.5f));
+    REQUIRE_FALSE(managerMeter("music").audible);
+
+    auto sound = AudioManager::acquireSound("blip.wav");
+    REQUIRE(AudioManager::playSound(sound.key).valid());
+    render(500);
+    REQUIRE(managerMeter("dialogue").peak[0] == Approx(0.5f));
+    REQUIRE(managerMeter("sfx").peak[0] == 0.0f);
+}
+
+TEST_CASE_METHOD(MixerFixture, "AudioManager leaves the mixer off when disabled", "[audio][mixer][manager]") {
+    ConfigurationManager::set("audio.mixer.enabled", false);
+    REQUIRE(AudioManager::init());
+    REQUIRE_FALSE(AudioManager::isMixerActive());
+    REQUIRE(AudioManager::mixerMeters().empty());
+    float out[4]{};
+    REQUIRE(AudioManager::renderMixer(out, 2) == 0);
+}
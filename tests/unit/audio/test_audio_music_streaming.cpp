@@ -0,0 +1,261 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/audio/AudioManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr unsigned int kStreamRate = 48000;
+
+struct StreamingBackend final : AudioManager::Backend {
+    void initDevice() override {}
+    void closeDevice() override {}
+    bool isDeviceReady() override { return true; }
+    void setMasterVolume(float) override {}
+};
+
+// Stands in for raylib's music streaming: a stream holds the buffer size that was the default
+// when it was loaded, and plays silence whenever more than one buffer's worth of time passes
+// between refills. Only one stream is tracked, which is all these tests load. Time is the
+// stub's own clock, stepped together with the manager's manual music clock.
+class StreamingStub {
+public:
+    static void reset() {
+        std::lock_guard lock(mutex());
+        auto& s = state();
+        s = State{};
+    }
+
+    static void advance(std::chrono::milliseconds step) {
+        std::lock_guard lock(mutex());
+        state().now += step;
+    }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api{
+            .loadSound = [](const char*) { return Sound{}; },
+            .unloadSound = [](Sound) {},
+            .loadSoundAlias = [](Sound) { return Sound{}; },
+            .unloadSoundAlias = [](Sound) {},
+            .playSound = [](Sound) {},
+            .stopSound = [](Sound) {},
+            .isSoundPlaying = [](Sound) { return false; },
+            .setSoundVolume = [](Sound, float) {},
+            .setSoundPitch = [](Sound, float) {},
+            .setSoundPan = [](Sound, float) {},
+            .loadMusicStream = &loadMusicStream,
+            .unloadMusicStream = [](Music) {},
+            .playMusicStream = &playMusicStream,
+            .pauseMusicStream = [](Music) { setPlaying(false); },
+            .resumeMusicStream = &playMusicStream,
+            .stopMusicStream = [](Music) { setPlaying(false); },
+            .updateMusicStream = &updateMusicStream,
+            .isMusicStreamPlaying = [](Music) {
+                std::lock_guard lock(mutex());
+                return state().playing;
+            },
+            .setMusicVolume = [](Music, float) {},
+            .seekMusicStream = [](Music, float) {},
+            .getMusicTimeLength = [](Music) { return 60.0f; },
+            .getMusicTimePlayed = [](Music) { return 0.0f; },
+            .setAudioStreamBufferSizeDefault = &setAudioStreamBufferSizeDefault};
+        return api;
+    }
+
+    static int loadedBufferFrames() {
+        std::lock_guard lock(mutex());
+        return state().streamFrames;
+    }
+
+    static int defaultBufferFrames() {
+        std::lock_guard lock(mutex());
+        return state().defaultFrames;
+    }
+
+    static int gaps() {
+        std::lock_guard lock(mutex());
+        return state().gaps;
+    }
+
+    static int refills() {
+        std::lock_guard lock(mutex());
+        return state().refills;
+    }
+
+private:
+    struct State {
+        int defaultFrames{0};
+        int streamFrames{0};
+        bool playing{false};
+        Clock::time_point now{};
+        Clock::time_point lastRefill{};
+        int gaps{0};
+        int refills{0};
+    };
+
+    static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+    }
+
+    static State& state() {
+        static State s;
+        return s;
+    }
+
+    static void setAudioStreamBufferSizeDefault(int frames) {
+        std::lock_guard lock(mutex());
+        state().defaultFrames = frames;
+    }
+
+    static Music loadMusicStream(const char*) {
+        std::lock_guard lock(mutex());
+        auto& s = state();
+        s.streamFrames = s.defaultFrames > 0 ? s.defaultFrames : 4096;
+        Music music{};
+        music.frameCount = kStreamRate * 60;
+        music.stream.sampleRate = kStreamRate;
+        music.stream.sampleSize = 16;
+        music.stream.channels = 2;
+        music.stream.buffer = reinterpret_cast<rAudioBuffer*>(static_cast<std::uintptr_t>(1));
+        return music;
+    }
+
+    static void playMusicStream(Music) {
+        std::lock_guard lock(mutex());
+        auto& s = state();
+        s.playing = true;
+        s.lastRefill = s.now;
+    }
+
+    static void setPlaying(bool playing) {
+        std::lock_guard lock(mutex());
+        state().playing = playing;
+    }
+
+    static void updateMusicStream(Music) {
+        std::lock_guard lock(mutex());
+        auto& s = state();
+        if (!s.playing) {
+            return;
+        }
+        const std::chrono::duration<double> sinceRefill = s.now - s.lastRefill;
+        if (sinceRefill.count() > static_cast<double>(s.streamFrames) / kStreamRate) {
+            ++s.gaps;
+        }
+        s.lastRefill = s.now;
+        ++s.refills;
+    }
+};
+
+struct MusicStreamingFixture {
+    MusicStreamingFixture() {
+        StreamingStub::reset();
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+
+        tempDir = std::filesystem::temp_directory_path() /
+                  (std::string("gb2d-audio-streaming-tests-") + std::to_string(++suiteCounter));
+        std::filesystem::create_directories(tempDir);
+        std::ofstream(tempDir / "theme.ogg").put('\0');
+
+        ConfigurationManager::set("audio.core.enabled", true);
+        ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{tempDir.string()});
+        ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        ConfigurationManager::set("audio.mixer.enabled", false);
+        // 100 ms of buffered audio per stream.
+        ConfigurationManager::set("audio.music.buffer_frames", static_cast<int64_t>(4800));
+        ConfigurationManager::set("audio.music.update_interval_ms", static_cast<int64_t>(2));
+
+        AudioManager::setBackendForTesting(&backend);
+        AudioManager::setRaylibHooksForTesting(&StreamingStub::hooks());
+        AudioManager::useManualMusicClockForTesting(true);
+    }
+
+    ~MusicStreamingFixture() {
+        AudioManager::resetForTesting();
+        std::error_code ec;
+        std::filesystem::remove_all(tempDir, ec);
+    }
+
+    // A game loop whose frames each stall the main thread for longer than the stream buffer lasts.
+    // Time moves in steps of the 2 ms update interval, so the stream thread wakes once per step.
+    static void playThroughStalls(int frames) {
+        const auto theme = AudioManager::acquireMusic("theme.ogg");
+        REQUIRE_FALSE(theme.placeholder);
+        REQUIRE(AudioManager::playMusic(theme.key));
+        constexpr std::chrono::milliseconds kStep{2};
+        for (int frame = 0; frame < frames; ++frame) {
+            for (int step = 0; step < 125; ++step) {
+                StreamingStub::advance(kStep);
+                AudioManager::advanceMusicClockForTesting(kStep);
+            }
+            AudioManager::tick(0.25f);
+        }
+    }
+
+    StreamingBackend backend{};
+    std::filesystem::path tempDir;
+    inline static int suiteCounter = 0;
+};
+
+} // namespace
+
+TEST_CASE_METHOD(MusicStreamingFixture, "Music streams load with the configured buffer size", "[audio][music][streaming]") {
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::config().musicBufferFrames == 4800);
+    REQUIRE(AudioManager::config().musicUpdateIntervalMs == 2);
+
+    REQUIRE_FALSE(AudioManager::acquireMusic("theme.ogg").placeholder);
+    REQUIRE(StreamingStub::loadedBufferFrames() == 4800);
+    // The default is restored so streams created elsewhere keep raylib's own size.
+    REQUIRE(StreamingStub::defaultBufferFrames() == 0);
+}
+
+TEST_CASE_METHOD(MusicStreamingFixture, "Streaming thread keeps music fed through main-thread stalls", "[audio][music][streaming]") {
+    ConfigurationManager::set("audio.music.stream_thread", true);
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::metrics().musicStreamThread);
+
+    playThroughStalls(4);
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(StreamingStub::gaps() == 0);
+    REQUIRE(metrics.musicUnderruns == 0);
+    REQUIRE(metrics.musicLongestGapMs == Approx(2.0f));
+    // Refilled on every interval of every stalled frame, not once per tick.
+    REQUIRE(metrics.musicStreamUpdates == 500);
+    REQUIRE(StreamingStub::refills() == 500);
+}
+
+TEST_CASE_METHOD(MusicStreamingFixture, "Tick-driven streaming underruns when the main thread stalls", "[audio][music][streaming]") {
+    ConfigurationManager::set("audio.music.stream_thread", false);
+    REQUIRE(AudioManager::init());
+    REQUIRE_FALSE(AudioManager::metrics().musicStreamThread);
+
+    playThroughStalls(4);
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(StreamingStub::gaps() == 4);
+    REQUIRE(metrics.musicUnderruns == 4);
+    REQUIRE(metrics.musicStreamUpdates == 4);
+    REQUIRE(metrics.musicLongestGapMs == Approx(250.0f));
+
+    AudioManager::shutdown();
+    REQUIRE(AudioManager::metrics().musicUnderruns == 0);
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "AudioTestHooks.h"
+#include "services/audio/AudioManager.h"
+#include "services/audio/OfflineAudioBackend.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::MixerBusSettings;
+using gb2d::audio::OfflineAudioBackend;
+using gb2d::audio::PlaybackParams;
+using gb2d::audio::testing::ScopedTempDir;
+using gb2d::audio::testing::toneSamples;
+using gb2d::audio::testing::writePcm16Wav;
+
+namespace {
+
+// Checksum of the scripted session below at 48 kHz. If a deliberate change to the mixer alters
+// the output, listen to the WAV the failing test writes and update this value.
+constexpr std::uint64_t kGoldenSessionChecksum = 0x654c42ad8c0ad302ull;
+
+constexpr float kFrameSeconds = 1.0f / 60.0f;
+constexpr double kPi = 3.14159265358979323846;
+
+struct OfflineRenderFixture {
+    OfflineRenderFixture() {
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+
+        writePcm16Wav(tempDir / "laser.wav", 48000, 1, toneSamples(880.0, 0.1, 48000, 1, 0.5));
+        writePcm16Wav(tempDir / "engine.wav", 24000, 2, toneSamples(110.0, 0.25, 24000, 2, 0.4));
+        writePcm16Wav(tempDir / "theme.wav", 48000, 2, toneSamples(220.0, 0.5, 48000, 2, 0.3));
+
+        ConfigurationManager::set("audio.core.enabled", true);
+        ConfigurationManager::set("audio.volumes.master", 1.0);
+        ConfigurationManager::set("audio.volumes.music", 0.8);
+        ConfigurationManager::set("audio.volumes.sfx", 1.0);
+        ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{tempDir.string()});
+        ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        // The offline backend turns the mixer on by itself.
+        ConfigurationManager::set("audio.mixer.enabled", false);
+    }
+
+    ~OfflineRenderFixture() { AudioManager::resetForTesting(); }
+
+    // One second of a small game: music starts, sounds fire, change and stop, a bus is turned down.
+    void playScriptedSession(OfflineAudioBackend& backend) {
+        backend.install();
+        REQUIRE(AudioManager::init());
+        REQUIRE(AudioManager::isMixerActive());
+        const auto laser = AudioManager::acquireSound("laser.wav").key;
+        const auto engine = AudioManager::acquireSound("engine.wav").key;
+        const auto theme = AudioManager::acquireMusic("theme.wav").key;
+
+        gb2d::audio::PlaybackHandle engineHandle{};
+        for (int frame = 0; frame < 60; ++frame) {
+            switch (frame) {
+                case 0: REQUIRE(AudioManager::playMusic(theme)); break;
+                case 5: REQUIRE(AudioManager::playSound(laser, PlaybackParams{0.8f, 1.0f, 0.3f}).valid()); break;
+                case 10:
+                    engineHandle = AudioManager::playSound(engine, PlaybackParams{1.0f, 1.5f, 0.5f});
+                    REQUIRE(engineHandle.valid());
+                    break;
+                case 14: REQUIRE(AudioManager::updateSoundPlayback(engineHandle, PlaybackParams{0.6f, 1.5f, 0.9f})); break;
+                case 20: REQUIRE(AudioManager::postPlaySound(laser, PlaybackParams{1.0f, 0.75f, 0.7f})); break;
+                case 30: REQUIRE(AudioManager::setMixerBusSettings("music", MixerBusSettings{0.5f, false, false})); break;
+                case 40: REQUIRE(AudioManager::pauseMusic(theme)); break;
+                case 45: REQUIRE(AudioManager::resumeMusic(theme)); break;
+                default: break;
+            }
+            AudioManager::tick(kFrameSeconds);
+        }
+        AudioManager::shutdown();
+    }
+
+    ScopedTempDir tempDir{"gb2d-audio-offline-tests"};
+};
+
+} // namespace
+
+TEST_CASE_METHOD(OfflineRenderFixture, "Offline backend renders tick(dt) worth of mix without a device", "[audio][offline]") {
+    OfflineAudioBackend backend(48000);
+    backend.install();
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::isMixerActive());
+    REQUIRE(AudioManager::config().mixerOutput == gb2d::audio::MixerOutputMode::Offline);
+
+    const auto laser = AudioManager::acquireSound("laser.wav");
+    REQUIRE_FALSE(laser.placeholder);
+    REQUIRE(AudioManager::playSound(laser.key).valid());
+
+    AudioManager::tick();
+    REQUIRE(backend.frames() == 0);
+    AudioManager::tick(0.05f);
+    REQUIRE(backend.frames() == 2400);
+    // The laser is mono and centered: both channels carry the decoded tone.
+    REQUIRE(backend.samples()[2 * 100] == Approx(0.5 * std::sin(2.0 * kPi * 880.0 * 100 / 48000)).margin(1e-4));
+    REQUIRE(backend.samples()[2 * 100 + 1] == backend.samples()[2 * 100]);
+
+    // Fractions of a frame carry over: 7 ticks of 1/7 s add up to one second.
+    backend.clear();
+    for (int i = 0; i < 7; ++i) {
+        AudioManager::tick(1.0f / 7.0f);
+    }
+    REQUIRE(std::abs(static_cast<long>(backend.frames()) - 48000) <= 1);
+    // The 0.1 s laser finished during the first tick and its slot was reclaimed.
+    REQUIRE(AudioManager::metrics().activeSoundInstances == 0);
+    // Before the backend goes out of scope.
+    AudioManager::shutdown();
+}
+
+TEST_CASE_METHOD(OfflineRenderFixture, "Offline renders of a scripted session are deterministic", "[audio][offline]") {
+    OfflineAudioBackend first(48000);
+    playScriptedSession(first);
+    REQUIRE(std::abs(static_cast<long>(first.frames()) - 48000) <= 1);
+
+    AudioManager::resetForTesting();
+    OfflineAudioBackend second(48000);
+    playScriptedSession(second);
+    REQUIRE(second.samples() == first.samples());
+    REQUIRE(second.checksum() == first.checksum());
+
+    const auto checksum = first.checksum();
+    if (checksum != kGoldenSessionChecksum) {
+        // Outside the fixture's directory, so the render outlives the test.
+        const auto renderDir = gb2d::audio::testing::uniqueTempPath("gb2d-offline-session");
+        std::filesystem::create_directories(renderDir);
+        const auto rendered = renderDir / "session.wav";
+        first.writeWav(rendered);
+        char hex[32];
+        std::snprintf(hex, sizeof(hex), "0x%016llxull", static_cast<unsigned long long>(checksum));
+        INFO("session checksum " << hex << "; render written to " << rendered.string());
+        REQUIRE(checksum == kGoldenSessionChecksum);
+    }
+}
+
+TEST_CASE("Offline backend encodes 16-bit stereo WAV", "[audio][offline][wav]") {
+    OfflineAudioBackend backend(22050);
+    const float samples[] = {0.0f, 1.0f, -1.0f, 2.0f, 0.5f, -0.25f};
+    backend.consumeOfflineAudio(samples, 3);
+    REQUIRE(backend.frames() == 3);
+    REQUIRE(backend.durationSeconds() == Approx(3.0 / 22050.0));
+
+    const auto pcm = backend.pcm16();
+    REQUIRE(pcm == std::vector<std::int16_t>{0, 32767, -32767, 32767, 16384, -8192});
+
+    const auto wav = backend.encodeWav();
+    REQUIRE(wav.size() == 44 + 12);
+    REQUIRE(std::memcmp(wav.data(), "RIFF", 4) == 0);
+    REQUIRE(std::memcmp(wav.data() + 8, "WAVEfmt ", 8) == 0);
+    const auto u32 = [&wav](std::size_t offset) {
+        return static_cast<std::uint32_t>(wav[offset]) | (static_cast<std::uint32_t>(wav[offset + 1]) << 8) |
+               (static_cast<std::uint32_t>(wav[offset + 2]) << 16) | (static_cast<std::uint32_t>(wav[offset + 3]) << 24);
+    };
+    REQUIRE(u32(4) == 36 + 12);
+    REQUIRE(u32(24) == 22050);
+    REQUIRE(u32(28) == 22050 * 4);
+    REQUIRE(std::memcmp(wav.data() + 36, "data", 4) == 0);
+    REQUIRE(u32(40) == 12);
+    REQUIRE(wav[46] == 0xFF);
+    REQUIRE(wav[47] == 0x7F);
+
+    const auto checksum = backend.checksum();
+    backend.clear();
+    REQUIRE(backend.frames() == 0);
+    REQUIRE(backend.checksum() != checksum);
+}
@@ -0,0 +1,226 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "AudioTestHooks.h"
+#include "services/audio/AudioManager.h"
+#include "services/audio/SpatialAudio.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AttenuationCurve;
+using gb2d::audio::AudioListener;
+using gb2d::audio::AudioManager;
+using gb2d::audio::EmitterPosition;
+using gb2d::audio::PlaybackHandle;
+using gb2d::audio::PlaybackParams;
+using gb2d::audio::SpatialSettings;
+using gb2d::audio::testing::AudioManagerFixture;
+using gb2d::audio::testing::fakeSoundId;
+
+namespace {
+
+// Remembers the last volume and pan set on each alias and which alias was set last, and counts
+// the pan calls.
+struct SpatialHooks {
+    static inline std::unordered_map<std::uintptr_t, float> volumes;
+    static inline std::unordered_map<std::uintptr_t, float> pans;
+    static inline std::uintptr_t lastAlias{0};
+    static inline int panCalls{0};
+
+    static void setVolume(Sound sound, float volume) {
+        lastAlias = fakeSoundId(sound);
+        volumes[lastAlias] = volume;
+    }
+    static void setPan(Sound sound, float pan) {
+        pans[fakeSoundId(sound)] = pan;
+        ++panCalls;
+    }
+
+    static void reset() {
+        volumes.clear();
+        pans.clear();
+        lastAlias = 0;
+        panCalls = 0;
+    }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            auto table = gb2d::audio::testing::stubRaylibHooks();
+            table.setSoundVolume = setVolume;
+            table.setSoundPan = setPan;
+            return table;
+        }();
+        return api;
+    }
+};
+
+struct AudioSpatialFixture : AudioManagerFixture {
+    AudioSpatialFixture() : AudioManagerFixture("gb2d-audio-spatial-tests", SpatialHooks::hooks()) {
+        tempDir.touch("engine.wav");
+        ConfigurationManager::set("audio.engine.max_concurrent_sounds", static_cast<int64_t>(4));
+        ConfigurationManager::set("audio.spatial.curve", std::string("linear"));
+        ConfigurationManager::set("audio.spatial.min_distance", 100.0);
+        ConfigurationManager::set("audio.spatial.max_distance", 500.0);
+        ConfigurationManager::set("audio.spatial.cull_volume", 0.05);
+        SpatialHooks::reset();
+    }
+
+    // Plays and returns the id of the alias the voice was started on alongside its handle.
+    std::pair<PlaybackHandle, std::uintptr_t> playAt(const std::string& key, Vector2 position,
+                                                     const PlaybackParams& params = {}) {
+        SpatialHooks::lastAlias = 0;
+        auto handle = AudioManager::playSoundAt(key, position, params);
+        return {handle, SpatialHooks::lastAlias};
+    }
+};
+
+} // namespace
+
+TEST_CASE("spatialGain follows each attenuation curve", "[audio][spatial]") {
+    SpatialSettings settings;
+    settings.minDistance = 100.0f;
+    settings.maxDistance = 500.0f;
+    settings.rolloff = 1.0f;
+
+    settings.curve = AttenuationCurve::None;
+    REQUIRE(gb2d::audio::spatialGain(settings, 10000.0f) == 1.0f);
+
+    settings.curve = AttenuationCurve::Linear;
+    REQUIRE(gb2d::audio::spatialGain(settings, 50.0f) == 1.0f);
+    REQUIRE(gb2d::audio::spatialGain(settings, 300.0f) == Approx(0.5f));
+    REQUIRE(gb2d::audio::spatialGain(settings, 500.0f) == 0.0f);
+
+    settings.curve = AttenuationCurve::Inverse;
+    REQUIRE(gb2d::audio::spatialGain(settings, 200.0f) == Approx(0.5f));
+    settings.rolloff = 3.0f;
+    REQUIRE(gb2d::audio::spatialGain(settings, 200.0f) == Approx(0.25f));
+
+    settings.curve = AttenuationCurve::Exponential;
+    settings.rolloff = 2.0f;
+    REQUIRE(gb2d::audio::spatialGain(settings, 200.0f) == Approx(0.25f));
+    REQUIRE(gb2d::audio::spatialGain(settings, 600.0f) == 0.0f);
+}
+
+TEST_CASE("spatialPan maps the listener's pan width onto the stereo field", "[audio][spatial]") {
+    AudioListener listener;
+    listener.position = {400.0f, 300.0f};
+    listener.panWidth = 200.0f;
+
+    REQUIRE(gb2d::audio::spatialPan(listener, {400.0f, 0.0f}) == Approx(0.5f));
+    REQUIRE(gb2d::audio::spatialPan(listener, {200.0f, 300.0f}) == Approx(0.0f));
+    REQUIRE(gb2d::audio::spatialPan(listener, {600.0f, 300.0f}) == Approx(1.0f));
+    REQUIRE(gb2d::audio::spatialPan(listener, {500.0f, 300.0f}) == Approx(0.75f));
+    REQUIRE(gb2d::audio::spatialPan(listener, {-1000.0f, 300.0f}) == Approx(0.0f));
+
+    listener.panWidth = 0.0f;
+    REQUIRE(gb2d::audio::spatialPan(listener, {600.0f, 300.0f}) == Approx(0.5f));
+}
+
+TEST_CASE_METHOD(AudioSpatialFixture, "playSoundAt attenuates and pans against the listener", "[audio][spatial]") {
+    REQUIRE(AudioManager::init());
+    const auto spatial = AudioManager::config().spatial;
+    REQUIRE(spatial.curve == AttenuationCurve::Linear);
+    REQUIRE(spatial.minDistance == Approx(100.0f));
+    REQUIRE(spatial.maxDistance == Approx(500.0f));
+
+    const auto key = AudioManager::acquireSound("engine.wav").key;
+    AudioManager::setListener(AudioListener{{0.0f, 0.0f}, 400.0f});
+
+    PlaybackParams params;
+    params.volume = 0.8f;
+    params.pan = 0.0f; // ignored by playSoundAt
+    auto [handle, alias] = playAt(key, {300.0f, 0.0f}, params);
+    REQUIRE(handle.valid());
+    REQUIRE(SpatialHooks::volumes[alias] == Approx(0.4f));
+    REQUIRE(SpatialHooks::pans[alias] == Approx(0.875f));
+
+    // A per-play curve overrides audio.spatial.
+    params.spatial = SpatialSettings{AttenuationCurve::None};
+    auto [unattenuated, unattenuatedAlias] = playAt(key, {-3000.0f, 0.0f}, params);
+    REQUIRE(unattenuated.valid());
+    REQUIRE(SpatialHooks::volumes[unattenuatedAlias] == Approx(0.8f));
+    REQUIRE(SpatialHooks::pans[unattenuatedAlias] == Approx(0.0f));
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.positionalVoices == 2);
+    REQUIRE(metrics.spatialCulled == 0);
+
+    // Only positional voices can be moved.
+    auto plain = AudioManager::playSound(key);
+    REQUIRE(plain.valid());
+    REQUIRE_FALSE(AudioManager::setSoundPosition(plain, {10.0f, 0.0f}));
+    REQUIRE(AudioManager::setSoundPosition(handle, {10.0f, 0.0f}));
+}
+
+TEST_CASE_METHOD(AudioSpatialFixture, "playSoundAt culls inaudible sounds before they take a slot", "[audio][spatial]") {
+    REQUIRE(AudioManager::init());
+    const auto key = AudioManager::acquireSound("engine.wav").key;
+
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(AudioManager::playSound(key).valid());
+    }
+    REQUIRE(AudioManager::metrics().activeSoundInstances == 4);
+
+    // Out of range, and in range but under the cull volume (gain 0.025 < 0.05): neither steals.
+    REQUIRE_FALSE(AudioManager::playSoundAt(key, {600.0f, 0.0f}).valid());
+    REQUIRE_FALSE(AudioManager::playSoundAt(key, {490.0f, 0.0f}).valid());
+
+    const auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.spatialCulled == 2);
+    REQUIRE(metrics.activeSoundInstances == 4);
+    REQUIRE(metrics.voicesStolen == 0);
+    REQUIRE(metrics.voicesDropped == 0);
+}
+
+TEST_CASE_METHOD(AudioSpatialFixture, "Emitter and listener moves are applied in one pass per tick", "[audio][spatial]") {
+    REQUIRE(AudioManager::init());
+    const auto key = AudioManager::acquireSound("engine.wav").key;
+    AudioManager::setListener(AudioListener{{0.0f, 0.0f}, 400.0f});
+
+    auto [left, leftAlias] = playAt(key, {-200.0f, 0.0f});
+    auto [right, rightAlias] = playAt(key, {200.0f, 0.0f});
+    PlaybackParams panOnly;
+    panOnly.spatial = SpatialSettings{AttenuationCurve::None};
+    auto [still, stillAlias] = playAt(key, {2000.0f, 0.0f}, panOnly);
+    REQUIRE(SpatialHooks::pans[leftAlias] == Approx(0.25f));
+    REQUIRE(SpatialHooks::pans[rightAlias] == Approx(0.75f));
+    AudioManager::tick();
+    SpatialHooks::panCalls = 0;
+    const auto updatesBefore = AudioManager::metrics().spatialUpdates;
+
+    // Stored until tick(); a stale handle is skipped.
+    const std::array<EmitterPosition, 3> moves{
+        EmitterPosition{left, {400.0f, 0.0f}},
+        EmitterPosition{right, {-400.0f, 0.0f}},
+        EmitterPosition{PlaybackHandle{right.slot, right.generation + 100}, {0.0f, 0.0f}}};
+    REQUIRE(AudioManager::setSoundPositions(moves) == 2);
+    REQUIRE(SpatialHooks::panCalls == 0);
+
+    AudioManager::tick();
+    REQUIRE(SpatialHooks::panCalls == 2);
+    REQUIRE(SpatialHooks::pans[leftAlias] == Approx(1.0f));
+    REQUIRE(SpatialHooks::pans[rightAlias] == Approx(0.0f));
+    REQUIRE(SpatialHooks::volumes[leftAlias] == Approx(0.25f));
+    REQUIRE(AudioManager::metrics().spatialUpdates == updatesBefore + 2);
+
+    // Nothing moved, nothing pushed.
+    AudioManager::tick();
+    REQUIRE(SpatialHooks::panCalls == 2);
+
+    // A listener move revisits every positional voice but only pushes those whose mix changed:
+    // the unattenuated voice far to the right stays at full volume, panned hard right.
+    AudioManager::setListener(AudioListener{{400.0f, 0.0f}, 400.0f});
+    AudioManager::tick();
+    REQUIRE(SpatialHooks::pans[leftAlias] == Approx(0.5f));
+    REQUIRE(SpatialHooks::volumes[leftAlias] == Approx(1.0f));
+    REQUIRE(SpatialHooks::volumes[rightAlias] == 0.0f);
+    REQUIRE(SpatialHooks::pans[stillAlias] == Approx(1.0f));
+    REQUIRE(AudioManager::metrics().spatialUpdates == updatesBefore + 4);
+    REQUIRE(AudioManager::listener().position.x == Approx(400.0f));
+}
@@ -0,0 +1,259 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "AudioTestHooks.h"
+#include "services/audio/AudioManager.h"
+#include "services/audio/OfflineAudioBackend.h"
+#include "services/audio/SoundBank.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+struct rAudioBuffer;
+
+using Catch::Approx;
+using gb2d::ConfigurationManager;
+using gb2d::audio::AudioManager;
+using gb2d::audio::OfflineAudioBackend;
+using gb2d::audio::SoundBank;
+using gb2d::audio::SoundBankEntry;
+using gb2d::audio::testing::ScopedTempDir;
+using gb2d::audio::testing::writePcm16Wav;
+
+namespace {
+
+std::vector<std::int16_t> ramp(std::size_t count, std::int16_t start, std::int16_t step) {
+    std::vector<std::int16_t> samples(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        samples[i] = static_cast<std::int16_t>(start + static_cast<int>(i) * step);
+    }
+    return samples;
+}
+
+// Raylib playback without a device: sounds made from waves are counted and keep their format.
+struct WaveSoundHooks {
+    static inline int soundsFromWaves = 0;
+    static inline int soundsFromFiles = 0;
+    static inline Wave lastWave{};
+    static inline std::int16_t lastFirstSample = 0;
+
+    static void reset() {
+        soundsFromWaves = 0;
+        soundsFromFiles = 0;
+        lastWave = Wave{};
+        lastFirstSample = 0;
+    }
+
+    static Sound makeSound(unsigned int frames, unsigned int sampleRate, unsigned int channels) {
+        static std::uintptr_t nextId = 1;
+        Sound sound{};
+        sound.frameCount = frames;
+        sound.stream.sampleRate = sampleRate;
+        sound.stream.sampleSize = 16;
+        sound.stream.channels = channels;
+        sound.stream.buffer = reinterpret_cast<rAudioBuffer*>(nextId++);
+        return sound;
+    }
+
+    static Sound loadSound(const char*) {
+        soundsFromFiles++;
+        return makeSound(1, 44100, 1);
+    }
+    static Sound loadSoundAlias(Sound source) {
+        return makeSound(source.frameCount, source.stream.sampleRate, source.stream.channels);
+    }
+    static Sound loadSoundFromWave(Wave wave) {
+        soundsFromWaves++;
+        lastWave = wave;
+        lastFirstSample = static_cast<const std::int16_t*>(wave.data)[0];
+        return makeSound(wave.frameCount, wave.sampleRate, wave.channels);
+    }
+
+    static const AudioManager::RaylibHooks& hooks() {
+        static const AudioManager::RaylibHooks api = [] {
+            AudioManager::RaylibHooks table = OfflineAudioBackend::hooks();
+            table.loadSound = &loadSound;
+            table.loadSoundAlias = &loadSoundAlias;
+            table.loadSoundFromWave = &loadSoundFromWave;
+            return table;
+        }();
+        return api;
+    }
+};
+
+struct DeviceBackend final : AudioManager::Backend {
+    void initDevice() override {}
+    void closeDevice() override {}
+    bool isDeviceReady() override { return true; }
+    void setMasterVolume(float) override {}
+};
+
+struct SoundBankFixture {
+    SoundBankFixture() {
+        WaveSoundHooks::reset();
+        AudioManager::resetForTesting();
+        ConfigurationManager::loadOrDefault();
+
+        writePcm16Wav(tempDir / "ui" / "click.wav", 48000, 1, ramp(480, 100, 3));
+        writePcm16Wav(tempDir / "ui" / "hover.wav", 48000, 2, ramp(960, -2000, 5));
+        writePcm16Wav(tempDir / "hit.wav", 22050, 1, ramp(220, 1000, -7));
+        const std::vector<std::string> identifiers{"ui/click.wav", "ui/hover.wav", "hit.wav"};
+        REQUIRE(SoundBank::pack(tempDir / "sfx.gb2dbank", tempDir.path(), identifiers));
+
+        ConfigurationManager::set("audio.core.enabled", true);
+        ConfigurationManager::set("audio.engine.search_paths", std::vector<std::string>{tempDir.string()});
+        ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.music", std::vector<std::string>{});
+        ConfigurationManager::set("audio.preload.sound_banks", std::vector<std::string>{"sfx.gb2dbank"});
+        ConfigurationManager::set("audio.mixer.enabled", false);
+    }
+
+    ~SoundBankFixture() { AudioManager::resetForTesting(); }
+
+    // Banked sounds must not need their files.
+    void removeSourceFiles() {
+        std::filesystem::remove_all(tempDir / "ui");
+        std::filesystem::remove(tempDir / "hit.wav");
+    }
+
+    std::string keyFor(const std::string& identifier) const {
+        std::string key = (tempDir / identifier).lexically_normal().generic_string();
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::tolower(ch));
+        });
+        return key;
+    }
+
+    DeviceBackend device{};
+    OfflineAudioBackend offline{48000};
+    ScopedTempDir tempDir{"gb2d-sound-bank-tests"};
+};
+
+} // namespace
+
+TEST_CASE("SoundBank round-trips PCM through a mapped file", "[audio][soundbank]") {
+    const ScopedTempDir dir("gb2d-sound-bank-roundtrip");
+    const auto path = dir / "roundtrip.gb2dbank";
+    std::vector<SoundBankEntry> sounds{
+        {"zap.wav", 44100, 1, ramp(5, 10, 1)},
+        {"a/b.wav", 22050, 2, ramp(6, -3, 2)},
+        {"empty.wav", 8000, 1, {}},
+    };
+    REQUIRE(SoundBank::write(path, sounds));
+
+    const auto bank = SoundBank::open(path);
+    REQUIRE(bank);
+    REQUIRE(bank->soundCount() == 3);
+    REQUIRE(bank->sizeBytes() == std::filesystem::file_size(path));
+
+    const auto zap = bank->find("zap.wav");
+    REQUIRE(zap);
+    const auto sound = bank->sound(*zap);
+    REQUIRE(sound.name == "zap.wav");
+    REQUIRE(sound.sampleRate == 44100);
+    REQUIRE(sound.channels == 1);
+    REQUIRE(sound.frameCount == 5);
+    REQUIRE(std::vector<std::int16_t>(sound.samples, sound.samples + 5) == sounds[0].samples);
+
+    const auto stereo = bank->sound(*bank->find("a/b.wav"));
+    REQUIRE(stereo.frameCount == 3);
+    REQUIRE(std::vector<std::int16_t>(stereo.samples, stereo.samples + 6) == sounds[1].samples);
+    REQUIRE(bank->sound(*bank->find("empty.wav")).frameCount == 0);
+    REQUIRE_FALSE(bank->find("missing.wav"));
+    REQUIRE_FALSE(bank->find("zap"));
+
+    std::vector<SoundBankEntry> duplicates{{"x.wav", 8000, 1, {1}}, {"x.wav", 8000, 1, {2}}};
+    REQUIRE_FALSE(SoundBank::write(path, duplicates));
+
+    // A truncated file is rejected rather than read past its end.
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 2);
+    REQUIRE_FALSE(SoundBank::open(path));
+}
+
+TEST_CASE_METHOD(SoundBankFixture, "SoundBank::pack stores the decoded 16-bit samples exactly", "[audio][soundbank]") {
+    const auto bank = SoundBank::open(tempDir / "sfx.gb2dbank");
+    REQUIRE(bank);
+    REQUIRE(bank->soundCount() == 3);
+    const auto hover = bank->sound(*bank->find("ui/hover.wav"));
+    REQUIRE(hover.channels == 2);
+    REQUIRE(hover.frameCount == 480);
+    REQUIRE(std::vector<std::int16_t>(hover.samples, hover.samples + 960) == ramp(960, -2000, 5));
+    const auto hit = bank->sound(*bank->find("hit.wav"));
+    REQUIRE(hit.sampleRate == 22050);
+    REQUIRE(hit.samples[0] == 1000);
+}
+
+TEST_CASE_METHOD(SoundBankFixture, "acquireSound serves banked sounds under file keys and aliases", "[audio][soundbank]") {
+    removeSourceFiles();
+    AudioManager::setBackendForTesting(&device);
+    AudioManager::setRaylibHooksForTesting(&WaveSoundHooks::hooks());
+    REQUIRE(AudioManager::init());
+
+    auto metrics = AudioManager::metrics();
+    REQUIRE(metrics.soundBanks == 1);
+    REQUIRE(metrics.bankedSounds == 3);
+    REQUIRE(metrics.soundBankBytes == std::filesystem::file_size(tempDir / "sfx.gb2dbank"));
+    const auto probesAfterMount = metrics.pathProbes;
+
+    const auto click = AudioManager::acquireSound("ui/click.wav");
+    REQUIRE_FALSE(click.placeholder);
+    REQUIRE(click.newlyLoaded);
+    REQUIRE(click.key == keyFor("ui/click.wav"));
+    REQUIRE(WaveSoundHooks::soundsFromWaves == 1);
+    REQUIRE(WaveSoundHooks::soundsFromFiles == 0);
+    REQUIRE(WaveSoundHooks::lastWave.sampleSize == 16);
+    REQUIRE(WaveSoundHooks::lastWave.frameCount == 480);
+    REQUIRE(WaveSoundHooks::lastFirstSample == 100);
+
+    // Identifiers match case- and separator-insensitively, like file keys.
+    const auto again = AudioManager::acquireSound("UI\\Click.wav");
+    REQUIRE(again.key == click.key);
+    REQUIRE_FALSE(again.newlyLoaded);
+
+    const auto aliased = AudioManager::acquireSound("hit.wav", std::string("impact"));
+    REQUIRE(aliased.key == "impact");
+    REQUIRE_FALSE(aliased.placeholder);
+    REQUIRE(AudioManager::playSound("impact").valid());
+    REQUIRE(AudioManager::playSound(click.key).valid());
+    REQUIRE(AudioManager::metrics().pathProbes == probesAfterMount);
+
+    const auto inventory = AudioManager::captureSoundInventorySnapshot();
+    const auto clickEntry = std::find_if(inventory.begin(), inventory.end(), [&](const auto& rec) { return rec.key == click.key; });
+    REQUIRE(clickEntry != inventory.end());
+    REQUIRE(clickEntry->bank == (tempDir / "sfx.gb2dbank").string());
+    REQUIRE(clickEntry->sampleRate == 48000);
+
+    // Sounds outside the bank still come from their files.
+    writePcm16Wav(tempDir / "loose.wav", 48000, 1, ramp(10, 0, 1));
+    const auto loose = AudioManager::acquireSound("loose.wav");
+    REQUIRE_FALSE(loose.placeholder);
+    REQUIRE(WaveSoundHooks::soundsFromFiles == 1);
+
+    REQUIRE(AudioManager::reloadAll());
+    REQUIRE(WaveSoundHooks::soundsFromWaves == 4);
+    REQUIRE_FALSE(AudioManager::captureSoundInventorySnapshot().empty());
+    AudioManager::shutdown();
+}
+
+TEST_CASE_METHOD(SoundBankFixture, "Preloaded banked sounds play through the mixer unchanged", "[audio][soundbank][offline]") {
+    ConfigurationManager::set("audio.preload.sounds", std::vector<std::string>{"ui/click.wav"});
+    ConfigurationManager::setJson("audio.preload.sound_aliases", nlohmann::json{{"ui/click.wav", "click"}});
+    removeSourceFiles();
+
+    offline.install();
+    REQUIRE(AudioManager::init());
+    REQUIRE(AudioManager::metrics().loadedSounds == 1);
+    REQUIRE(AudioManager::playSound("click").valid());
+    AudioManager::tick(0.005f);
+    REQUIRE(offline.frames() >= 200);
+    // Mono and centered: both channels carry the banked sample, scaled like raylib's LoadWaveSamples.
+    REQUIRE(offline.samples()[2 * 100] == Approx((100 + 100 * 3) / 32768.0).margin(1e-6));
+    REQUIRE(offline.samples()[2 * 100 + 1] == offline.samples()[2 * 100]);
+}
@@ -0,0 +1,241 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/LogManager.h"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gb2d::logging::AsyncOptions;
+using gb2d::logging::Config;
+using gb2d::logging::Level;
+using gb2d::logging::LogManager;
+using gb2d::logging::OverflowPolicy;
+
+namespace {
+
+// Records payloads in arrival order. While `gated` is set, the first write parks the writer
+// thread inside the sink so a test can fill the queue behind it.
+class CaptureSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    std::atomic<bool> gated{false};
+    std::atomic<bool> parked{false};
+    std::atomic<int> count{0};
+
+    std::vector<std::string> lines() {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        return lines_;
+    }
+    std::thread::id lastThread() {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        return lastThread_;
+    }
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override {
+        lines_.emplace_back(msg.payload.data(), msg.payload.size());
+        lastThread_ = std::this_thread::get_id();
+        count.fetch_add(1);
+        while (gated.load()) {
+            parked.store(true);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    void flush_() override {}
+
+private:
+    std::vector<std::string> lines_;
+    std::thread::id lastThread_{};
+};
+
+template <typename Predicate>
+bool waitFor(Predicate pred) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+struct AsyncLoggingFixture {
+    std::shared_ptr<CaptureSink> sink = std::make_shared<CaptureSink>();
+
+    AsyncLoggingFixture() {
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({ sink });
+    }
+
+    ~AsyncLoggingFixture() {
+        sink->gated.store(false);
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({});
+    }
+
+    void start(std::size_t capacity, OverflowPolicy overflow) {
+        Config cfg;
+        cfg.pattern = "%v";
+        cfg.async = AsyncOptions{ true, capacity, overflow, 16 };
+        REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+    }
+
+    // Parks the writer on message "gate" so everything logged afterwards stays queued.
+    void parkWriter() {
+        sink->gated.store(true);
+        LogManager::info("gate");
+        REQUIRE(waitFor([&] { return sink->parked.load(); }));
+    }
+};
+
+} // namespace
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "Async logging delivers every message in per-thread order from the writer thread", "[logger][async]") {
+    start(1024, OverflowPolicy::block);
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 2000;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([t] {
+            for (int i = 0; i < kPerThread; ++i) LogManager::info("{}:{}", t, i);
+        });
+    }
+    for (auto& p : producers) p.join();
+    LogManager::flush();
+
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == (std::size_t)(kThreads * kPerThread));
+    std::vector<int> next(kThreads, 0);
+    for (const auto& line : lines) {
+        const auto colon = line.find(':');
+        const int t = std::stoi(line.substr(0, colon));
+        const int i = std::stoi(line.substr(colon + 1));
+        CHECK(i == next[t]);
+        next[t] = i + 1;
+    }
+    CHECK(sink->lastThread() != std::this_thread::get_id());
+
+    auto stats = LogManager::asyncStats();
+    CHECK(stats.active);
+    CHECK(stats.capacity == 1024);
+    CHECK(stats.written == (std::uint64_t)(kThreads * kPerThread));
+    CHECK(stats.dropped_oldest == 0);
+    CHECK(stats.dropped_newest == 0);
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "drop_newest discards messages that arrive while the queue is full", "[logger][async]") {
+    start(64, OverflowPolicy::drop_newest);
+    parkWriter();
+    for (int i = 0; i < 74; ++i) LogManager::info("m{}", i);
+
+    auto stats = LogManager::asyncStats();
+    CHECK(stats.dropped_newest == 10);
+    CHECK(stats.queued == 64);
+
+    sink->gated.store(false);
+    LogManager::flush();
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == 65);
+    CHECK(lines[1] == "m0");
+    CHECK(lines.back() == "m63");
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "drop_oldest evicts queued messages to make room", "[logger][async]") {
+    start(64, OverflowPolicy::drop_oldest);
+    parkWriter();
+    for (int i = 0; i < 74; ++i) LogManager::info("m{}", i);
+
+    CHECK(LogManager::asyncStats().dropped_oldest == 10);
+
+    sink->gated.store(false);
+    LogManager::flush();
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == 65);
+    CHECK(lines[0] == "gate");
+    CHECK(lines[1] == "m10");
+    CHECK(lines.back() == "m73");
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "block waits for room without losing messages", "[logger][async]") {
+    start(64, OverflowPolicy::block);
+    parkWriter();
+    for (int i = 0; i < 64; ++i) LogManager::info("m{}", i);
+
+    std::atomic<bool> returned{false};
+    std::thread producer([&] {
+        LogManager::info("m64");
+        returned.store(true);
+    });
+    REQUIRE(waitFor([] { return LogManager::asyncStats().blocked == 1; }));
+    CHECK_FALSE(returned.load());
+
+    sink->gated.store(false);
+    producer.join();
+    LogManager::flush();
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == 66);
+    CHECK(lines.back() == "m64");
+    CHECK(LogManager::asyncStats().dropped_newest == 0);
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "Filtered levels are not queued and shutdown drains the queue", "[logger][async]") {
+    start(256, OverflowPolicy::block);
+    for (int i = 0; i < 100; ++i) {
+        LogManager::debug("hidden {}", i);
+        LogManager::warn("shown {}", i);
+    }
+    REQUIRE(LogManager::shutdown() == gb2d::logging::Status::ok);
+
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == 100);
+    CHECK(lines.front() == "shown 0");
+    CHECK(lines.back() == "shown 99");
+    CHECK_FALSE(LogManager::asyncStats().active);
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "Messages logged while async mode stops are neither lost nor duplicated", "[logger][async]") {
+    start(64, OverflowPolicy::block);
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 2000;
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([t, &go] {
+            while (!go.load()) std::this_thread::yield();
+            for (int i = 0; i < kPerThread; ++i) LogManager::info("{}:{}", t, i);
+        });
+    }
+    go.store(true);
+    REQUIRE(waitFor([&] { return sink->count.load() > 100; }));
+    Config sync;
+    sync.pattern = "%v";
+    REQUIRE(LogManager::reconfigure(sync) == gb2d::logging::Status::ok);
+    for (auto& p : producers) p.join();
+
+    // Whatever was queued when the writer stopped was written by it; the rest went out directly.
+    REQUIRE(sink->lines().size() == (std::size_t)(kThreads * kPerThread));
+}
+
+TEST_CASE_METHOD(AsyncLoggingFixture, "Reconfiguring without async switches back to synchronous writes", "[logger][async]") {
+    start(256, OverflowPolicy::block);
+    LogManager::info("queued");
+
+    Config sync;
+    sync.pattern = "%v";
+    REQUIRE(LogManager::reconfigure(sync) == gb2d::logging::Status::ok);
+    CHECK_FALSE(LogManager::asyncStats().active);
+    REQUIRE(sink->lines().size() == 1);
+
+    LogManager::info("direct");
+    auto lines = sink->lines();
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[1] == "direct");
+    CHECK(sink->lastThread() == std::this_thread::get_id());
+}
@@ -0,0 +1,289 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/BinaryLogReader.h"
+#include "services/logger/LogManager.h"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+namespace binlog = gb2d::logging::binlog;
+using gb2d::logging::BinaryLogOptions;
+using gb2d::logging::BinaryLogSink;
+using gb2d::logging::Config;
+using gb2d::logging::Level;
+using gb2d::logging::LogManager;
+
+namespace {
+
+// Has a formatter but no packed representation, so messages using it become text records.
+struct Vec2 {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+class PayloadSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    std::vector<std::string> lines;
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override { lines.emplace_back(msg.payload.data(), msg.payload.size()); }
+    void flush_() override {}
+};
+
+struct BinaryLogFixture {
+    fs::path dir = fs::temp_directory_path() / "gb2d_binary_log_tests";
+    std::shared_ptr<PayloadSink> sink = std::make_shared<PayloadSink>();
+
+    BinaryLogFixture() {
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({ sink });
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+    }
+
+    ~BinaryLogFixture() {
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({});
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+    }
+
+    BinaryLogOptions options(size_t segmentBytes = 1u << 20, size_t maxSegments = 8) const {
+        BinaryLogOptions o;
+        o.enabled = true;
+        o.directory = dir;
+        o.segment_bytes = segmentBytes;
+        o.max_segments = maxSegments;
+        return o;
+    }
+
+    std::vector<fs::path> segments() const {
+        std::vector<fs::path> out;
+        std::error_code ec;
+        for (const auto& e : fs::directory_iterator(dir, ec)) {
+            if (e.path().extension() == binlog::kExtension) out.push_back(e.path());
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    static std::string readAll(const fs::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // Decodes every segment in order and returns the rendered messages.
+    std::vector<binlog::DecodedRecord> decodeAll(std::vector<std::string>& messages, std::vector<std::string>& storage) const {
+        std::vector<binlog::DecodedRecord> records;
+        const auto paths = segments();
+        storage.reserve(paths.size());
+        for (const auto& path : paths) {
+            storage.push_back(readAll(path));
+            const auto status = binlog::decode_segment(storage.back(), [&](const binlog::DecodedRecord& r) {
+                records.push_back(r);
+                messages.push_back(binlog::render_message(r));
+            });
+            CHECK(status == binlog::DecodeStatus::ok);
+        }
+        return records;
+    }
+};
+
+} // namespace
+
+template <>
+struct fmt::formatter<Vec2> : fmt::formatter<float> {
+    template <typename FormatContext>
+    auto format(const Vec2& v, FormatContext& ctx) const {
+        return fmt::format_to(ctx.out(), "({}, {})", v.x, v.y);
+    }
+};
+
+TEST_CASE_METHOD(BinaryLogFixture, "Packed arguments decode to the same text fmt produces", "[logger][binary]") {
+    BinaryLogSink log(options());
+    REQUIRE(log.open());
+    const std::string name = "player";
+    const int a = -123456;
+    const unsigned long long big = 18446744073709551615ull;
+    const short s = -7;
+    const float f = 0.1f;
+    const double d = -2.5e-300;
+    const void* p = reinterpret_cast<const void*>(uintptr_t{0x1234abcd});
+    log.write(2, "{} at {}/{} hp={:>6} s={}", name, a, big, 42u, s);
+    log.write(3, "f={} d={:.3e} b={} c={} p={}", f, d, true, 'x', p);
+    log.write(4, "view={} cstr={} empty='{}'", std::string_view("sv"), "literal", std::string());
+    log.write(1, "no arguments");
+    log.close();
+
+    std::vector<std::string> messages, storage;
+    const auto records = decodeAll(messages, storage);
+    REQUIRE(messages.size() == 4);
+    CHECK(messages[0] == fmt::format("{} at {}/{} hp={:>6} s={}", name, a, big, 42u, s));
+    CHECK(messages[1] == fmt::format("f={} d={:.3e} b={} c={} p={}", f, d, true, 'x', p));
+    CHECK(messages[2] == "view=sv cstr=literal empty=''");
+    CHECK(messages[3] == "no arguments");
+    CHECK(records[0].level == 2);
+    CHECK(records[3].level == 1);
+    CHECK(records[0].format == "{} at {}/{} hp={:>6} s={}");
+    CHECK(records[1].args.size() == 5);
+
+    const auto stats = log.stats();
+    CHECK(stats.records == 4);
+    CHECK(stats.dropped == 0);
+    CHECK_FALSE(stats.active);
+    // Closing truncates the mapped segment to the bytes written.
+    CHECK(fs::file_size(segments().front()) == sizeof(binlog::SegmentHeader) + stats.bytes);
+}
+
+TEST_CASE_METHOD(BinaryLogFixture, "Segments rotate, stand alone, and keep only the newest ones across runs", "[logger][binary]") {
+    constexpr int kMessages = 2000;
+    {
+        BinaryLogSink log(options(4096, 3));
+        REQUIRE(log.open());
+        for (int i = 0; i < kMessages; ++i) log.write(2, "message {} of {}", i, kMessages);
+        CHECK(log.stats().segments > 3);
+    }
+    auto paths = segments();
+    REQUIRE(paths.size() == 3);
+
+    // Every retained segment decodes on its own, and together they end with the newest messages.
+    std::vector<int> seen;
+    for (const auto& path : paths) {
+        CHECK(fs::file_size(path) <= 4096);
+        const std::string bytes = readAll(path);
+        REQUIRE(binlog::decode_segment(bytes, [&](const binlog::DecodedRecord& r) {
+            REQUIRE(r.args.size() == 2);
+            seen.push_back((int)r.args[0].i);
+        }) == binlog::DecodeStatus::ok);
+    }
+    REQUIRE_FALSE(seen.empty());
+    CHECK(seen.back() == kMessages - 1);
+    for (size_t i = 1; i < seen.size(); ++i) CHECK(seen[i] == seen[i - 1] + 1);
+
+    // A second run continues the numbering and counts the old segments towards the limit.
+    const std::string lastBefore = paths.back().filename().string();
+    {
+        BinaryLogSink log(options(4096, 3));
+        REQUIRE(log.open());
+        log.write(2, "second run");
+        CHECK(log.currentSegmentPath().filename().string() > lastBefore);
+    }
+    paths = segments();
+    REQUIRE(paths.size() == 3);
+    binlog::SegmentHeader header{};
+    const std::string bytes = readAll(paths.back());
+    std::vector<std::string> messages;
+    REQUIRE(binlog::decode_segment(bytes, [&](const binlog::DecodedRecord& r) { messages.push_back(binlog::render_message(r)); },
+                                   &header) == binlog::DecodeStatus::ok);
+    CHECK(messages == std::vector<std::string>{ "second run" });
+    CHECK(paths[1].filename().string() == lastBefore);
+}
+
+TEST_CASE_METHOD(BinaryLogFixture, "LogManager writes to the binary log and can skip the text sinks", "[logger][binary]") {
+    Config cfg;
+    cfg.pattern = "%v";
+    cfg.level = Level::debug;
+    cfg.binary = options();
+    cfg.binary.text_sinks = false;
+    REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+
+    LogManager::info("loaded {} textures in {} ms", 12, 3.5);
+    LogManager::warn("unit {} at {}", 7, Vec2{ 1.5f, -2.0f });
+    LogManager::trace("below the level {}", 1);
+    LogManager::error("plain");
+    const auto stats = LogManager::binaryStats();
+    CHECK(stats.active);
+    CHECK(stats.records == 2);
+    CHECK(stats.text_records == 1);
+    (void)LogManager::shutdown();
+
+    CHECK(sink->lines.empty());
+    std::vector<std::string> messages, storage;
+    const auto records = decodeAll(messages, storage);
+    REQUIRE(messages.size() == 3);
+    CHECK(messages[0] == "loaded 12 textures in 3.5 ms");
+    CHECK(messages[1] == "unit 7 at (1.5, -2)");
+    CHECK(messages[2] == "plain");
+    CHECK_FALSE(records[0].is_text);
+    CHECK(records[1].is_text);
+    CHECK(records[1].level == (uint8_t)Level::warn);
+}
+
+TEST_CASE_METHOD(BinaryLogFixture, "Text sinks still receive messages while the binary log is on", "[logger][binary]") {
+    Config cfg;
+    cfg.pattern = "%v";
+    cfg.binary = options();
+    REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+    LogManager::info("both {}", 1);
+
+    // Turning the binary log off closes the segment; later messages only reach the text sinks.
+    Config off = cfg;
+    off.binary = BinaryLogOptions{};
+    LogManager::reconfigure(off);
+    CHECK_FALSE(LogManager::binaryStats().active);
+    LogManager::info("text only");
+
+    CHECK(sink->lines == std::vector<std::string>{ "both 1", "text only" });
+    std::vector<std::string> messages, storage;
+    decodeAll(messages, storage);
+    CHECK(messages == std::vector<std::string>{ "both 1" });
+}
+
+TEST_CASE("RecordFilter selects by minimum level and time range", "[logger][binary]") {
+    binlog::DecodedRecord r;
+    r.level = 3;
+    r.time_ns = 1000;
+    binlog::RecordFilter filter;
+    CHECK(filter.accepts(r));
+    filter.min_level = 4;
+    CHECK_FALSE(filter.accepts(r));
+    filter.min_level = 3;
+    filter.since_ns = 1000;
+    filter.until_ns = 2000;
+    CHECK(filter.accepts(r));
+    filter.since_ns = 1001;
+    CHECK_FALSE(filter.accepts(r));
+    filter.since_ns = 0;
+    filter.until_ns = 999;
+    CHECK_FALSE(filter.accepts(r));
+}
+
+TEST_CASE("decode_segment rejects foreign files and reports a damaged tail", "[logger][binary]") {
+    CHECK(binlog::decode_segment("not a log segment at all, just text", [](const binlog::DecodedRecord&) {}) ==
+          binlog::DecodeStatus::not_a_segment);
+
+    const fs::path dir = fs::temp_directory_path() / "gb2d_binary_log_damaged";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    BinaryLogOptions o;
+    o.directory = dir;
+    fs::path path;
+    {
+        BinaryLogSink log(o);
+        REQUIRE(log.open());
+        log.write(2, "first {}", 1);
+        log.write(2, "second {}", "two");
+        path = log.currentSegmentPath();
+    }
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    bytes.resize(bytes.size() - 3); // cut into the last record, as a crash mid-write would
+    std::vector<std::string> messages;
+    CHECK(binlog::decode_segment(bytes, [&](const binlog::DecodedRecord& r) { messages.push_back(binlog::render_message(r)); }) ==
+          binlog::DecodeStatus::truncated);
+    CHECK(messages == std::vector<std::string>{ "first 1" });
+    fs::remove_all(dir, ec);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/ImGuiLogSink.h"
+#include "services/logger/LogManager.h"
+
+#include <string>
+#include <vector>
+
+using gb2d::logging::ImGuiLogBuffer;
+using gb2d::logging::LogEntry;
+
+namespace {
+
+void pushLines(ImGuiLogBuffer& buffer, int from, int to) {
+    for (int i = from; i < to; ++i) {
+        buffer.push(spdlog::level::info, std::chrono::system_clock::now(), "line " + std::to_string(i));
+    }
+}
+
+std::vector<std::string> messages(const std::vector<LogEntry>& entries) {
+    std::vector<std::string> out;
+    for (const auto& e : entries) out.push_back(e.message);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("ImGuiLogBuffer keeps the newest entries once it wraps", "[logger][buffer]") {
+    ImGuiLogBuffer buffer;
+    buffer.setCapacity(4);
+    pushLines(buffer, 0, 10);
+
+    CHECK(buffer.size() == 4);
+    CHECK(buffer.firstSeq() == 6);
+    CHECK(buffer.nextSeq() == 10);
+
+    std::vector<LogEntry> all;
+    buffer.snapshot(all);
+    CHECK(messages(all) == std::vector<std::string>{ "line 6", "line 7", "line 8", "line 9" });
+    CHECK(all.front().seq == 6);
+    CHECK(all.back().seq == 9);
+}
+
+TEST_CASE("ImGuiLogBuffer::readSince returns only entries the reader has not seen", "[logger][buffer]") {
+    ImGuiLogBuffer buffer;
+    buffer.setCapacity(8);
+    pushLines(buffer, 0, 3);
+
+    std::vector<LogEntry> seen;
+    uint64_t next = buffer.readSince(0, seen);
+    CHECK(next == 3);
+    CHECK(seen.size() == 3);
+
+    std::vector<LogEntry> fresh;
+    CHECK(buffer.readSince(next, fresh) == 3);
+    CHECK(fresh.empty());
+
+    pushLines(buffer, 3, 5);
+    next = buffer.readSince(next, fresh);
+    CHECK(next == 5);
+    CHECK(messages(fresh) == std::vector<std::string>{ "line 3", "line 4" });
+
+    // A reader that fell behind by more than the capacity resumes at the oldest retained entry.
+    pushLines(buffer, 5, 20);
+    fresh.clear();
+    CHECK(buffer.readSince(next, fresh) == 20);
+    REQUIRE(fresh.size() == 8);
+    CHECK(fresh.front().seq == 12);
+}
+
+TEST_CASE("ImGuiLogBuffer capacity changes keep order and sequence numbers", "[logger][buffer]") {
+    ImGuiLogBuffer buffer;
+    buffer.setCapacity(5);
+    pushLines(buffer, 0, 7); // retains 2..6
+
+    buffer.setCapacity(3);
+    std::vector<LogEntry> all;
+    buffer.snapshot(all);
+    CHECK(messages(all) == std::vector<std::string>{ "line 4", "line 5", "line 6" });
+    CHECK(buffer.firstSeq() == 4);
+
+    buffer.setCapacity(6);
+    pushLines(buffer, 7, 10);
+    buffer.snapshot(all);
+    CHECK(messages(all) == std::vector<std::string>{ "line 4", "line 5", "line 6", "line 7", "line 8", "line 9" });
+    CHECK(all.back().seq == 9);
+}
+
+TEST_CASE("ImGuiLogBuffer::clear drops entries but never reuses sequence numbers", "[logger][buffer]") {
+    ImGuiLogBuffer buffer;
+    pushLines(buffer, 0, 3);
+    buffer.clear();
+    CHECK(buffer.size() == 0);
+
+    std::vector<LogEntry> fresh;
+    CHECK(buffer.readSince(0, fresh) == 3);
+    CHECK(fresh.empty());
+
+    pushLines(buffer, 3, 4);
+    buffer.readSince(0, fresh);
+    REQUIRE(fresh.size() == 1);
+    CHECK(fresh[0].seq == 3);
+    CHECK(fresh[0].message == "line 3");
+}
+
+TEST_CASE("read_log_lines_since follows the shared console buffer", "[logger][buffer]") {
+    auto& buffer = ImGuiLogBuffer::instance();
+    const uint64_t start = buffer.nextSeq();
+    buffer.push(spdlog::level::warn, std::chrono::system_clock::now(), "first");
+    buffer.push(spdlog::level::err, std::chrono::system_clock::now(), "second");
+
+    std::vector<gb2d::logging::LogLine> lines;
+    const uint64_t next = gb2d::logging::read_log_lines_since(start, lines);
+    CHECK(next == start + 2);
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0].level == gb2d::logging::Level::warn);
+    CHECK(lines[0].text == "first");
+    CHECK(lines[1].level == gb2d::logging::Level::err);
+    CHECK(lines[1].seq == start + 1);
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/LogManager.h"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using gb2d::logging::Config;
+using gb2d::logging::Level;
+using gb2d::logging::LogManager;
+
+namespace {
+
+// Counts how often it is formatted, to show filtered-out calls never format their arguments.
+struct Counted {
+    int value = 0;
+    static inline int formats = 0;
+};
+
+class PayloadSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    std::vector<std::string> lines;
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override { lines.emplace_back(msg.payload.data(), msg.payload.size()); }
+    void flush_() override {}
+};
+
+struct LogLevelFixture {
+    std::shared_ptr<PayloadSink> sink = std::make_shared<PayloadSink>();
+
+    LogLevelFixture() {
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({ sink });
+        Counted::formats = 0;
+    }
+
+    ~LogLevelFixture() {
+        (void)LogManager::shutdown();
+        LogManager::setSinksForTesting({});
+    }
+};
+
+} // namespace
+
+template <>
+struct fmt::formatter<Counted> : fmt::formatter<int> {
+    template <typename FormatContext>
+    auto format(const Counted& c, FormatContext& ctx) const {
+        ++Counted::formats;
+        return fmt::formatter<int>::format(c.value, ctx);
+    }
+};
+
+TEST_CASE_METHOD(LogLevelFixture, "Calls below the level are rejected before formatting", "[logger][levels]") {
+    Config cfg;
+    cfg.level = Level::info;
+    REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+
+    LogManager::trace("trace {}", Counted{1});
+    LogManager::debug("debug {}", Counted{2});
+    CHECK(Counted::formats == 0);
+
+    LogManager::info("info {}", Counted{3});
+    CHECK(Counted::formats == 1);
+    REQUIRE(sink->lines.size() == 1);
+    CHECK(sink->lines[0] == "info 3");
+}
+
+TEST_CASE_METHOD(LogLevelFixture, "isEnabled follows reconfigure and resets on shutdown", "[logger][levels]") {
+    Config cfg;
+    cfg.level = Level::warn;
+    REQUIRE(LogManager::init(cfg) == gb2d::logging::Status::ok);
+    CHECK_FALSE(LogManager::isEnabled(Level::info));
+    CHECK(LogManager::isEnabled(Level::warn));
+    CHECK(LogManager::isEnabled(Level::critical));
+    CHECK_FALSE(LogManager::isEnabled(Level::off));
+
+    cfg.level = Level::trace;
+    REQUIRE(LogManager::reconfigure(cfg) == gb2d::logging::Status::ok);
+    CHECK(LogManager::isEnabled(Level::trace));
+
+    cfg.level = Level::off;
+    REQUIRE(LogManager::reconfigure(cfg) == gb2d::logging::Status::ok);
+    LogManager::critical("silenced {}", Counted{4});
+    CHECK(Counted::formats == 0);
+    CHECK(sink->lines.empty());
+
+    REQUIRE(LogManager::shutdown() == gb2d::logging::Status::ok);
+    CHECK(LogManager::isEnabled(Level::info));
+    CHECK_FALSE(LogManager::isEnabled(Level::debug));
+}
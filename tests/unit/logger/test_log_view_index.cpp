@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/logger/LogViewIndex.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using gb2d::logging::Level;
+using gb2d::logging::LogViewIndex;
+
+namespace {
+
+std::vector<std::string> rows(const LogViewIndex& index) {
+    std::vector<std::string> out;
+    for (size_t r = 0; r < index.rowCount(); ++r) out.emplace_back(index.rowText(r));
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("LogViewIndex filters by level and case-insensitive text", "[logger][view]") {
+    LogViewIndex index;
+    index.append(Level::info, "[info] Loaded Texture hero.png\n");
+    index.append(Level::warn, "[warn] texture cache full");
+    index.append(Level::err, "[error] failed to open level.json");
+    index.append(Level::debug, "[debug] frame 12");
+    CHECK(index.rowCount() == 4);
+    CHECK(index.rowText(0) == "[info] Loaded Texture hero.png");
+
+    CHECK(index.setFilter(LogViewIndex::kAllLevels, "TEXTURE"));
+    CHECK(rows(index) == std::vector<std::string>{ "[info] Loaded Texture hero.png", "[warn] texture cache full" });
+
+    const uint32_t warnAndUp = LogViewIndex::levelBit(Level::warn) | LogViewIndex::levelBit(Level::err) | LogViewIndex::levelBit(Level::critical);
+    CHECK(index.setFilter(warnAndUp, "TEXTURE"));
+    CHECK(rows(index) == std::vector<std::string>{ "[warn] texture cache full" });
+    CHECK(index.rowLevel(0) == Level::warn);
+    CHECK_FALSE(index.setFilter(warnAndUp, "texture"));
+
+    CHECK(index.setFilter(warnAndUp, ""));
+    CHECK(rows(index) == std::vector<std::string>{ "[warn] texture cache full", "[error] failed to open level.json" });
+
+    // Lines appended while a filter is active are filtered as they arrive.
+    index.append(Level::critical, "[critical] out of memory");
+    index.append(Level::info, "[info] not shown");
+    CHECK(index.rowCount() == 3);
+    CHECK(index.rowText(2) == "[critical] out of memory");
+}
+
+TEST_CASE("LogViewIndex narrows and widens a text filter", "[logger][view]") {
+    LogViewIndex index;
+    for (int i = 0; i < 30; ++i) index.append(Level::info, "entity " + std::to_string(i) + (i % 3 == 0 ? " spawned" : " moved"));
+
+    index.setFilter(LogViewIndex::kAllLevels, "entity 1");
+    CHECK(index.rowCount() == 11); // 1, 10..19
+    index.setFilter(LogViewIndex::kAllLevels, "entity 1 ");
+    CHECK(rows(index) == std::vector<std::string>{ "entity 1 moved" });
+    index.setFilter(LogViewIndex::kAllLevels, "entity 12 spawned");
+    CHECK(rows(index) == std::vector<std::string>{ "entity 12 spawned" });
+    index.setFilter(LogViewIndex::kAllLevels, "spawned");
+    CHECK(index.rowCount() == 10);
+    index.setFilter(LogViewIndex::kAllLevels, "");
+    CHECK(index.rowCount() == 30);
+}
+
+TEST_CASE("LogViewIndex keeps the newest lines and stable line ids", "[logger][view]") {
+    LogViewIndex index;
+    index.setMaxLines(5000);
+    for (int i = 0; i < 20000; ++i) index.append(i % 2 ? Level::warn : Level::info, "line " + std::to_string(i));
+    CHECK(index.lineCount() == 5000);
+    CHECK(index.rowText(0) == "line 15000");
+    CHECK(index.rowLine(0) == 15000);
+    CHECK(index.rowText(index.rowCount() - 1) == "line 19999");
+
+    index.setFilter(LogViewIndex::levelBit(Level::warn), "");
+    CHECK(index.rowCount() == 2500);
+    CHECK(index.rowOf(15001) == 0);
+    CHECK(index.rowOf(15000) == index.rowCount());
+
+    index.setMaxLines(3);
+    CHECK(rows(index) == std::vector<std::string>{ "line 19997", "line 19999" });
+
+    index.clear();
+    CHECK(index.lineCount() == 0);
+    index.append(Level::warn, "after clear");
+    CHECK(index.rowLine(0) == 20000);
+}
+
+TEST_CASE("LogViewIndex splits multi-line messages into rows", "[logger][view]") {
+    LogViewIndex index;
+    index.append(Level::err, "[error] stack:\r\n  at a()\n  at b()\n");
+    CHECK(rows(index) == std::vector<std::string>{ "[error] stack:", "  at a()", "  at b()" });
+    CHECK(index.rowLevel(2) == Level::err);
+    CHECK(index.visibleText() == "[error] stack:\n  at a()\n  at b()");
+}
+
+TEST_CASE("LogViewIndex search tracks matches through appends and filters", "[logger][view]") {
+    LogViewIndex index;
+    index.setMaxLines(4);
+    index.append(Level::info, "Player joined");
+    index.append(Level::warn, "player lagging: player 2");
+    index.append(Level::info, "level loaded");
+
+    index.setSearch("player", false);
+    REQUIRE(index.searchMatchCount() == 2);
+    CHECK(index.searchMatchLine(0) == 0);
+    CHECK(index.searchMatchLine(1) == 1);
+
+    std::vector<std::pair<size_t, size_t>> spans;
+    index.searchSpans(1, spans);
+    CHECK(spans == std::vector<std::pair<size_t, size_t>>{ { 0, 6 }, { 16, 22 } });
+
+    index.setSearch("player", true);
+    REQUIRE(index.searchMatchCount() == 1);
+    CHECK(index.searchMatchLine(0) == 1);
+
+    index.setSearch("player", false);
+    index.append(Level::info, "PLAYER left");
+    index.append(Level::info, "tick"); // drops line 0
+    CHECK(index.searchMatchCount() == 2);
+    CHECK(index.searchMatchLine(0) == 1);
+    CHECK(index.searchMatchLine(1) == 3);
+
+    index.setFilter(LogViewIndex::levelBit(Level::info), "");
+    REQUIRE(index.searchMatchCount() == 1);
+    CHECK(index.searchMatchLine(0) == 3);
+    CHECK(index.rowOf(3) == 1);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/texture/AtlasPacker.h"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using gb2d::textures::PackedRect;
+using gb2d::textures::PackResult;
+using gb2d::textures::PackSize;
+using gb2d::textures::SkylinePacker;
+using gb2d::textures::packRects;
+
+namespace {
+
+bool overlaps(const PackedRect& a, const PackedRect& b, int padding) {
+    return a.x < b.x + b.width + padding && b.x < a.x + a.width + padding &&
+           a.y < b.y + b.height + padding && b.y < a.y + a.height + padding;
+}
+
+} // namespace
+
+TEST_CASE("SkylinePacker places rectangles inside the page without overlap") {
+    SkylinePacker packer(256, 256, 2);
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> dist(4, 40);
+
+    std::vector<PackedRect> placed;
+    for (int i = 0; i < 200; ++i) {
+        auto rect = packer.insert(dist(rng), dist(rng));
+        if (!rect) {
+            continue;
+        }
+        REQUIRE(rect->x >= 0);
+        REQUIRE(rect->y >= 0);
+        REQUIRE(rect->x + rect->width <= 256);
+        REQUIRE(rect->y + rect->height <= 256);
+        for (const auto& other : placed) {
+            REQUIRE_FALSE(overlaps(*rect, other, 2));
+        }
+        placed.push_back(*rect);
+    }
+
+    REQUIRE(placed.size() == packer.placedCount());
+    REQUIRE(packer.occupancy() > 0.5);
+    REQUIRE(packer.occupancy() <= 1.0);
+}
+
+TEST_CASE("SkylinePacker fills a page exactly and rejects overflow") {
+    SkylinePacker packer(64, 64);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(packer.insert(16, 16).has_value());
+    }
+    REQUIRE(packer.occupancy() == 1.0);
+    REQUIRE_FALSE(packer.insert(1, 1).has_value());
+    REQUIRE_FALSE(packer.insert(0, 4).has_value());
+
+    packer.reset();
+    REQUIRE(packer.usedArea() == 0);
+    auto full = packer.insert(64, 64);
+    REQUIRE(full.has_value());
+    REQUIRE(full->x == 0);
+    REQUIRE(full->y == 0);
+}
+
+TEST_CASE("packRects spreads rectangles across pages and skips oversized ones") {
+    std::vector<PackSize> sizes(40, PackSize{32, 32});
+    sizes.push_back(PackSize{300, 8});
+
+    PackResult result = packRects(sizes, 128, 128);
+    REQUIRE(result.placements.size() == sizes.size());
+    REQUIRE(result.pageCount == 3);
+    REQUIRE(result.placements.back().page == -1);
+
+    for (std::size_t i = 0; i + 1 < sizes.size(); ++i) {
+        REQUIRE(result.placements[i].page >= 0);
+        for (std::size_t j = i + 1; j + 1 < sizes.size(); ++j) {
+            if (result.placements[i].page == result.placements[j].page) {
+                REQUIRE_FALSE(overlaps(result.placements[i].rect, result.placements[j].rect, 0));
+            }
+        }
+    }
+    REQUIRE(result.occupancy > 0.8);
+}
@@ -0,0 +1,230 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/texture/BakedAtlas.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::AtlasFrame;
+using gb2d::textures::AtlasSourceStamp;
+using gb2d::textures::BakedAtlas;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+struct ResetGuard {
+    ~ResetGuard() { TextureManager::resetForTesting(); }
+};
+
+struct TempDir {
+    TempDir() {
+        auto base = std::filesystem::temp_directory_path();
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path_ = base / ("gb2d_baked_atlas_tests_" + std::to_string(stamp));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_{};
+};
+
+TextureManager::LoadedTexture makeStubTexture(int id) {
+    TextureManager::LoadedTexture stub;
+    stub.texture.id = id;
+    stub.texture.width = 8;
+    stub.texture.height = 8;
+    stub.texture.mipmaps = 1;
+    stub.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    stub.bytes = 8 * 8 * 4;
+    stub.ownsTexture = false;
+    return stub;
+}
+
+void writeAtlasJson(const std::filesystem::path& jsonPath, int frameCount) {
+    std::ofstream out(jsonPath);
+    out << "{\n  \"frames\": [\n";
+    for (int i = 0; i < frameCount; ++i) {
+        out << "    {\"filename\": \"Icons/Frame_" << i << ".png\", \"frame\": {\"x\": " << i * 16
+            << ", \"y\": 0, \"w\": 16, \"h\": 16}, \"pivot\": {\"x\": 0.5, \"y\": 0.25}}";
+        out << (i + 1 < frameCount ? ",\n" : "\n");
+    }
+    out << "  ],\n  \"meta\": {\"image\": \"sheet.png\"}\n}\n";
+}
+
+} // namespace
+
+TEST_CASE("BakedAtlas round-trips frames and resolves every name through the perfect hash") {
+    TempDir dir;
+    const auto bakedPath = dir.path() / "sheet.gb2datlas";
+
+    std::vector<AtlasFrame> frames;
+    std::vector<std::string> names;
+    for (int i = 0; i < 1000; ++i) {
+        AtlasFrame frame{};
+        frame.frame = Rectangle{static_cast<float>(i), 2.0f, 16.0f, 8.0f};
+        frame.source = Rectangle{1.0f, 1.0f, 18.0f, 10.0f};
+        frame.pivot = Vector2{0.5f, 1.0f};
+        frame.trimmed = (i % 3) == 0;
+        frame.originalName = "Walk/Frame_" + std::to_string(i) + ".PNG";
+        frames.push_back(frame);
+        names.push_back("walk/frame_" + std::to_string(i) + ".png");
+    }
+    const AtlasSourceStamp stamp{1234, 5678};
+    REQUIRE(BakedAtlas::write(bakedPath, frames, names, dir.path() / "img" / "sheet.png", stamp));
+
+    auto baked = BakedAtlas::open(bakedPath);
+    REQUIRE(baked != nullptr);
+    REQUIRE(baked->frameCount() == frames.size());
+    REQUIRE(baked->sourceStamp() == stamp);
+    REQUIRE(baked->imagePath() == (dir.path() / "img" / "sheet.png").lexically_normal());
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        auto index = baked->find(names[i]);
+        REQUIRE(index.has_value());
+        REQUIRE(*index == i);
+        auto frame = baked->frame(i);
+        REQUIRE(frame.frame.x == frames[i].frame.x);
+        REQUIRE(frame.source.width == frames[i].source.width);
+        REQUIRE(frame.pivot.y == frames[i].pivot.y);
+        REQUIRE(frame.trimmed == frames[i].trimmed);
+        REQUIRE_FALSE(frame.rotated);
+        REQUIRE(frame.originalName == frames[i].originalName);
+    }
+    REQUIRE_FALSE(baked->find("walk/frame_1000.png").has_value());
+    REQUIRE_FALSE(baked->find("").has_value());
+}
+
+TEST_CASE("BakedAtlas rejects truncated or foreign files") {
+    TempDir dir;
+    const auto bakedPath = dir.path() / "broken.gb2datlas";
+    {
+        std::ofstream out(bakedPath, std::ios::binary);
+        out << "GB2DATL";
+    }
+    REQUIRE(BakedAtlas::open(bakedPath) == nullptr);
+    REQUIRE(BakedAtlas::open(dir.path() / "missing.gb2datlas") == nullptr);
+
+    std::vector<AtlasFrame> frames(4);
+    std::vector<std::string> names{"a", "b", "c", "d"};
+    REQUIRE(BakedAtlas::write(bakedPath, frames, names, dir.path() / "sheet.png", AtlasSourceStamp{}));
+    std::filesystem::resize_file(bakedPath, std::filesystem::file_size(bakedPath) - 2);
+    REQUIRE(BakedAtlas::open(bakedPath) == nullptr);
+}
+
+TEST_CASE("BakedAtlas refuses to bake names that share a hash") {
+    TempDir dir;
+    const auto bakedPath = dir.path() / "duplicate.gb2datlas";
+
+    std::vector<AtlasFrame> frames(3);
+    std::vector<std::string> names{"idle", "run", "idle"};
+    REQUIRE_FALSE(BakedAtlas::write(bakedPath, frames, names, dir.path() / "sheet.png", AtlasSourceStamp{}));
+    REQUIRE_FALSE(std::filesystem::exists(bakedPath));
+}
+
+TEST_CASE("TextureManager prefers an up-to-date baked atlas and falls back to JSON when stale") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    const auto jsonPath = dir.path() / "sheet.json";
+    const auto bakedPath = dir.path() / "sheet.gb2datlas";
+    writeAtlasJson(jsonPath, 32);
+    {
+        std::ofstream png(dir.path() / "sheet.png", std::ios::binary);
+        png << "stub";
+    }
+
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::bake_atlases", true);
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(999);
+    });
+    int loadCount = 0;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(100 + ++loadCount);
+    });
+    REQUIRE(TextureManager::init());
+
+    auto parsed = TextureManager::acquireAtlas("sheet.json");
+    REQUIRE_FALSE(parsed.placeholder);
+    REQUIRE(parsed.frames.size() == 32);
+    REQUIRE(std::filesystem::exists(bakedPath));
+    REQUIRE(TextureManager::metrics().bakedAtlases == 0);
+    REQUIRE(TextureManager::releaseAtlas(parsed.key));
+    TextureManager::forceUnload(parsed.key);
+
+    auto baked = TextureManager::acquireAtlas("sheet.json");
+    REQUIRE_FALSE(baked.placeholder);
+    REQUIRE(baked.frames.size() == 32);
+    REQUIRE(baked.frames[7].originalName == "Icons/Frame_7.png");
+    REQUIRE(TextureManager::metrics().bakedAtlases == 1);
+    auto frame = TextureManager::getAtlasFrame(baked.key, "ICONS\\frame_7.png");
+    REQUIRE(frame.has_value());
+    REQUIRE(frame->frame.x == 7 * 16.0f);
+    REQUIRE(frame->pivot.y == 0.25f);
+    REQUIRE_FALSE(TextureManager::getAtlasFrame(baked.key, "icons/frame_32.png").has_value());
+
+    // Editing the JSON invalidates the baked file's source stamp; reload parses (and re-bakes).
+    writeAtlasJson(jsonPath, 40);
+    auto reload = TextureManager::reloadAll();
+    REQUIRE(reload.succeeded >= 1);
+    const auto* refreshed = TextureManager::tryGetAtlas(baked.key);
+    REQUIRE(refreshed != nullptr);
+    REQUIRE(refreshed->frames.size() == 40);
+    auto rebaked = BakedAtlas::open(bakedPath);
+    REQUIRE(rebaked != nullptr);
+    REQUIRE(rebaked->frameCount() == 40);
+
+    REQUIRE(TextureManager::releaseAtlas(baked.key));
+}
+
+TEST_CASE("TextureManager bakes atlases offline and loads .gb2datlas files directly") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    const auto jsonPath = dir.path() / "sheet.json";
+    const auto outputPath = dir.path() / "baked" / "ui.gb2datlas";
+    writeAtlasJson(jsonPath, 5);
+    {
+        std::ofstream png(dir.path() / "sheet.png", std::ios::binary);
+        png << "stub";
+    }
+    std::filesystem::create_directories(outputPath.parent_path());
+
+    REQUIRE(TextureManager::bakeAtlas(jsonPath, outputPath));
+    REQUIRE_FALSE(TextureManager::bakeAtlas(dir.path() / "missing.json"));
+
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(999);
+    });
+    std::filesystem::path loadedPath;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path& path, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        loadedPath = path;
+        return makeStubTexture(200);
+    });
+    REQUIRE(TextureManager::init());
+
+    auto atlas = TextureManager::acquireAtlas("baked/ui.gb2datlas");
+    REQUIRE_FALSE(atlas.placeholder);
+    REQUIRE(atlas.frames.size() == 5);
+    REQUIRE(loadedPath.filename() == "sheet.png");
+    REQUIRE(TextureManager::getAtlasFrame(atlas.key, "icons/frame_4.png").has_value());
+    REQUIRE(TextureManager::releaseAtlas(atlas.key));
+}
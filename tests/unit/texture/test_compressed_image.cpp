@@ -0,0 +1,413 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/texture/CompressedImage.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::BlockFormat;
+using gb2d::textures::TextureManager;
+using gb2d::textures::decodeBlock;
+using gb2d::textures::parseDds;
+using gb2d::textures::parseKtx2;
+using gb2d::textures::transcodeToRgba8;
+
+namespace {
+
+using Block8 = std::array<std::uint8_t, 8>;
+using Block16 = std::array<std::uint8_t, 16>;
+using Texels = std::array<std::uint8_t, 64>;
+
+struct ResetGuard {
+    ~ResetGuard() { TextureManager::resetForTesting(); }
+};
+
+struct TempDir {
+    TempDir() {
+        auto base = std::filesystem::temp_directory_path();
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path_ = base / ("gb2d_compressed_tests_" + std::to_string(stamp));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_{};
+};
+
+// Packs fields LSB-first, the way BC7 blocks are laid out.
+struct BitWriter {
+    Block16 bytes{};
+    unsigned position{0};
+
+    void write(std::uint32_t value, unsigned count) {
+        for (unsigned i = 0; i < count; ++i, ++position) {
+            if ((value >> i) & 1) {
+                bytes[position >> 3] |= static_cast<std::uint8_t>(1 << (position & 7));
+            }
+        }
+    }
+};
+
+std::array<int, 4> texel(const Texels& texels, int x, int y) {
+    const auto* p = texels.data() + (y * 4 + x) * 4;
+    return {p[0], p[1], p[2], p[3]};
+}
+
+template <typename Block>
+Texels decode(BlockFormat format, const Block& block) {
+    Texels texels{};
+    decodeBlock(format, block.data(), texels.data());
+    return texels;
+}
+
+void put32(std::vector<std::byte>& out, std::size_t offset, std::uint32_t value) {
+    std::memcpy(out.data() + offset, &value, sizeof(value));
+}
+
+void put64(std::vector<std::byte>& out, std::size_t offset, std::uint64_t value) {
+    std::memcpy(out.data() + offset, &value, sizeof(value));
+}
+
+std::uint32_t fourCC(const char* code) {
+    std::uint32_t value = 0;
+    std::memcpy(&value, code, 4);
+    return value;
+}
+
+// DXT1/DXT5 through the legacy header, BC7 through the DX10 extension header.
+std::vector<std::byte> makeDds(BlockFormat format, int width, int height, int mipmaps, std::size_t dataBytes) {
+    const bool dx10 = format == BlockFormat::BC7;
+    std::vector<std::byte> out((dx10 ? 148 : 128) + dataBytes, std::byte{0x11});
+    std::memset(out.data(), 0, dx10 ? 148 : 128);
+    put32(out, 0, fourCC("DDS "));
+    put32(out, 4, 124);
+    put32(out, 8, 0x1007u | (mipmaps > 1 ? 0x20000u : 0u));
+    put32(out, 12, static_cast<std::uint32_t>(height));
+    put32(out, 16, static_cast<std::uint32_t>(width));
+    put32(out, 28, static_cast<std::uint32_t>(mipmaps));
+    put32(out, 76, 32);
+    put32(out, 80, 0x4);
+    put32(out, 84, fourCC(dx10 ? "DX10" : format == BlockFormat::BC1 ? "DXT1" : "DXT5"));
+    if (dx10) {
+        put32(out, 128, 98); // DXGI_FORMAT_BC7_UNORM
+        put32(out, 132, 3);  // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+        put32(out, 140, 1);
+    }
+    return out;
+}
+
+std::vector<std::byte> makeKtx2(std::uint32_t vkFormat, int width, int height, std::size_t levelBytes,
+                                std::uint32_t faces = 1, std::uint32_t supercompression = 0) {
+    constexpr std::uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+    std::vector<std::byte> out(104 + levelBytes, std::byte{0x22});
+    std::memset(out.data(), 0, 104);
+    std::memcpy(out.data(), identifier, sizeof(identifier));
+    put32(out, 12, vkFormat);
+    put32(out, 16, 1);
+    put32(out, 20, static_cast<std::uint32_t>(width));
+    put32(out, 24, static_cast<std::uint32_t>(height));
+    put32(out, 36, faces);
+    put32(out, 40, 1);
+    put32(out, 44, supercompression);
+    put64(out, 80, 104);
+    put64(out, 88, levelBytes);
+    put64(out, 96, levelBytes);
+    return out;
+}
+
+void writeBytes(const std::filesystem::path& path, const std::vector<std::byte>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST_CASE("BC1 and BC3 blocks decode on the CPU") {
+    // c0 (red) > c1 (blue): four-colour palette; texels 0..3 use indices 0..3.
+    const Block8 fourColor = {0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00};
+    auto texels = decode(BlockFormat::BC1, fourColor);
+    REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 0, 0, 255});
+    REQUIRE(texel(texels, 1, 0) == std::array<int, 4>{0, 0, 255, 255});
+    REQUIRE(texel(texels, 2, 0) == std::array<int, 4>{170, 0, 85, 255});
+    REQUIRE(texel(texels, 3, 0) == std::array<int, 4>{85, 0, 170, 255});
+    REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{255, 0, 0, 255});
+
+    // c0 <= c1: three colours plus transparent black.
+    const Block8 punchThrough = {0x1F, 0x00, 0x00, 0xF8, 0xE4, 0x00, 0x00, 0x00};
+    texels = decode(BlockFormat::BC1, punchThrough);
+    REQUIRE(texel(texels, 2, 0) == std::array<int, 4>{127, 0, 127, 255});
+    REQUIRE(texel(texels, 3, 0) == std::array<int, 4>{0, 0, 0, 0});
+
+    // BC3 colour blocks stay four-colour even with c0 <= c1; alpha interpolates over 8 steps.
+    const Block16 bc3 = {255, 0, 0x88, 0x0E, 0, 0, 0, 0, 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0x00, 0x00, 0x00};
+    texels = decode(BlockFormat::BC3, bc3);
+    REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{0, 0, 255, 255});
+    REQUIRE(texel(texels, 1, 0) == std::array<int, 4>{255, 0, 0, 0});
+    REQUIRE(texel(texels, 2, 0) == std::array<int, 4>{85, 0, 170, 218});
+    REQUIRE(texel(texels, 3, 0) == std::array<int, 4>{170, 0, 85, 36});
+}
+
+TEST_CASE("BC7 blocks decode across modes") {
+    SECTION("mode 6 interpolates between endpoints with per-endpoint p-bits") {
+        BitWriter bits;
+        bits.write(1u << 6, 7);
+        for (std::uint32_t value : {127u, 0u, 0u, 127u, 0u, 0u, 127u, 127u}) { // R0 R1 G0 G1 B0 B1 A0 A1
+            bits.write(value, 7);
+        }
+        bits.write(1, 1); // p0
+        bits.write(0, 1); // p1
+        bits.write(0, 3); // texel 0 (anchor)
+        for (int i = 1; i < 16; ++i) {
+            bits.write(15, 4);
+        }
+        auto texels = decode(BlockFormat::BC7, bits.bytes);
+        REQUIRE(bits.position == 128);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 1, 1, 255});
+        REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{0, 254, 0, 254});
+    }
+
+    SECTION("mode 5 applies the channel rotation") {
+        BitWriter bits;
+        bits.write(1u << 5, 6);
+        bits.write(1, 2); // rotation: swap red and alpha
+        for (std::uint32_t value : {127u, 0u, 0u, 0u, 0u, 0u}) {
+            bits.write(value, 7);
+        }
+        bits.write(100, 8);
+        bits.write(100, 8);
+        bits.write(0, 31);
+        bits.write(0, 31);
+        auto texels = decode(BlockFormat::BC7, bits.bytes);
+        REQUIRE(bits.position == 128);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{100, 0, 0, 255});
+    }
+
+    SECTION("mode 1 splits texels by partition with shared p-bits") {
+        BitWriter bits;
+        bits.write(1u << 1, 2);
+        bits.write(13, 6); // top two rows subset 0, bottom two rows subset 1
+        for (std::uint32_t value : {63u, 63u, 0u, 0u}) { bits.write(value, 6); } // R
+        for (std::uint32_t value : {0u, 0u, 0u, 0u}) { bits.write(value, 6); }   // G
+        for (std::uint32_t value : {0u, 0u, 63u, 63u}) { bits.write(value, 6); } // B
+        bits.write(1, 1);
+        bits.write(1, 1);
+        bits.write(0, 46); // indices: 3 bits each, anchors 0 and 15 use 2
+        auto texels = decode(BlockFormat::BC7, bits.bytes);
+        REQUIRE(bits.position == 128);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 2, 2, 255});
+        REQUIRE(texel(texels, 3, 1) == std::array<int, 4>{255, 2, 2, 255});
+        REQUIRE(texel(texels, 0, 2) == std::array<int, 4>{2, 2, 255, 255});
+        REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{2, 2, 255, 255});
+    }
+
+    SECTION("reserved mode decodes to transparent black") {
+        Block16 reserved{};
+        reserved[5] = 0xFF;
+        auto texels = decode(BlockFormat::BC7, reserved);
+        REQUIRE(texel(texels, 2, 2) == std::array<int, 4>{0, 0, 0, 0});
+    }
+}
+
+TEST_CASE("ETC2 blocks decode in every mode") {
+    SECTION("individual") {
+        const Block8 block = {0xF0, 0x00, 0x0F, 0x00, 0, 0, 0, 0};
+        auto texels = decode(BlockFormat::ETC2_RGB, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 2, 2, 255});
+        REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{2, 2, 255, 255});
+    }
+
+    SECTION("differential, flipped, with per-texel modifiers") {
+        // Texel (1, 3) is bit 7 of both index planes: index 3 = -8.
+        const Block8 block = {0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x00, 0x80};
+        auto texels = decode(BlockFormat::ETC2_RGB, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{134, 134, 134, 255});
+        REQUIRE(texel(texels, 1, 3) == std::array<int, 4>{124, 124, 124, 255});
+    }
+
+    SECTION("T mode") {
+        const Block8 block = {0xFB, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x10};
+        auto texels = decode(BlockFormat::ETC2_RGB, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 0, 0, 255});
+        REQUIRE(texel(texels, 1, 0) == std::array<int, 4>{3, 3, 3, 255});
+        REQUIRE(texel(texels, 2, 0) == std::array<int, 4>{0, 0, 0, 255});
+    }
+
+    SECTION("H mode") {
+        const Block8 block = {0x00, 0xFB, 0x00, 0x02, 0, 0, 0, 0};
+        auto texels = decode(BlockFormat::ETC2_RGB, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{6, 23, 244, 255});
+    }
+
+    SECTION("planar") {
+        const Block8 block = {0x00, 0x00, 0x07, 0x02, 0, 0, 0, 0};
+        auto texels = decode(BlockFormat::ETC2_RGB, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{0, 0, 24, 255});
+        REQUIRE(texel(texels, 1, 0) == std::array<int, 4>{0, 0, 18, 255});
+        REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{0, 0, 0, 255});
+    }
+
+    SECTION("EAC alpha") {
+        std::uint64_t indices = 0;
+        for (int k = 0; k < 16; ++k) {
+            const std::uint64_t index = k == 0 ? 7 : k == 1 ? 0 : 4;
+            indices |= index << (45 - 3 * k);
+        }
+        Block16 block = {128, 0x20, 0, 0, 0, 0, 0, 0, 0xF0, 0x00, 0x0F, 0x00, 0, 0, 0, 0};
+        for (int i = 0; i < 6; ++i) {
+            block[2 + i] = static_cast<std::uint8_t>(indices >> (40 - 8 * i));
+        }
+        auto texels = decode(BlockFormat::ETC2_RGBA, block);
+        REQUIRE(texel(texels, 0, 0) == std::array<int, 4>{255, 2, 2, 156});
+        REQUIRE(texel(texels, 0, 1) == std::array<int, 4>{255, 2, 2, 122});
+        REQUIRE(texel(texels, 3, 3) == std::array<int, 4>{2, 2, 255, 132});
+    }
+}
+
+TEST_CASE("DDS and KTX2 containers parse and reject what they cannot hold") {
+    std::string error;
+
+    auto bc1 = parseDds(makeDds(BlockFormat::BC1, 8, 8, 2, 40), &error);
+    REQUIRE(bc1);
+    REQUIRE(bc1->format == BlockFormat::BC1);
+    REQUIRE(bc1->width == 8);
+    REQUIRE(bc1->mipmaps == 2);
+    REQUIRE(bc1->data.size() == 40);
+
+    auto bc7 = parseDds(makeDds(BlockFormat::BC7, 4, 4, 1, 16), &error);
+    REQUIRE(bc7);
+    REQUIRE(bc7->format == BlockFormat::BC7);
+
+    REQUIRE_FALSE(parseDds(makeDds(BlockFormat::BC3, 8, 8, 1, 63), &error));
+    REQUIRE(error.find("truncated") != std::string::npos);
+
+    auto etc = parseKtx2(makeKtx2(151, 8, 4, 32), &error);
+    REQUIRE(etc);
+    REQUIRE(etc->format == BlockFormat::ETC2_RGBA);
+    REQUIRE(etc->height == 4);
+    REQUIRE(etc->data.size() == 32);
+
+    REQUIRE_FALSE(parseKtx2(makeKtx2(151, 8, 4, 32, 6), &error));
+    REQUIRE_FALSE(parseKtx2(makeKtx2(151, 8, 4, 32, 1, 2), &error));
+    REQUIRE(error.find("supercompressed") != std::string::npos);
+    REQUIRE_FALSE(parseKtx2(makeKtx2(37, 8, 4, 32), &error)); // VK_FORMAT_R8G8B8A8_UNORM
+
+    // 6x6 -> 3x3 -> 1x1: partial edge blocks are stored whole and cropped when transcoding.
+    const std::vector<std::uint8_t> chain(4 * 8 + 8 + 8, 0);
+    REQUIRE(transcodeToRgba8(BlockFormat::BC1, 6, 6, 3, chain).size() == (36 + 9 + 1) * 4);
+    REQUIRE(transcodeToRgba8(BlockFormat::BC1, 6, 6, 3, std::span(chain).first(40)).empty());
+}
+
+TEST_CASE("TextureManager keeps compressed textures compressed and transcodes as a fallback") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeBytes(dir.path() / "tiles.dds", makeDds(BlockFormat::BC1, 64, 64, 1, 2048));
+    writeBytes(dir.path() / "hero.ktx2", makeKtx2(151, 64, 64, 4096));
+    writeBytes(dir.path() / "sky.dds", makeDds(BlockFormat::BC7, 64, 64, 1, 4096));
+    writeBytes(dir.path() / "broken.dds", makeDds(BlockFormat::BC3, 64, 64, 1, 100));
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture stub;
+        stub.texture.id = 999;
+        stub.ownsTexture = false;
+        return stub;
+    });
+
+    // Stands in for a GPU with BC support but no ETC2; bytes are left for the manager to compute.
+    std::vector<int> uploadedFormats;
+    unsigned int nextId = 1;
+    TextureManager::setUploaderForTesting([&](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        if (image.format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA) {
+            return std::nullopt;
+        }
+        uploadedFormats.push_back(image.format);
+        TextureManager::LoadedTexture loaded;
+        loaded.texture.id = nextId++;
+        loaded.texture.width = image.width;
+        loaded.texture.height = image.height;
+        loaded.texture.mipmaps = image.mipmaps;
+        loaded.texture.format = image.format;
+        loaded.ownsTexture = false;
+        return loaded;
+    });
+    REQUIRE(TextureManager::init());
+
+    auto tiles = TextureManager::acquire("tiles.dds");
+    REQUIRE_FALSE(tiles.placeholder);
+    REQUIRE(tiles.texture->format == PIXELFORMAT_COMPRESSED_DXT1_RGBA);
+    auto metrics = TextureManager::metrics();
+    REQUIRE(metrics.totalBytes == 2048); // 64x64 RGBA8 would be 16384
+    REQUIRE(metrics.compressedTextures == 1);
+    REQUIRE(metrics.compressedBytes == 2048);
+    REQUIRE(metrics.transcodedTextures == 0);
+
+    // ETC2 is refused by the uploader and retried as RGBA8; BC7 has no raylib format at all.
+    auto hero = TextureManager::acquire("hero.ktx2");
+    REQUIRE_FALSE(hero.placeholder);
+    REQUIRE(hero.texture->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    auto sky = TextureManager::acquireAsync("sky.dds");
+    REQUIRE(sky.pending);
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+    TextureManager::processPendingUploads(0);
+    REQUIRE(TextureManager::tryGet(sky.key)->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.totalBytes == 2048 + 2 * 16384);
+    REQUIRE(metrics.compressedTextures == 1);
+    REQUIRE(metrics.transcodedTextures == 2);
+
+    REQUIRE(TextureManager::acquire("broken.dds").placeholder);
+    REQUIRE(uploadedFormats.size() == 3);
+}
+
+TEST_CASE("TextureManager transcodes everything when compressed uploads are disabled") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeBytes(dir.path() / "tiles.dds", makeDds(BlockFormat::BC1, 16, 16, 1, 128));
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::compressed_upload", false);
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture stub;
+        stub.texture.id = 999;
+        stub.ownsTexture = false;
+        return stub;
+    });
+    int uploadedFormat = 0;
+    TextureManager::setUploaderForTesting([&](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        uploadedFormat = image.format;
+        TextureManager::LoadedTexture loaded;
+        loaded.texture.id = 1;
+        loaded.texture.width = image.width;
+        loaded.texture.height = image.height;
+        loaded.texture.format = image.format;
+        loaded.ownsTexture = false;
+        return loaded;
+    });
+    REQUIRE(TextureManager::init());
+
+    REQUIRE_FALSE(TextureManager::acquire("tiles.dds").placeholder);
+    REQUIRE(uploadedFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    REQUIRE(TextureManager::metrics().totalBytes == 16 * 16 * 4);
+    REQUIRE(TextureManager::metrics().transcodedTextures == 1);
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/filesystem/PathResolver.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::filesystem::PathResolver;
+using gb2d::textures::TextureManager;
+using gb2d::textures::TextureMetrics;
+
+namespace {
+
+struct ResetGuard {
+    ~ResetGuard() { TextureManager::resetForTesting(); }
+};
+
+struct TempDir {
+    TempDir() {
+        auto base = std::filesystem::temp_directory_path();
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path_ = base / ("gb2d_path_resolver_tests_" + std::to_string(stamp));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_{};
+};
+
+void writeFile(const std::filesystem::path& path) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << "stub";
+}
+
+} // namespace
+
+TEST_CASE("PathResolver searches roots in order and caches hits and misses") {
+    TempDir dir;
+    const auto first = dir.path() / "first";
+    const auto second = dir.path() / "second";
+    writeFile(second / "hero.png");
+    writeFile(first / "shared.png");
+    writeFile(second / "shared.png");
+
+    PathResolver resolver({first, second});
+    auto hero = resolver.resolve("hero.png");
+    REQUIRE(hero);
+    REQUIRE(*hero == std::filesystem::weakly_canonical(second / "hero.png"));
+    REQUIRE(resolver.resolve("shared.png") == std::filesystem::weakly_canonical(first / "shared.png"));
+    REQUIRE_FALSE(resolver.resolve("missing.png"));
+    REQUIRE_FALSE(resolver.resolve(""));
+
+    // Working directory, then both roots.
+    const auto cold = resolver.stats();
+    REQUIRE(cold.lookups == 3);
+    REQUIRE(cold.hits == 0);
+    REQUIRE(cold.probes == 3 + 2 + 3);
+
+    REQUIRE(resolver.resolve("hero.png") == hero);
+    REQUIRE_FALSE(resolver.resolve("missing.png"));
+    const auto warm = resolver.stats();
+    REQUIRE(warm.probes == cold.probes);
+    REQUIRE(warm.hits == 2);
+    REQUIRE(warm.negativeHits == 1);
+    REQUIRE(warm.probesAvoided == 3 + 3);
+    REQUIRE(warm.entries == 3);
+
+    // A file event forgets misses and lookups that landed on the file, and nothing else.
+    writeFile(first / "missing.png");
+    resolver.invalidatePath(first / "missing.png");
+    REQUIRE(resolver.stats().entries == 2);
+    REQUIRE(resolver.resolve("missing.png") == std::filesystem::weakly_canonical(first / "missing.png"));
+    resolver.invalidatePath(second / "hero.png");
+    REQUIRE(resolver.stats().entries == 2);
+
+    // Unchanged roots keep the cache; new roots drop it.
+    REQUIRE_FALSE(resolver.setSearchPaths({first, second}));
+    REQUIRE(resolver.stats().entries == 2);
+    REQUIRE(resolver.setSearchPaths({second, first}));
+    REQUIRE(resolver.stats().entries == 0);
+    REQUIRE(resolver.resolve("shared.png") == std::filesystem::weakly_canonical(second / "shared.png"));
+}
+
+TEST_CASE("PathResolver forgets cached misses after the negative TTL") {
+    TempDir dir;
+    PathResolver resolver({dir.path()});
+
+    resolver.setNegativeTtl(std::chrono::milliseconds(0));
+    REQUIRE_FALSE(resolver.resolve("late.png"));
+    REQUIRE(resolver.stats().entries == 0);
+    writeFile(dir.path() / "late.png");
+    REQUIRE(resolver.resolve("late.png") == std::filesystem::weakly_canonical(dir.path() / "late.png"));
+
+    resolver.setNegativeTtl(std::chrono::milliseconds(20));
+    REQUIRE_FALSE(resolver.resolve("later.png"));
+    writeFile(dir.path() / "later.png");
+    REQUIRE_FALSE(resolver.resolve("later.png"));
+    REQUIRE(resolver.stats().negativeHits == 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    REQUIRE(resolver.resolve("later.png") == std::filesystem::weakly_canonical(dir.path() / "later.png"));
+}
+
+TEST_CASE("TextureManager reuses resolved paths across acquires") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeFile(dir.path() / "a.png");
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture placeholder;
+        placeholder.texture.id = 999;
+        placeholder.ownsTexture = false;
+        return placeholder;
+    });
+    TextureManager::setLoaderForTesting([](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture stub;
+        stub.texture.id = 7;
+        stub.texture.width = 4;
+        stub.texture.height = 4;
+        stub.ownsTexture = false;
+        stub.bytes = 64;
+        return stub;
+    });
+    REQUIRE(TextureManager::init());
+
+    auto a = TextureManager::acquire("a.png");
+    REQUIRE_FALSE(a.placeholder);
+    REQUIRE(TextureManager::acquire("missing.png").placeholder);
+    const TextureMetrics cold = TextureManager::metrics();
+    REQUIRE(cold.pathLookups == 2);
+    REQUIRE(cold.pathCacheHits == 0);
+
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(TextureManager::acquire("a.png").key == a.key);
+        REQUIRE(TextureManager::acquire("missing.png").placeholder);
+    }
+    const TextureMetrics warm = TextureManager::metrics();
+    REQUIRE(warm.pathCacheHits == 20);
+    REQUIRE(warm.pathProbes == cold.pathProbes);
+    REQUIRE(warm.pathProbesAvoided == 10 * cold.pathProbes);
+
+    // reloadAll re-resolves everything, so a file that appeared since is found.
+    writeFile(dir.path() / "missing.png");
+    TextureManager::reloadAll();
+    REQUIRE_FALSE(TextureManager::acquire("missing.png").placeholder);
+}
@@ -0,0 +1,231 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/filesystem/FileWatcher.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gb2d::ConfigurationManager;
+using gb2d::filesystem::FileWatcher;
+using gb2d::textures::ReloadResult;
+using gb2d::textures::TextureManager;
+
+namespace {
+
+struct ResetGuard {
+    ~ResetGuard() { TextureManager::resetForTesting(); }
+};
+
+struct TempDir {
+    TempDir() {
+        auto base = std::filesystem::temp_directory_path();
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path_ = base / ("gb2d_hot_reload_tests_" + std::to_string(stamp));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_{};
+};
+
+void writeFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+// Keeps the mtime strictly increasing even on filesystems with coarse timestamps.
+void bumpModified(const std::filesystem::path& path) {
+    auto time = std::filesystem::last_write_time(path);
+    std::filesystem::last_write_time(path, time + std::chrono::seconds(1));
+}
+
+void writeAtlasJson(const std::filesystem::path& jsonPath, const std::string& imageName, int frameCount) {
+    std::ofstream out(jsonPath, std::ios::trunc);
+    out << "{\"frames\": [";
+    for (int i = 0; i < frameCount; ++i) {
+        out << (i > 0 ? "," : "") << "{\"filename\": \"f" << i << ".png\", \"frame\": {\"x\": " << i * 8
+            << ", \"y\": 0, \"w\": 8, \"h\": 8}}";
+    }
+    out << "], \"meta\": {\"image\": \"" << imageName << "\"}}\n";
+}
+
+TextureManager::LoadedTexture makeStubTexture(unsigned int id) {
+    TextureManager::LoadedTexture stub;
+    stub.texture.id = id;
+    stub.texture.width = 8;
+    stub.texture.height = 8;
+    stub.texture.mipmaps = 1;
+    stub.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    stub.bytes = 256;
+    return stub;
+}
+
+} // namespace
+
+TEST_CASE("FileWatcher debounces bursts and ignores rewrites with identical contents") {
+    TempDir dir;
+    const auto path = dir.path() / "hero.png";
+    writeFile(path, "v1");
+
+    FileWatcher::Options options;
+    options.backend = FileWatcher::Backend::Polling;
+    options.debounce = std::chrono::milliseconds(100);
+    options.pollInterval = std::chrono::milliseconds(0);
+    FileWatcher watcher(options);
+    watcher.watch(path);
+    watcher.watch(path);
+    REQUIRE(watcher.watchedCount() == 1);
+
+    const auto t0 = FileWatcher::Clock::now();
+    REQUIRE(watcher.poll(t0).empty());
+
+    writeFile(path, "v2-longer");
+    bumpModified(path);
+    REQUIRE(watcher.poll(t0 + std::chrono::milliseconds(10)).empty()); // seen, still settling
+    REQUIRE(watcher.poll(t0 + std::chrono::milliseconds(50)).empty());
+    auto changed = watcher.poll(t0 + std::chrono::milliseconds(120));
+    REQUIRE(changed.size() == 1);
+    REQUIRE(changed.front() == gb2d::filesystem::normalizeWatchPath(path));
+    REQUIRE(watcher.poll(t0 + std::chrono::milliseconds(400)).empty());
+
+    // Touching a file (or saving it unchanged) moves the mtime but not the hash.
+    bumpModified(path);
+    REQUIRE(watcher.scan().empty());
+
+    writeFile(path, "v3");
+    bumpModified(path);
+    REQUIRE(watcher.scan().size() == 1);
+
+    watcher.unwatch(path);
+    REQUIRE(watcher.watching(path));
+    watcher.unwatch(path);
+    REQUIRE_FALSE(watcher.watching(path));
+}
+
+TEST_CASE("TextureManager reloadChanged reloads only assets whose contents changed") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeFile(dir.path() / "ship.png", "ship-v1");
+    writeFile(dir.path() / "rock.png", "rock-v1");
+    writeFile(dir.path() / "icons.png", "icons-v1");
+    writeAtlasJson(dir.path() / "icons.json", "icons.png", 2);
+
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::hot_reload", true);
+    std::map<std::string, int> loads;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path& path, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        const int count = ++loads[path.filename().string()];
+        return makeStubTexture(static_cast<unsigned int>(100 * count));
+    });
+    REQUIRE(TextureManager::init());
+
+    auto ship = TextureManager::acquire("ship.png");
+    auto rock = TextureManager::acquire("rock.png");
+    auto atlas = TextureManager::acquireAtlas("icons.json");
+    REQUIRE(atlas.frames.size() == 2);
+
+    // Nothing changed: no loads, every record counted as unchanged.
+    ReloadResult idle = TextureManager::reloadChanged();
+    REQUIRE(idle.attempted == 0);
+    REQUIRE(idle.unchanged == 3);
+    REQUIRE(TextureManager::metrics().watchedFiles == 4);
+
+    writeFile(dir.path() / "ship.png", "ship-v2-bigger");
+    bumpModified(dir.path() / "ship.png");
+    ReloadResult textureOnly = TextureManager::reloadChanged();
+    REQUIRE(textureOnly.attempted == 1);
+    REQUIRE(textureOnly.succeeded == 1);
+    REQUIRE(textureOnly.unchanged == 2);
+    REQUIRE(textureOnly.timings.size() == 1);
+    REQUIRE(textureOnly.timings.front().key == ship.key);
+    REQUIRE(textureOnly.timings.front().texture);
+    REQUIRE_FALSE(textureOnly.timings.front().atlas);
+    REQUIRE(textureOnly.timings.front().milliseconds >= 0.0);
+    REQUIRE(textureOnly.totalMs >= textureOnly.timings.front().milliseconds);
+    REQUIRE(loads["ship.png"] == 2);
+    REQUIRE(loads["rock.png"] == 1);
+    REQUIRE(TextureManager::tryGet(ship.key)->id == 200u);
+
+    // Editing only the atlas JSON re-parses the frames without decoding the image again.
+    writeAtlasJson(dir.path() / "icons.json", "icons.png", 3);
+    bumpModified(dir.path() / "icons.json");
+    ReloadResult atlasOnly = TextureManager::reloadChanged();
+    REQUIRE(atlasOnly.attempted == 1);
+    REQUIRE(atlasOnly.timings.front().key == atlas.key);
+    REQUIRE(atlasOnly.timings.front().atlas);
+    REQUIRE_FALSE(atlasOnly.timings.front().texture);
+    REQUIRE(loads["icons.png"] == 1);
+    REQUIRE(TextureManager::tryGetAtlas(atlas.key)->frames.size() == 3);
+
+    // reloadAll reports timings for everything and leaves nothing for the watcher to redo.
+    ReloadResult all = TextureManager::reloadAll();
+    REQUIRE(all.attempted == 3);
+    REQUIRE(all.timings.size() == 3);
+    REQUIRE(TextureManager::reloadChanged().attempted == 0);
+
+    // Released records stop being watched.
+    REQUIRE(TextureManager::release(rock.key));
+    REQUIRE(TextureManager::reloadChanged().unchanged == 2);
+    REQUIRE(TextureManager::metrics().watchedFiles == 3);
+}
+
+TEST_CASE("TextureManager tick applies debounced hot reloads") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    bool polling = false;
+    SECTION("native events") { polling = false; }
+    SECTION("polling fallback") { polling = true; }
+
+    TempDir dir;
+    writeFile(dir.path() / "ship.png", "ship-v1");
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::hot_reload", true);
+    ConfigurationManager::set("textures::hot_reload_polling", polling);
+    ConfigurationManager::set("textures::hot_reload_debounce_ms", static_cast<std::int64_t>(0));
+    ConfigurationManager::set("textures::hot_reload_poll_ms", static_cast<std::int64_t>(0));
+    int loads = 0;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(static_cast<unsigned int>(++loads));
+    });
+    REQUIRE(TextureManager::init());
+
+    auto ship = TextureManager::acquire("ship.png");
+    TextureManager::tick(); // registers the watch
+    REQUIRE(TextureManager::metrics().hotReloads == 0);
+
+    writeFile(dir.path() / "ship.png", "ship-v2-bigger");
+    bumpModified(dir.path() / "ship.png");
+    for (int i = 0; i < 50 && TextureManager::metrics().hotReloads == 0; ++i) {
+        TextureManager::tick();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    REQUIRE(TextureManager::metrics().hotReloads == 1);
+    REQUIRE(loads == 2);
+    REQUIRE(TextureManager::tryGet(ship.key)->id == 2u);
+    const auto last = TextureManager::lastHotReload();
+    REQUIRE(last.attempted == 1);
+    REQUIRE(last.timings.front().key == ship.key);
+
+    TextureManager::tick();
+    REQUIRE(TextureManager::metrics().hotReloads == 1);
+}
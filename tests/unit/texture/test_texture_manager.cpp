@@ -4,10 +4,13 @@
 #include "services/configuration/ConfigurationManager.h"
 #include "services/logger/LogManager.h"
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <string>
+#include <thread>
 #include <vector>
 
 using gb2d::ConfigurationManager;
@@ -53,6 +56,20 @@ TextureManager::LoadedTexture makeStubTexture(int id, int width = 4, int height
     return stub;
 }
 
+Image makeStubImage(int width = 8, int height = 8) {
+    Image image{};
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return image;
+}
+
+void writeStubFile(const std::filesystem::path& path) {
+    std::ofstream out(path, std::ios::binary);
+    out << "stub";
+}
+
 void writePlaceholderGenerator() {
     TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
         return makeStubTexture(999, 2, 2);
@@ -481,6 +498,61 @@ TEST_CASE("TextureManager reloadAll refreshes atlas metadata and texture") {
     REQUIRE(TextureManager::releaseAtlas(atlas.key));
 }
 
+TEST_CASE("TextureManager resolves atlas frame ids for lock-free lookup") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    const auto jsonPath = dir.path() / "toolbaricons.json";
+    const auto pngPath = dir.path() / "toolbaricons.png";
+    writeAtlasFiles(jsonPath, pngPath, {"zoom-in.png", "zoom-out.png", "Hand.png"});
+
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    writePlaceholderGenerator();
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(300, 8, 8);
+    });
+    REQUIRE(TextureManager::init());
+
+    auto atlas = TextureManager::acquireAtlas("toolbaricons.json");
+    REQUIRE(atlas.frames.size() == 3);
+
+    auto id = TextureManager::resolveAtlasFrame(atlas.key, "HAND.png");
+    REQUIRE(id.valid());
+    const auto* frame = TextureManager::frameById(id);
+    REQUIRE(frame != nullptr);
+    REQUIRE(frame->originalName == "Hand.png");
+    REQUIRE(frame->frame.x == 32.0f);
+    REQUIRE(TextureManager::frameById(id) == frame);
+
+    REQUIRE_FALSE(TextureManager::resolveAtlasFrame(atlas.key, "missing.png").valid());
+    REQUIRE_FALSE(TextureManager::resolveAtlasFrame("unknown.json", "hand.png").valid());
+    REQUIRE(TextureManager::frameById(gb2d::textures::AtlasFrameId{}) == nullptr);
+
+    auto sibling = TextureManager::resolveAtlasFrame(atlas.key, "zoom-out.png");
+    REQUIRE(sibling.slot == id.slot);
+    REQUIRE(sibling.generation == id.generation);
+    REQUIRE(TextureManager::frameById(sibling)->originalName == "zoom-out.png");
+
+    // Reloading publishes a new frame table: old ids go stale, the retired table stays readable
+    // until tick() has run, and re-resolving yields the new data.
+    writeAtlasFiles(jsonPath, pngPath, {"Hand.png", "zoom-in.png"});
+    REQUIRE(TextureManager::reloadAll().succeeded == 1);
+    REQUIRE(TextureManager::frameById(id) == nullptr);
+    REQUIRE(frame->originalName == "Hand.png");
+    TextureManager::tick();
+    TextureManager::tick();
+
+    auto refreshed = TextureManager::resolveAtlasFrame(atlas.key, "hand.png");
+    REQUIRE(refreshed.valid());
+    REQUIRE(refreshed.generation != id.generation);
+    REQUIRE(TextureManager::frameById(refreshed)->frame.x == 0.0f);
+
+    REQUIRE(TextureManager::releaseAtlas(atlas.key));
+    REQUIRE(TextureManager::frameById(refreshed) == nullptr);
+}
+
 TEST_CASE("TextureManager can dump atlas contents when enabled") {
     using namespace gb2d::logging;
 
@@ -561,3 +633,445 @@ TEST_CASE("TextureManager can dump atlas contents when enabled") {
     LogManager::reconfigure(Config{});
     clear_log_buffer();
 }
+
+TEST_CASE("TextureManager acquireAsync decodes off-thread and uploads within the frame budget") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    for (const char* name : {"a.png", "b.png", "c.png"}) {
+        writeStubFile(dir.path() / name);
+    }
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+
+    writePlaceholderGenerator();
+
+    std::atomic<int> decodeCount{0};
+    TextureManager::setDecoderForTesting([&](const std::filesystem::path&) -> std::optional<Image> {
+        decodeCount++;
+        return makeStubImage(8, 8);
+    });
+    int uploadCount = 0;
+    TextureManager::setUploaderForTesting([&](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(200 + ++uploadCount, image.width, image.height);
+    });
+
+    REQUIRE(TextureManager::init());
+    const Texture2D* placeholder = TextureManager::acquire("missing.png").texture;
+    REQUIRE(placeholder != nullptr);
+
+    std::vector<AcquireResult> results;
+    for (const char* name : {"a.png", "b.png", "c.png"}) {
+        auto result = TextureManager::acquireAsync(name);
+        REQUIRE(result.pending);
+        REQUIRE(result.placeholder);
+        REQUIRE(result.newlyLoaded);
+        REQUIRE(result.texture == placeholder);
+        results.push_back(result);
+    }
+
+    auto again = TextureManager::acquireAsync("a.png");
+    REQUIRE(again.key == results[0].key);
+    REQUIRE_FALSE(again.newlyLoaded);
+
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+    REQUIRE(decodeCount.load() == 3);
+
+    TextureMetrics metrics = TextureManager::metrics();
+    REQUIRE(metrics.pendingDecodes == 0);
+    REQUIRE(metrics.pendingUploads == 3);
+    REQUIRE(metrics.asyncDecodesCompleted == 3);
+    REQUIRE(metrics.averageDecodeMs >= 0.0);
+    REQUIRE(metrics.maxDecodeMs >= metrics.averageDecodeMs);
+
+    REQUIRE(TextureManager::processPendingUploads(2) == 2);
+    REQUIRE(uploadCount == 2);
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.pendingUploads == 1);
+
+    REQUIRE(TextureManager::processPendingUploads(0) == 1);
+    REQUIRE(uploadCount == 3);
+
+    for (const auto& result : results) {
+        const Texture2D* texture = TextureManager::tryGet(result.key);
+        REQUIRE(texture != nullptr);
+        REQUIRE(texture != placeholder);
+        REQUIRE(texture->width == 8);
+    }
+
+    auto snapshot = TextureManager::diagnosticsSnapshot();
+    for (const auto& record : snapshot.records) {
+        REQUIRE_FALSE(record.pending);
+    }
+    REQUIRE(snapshot.metrics.totalTextures == 3);
+}
+
+TEST_CASE("TextureManager discards async decodes that are released or superseded") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeStubFile(dir.path() / "released.png");
+    writeStubFile(dir.path() / "upgraded.png");
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+
+    writePlaceholderGenerator();
+
+    TextureManager::setDecoderForTesting([](const std::filesystem::path&) -> std::optional<Image> {
+        return makeStubImage(4, 4);
+    });
+    int uploadCount = 0;
+    TextureManager::setUploaderForTesting([&](const Image&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        ++uploadCount;
+        return makeStubTexture(300);
+    });
+    int loadCount = 0;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(400 + ++loadCount);
+    });
+
+    REQUIRE(TextureManager::init());
+
+    auto released = TextureManager::acquireAsync("released.png");
+    REQUIRE(released.pending);
+    REQUIRE(TextureManager::release(released.key));
+    REQUIRE(TextureManager::tryGet(released.key) == nullptr);
+
+    auto upgraded = TextureManager::acquireAsync("upgraded.png");
+    REQUIRE(upgraded.pending);
+    auto sync = TextureManager::acquire("upgraded.png");
+    REQUIRE(sync.key == upgraded.key);
+    REQUIRE_FALSE(sync.placeholder);
+    REQUIRE_FALSE(sync.pending);
+    REQUIRE(loadCount == 1);
+
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+    REQUIRE(TextureManager::processPendingUploads(0) == 0);
+    REQUIRE(uploadCount == 0);
+    REQUIRE(TextureManager::tryGet(sync.key) == sync.texture);
+    REQUIRE(TextureManager::metrics().pendingUploads == 0);
+}
+
+TEST_CASE("TextureManager resizes the decode pool when async_workers changes") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    for (const char* name : {"a.png", "b.png", "c.png", "d.png"}) {
+        writeStubFile(dir.path() / name);
+    }
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::async_workers", static_cast<std::int64_t>(2));
+
+    writePlaceholderGenerator();
+
+    std::atomic<int> decodeCount{0};
+    TextureManager::setDecoderForTesting([&](const std::filesystem::path&) -> std::optional<Image> {
+        decodeCount++;
+        return makeStubImage(4, 4);
+    });
+    TextureManager::setUploaderForTesting([](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(500, image.width, image.height);
+    });
+
+    REQUIRE(TextureManager::init());
+    REQUIRE(TextureManager::metrics().asyncWorkers == 0);
+
+    REQUIRE(TextureManager::acquireAsync("a.png").pending);
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+    REQUIRE(TextureManager::metrics().asyncWorkers == 2);
+
+    ConfigurationManager::set("textures::async_workers", static_cast<std::int64_t>(4));
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+    REQUIRE(TextureManager::metrics().asyncWorkers == 4);
+    REQUIRE(TextureManager::acquireAsync("b.png").pending);
+    REQUIRE(TextureManager::acquireAsync("c.png").pending);
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+
+    ConfigurationManager::set("textures::async_workers", static_cast<std::int64_t>(1));
+    REQUIRE(ConfigurationManager::applyRuntime(ConfigurationManager::raw()));
+    REQUIRE(TextureManager::metrics().asyncWorkers == 1);
+    REQUIRE(TextureManager::acquireAsync("d.png").pending);
+    REQUIRE(TextureManager::waitForPendingDecodes(std::chrono::seconds(5)));
+
+    REQUIRE(decodeCount.load() == 4);
+    REQUIRE(TextureManager::processPendingUploads(0) == 4);
+}
+
+TEST_CASE("TextureManager keeps unreferenced textures resident and evicts them LRU-first under budget") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    for (const char* name : {"a.png", "b.png", "c.png", "d.png"}) {
+        writeStubFile(dir.path() / name);
+    }
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    // Each stub texture is 4x4 RGBA (64 bytes); the budget fits two of them.
+    ConfigurationManager::set("textures::max_bytes", static_cast<int64_t>(128));
+
+    writePlaceholderGenerator();
+
+    int loadCount = 0;
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path&, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(500 + ++loadCount);
+    });
+
+    REQUIRE(TextureManager::init());
+
+    auto a = TextureManager::acquire("a.png");
+    auto b = TextureManager::acquire("b.png");
+    REQUIRE(TextureManager::release(a.key));
+    REQUIRE(TextureManager::release(b.key));
+
+    TextureMetrics metrics = TextureManager::metrics();
+    REQUIRE(metrics.totalTextures == 2);
+    REQUIRE(metrics.unreferencedTextures == 2);
+    REQUIRE(metrics.unreferencedBytes == 128);
+    REQUIRE(metrics.evictions == 0);
+
+    auto snapshot = TextureManager::diagnosticsSnapshot();
+    REQUIRE(snapshot.records.size() == 2);
+    REQUIRE(snapshot.records[0].evictionRank == std::optional<std::size_t>{0});
+    REQUIRE(snapshot.records[1].evictionRank == std::optional<std::size_t>{1});
+
+    // Re-acquiring a resident texture is a cache hit and moves it out of the eviction queue.
+    auto aAgain = TextureManager::acquire("a.png");
+    REQUIRE(aAgain.key == a.key);
+    REQUIRE_FALSE(aAgain.newlyLoaded);
+    REQUIRE(loadCount == 2);
+
+    auto c = TextureManager::acquire("c.png");
+    REQUIRE(c.newlyLoaded);
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.evictions == 1);
+    REQUIRE(metrics.evictedBytes == 64);
+    REQUIRE(metrics.totalBytes == 128);
+    REQUIRE(TextureManager::tryGet(b.key) == nullptr);
+    REQUIRE(TextureManager::tryGet(a.key) != nullptr);
+    REQUIRE(metrics.cacheHits == 1);
+    REQUIRE(metrics.cacheMisses == 3);
+    REQUIRE(metrics.cacheHitRatio == 0.25);
+
+    // Referenced textures are never evicted even when the budget is exceeded.
+    auto d = TextureManager::acquire("d.png");
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.totalTextures == 3);
+    REQUIRE(metrics.totalBytes == 192);
+    REQUIRE(metrics.evictions == 1);
+
+    REQUIRE(TextureManager::release(d.key));
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.evictions == 2);
+    REQUIRE(metrics.totalBytes == 128);
+    REQUIRE(TextureManager::tryGet(d.key) == nullptr);
+
+    REQUIRE(TextureManager::forceUnload(a.key));
+    REQUIRE(TextureManager::release(c.key));
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.unreferencedTextures == 1);
+    REQUIRE(metrics.totalTextures == 1);
+}
+
+TEST_CASE("TextureManager packs small sprites into shared pages") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    for (const char* name : {"coin.png", "gem.png", "banner.png"}) {
+        writeStubFile(dir.path() / name);
+    }
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::pack_small_textures", true);
+    ConfigurationManager::set("textures::pack_max_dimension", static_cast<int64_t>(32));
+    ConfigurationManager::set("textures::pack_page_size", static_cast<int64_t>(256));
+    ConfigurationManager::set("textures::pack_padding", static_cast<int64_t>(1));
+
+    writePlaceholderGenerator();
+
+    TextureManager::setDecoderForTesting([](const std::filesystem::path& path) -> std::optional<Image> {
+        if (path.filename() == "banner.png") {
+            return makeStubImage(100, 20);
+        }
+        return makeStubImage(16, 16);
+    });
+    int uploadCount = 0;
+    TextureManager::setUploaderForTesting([&](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(600 + ++uploadCount, image.width, image.height);
+    });
+
+    REQUIRE(TextureManager::init());
+
+    auto coin = TextureManager::acquireSprite("coin.png");
+    auto gem = TextureManager::acquireSprite("gem.png", "sprites/gem");
+    REQUIRE_FALSE(coin.placeholder);
+    REQUIRE(coin.newlyLoaded);
+    REQUIRE(coin.frames.size() == 1);
+    REQUIRE(gem.frames.size() == 1);
+    REQUIRE(coin.texture != nullptr);
+    REQUIRE(coin.texture == gem.texture);
+    REQUIRE(coin.texture->width == 256);
+    REQUIRE(uploadCount == 1);
+
+    const auto& coinRect = coin.frames[0].frame;
+    const auto& gemRect = gem.frames[0].frame;
+    REQUIRE(coinRect.width == 16);
+    REQUIRE(gemRect.height == 16);
+    REQUIRE((coinRect.x != gemRect.x || coinRect.y != gemRect.y));
+
+    auto banner = TextureManager::acquireSprite("banner.png");
+    REQUIRE(banner.texture != coin.texture);
+    REQUIRE(banner.frames[0].frame.width == 100);
+    REQUIRE(banner.frames[0].frame.x == 0);
+
+    TextureMetrics metrics = TextureManager::metrics();
+    REQUIRE(metrics.spritePages == 1);
+    REQUIRE(metrics.packedSprites == 2);
+    REQUIRE(metrics.totalTextures == 1);
+    REQUIRE(metrics.spritePageOccupancy > 0.0);
+
+    auto gemAgain = TextureManager::acquireSprite("gem.png");
+    REQUIRE_FALSE(gemAgain.newlyLoaded);
+    REQUIRE(gemAgain.frames.data() == gem.frames.data());
+
+    REQUIRE(TextureManager::releaseSprite("sprites/gem"));
+    REQUIRE(TextureManager::releaseSprite(gem.key));
+    REQUIRE(TextureManager::releaseSprite(coin.key));
+    REQUIRE(TextureManager::releaseSprite(banner.key));
+    REQUIRE_FALSE(TextureManager::releaseSprite(coin.key));
+
+    metrics = TextureManager::metrics();
+    REQUIRE(metrics.spritePages == 0);
+    REQUIRE(metrics.packedSprites == 0);
+    REQUIRE(metrics.totalTextures == 0);
+    REQUIRE(metrics.totalBytes == 0);
+}
+
+TEST_CASE("TextureManager does not pack sprites larger than a page") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeStubFile(dir.path() / "poster.png");
+    writeStubFile(dir.path() / "tile.png");
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::pack_small_textures", true);
+    // Valid per the schema, but larger than a 256 px page can hold.
+    ConfigurationManager::set("textures::pack_max_dimension", static_cast<int64_t>(1024));
+    ConfigurationManager::set("textures::pack_page_size", static_cast<int64_t>(256));
+    ConfigurationManager::set("textures::pack_padding", static_cast<int64_t>(1));
+
+    writePlaceholderGenerator();
+
+    TextureManager::setDecoderForTesting([](const std::filesystem::path& path) -> std::optional<Image> {
+        return path.filename() == "poster.png" ? makeStubImage(300, 300) : makeStubImage(254, 254);
+    });
+    int uploadCount = 0;
+    TextureManager::setUploaderForTesting([&](const Image& image, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        return makeStubTexture(700 + ++uploadCount, image.width, image.height);
+    });
+
+    REQUIRE(TextureManager::init());
+
+    auto poster = TextureManager::acquireSprite("poster.png");
+    REQUIRE_FALSE(poster.placeholder);
+    REQUIRE(poster.texture->width == 300);
+    REQUIRE(TextureManager::metrics().spritePages == 0);
+    REQUIRE(uploadCount == 1);
+
+    auto tile = TextureManager::acquireSprite("tile.png");
+    REQUIRE(tile.texture->width == 256);
+    REQUIRE(TextureManager::metrics().spritePages == 1);
+    REQUIRE(TextureManager::metrics().packedSprites == 1);
+}
+
+TEST_CASE("TextureManager read path does not block on writers") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeStubFile(dir.path() / "stable.png");
+    writeStubFile(dir.path() / "slow.png");
+    for (int i = 0; i < 8; ++i) {
+        writeStubFile(dir.path() / ("churn_" + std::to_string(i) + ".png"));
+    }
+    const auto jsonPath = dir.path() / "icons.json";
+    writeAtlasFiles(jsonPath, dir.path() / "icons.png", {"a.png", "b.png"});
+
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    writePlaceholderGenerator();
+
+    // The loader runs with the manager lock held; readers on another thread must still finish.
+    std::atomic<bool> readersFinished{false};
+    TextureManager::setLoaderForTesting([&](const std::filesystem::path& path, bool, int) -> std::optional<TextureManager::LoadedTexture> {
+        if (path.filename() == "slow.png") {
+            auto reader = std::async(std::launch::async, []() -> bool {
+                return TextureManager::tryGet("stable.png") != nullptr && TextureManager::metrics().totalTextures > 0;
+            });
+            readersFinished = reader.wait_for(std::chrono::seconds(5)) == std::future_status::ready && reader.get();
+        }
+        return makeStubTexture(400, 8, 8);
+    });
+    REQUIRE(TextureManager::init());
+
+    auto stable = TextureManager::acquire("stable.png");
+    auto atlas = TextureManager::acquireAtlas(jsonPath.string());
+    REQUIRE(stable.texture != nullptr);
+    REQUIRE(TextureManager::tryGet("STABLE.png") == TextureManager::tryGet(stable.key));
+    REQUIRE(TextureManager::tryGetAtlas(atlas.key) != nullptr);
+    REQUIRE(TextureManager::tryGetAtlas(atlas.key)->frames.size() == 2);
+
+    auto slow = TextureManager::acquire("slow.png");
+    REQUIRE(readersFinished);
+    REQUIRE(TextureManager::release(slow.key));
+
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> lookups{0};
+    std::atomic<std::size_t> misses{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t] {
+            std::size_t local = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (TextureManager::tryGet(stable.key) == nullptr || TextureManager::tryGetAtlas(atlas.key) == nullptr) {
+                    misses++;
+                }
+                TextureManager::tryGet("churn_" + std::to_string((local + t) % 8) + ".png");
+                if (TextureManager::metrics().totalTextures < 2) {
+                    misses++;
+                }
+                local++;
+            }
+            lookups += local;
+        });
+    }
+
+    for (int round = 0; round < 200; ++round) {
+        std::vector<std::string> keys;
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(TextureManager::acquire("churn_" + std::to_string(i) + ".png").key);
+        }
+        for (const auto& key : keys) {
+            TextureManager::release(key);
+        }
+        if (round % 50 == 0) {
+            TextureManager::reloadAll();
+        }
+        TextureManager::tick();
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(lookups.load() > 0);
+    REQUIRE(misses.load() == 0);
+    REQUIRE(TextureManager::metrics().totalTextures == 2);
+}
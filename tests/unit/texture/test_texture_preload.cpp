@@ -0,0 +1,280 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "services/filesystem/FileWatcher.h"
+#include "services/texture/DecodedImageCache.h"
+#include "services/texture/TextureManager.h"
+#include "services/configuration/ConfigurationManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+using gb2d::ConfigurationManager;
+using gb2d::textures::DecodedImageCache;
+using gb2d::textures::PreloadResult;
+using gb2d::textures::TextureManager;
+using gb2d::textures::TextureMetrics;
+
+namespace {
+
+struct ResetGuard {
+    ~ResetGuard() { TextureManager::resetForTesting(); }
+};
+
+struct TempDir {
+    TempDir() {
+        auto base = std::filesystem::temp_directory_path();
+        auto stamp = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        path_ = base / ("gb2d_preload_tests_" + std::to_string(stamp));
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_{};
+};
+
+void writeFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+// RGBA8 image whose texels all hold `seed`, allocated the way raylib's decoders allocate.
+Image makePixelImage(int width, int height, std::uint8_t seed) {
+    Image image{};
+    const auto bytes = static_cast<unsigned int>(width * height * 4);
+    image.data = MemAlloc(bytes);
+    std::memset(image.data, seed, bytes);
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return image;
+}
+
+TextureManager::LoadedTexture makeStubTexture(unsigned int id, const Image& image) {
+    TextureManager::LoadedTexture stub;
+    stub.texture.id = id;
+    stub.texture.width = image.width;
+    stub.texture.height = image.height;
+    stub.texture.mipmaps = 1;
+    stub.texture.format = image.format;
+    stub.ownsTexture = false;
+    return stub;
+}
+
+void installSeams(std::atomic<int>& decodeCount, std::atomic<int>& uploadCount,
+                  std::atomic<std::uint8_t>* lastUploadedTexel = nullptr) {
+    TextureManager::setPlaceholderGeneratorForTesting([]() -> std::optional<TextureManager::LoadedTexture> {
+        TextureManager::LoadedTexture placeholder;
+        placeholder.texture.id = 999;
+        placeholder.texture.width = 2;
+        placeholder.texture.height = 2;
+        placeholder.ownsTexture = false;
+        return placeholder;
+    });
+    TextureManager::setDecoderForTesting([&decodeCount](const std::filesystem::path& path) -> std::optional<Image> {
+        decodeCount++;
+        return makePixelImage(8, 4, static_cast<std::uint8_t>(path.filename().string().front()));
+    });
+    TextureManager::setUploaderForTesting([&uploadCount, lastUploadedTexel](const Image& image, bool, int)
+                                              -> std::optional<TextureManager::LoadedTexture> {
+        if (lastUploadedTexel) {
+            *lastUploadedTexel = static_cast<const std::uint8_t*>(image.data)[0];
+        }
+        return makeStubTexture(static_cast<unsigned int>(100 + ++uploadCount), image);
+    });
+}
+
+} // namespace
+
+TEST_CASE("DecodedImageCache round-trips pixels keyed by content hash") {
+    TempDir dir;
+    const auto source = dir.path() / "hero.png";
+    writeFile(source, "encoded-v1");
+
+    DecodedImageCache cache(dir.path() / "cache");
+    int decodes = 0;
+    const auto decode = [&decodes](const std::filesystem::path&) -> std::optional<Image> {
+        decodes++;
+        return makePixelImage(4, 2, 0x5A);
+    };
+
+    auto first = cache.loadOrDecode(source, decode);
+    REQUIRE(first);
+    REQUIRE(decodes == 1);
+    REQUIRE(cache.misses() == 1);
+    const auto hash = gb2d::filesystem::hashFile(source);
+    REQUIRE(hash);
+    REQUIRE(std::filesystem::exists(cache.entryPath(*hash)));
+    UnloadImage(*first);
+
+    auto second = cache.loadOrDecode(source, decode);
+    REQUIRE(second);
+    REQUIRE(decodes == 1);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(second->width == 4);
+    REQUIRE(second->height == 2);
+    REQUIRE(second->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    REQUIRE(static_cast<const std::uint8_t*>(second->data)[31] == 0x5A);
+    UnloadImage(*second);
+
+    // Different contents hash to a different entry.
+    writeFile(source, "encoded-v2");
+    auto third = cache.loadOrDecode(source, decode);
+    REQUIRE(third);
+    REQUIRE(decodes == 2);
+    UnloadImage(*third);
+
+    // Truncated entries are rejected rather than read past their end.
+    const auto entry = cache.entryPath(*gb2d::filesystem::hashFile(source));
+    std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 1);
+    REQUIRE_FALSE(cache.find(*gb2d::filesystem::hashFile(source)));
+
+    // Images without pixels (or block-compressed ones) are not stored.
+    Image empty{};
+    empty.width = 4;
+    empty.height = 4;
+    empty.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    REQUIRE_FALSE(cache.store(42, empty));
+}
+
+TEST_CASE("DecodedImageCache prune deletes the oldest entries until the cache fits") {
+    TempDir dir;
+    DecodedImageCache cache(dir.path() / "cache");
+    Image image = makePixelImage(4, 4, 0x11);
+    for (std::uint64_t hash = 1; hash <= 4; ++hash) {
+        REQUIRE(cache.store(hash, image));
+        // Spread the write times so the age order is unambiguous.
+        std::filesystem::last_write_time(cache.entryPath(hash),
+                                         std::filesystem::file_time_type::clock::now() - std::chrono::hours(10 - hash));
+    }
+    UnloadImage(image);
+    writeFile(cache.entryPath(9).string() + ".tmp1234", "interrupted");
+    const auto entryBytes = std::filesystem::file_size(cache.entryPath(1));
+
+    REQUIRE(cache.prune(entryBytes * 4) == 1);
+    REQUIRE(std::filesystem::exists(cache.entryPath(1)));
+
+    REQUIRE(cache.prune(entryBytes * 2) == 2);
+    REQUIRE_FALSE(std::filesystem::exists(cache.entryPath(1)));
+    REQUIRE_FALSE(std::filesystem::exists(cache.entryPath(2)));
+    REQUIRE(std::filesystem::exists(cache.entryPath(3)));
+    REQUIRE(std::filesystem::exists(cache.entryPath(4)));
+}
+
+TEST_CASE("TextureManager preloadGroup loads a manifest group and holds it until released") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeFile(dir.path() / "a.png", "a");
+    writeFile(dir.path() / "b.png", "b");
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::setJson("textures.preload", nlohmann::json{
+        {"level1", {"a.png", "b.png", "missing.png"}},
+        {"level2", {"b.png"}},
+    });
+
+    std::atomic<int> decodeCount{0};
+    std::atomic<int> uploadCount{0};
+    installSeams(decodeCount, uploadCount);
+    REQUIRE(TextureManager::init());
+    REQUIRE(TextureManager::hasPreloadGroup("level1"));
+    REQUIRE_FALSE(TextureManager::hasPreloadGroup("level3"));
+
+    PreloadResult result = TextureManager::preloadGroup("level1");
+    REQUIRE(result.group == "level1");
+    REQUIRE(result.requested == 3);
+    REQUIRE(result.loaded == 2);
+    REQUIRE(result.placeholders == 1);
+    REQUIRE(decodeCount.load() == 2);
+    REQUIRE(uploadCount.load() == 2);
+
+    auto a = TextureManager::acquire("a.png");
+    REQUIRE_FALSE(a.placeholder);
+    REQUIRE_FALSE(a.newlyLoaded);
+    REQUIRE(TextureManager::release(a.key));
+
+    // An active group is not preloaded twice; overlapping groups share records.
+    REQUIRE(TextureManager::preloadGroup("level1").requested == 0);
+    REQUIRE(TextureManager::preloadGroup("level2").loaded == 1);
+    REQUIRE(decodeCount.load() == 2);
+
+    TextureMetrics metrics = TextureManager::metrics();
+    REQUIRE(metrics.preloadGroups == 2);
+    REQUIRE(metrics.preloadedTextures == 4);
+
+    REQUIRE(TextureManager::releasePreloadGroup("level1"));
+    REQUIRE_FALSE(TextureManager::releasePreloadGroup("level1"));
+    REQUIRE(TextureManager::tryGet(a.key) == nullptr);
+    auto b = TextureManager::acquire("b.png");
+    REQUIRE_FALSE(b.newlyLoaded); // still held by level2
+    REQUIRE(TextureManager::release(b.key));
+    REQUIRE(TextureManager::releasePreloadGroup("level2"));
+    REQUIRE(TextureManager::metrics().preloadedTextures == 0);
+}
+
+TEST_CASE("TextureManager decoded image cache skips decoding on a warm start") {
+    ConfigurationManager::loadOrDefault();
+    ResetGuard guard;
+    TextureManager::resetForTesting();
+
+    TempDir dir;
+    writeFile(dir.path() / "a.png", "a");
+    writeFile(dir.path() / "b.png", "b");
+    const auto cacheDir = dir.path() / "decoded";
+    ConfigurationManager::set("textures::search_paths", std::vector<std::string>{ dir.path().string() });
+    ConfigurationManager::set("textures::decoded_cache_dir", cacheDir.string());
+    ConfigurationManager::setJson("textures.preload", nlohmann::json{{"startup", {"a.png", "b.png"}}});
+
+    std::atomic<int> decodeCount{0};
+    std::atomic<int> uploadCount{0};
+    std::atomic<std::uint8_t> lastTexel{0};
+    installSeams(decodeCount, uploadCount, &lastTexel);
+
+    REQUIRE(TextureManager::init());
+    PreloadResult cold = TextureManager::preloadGroup("startup");
+    REQUIRE(cold.loaded == 2);
+    REQUIRE(cold.decodedCacheHits == 0);
+    REQUIRE(decodeCount.load() == 2);
+    REQUIRE(TextureManager::metrics().decodedCacheMisses == 2);
+    TextureManager::shutdown();
+
+    REQUIRE(TextureManager::init());
+    PreloadResult warm = TextureManager::preloadGroup("startup");
+    REQUIRE(warm.loaded == 2);
+    REQUIRE(warm.decodedCacheHits == 2);
+    REQUIRE(decodeCount.load() == 2);
+    REQUIRE(uploadCount.load() == 4);
+    TextureMetrics metrics = TextureManager::metrics();
+    REQUIRE(metrics.decodedCacheHits == 2);
+    REQUIRE(metrics.decodedCacheMisses == 0);
+    TextureManager::shutdown();
+
+    // Editing a source misses the cache and decodes the new contents; synchronous loads share it.
+    writeFile(dir.path() / "b.png", "bb");
+    REQUIRE(TextureManager::init());
+    auto b = TextureManager::acquire("b.png");
+    REQUIRE_FALSE(b.placeholder);
+    REQUIRE(decodeCount.load() == 3);
+    REQUIRE(lastTexel.load() == 'b');
+    auto a = TextureManager::acquire("a.png");
+    REQUIRE_FALSE(a.placeholder);
+    REQUIRE(decodeCount.load() == 3);
+    REQUIRE(lastTexel.load() == 'a');
+    REQUIRE(TextureManager::metrics().decodedCacheHits == 1);
+}
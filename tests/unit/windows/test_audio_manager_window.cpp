@@ -136,28 +136,28 @@ struct DummyRaylib {
 
     static audio::AudioManager::RaylibHooks& hooks() {
         static audio::AudioManager::RaylibHooks instance{
-            &DummyRaylib::loadSound,
-            &DummyRaylib::unloadSound,
-            &DummyRaylib::loadSoundAlias,
-            &DummyRaylib::unloadSoundAlias,
-            &DummyRaylib::playSound,
-            &DummyRaylib::stopSound,
-            &DummyRaylib::isSoundPlaying,
-            &DummyRaylib::setSoundVolume,
-            &DummyRaylib::setSoundPitch,
-            &DummyRaylib::setSoundPan,
-            &DummyRaylib::loadMusicStream,
-            &DummyRaylib::unloadMusicStream,
-            &DummyRaylib::playMusicStream,
-            &DummyRaylib::pauseMusicStream,
-            &DummyRaylib::resumeMusicStream,
-            &DummyRaylib::stopMusicStream,
-            &DummyRaylib::updateMusicStream,
-            &DummyRaylib::isMusicStreamPlaying,
-            &DummyRaylib::setMusicVolume,
-            &DummyRaylib::seekMusicStream,
-            &DummyRaylib::getMusicTimeLength,
-            &DummyRaylib::getMusicTimePlayed
+            .loadSound = &DummyRaylib::loadSound,
+            .unloadSound = &DummyRaylib::unloadSound,
+            .loadSoundAlias = &DummyRaylib::loadSoundAlias,
+            .unloadSoundAlias = &DummyRaylib::unloadSoundAlias,
+            .playSound = &DummyRaylib::playSound,
+            .stopSound = &DummyRaylib::stopSound,
+            .isSoundPlaying = &DummyRaylib::isSoundPlaying,
+            .setSoundVolume = &DummyRaylib::setSoundVolume,
+            .setSoundPitch = &DummyRaylib::setSoundPitch,
+            .setSoundPan = &DummyRaylib::setSoundPan,
+            .loadMusicStream = &DummyRaylib::loadMusicStream,
+            .unloadMusicStream = &DummyRaylib::unloadMusicStream,
+            .playMusicStream = &DummyRaylib::playMusicStream,
+            .pauseMusicStream = &DummyRaylib::pauseMusicStream,
+            .resumeMusicStream = &DummyRaylib::resumeMusicStream,
+            .stopMusicStream = &DummyRaylib::stopMusicStream,
+            .updateMusicStream = &DummyRaylib::updateMusicStream,
+            .isMusicStreamPlaying = &DummyRaylib::isMusicStreamPlaying,
+            .setMusicVolume = &DummyRaylib::setMusicVolume,
+            .seekMusicStream = &DummyRaylib::seekMusicStream,
+            .getMusicTimeLength = &DummyRaylib::getMusicTimeLength,
+            .getMusicTimePlayed = &DummyRaylib::getMusicTimePlayed
         };
         return instance;
     }